@@ -0,0 +1,59 @@
+# Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+# 
+# This file is part of UG4.
+# 
+# UG4 is free software: you can redistribute it and/or modify it under the
+# terms of the GNU Lesser General Public License version 3 (as published by the
+# Free Software Foundation) with the following additional attribution
+# requirements (according to LGPL/GPL v3 §7):
+# 
+# (1) The following notice must be displayed in the Appropriate Legal Notices
+# of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+# 
+# (2) The following notice must be displayed at a prominent place in the
+# terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+# 
+# (3) The following bibliography is recommended for citation and must be
+# preserved in all covered files:
+# "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+#   parallel geometric multigrid solver on hierarchically distributed grids.
+#   Computing and visualization in science 16, 4 (2013), 151-164"
+# "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+#   flexible software system for simulating pde based models on high performance
+#   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+# 
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+# GNU Lesser General Public License for more details.
+
+################################################################################
+# ZLIB, LZ4
+#
+# Optional compression libraries, used e.g. for the compressed appended data
+# of the vtk output.
+################################################################################
+
+# included from ug_includes.cmake
+if(ZLIB)
+	find_package(ZLIB)
+	if(NOT ZLIB_FOUND)
+		message(FATAL_ERROR "ERROR: Couldn't find ZLIB. Please disable the option ZLIB.")
+	else(NOT ZLIB_FOUND)
+		add_definitions(-DUG_ZLIB)
+		include_directories(${ZLIB_INCLUDE_DIRS})
+		set(linkLibraries ${linkLibraries} ${ZLIB_LIBRARIES})
+	endif(NOT ZLIB_FOUND)
+endif(ZLIB)
+
+if(LZ4)
+	find_path(LZ4_INCLUDE_DIR lz4.h)
+	find_library(LZ4_LIBS NAMES lz4)
+	if(NOT LZ4_INCLUDE_DIR OR NOT LZ4_LIBS)
+		message(FATAL_ERROR "ERROR: Couldn't find LZ4. Please disable the option LZ4.")
+	else(NOT LZ4_INCLUDE_DIR OR NOT LZ4_LIBS)
+		add_definitions(-DUG_LZ4)
+		include_directories(${LZ4_INCLUDE_DIR})
+		set(linkLibraries ${linkLibraries} ${LZ4_LIBS})
+	endif(NOT LZ4_INCLUDE_DIR OR NOT LZ4_LIBS)
+endif(LZ4)
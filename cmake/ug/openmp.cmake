@@ -38,12 +38,12 @@ IF(OPENMP)
   # as these are not passed to the link then. But they have to. tklatt.
 	#	SET(CMAKE_EXE_LINKER_FLAGS "${CMAKE_EXE_LINKER_FLAGS} -lgomp")
   IF(CMAKE_C_COMPILER_ID STREQUAL "GNU" OR CMAKE_CXX_COMPILER_ID STREQUAL "GNU")
-    add_cxx_flags("-fopenmp")
+    add_cxx_flag("-fopenmp")
     SET(CMAKE_EXE_LINKER_FLAGS "${CMAKE_EXE_LINKER_FLAGS} -lgomp")
     ADD_DEFINITIONS(-DUG_OPENMP)
     MESSAGE(STATUS "Info: Using OpenMP (experimental)")
   ELSEIF(CMAKE_C_COMPILER_ID STREQUAL "Intel" OR CMAKE_CXX_COMPILER_ID STREQUAL "Intel")
-    add_cxx_flags("-fopenmp")
+    add_cxx_flag("-fopenmp")
     SET(CMAKE_SHARED_LINKER_FLAGS "${CMAKE_SHARED_LINKER_FLAGS} -liomp5")
     SET(CMAKE_EXE_LINKER_FLAGS "${CMAKE_EXE_LINKER_FLAGS} -liomp5")
     ADD_DEFINITIONS(-DUG_OPENMP)
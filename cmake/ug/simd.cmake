@@ -0,0 +1,61 @@
+# Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+# 
+# This file is part of UG4.
+# 
+# UG4 is free software: you can redistribute it and/or modify it under the
+# terms of the GNU Lesser General Public License version 3 (as published by the
+# Free Software Foundation) with the following additional attribution
+# requirements (according to LGPL/GPL v3 §7):
+# 
+# (1) The following notice must be displayed in the Appropriate Legal Notices
+# of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+# 
+# (2) The following notice must be displayed at a prominent place in the
+# terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+# 
+# (3) The following bibliography is recommended for citation and must be
+# preserved in all covered files:
+# "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+#   parallel geometric multigrid solver on hierarchically distributed grids.
+#   Computing and visualization in science 16, 4 (2026), 151-164"
+# "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+#   flexible software system for simulating pde based models on high performance
+#   computers. Computing and visualization in science 16, 4 (2026), 165-179"
+# 
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+# GNU Lesser General Public License for more details.
+
+# included from ug_includes.cmake
+########################################
+# SIMD
+# Enables instruction set extensions, e.g. for the explicitly vectorized
+# kernels of the sparse matrix-vector product (see
+# lib_algebra/cpu_algebra/sparsematrix_kernels.h).
+if("${SIMD}" STREQUAL "None")
+	# no flags, the compiler defaults are used
+elseif(MSVC)
+	if("${SIMD}" STREQUAL "AVX2")
+		add_cxx_flag("/arch:AVX2")
+	elseif("${SIMD}" STREQUAL "AVX512")
+		add_cxx_flag("/arch:AVX512")
+	else("${SIMD}" STREQUAL "AVX2")
+		message(FATAL_ERROR "Unsupported SIMD for MSVC: ${SIMD}. Options are: None, AVX2, AVX512")
+	endif("${SIMD}" STREQUAL "AVX2")
+	message(STATUS "Info: Using instruction set ${SIMD}")
+else("${SIMD}" STREQUAL "None")
+	if("${SIMD}" STREQUAL "AVX2")
+		add_cxx_flag("-mavx2")
+		add_cxx_flag("-mfma")
+	elseif("${SIMD}" STREQUAL "AVX512")
+		add_cxx_flag("-mavx2")
+		add_cxx_flag("-mfma")
+		add_cxx_flag("-mavx512f")
+	elseif("${SIMD}" STREQUAL "native")
+		add_cxx_flag("-march=native")
+	else("${SIMD}" STREQUAL "AVX2")
+		message(FATAL_ERROR "Unsupported SIMD: ${SIMD}. Options are: ${simdOptions}")
+	endif("${SIMD}" STREQUAL "AVX2")
+	message(STATUS "Info: Using instruction set ${SIMD}")
+endif("${SIMD}" STREQUAL "None")
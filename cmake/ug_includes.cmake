@@ -128,6 +128,10 @@ set(profilerDefault "None")
 # Option to set frequency
 set(cpufreqDefault OFF)
 
+# Values for the SIMD option
+set(simdOptions "None, AVX2, AVX512, native")
+set(simdDefault "None")
+
 # If we run the script the first time, search for MPI to determine the default value.
 # Note that you may use -DMPI_DIR=... to set a custom MPI path.
 if(BUILTIN_MPI)
@@ -184,6 +188,8 @@ option(POSIX "If enabled and available, some additional functionality may be ava
 option(CRS_ALGEBRA "Use the CRS Sparse Matrix" OFF)
 option(CPU_ALGEBRA "Use the old CPU Sparse Matrix" ON)
 option(INTERNAL_MEMTRACKER "Internal Memory Tracker" OFF)
+option(ZLIB "Enables zlib compression, e.g. of vtk output. Valid options are ON, OFF" OFF)
+option(LZ4 "Enables lz4 compression, e.g. of vtk output. Valid options are ON, OFF" OFF)
 
 if(APPLE)
 	option(USE_LUA2C "Use LUA2C" ON)
@@ -221,6 +227,10 @@ if(NOT CPU_FREQ)
     set(CPU_FREQ ${cpufreqDefault})
 endif(NOT CPU_FREQ)
 
+if(NOT SIMD)
+	set(SIMD ${simdDefault})
+endif(NOT SIMD)
+
 
 ########################################
 # TARGET
@@ -263,6 +273,7 @@ message(STATUS "Info: PCL_DEBUG_BARRIER: ${PCL_DEBUG_BARRIER} (options are: ON,
 message(STATUS "Info: PROFILER:          ${PROFILER} (options are: ${profilerOptions})")
 message(STATUS "Info: PROFILE_PCL:       ${PROFILE_PCL} (options are: ON, OFF)")
 message(STATUS "Info: CPU_FREQ:          ${CPU_FREQ} (options are: ON, OFF)")
+message(STATUS "Info: SIMD:              ${SIMD} (options are: ${simdOptions})")
 message(STATUS "Info: PROFILE_BRIDGE:    ${PROFILE_BRIDGE} (options are: ON, OFF)")
 message(STATUS "Info: LAPACK:            ${LAPACK} (options are: ON, OFF)")
 message(STATUS "Info: BLAS:              ${BLAS} (options are: ON, OFF)")
@@ -271,6 +282,8 @@ message(STATUS "Info: EMBEDDED_PLUGINS   ${EMBEDDED_PLUGINS} (options are: ON, O
 message(STATUS "Info: COMPILE_INFO       ${COMPILE_INFO} (options are: ON, OFF)")
 message(STATUS "Info: USE_LUA2C          ${USE_LUA2C} (options are: ON, OFF)")
 message(STATUS "Info: USE_LUAJIT         ${USE_LUAJIT} (options are: ON, OFF)")
+message(STATUS "Info: ZLIB               ${ZLIB} (options are: ON, OFF)")
+message(STATUS "Info: LZ4                ${LZ4} (options are: ON, OFF)")
 message(STATUS "")
 message(STATUS "Info: External libraries (path which contains the library or ON if you used uginstall):")
 message(STATUS "Info: TETGEN:   ${TETGEN}")
@@ -419,6 +432,8 @@ endif(PCL_DEBUG_BARRIER)
 ########################################
 # OPENMP
 include(${UG_ROOT_CMAKE_PATH}/ug/openmp.cmake)
+# SIMD
+include(${UG_ROOT_CMAKE_PATH}/ug/simd.cmake)
 # C++11
 include(${UG_ROOT_CMAKE_PATH}/ug/cpp11.cmake)
 # CUDA
@@ -440,6 +455,8 @@ include(${UG_ROOT_CMAKE_PATH}/ug/tetgen.cmake)
 include(${UG_ROOT_CMAKE_PATH}/ug/hlibpro.cmake)
 # OpenCL
 include(${UG_ROOT_CMAKE_PATH}/ug/opencl.cmake)
+# ZLIB, LZ4
+include(${UG_ROOT_CMAKE_PATH}/ug/compression.cmake)
 
 
 ################################################################################
@@ -500,6 +517,9 @@ endif(buildCompileInfo)
 ########################################
 if(POSIX)
 	add_definitions(-DUG_POSIX)
+#	threads are used e.g. for asynchronous output
+	find_package(Threads)
+	set(linkLibraries ${linkLibraries} ${CMAKE_THREAD_LIBS_INIT})
 endif(POSIX)
 
 ########################################
@@ -596,6 +616,7 @@ set(DIM ${DIM} CACHE STRING "Set the dimension for which ug4 is build. Valid opt
 set(CPU ${CPU} CACHE STRING "Set block sizes for which ug4 is build. Valid options are: ${cpuOptions}")
 set(PRECISION ${PRECISION} CACHE STRING "Set the precision of the number type. Valid options are: ${precisionOptions}")
 set(PROFILER ${PROFILER} CACHE STRING "Set the a profiler. Valid options are: ${profilerOptions}")
+set(SIMD ${SIMD} CACHE STRING "Set the instruction set extensions used for vectorized kernels. Valid options are: ${simdOptions}")
 
 # the following options too are pseudo cmake-options. However, they should
 # contains pathes, if set.
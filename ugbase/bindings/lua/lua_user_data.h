@@ -135,6 +135,9 @@ class LuaUserData
 	///	evaluates the data at a given point and time
 		inline TRet evaluate(TData& D, const MathVector<dim>& x, number time, int si) const;
 
+	///	returns that the data may not be evaluated concurrently (one lua state)
+		virtual bool thread_safe_evaluation() const {return false;}
+
 	protected:
 	///	sets that LuaUserData is created by LuaUserDataFactory
 		void set_created_from_factory(bool bFromFactory) {m_bFromFactory = bFromFactory;}
@@ -312,6 +315,9 @@ class LuaUserFunction
 		                    std::vector<std::vector<TData> > vvvDeriv[],
 		                    const MathMatrix<refDim, dim>* vJT = NULL);
 
+	///	returns that the data may not be evaluated concurrently (one lua state)
+		virtual bool thread_safe_evaluation() const {return false;}
+
 	protected:
 	///	sets the Lua function used to compute the data
 		void set_lua_value_callback(const char* luaCallback, size_t numArgs);
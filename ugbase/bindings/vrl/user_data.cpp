@@ -569,6 +569,9 @@ class VRLUserLinker
 		}
 
 	public:
+	///	returns that the data may not be evaluated concurrently (calls into java)
+		virtual bool thread_safe_evaluation() const {return false;}
+
 		void releaseGlobalRefs()
 		{
 			// deleting thread-safe global references
@@ -727,6 +730,9 @@ class VRLUserData
 				                        params, jsi);
 		}
 
+	///	returns that the data may not be evaluated concurrently (calls into java)
+		virtual bool thread_safe_evaluation() const {return false;}
+
 		void releaseGlobalRefs()
 		{
 			// deleting thread-safe global references
@@ -917,6 +923,9 @@ public:
 ///	returns if grid function is needed for evaluation
 	virtual bool requires_grid_fct() const {return false;}
 
+///	returns that the data may not be evaluated concurrently (calls into java)
+	virtual bool thread_safe_evaluation() const {return false;}
+
 	void releaseGlobalRefs()
 	{
 		// deleting thread-safe global references
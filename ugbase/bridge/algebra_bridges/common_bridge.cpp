@@ -45,6 +45,7 @@
 #include "lib_algebra/operator/fixed_convergence_check.h"
 #include "lib_algebra/operator/interface/operator.h"
 #include "lib_algebra/operator/interface/matrix_operator.h"
+#include "lib_algebra/operator/interface/matrix_free_operator.h"
 #include "lib_algebra/operator/interface/matrix_operator_inverse.h"
 #include "lib_algebra/operator/interface/preconditioner.h"
 #include "lib_algebra/operator/interface/preconditioned_linear_operator_inverse.h"
@@ -63,6 +64,8 @@
 #include "matrix_diagonal.h"
 
 #include "lib_algebra/operator/energy_convergence_check.h"
+#include "lib_algebra/cpu_algebra/spmv_benchmark.h"
+#include "lib_algebra/operator/sell_matrix_operator.h"
 
 using namespace std;
 
@@ -168,6 +171,22 @@ static void Algebra(Registry& reg, string grp)
 				&VecHadamardProd<vector_type>, grp, "", "dst#vec1#vec2", "vec1 * vec2 (elementwise)");
 	}
 
+//	MultiVector
+	{
+		typedef MultiVector<vector_type> T;
+		string name = string("MultiVector").append(suffix);
+		reg.add_class_<T>(name, grp, "collection of vectors processed at once (e.g. several right-hand sides)")
+			.add_constructor()
+			.ADD_CONSTRUCTOR( (const vector_type& v, size_t num) )("vec#num")
+			.add_method("resize", &T::resize, "", "vec#num", "resizes to num vectors with the layout of vec (values are not copied)")
+			.add_method("add_vector", &T::add_vector, "", "vec", "adds a vector (shared, not copied)")
+			.add_method("vector", static_cast<SmartPtr<vector_type> (T::*)(size_t)>(&T::vector), "vector", "i", "returns the i'th vector")
+			.add_method("size", &T::size, "number of vectors")
+			.add_method("set", &T::set, "", "value", "sets all entries of all vectors")
+			.set_construct_as_smart_pointer(true);
+		reg.add_class_to_group(name, "MultiVector", tag);
+	}
+
 //	VecScaleAddClass
 	{
 		string name = string("VecScaleAddClass").append(suffix);
@@ -193,8 +212,15 @@ static void Algebra(Registry& reg, string grp)
 		reg.add_class_<matrix_type>(name, grp)
 			.add_constructor()
 			.add_method("print|hide=true", &matrix_type::p)
+#ifdef UG_PARALLEL
+			.add_method("enable_overlapped_apply", &matrix_type::enable_overlapped_apply, "", "bEnable",
+					"if true, interface communication is overlapped with the computation of interior rows in A*x")
+#endif
 			.set_construct_as_smart_pointer(true);
 		reg.add_class_to_group(name, "Matrix", tag);
+
+		reg.add_function("SpMVBenchmark", &SpMVBenchmark<matrix_type, vector_type>, grp,
+				"", "A#x#numRuns", "measures the matrix-vector product A*x");
 	}
 
 //	ApplyLinearSolver
@@ -270,7 +296,8 @@ static void Algebra(Registry& reg, string grp)
 		reg.add_class_<T, TBase>(name, grp)
 			.add_method("init", static_cast<void (T::*)()>(&T::init))
 			.add_method("apply", &T::apply, "f#u", "", "calculates f = Op(u)")
-			.add_method("apply_sub", &T::apply_sub, "f#u", "", "calculates f -= Op(u)");
+			.add_method("apply_sub", &T::apply_sub, "f#u", "", "calculates f -= Op(u)")
+			.add_method("apply_multi", &T::apply_multi, "f#u", "", "calculates f[j] = Op(u[j]) for all vectors of the multi-vectors");
 		reg.add_class_to_group(name, "ILinearOperator", tag);
 	}
 
@@ -285,6 +312,15 @@ static void Algebra(Registry& reg, string grp)
 		reg.add_class_to_group(name, "MatrixOperator", tag);
 	}
 
+//	IMatrixFreeOperator
+	{
+		typedef IMatrixFreeOperator<vector_type> T;
+		typedef ILinearOperator<vector_type> TBase;
+		string name = string("IMatrixFreeOperator").append(suffix);
+		reg.add_class_<T, TBase>(name, grp);
+		reg.add_class_to_group(name, "IMatrixFreeOperator", tag);
+	}
+
 //	ILinearIterator
 	{
 		typedef ILinearIterator<vector_type> T;
@@ -323,6 +359,7 @@ static void Algebra(Registry& reg, string grp)
 			.add_method("apply_return_defect", &T::apply_return_defect, "Success", "u#f",
 					"Solve A*u = f, such that u = A^{-1} f by iterating u := u + B(f - A*u),  f := f - A*u becomes new defect")
 			.add_method("apply", &T::apply, "Success", "u#f", "Solve A*u = f, such that u = A^{-1} f by iterating u := u + B(f - A*u), f remains constant")
+			.add_method("apply_multi", &T::apply_multi, "Success", "u#f", "Solve A*u[j] = f[j] for all right-hand sides of the multi-vector f (at once for block solvers)")
 			.add_method("set_convergence_check", &T::set_convergence_check)
 			.add_method("convergence_check", static_cast<ConstSmartPtr<IConvergenceCheck<vector_type> > (T::*)() const>(&T::convergence_check))
 			.add_method("defect", &T::defect, "the current defect")
@@ -493,6 +530,30 @@ static void Common(Registry& reg, string grp)
 			.add_method("compose_file_path", &T::leave_section)
 			.set_construct_as_smart_pointer(true);
 	}
+
+#ifdef UG_CPU_1
+//	SellMatrixOperator (scalar algebra only)
+	{
+		typedef CPUAlgebra::vector_type vector_type;
+		typedef CPUAlgebra::matrix_type matrix_type;
+		typedef SellMatrixOperator<CPUAlgebra> T;
+		typedef IMatrixFreeOperator<vector_type> TBase;
+		string suffix = GetAlgebraSuffix<CPUAlgebra>();
+		string tag = GetAlgebraTag<CPUAlgebra>();
+		string name = string("SellMatrixOperator").append(suffix);
+		reg.add_class_<T, TBase>(name, grp, "Operator applying a SELL-C-sigma copy of the matrix of a MatrixOperator")
+			.add_constructor()
+			.add_constructor<void (*)(SmartPtr<MatrixOperator<matrix_type, vector_type> >)>("MatrixOperator")
+			.add_method("set_matrix_operator", &T::set_matrix_operator, "", "MatrixOperator", "sets the matrix operator to be converted")
+			.add_method("set_chunk_size", &T::set_chunk_size, "", "chunkSize", "sets the number of rows per chunk (1, 2, 4, 8, 16 or 32), default 8")
+			.add_method("set_sigma", &T::set_sigma, "", "sigma", "sets the size of the sorting window (multiple of chunk size or 1), default 256")
+			.add_method("set_report", &T::set_report, "", "bReport", "enables the report of conversion cost and speedup")
+			.add_method("conversion_report", &T::conversion_report, "report", "", "returns the report of the last conversion")
+			.add_method("init", static_cast<void (T::*)()>(&T::init), "", "", "converts the matrix (call again if the matrix has changed)")
+			.set_construct_as_smart_pointer(true);
+		reg.add_class_to_group(name, "SellMatrixOperator", tag);
+	}
+#endif
 }
 
 }; // end Functionality
@@ -145,6 +145,7 @@ static void Algebra(Registry& reg, string grp)
 			.add_method("set_start_vector", &T::set_start_vector, "", "start vector")
 			.add_method("set_max_iterations", &T::set_max_iterations, "", "iterations")
 			.add_method("set_precision", &T::set_precision, "", "precision")
+			.add_method("set_verbose", &T::set_verbose, "", "verbose")
 			.add_method("calculate_max_eigenvalue", &T::calculate_max_eigenvalue, "", "")
 			.add_method("calculate_min_eigenvalue", &T::calculate_min_eigenvalue, "", "")
 			.add_method("get_max_eigenvalue", &T::get_max_eigenvalue, "", "")
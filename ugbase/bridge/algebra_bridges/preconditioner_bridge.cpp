@@ -47,6 +47,7 @@
 #include "lib_algebra/operator/preconditioner/ilut_scalar.h"
 #include "lib_algebra/operator/linear_solver/agglomerating_solver.h"
 #include "lib_algebra/operator/preconditioner/block_gauss_seidel.h"
+#include "lib_algebra/operator/preconditioner/mixed_precision.h"
 
 #include "../util_overloaded.h"
 using namespace std;
@@ -169,6 +170,36 @@ static void Algebra(Registry& reg, string grp)
 		reg.add_class_to_group(name, "Jacobi", tag);
 	}
 
+//	MatrixFreeJacobi
+	{
+		typedef MatrixFreeJacobi<TAlgebra> T;
+		typedef ILinearIterator<vector_type> TBase;
+		string name = string("MatrixFreeJacobi").append(suffix);
+		reg.add_class_<T,TBase>(name, grp, "Jacobi Preconditioner using only the operator diagonal")
+			.add_constructor()
+			.template add_constructor<void (*)(number)>("DampingFactor")
+			.set_construct_as_smart_pointer(true);
+		reg.add_class_to_group(name, "MatrixFreeJacobi", tag);
+	}
+
+//	Chebyshev
+	{
+		typedef Chebyshev<TAlgebra> T;
+		typedef ILinearIterator<vector_type> TBase;
+		string name = string("Chebyshev").append(suffix);
+		reg.add_class_<T,TBase>(name, grp, "Jacobi preconditioned Chebyshev iteration")
+			.add_constructor()
+			.add_method("set_degree", &T::set_degree, "", "degree", "sets the degree of the polynomial")
+			.add_method("set_eigenvalue_bounds", &T::set_eigenvalue_bounds, "", "lambdaMin#lambdaMax", "sets the range of eigenvalues of D^{-1}A to be damped")
+			.add_method("set_eigenvalue_ratio", &T::set_eigenvalue_ratio, "", "ratio", "sets lambdaMax/lambdaMin of the damped range")
+			.add_method("set_estimate_max_eigenvalue", &T::set_estimate_max_eigenvalue, "", "bEstimate", "enables estimation of lambdaMax by the power method")
+			.add_method("set_power_method_steps", &T::set_power_method_steps, "", "numSteps", "sets the number of power method steps")
+			.add_method("set_safety_factor", &T::set_safety_factor, "", "factor", "sets the factor the estimated lambdaMax is multiplied with")
+			.add_method("max_eigenvalue_estimate", &T::max_eigenvalue_estimate, "lambdaMax", "", "returns the last estimate of lambdaMax")
+			.set_construct_as_smart_pointer(true);
+		reg.add_class_to_group(name, "Chebyshev", tag);
+	}
+
 //	GaussSeidelBase
 	{
 		typedef GaussSeidelBase<TAlgebra> T;
@@ -177,6 +208,7 @@ static void Algebra(Registry& reg, string grp)
 		reg.add_class_<T,TBase>(name, grp, "Gauss-Seidel Base")
 			.add_method("enable_consistent_interfaces", &T::enable_consistent_interfaces, "", "enable", "makes the matrix and defect consistent at the proc. interfaces")
 			.add_method("enable_overlap", &T::enable_overlap, "", "enable", "Enables matrix overlap. This also means that interfaces are consistent.")
+			.add_method("enable_level_scheduling", &T::enable_level_scheduling, "", "enable", "Enables thread-parallel sweeps based on a level schedule (requires OPENMP).")
 			.add_method("set_sor_relax", &T::set_sor_relax,
 					"", "sor relaxation", "sets sor relaxation parameter");
 		reg.add_class_to_group(name, "GaussSeidelBase", tag);
@@ -244,10 +276,12 @@ static void Algebra(Registry& reg, string grp)
 			.add_method("set_sort_eps", &T::set_sort_eps, "", "eps")
 			.add_method("set_inversion_eps", &T::set_inversion_eps, "", "eps")
 			.add_method("set_sort", &T::set_sort, "", "bSort", "if bSort=true, use a cuthill-mckey sorting to reduce fill-in. default false")
+			.add_method("set_sort_type", &T::set_sort_type, "", "type", "ordering if sorting is enabled: 'cuthill-mckee' (default) or 'nested-dissection'")
 			.add_method("set_disable_preprocessing", &T::set_disable_preprocessing, "", "disable",
 						"set whether preprocessing (notably, LU factorization) is to be disabled - usable when the operator has not changed; use with care")
 			.add_method("enable_consistent_interfaces", &T::enable_consistent_interfaces, "", "enable", "Make Matrix consistent for connections in interfaces.")
 			.add_method("enable_overlap", &T::enable_overlap, "", "enable", "Enables matrix overlap. This also means that interfaces are consistent.")
+			.add_method("enable_level_scheduling", &T::enable_level_scheduling, "", "enable", "Enables thread-parallel triangular solves based on a level schedule (requires OPENMP).")
 			.set_construct_as_smart_pointer(true);
 		reg.add_class_to_group(name, "ILU", tag);
 	}
@@ -265,6 +299,7 @@ static void Algebra(Registry& reg, string grp)
 			.add_method("set_info", &T::set_info,
 						"", "info", "sets storage information output")
 			.add_method("set_sort", &T::set_sort, "", "bSort", "if bSort=true, use a cuthill-mckey sorting to reduce fill-in. default true")
+			.add_method("set_sort_type", &T::set_sort_type, "", "type", "ordering if sorting is enabled: 'cuthill-mckee' (default) or 'nested-dissection'")
 			.set_construct_as_smart_pointer(true);
 		reg.add_class_to_group(name, "ILUT", tag);
 	}
@@ -281,6 +316,7 @@ static void Algebra(Registry& reg, string grp)
 			.add_method("set_info", &T::set_info,
 						"", "info", "sets storage information output")
 			.add_method("set_sort", &T::set_sort, "", "bSort", "if bSort=true, use a cuthill-mckey sorting to reduce fill-in")
+			.add_method("set_sort_type", &T::set_sort_type, "", "type", "ordering if sorting is enabled: 'cuthill-mckee' (default) or 'nested-dissection'")
 			.set_construct_as_smart_pointer(true);
 		reg.add_class_to_group(name, "ILUTScalar", tag);
 	}
@@ -366,7 +402,66 @@ static void Algebra(Registry& reg, string grp)
 	}
 
 }
-	
+
+/**
+ * Function called for the registration of Algebra independent parts.
+ * The single precision preconditioners are only available for the
+ * CPUAlgebra and are registered here.
+ *
+ * @param reg				registry
+ * @param parentGroup		group for sorting of functionality
+ */
+static void Common(Registry& reg, string grp)
+{
+#ifdef UG_CPU_1
+	string suffix = GetAlgebraSuffix<CPUAlgebra>();
+	string tag = GetAlgebraTag<CPUAlgebra>();
+
+	typedef CPUAlgebra::vector_type vector_type;
+	typedef ILinearIterator<vector_type> TBase;
+
+//	MixedPrecisionIterator
+	{
+		typedef MixedPrecisionIterator<CPUAlgebra, CPUMixedAlgebra> T;
+		string name = string("MixedPrecisionIterator").append(suffix);
+		reg.add_class_<T,TBase>(name, grp, "Applies an iterator to a single precision copy of the matrix, the defect is updated in double precision")
+			.add_constructor()
+			.add_constructor<void (*)(SmartPtr<TBase>)>("iterator")
+			.add_method("set_iterator", &T::set_iterator, "", "iterator", "sets the iterator working on the single precision matrix")
+			.set_construct_as_smart_pointer(true);
+		reg.add_class_to_group(name, "MixedPrecisionIterator", tag);
+	}
+
+//	SinglePrecisionJacobi
+	{
+		typedef Jacobi<CPUMixedAlgebra> T;
+		string name = string("SinglePrecisionJacobi").append(suffix);
+		reg.add_class_<T,TBase>(name, grp, "Jacobi Preconditioner in single precision (use within MixedPrecisionIterator)")
+			.add_constructor()
+			.add_constructor<void (*)(number)>("DampingFactor")
+			.set_construct_as_smart_pointer(true);
+		reg.add_class_to_group(name, "SinglePrecisionJacobi", tag);
+	}
+
+//	SinglePrecisionILU
+	{
+		typedef ILU<CPUMixedAlgebra> T;
+		string name = string("SinglePrecisionILU").append(suffix);
+		reg.add_class_<T,TBase>(name, grp, "Incomplete LU Decomposition in single precision (use within MixedPrecisionIterator)")
+			.add_constructor()
+			.add_method("set_beta", &T::set_beta, "", "beta")
+			.add_method("set_sort_eps", &T::set_sort_eps, "", "eps")
+			.add_method("set_inversion_eps", &T::set_inversion_eps, "", "eps")
+			.add_method("set_sort", &T::set_sort, "", "bSort", "if bSort=true, use a cuthill-mckey sorting to reduce fill-in. default false")
+			.add_method("set_sort_type", &T::set_sort_type, "", "type", "ordering if sorting is enabled: 'cuthill-mckee' (default) or 'nested-dissection'")
+			.add_method("enable_consistent_interfaces", &T::enable_consistent_interfaces, "", "enable", "Make Matrix consistent for connections in interfaces.")
+			.add_method("enable_overlap", &T::enable_overlap, "", "enable", "Enables matrix overlap. This also means that interfaces are consistent.")
+			.add_method("enable_level_scheduling", &T::enable_level_scheduling, "", "enable", "Enables thread-parallel triangular solves based on a level schedule (requires OPENMP).")
+			.set_construct_as_smart_pointer(true);
+		reg.add_class_to_group(name, "SinglePrecisionILU", tag);
+	}
+#endif
+}
 
 }; // end Functionality
 
@@ -383,6 +478,7 @@ void RegisterBridge_Preconditioner(Registry& reg, string grp)
 
 	try{
 		RegisterAlgebraDependent<Functionality>(reg,grp);
+		RegisterCommon<Functionality>(reg,grp);
 	}
 	UG_REGISTRY_CATCH_THROW(grp);
 }
@@ -47,8 +47,12 @@
 #include "lib_algebra/operator/linear_solver/auto_linear_solver.h"
 #include "lib_algebra/operator/linear_solver/analyzing_solver.h"
 #include "lib_algebra/operator/linear_solver/cg.h"
+#include "lib_algebra/operator/linear_solver/pipelined_cg.h"
+#include "lib_algebra/operator/linear_solver/chronopoulos_gear_cg.h"
 #include "lib_algebra/operator/linear_solver/bicgstab.h"
 #include "lib_algebra/operator/linear_solver/gmres.h"
+#include "lib_algebra/operator/linear_solver/block_cg.h"
+#include "lib_algebra/operator/linear_solver/block_gmres.h"
 #include "lib_algebra/operator/linear_solver/lu.h"
 #include "lib_algebra/operator/linear_solver/agglomerating_solver.h"
 #include "lib_algebra/operator/linear_solver/debug_iterator.h"
@@ -217,6 +221,33 @@ static void Algebra(Registry& reg, string grp)
 		reg.add_class_to_group(name, "CG", tag);
 	}
 
+	// 	Pipelined CG Solver
+	{
+		typedef PipelinedCG<vector_type> T;
+		typedef IPreconditionedLinearOperatorInverse<vector_type> TBase;
+		string name = string("PipelinedCG").append(suffix);
+		reg.add_class_<T,TBase>(name, grp, "Pipelined Conjugate Gradient Solver (overlaps the global reduction with preconditioner and operator)")
+			.add_constructor()
+			. ADD_CONSTRUCTOR( (SmartPtr<ILinearIterator<vector_type,vector_type> > ) )("precond")
+			. ADD_CONSTRUCTOR( (SmartPtr<ILinearIterator<vector_type,vector_type> >, SmartPtr<IConvergenceCheck<vector_type> >) )("precond#convCheck")
+			.add_method("set_residual_replacement", &T::set_residual_replacement, "", "numIter", "recomputes the residuals every numIter iterations (0 = never)")
+			.set_construct_as_smart_pointer(true);
+		reg.add_class_to_group(name, "PipelinedCG", tag);
+	}
+
+	// 	Chronopoulos-Gear CG Solver
+	{
+		typedef ChronopoulosGearCG<vector_type> T;
+		typedef IPreconditionedLinearOperatorInverse<vector_type> TBase;
+		string name = string("ChronopoulosGearCG").append(suffix);
+		reg.add_class_<T,TBase>(name, grp, "Conjugate Gradient Solver with one global reduction per iteration (Chronopoulos-Gear)")
+			.add_constructor()
+			. ADD_CONSTRUCTOR( (SmartPtr<ILinearIterator<vector_type,vector_type> > ) )("precond")
+			. ADD_CONSTRUCTOR( (SmartPtr<ILinearIterator<vector_type,vector_type> >, SmartPtr<IConvergenceCheck<vector_type> >) )("precond#convCheck")
+			.set_construct_as_smart_pointer(true);
+		reg.add_class_to_group(name, "ChronopoulosGearCG", tag);
+	}
+
 // 	BiCGStab Solver
 	{
 		typedef BiCGStab<vector_type> T;
@@ -243,10 +274,37 @@ static void Algebra(Registry& reg, string grp)
 			.ADD_CONSTRUCTOR( (size_t restar) )("restart")
 			.add_method("add_postprocess_corr", &T::add_postprocess_corr, "adds a postprocess of the corrections", "op")
 			.add_method("remove_postprocess_corr", &T::remove_postprocess_corr, "removes a postprocess of the corrections", "op")
+			.add_method("set_classical_gram_schmidt", &T::set_classical_gram_schmidt, "", "bCGS", "if true, classical Gram-Schmidt with fused inner products is used (default: false, modified Gram-Schmidt)")
 			.set_construct_as_smart_pointer(true);
 		reg.add_class_to_group(name, "GMRES", tag);
 	}
 
+// 	Block CG Solver
+	{
+		typedef BlockCG<vector_type> T;
+		typedef IPreconditionedLinearOperatorInverse<vector_type> TBase;
+		string name = string("BlockCG").append(suffix);
+		reg.add_class_<T,TBase>(name, grp, "Block Conjugate Gradient Solver for several right-hand sides (use apply_multi)")
+			.add_constructor()
+			. ADD_CONSTRUCTOR( (SmartPtr<ILinearIterator<vector_type,vector_type> > ) )("precond")
+			. ADD_CONSTRUCTOR( (SmartPtr<ILinearIterator<vector_type,vector_type> >, SmartPtr<IConvergenceCheck<vector_type> >) )("precond#convCheck")
+			.add_method("set_deflation_tolerance", &T::set_deflation_tolerance, "", "tol", "relative norm below which a search direction is considered linearly dependent and removed (default: 1e-8)")
+			.set_construct_as_smart_pointer(true);
+		reg.add_class_to_group(name, "BlockCG", tag);
+	}
+
+// 	Block GMRES Solver
+	{
+		typedef BlockGMRES<vector_type> T;
+		typedef IPreconditionedLinearOperatorInverse<vector_type> TBase;
+		string name = string("BlockGMRES").append(suffix);
+		reg.add_class_<T,TBase>(name, grp, "Block GMRES Solver for several right-hand sides (use apply_multi)")
+			.ADD_CONSTRUCTOR( (size_t restart) )("restart")
+			.add_method("set_deflation_tolerance", &T::set_deflation_tolerance, "", "tol", "relative defect below which a right-hand side is not iterated in a restart cycle (default: 1e-10)")
+			.set_construct_as_smart_pointer(true);
+		reg.add_class_to_group(name, "BlockGMRES", tag);
+	}
+
 // 	LU Solver
 	{
 		typedef LU<TAlgebra> T;
@@ -256,6 +314,7 @@ static void Algebra(Registry& reg, string grp)
 			.add_constructor()
 			.add_method("set_minimum_for_sparse", &T::set_minimum_for_sparse, "", "N")
 			.add_method("set_sort_sparse", &T::set_sort_sparse, "", "bSort", "if bSort=true, use a cuthill-mckey sorting to reduce fill-in in sparse LU. default true")
+			.add_method("set_sort_type", &T::set_sort_type, "", "type", "ordering of the sparse LU: 'cuthill-mckee' (default) or 'nested-dissection'")
 			.add_method("set_info", &T::set_info, "", "bInfo", "if true, sparse LU prints some fill-in info")
 			.add_method("set_show_progress", &T::set_show_progress, "", "onoff", "switches the progress indicator on/off")
 			.set_construct_as_smart_pointer(true);
@@ -53,6 +53,7 @@
 #include "lib_disc/time_disc/time_disc_interface.h"
 #include "lib_disc/time_disc/theta_time_step.h"
 #include "lib_disc/operator/linear_operator/assembled_linear_operator.h"
+#include "lib_disc/operator/linear_operator/matrix_free_operator.h"
 #include "lib_disc/operator/non_linear_operator/assembled_non_linear_operator.h"
 #include "lib_disc/operator/non_linear_operator/line_search.h"
 #include "lib_disc/operator/linear_operator/nested_iteration/nested_iteration.h"
@@ -179,7 +180,11 @@ static void Algebra(Registry& reg, string parentGroup)
 				"calculate error indicators for elements from error estimators of the elemDiscs")
 			.add_method("invalidate_error", &T::invalidate_error, "", "Marks error indicators as invalid, "
 				"which will prohibit refining and coarsening before a new call to calc_error.")
-			.add_method("is_error_valid", &T::is_error_valid, "", "Returns whether error indicators are valid");
+			.add_method("is_error_valid", &T::is_error_valid, "", "Returns whether error indicators are valid")
+			.add_method("set_linear_time_invariant", &T::set_linear_time_invariant, "", "bLTI",
+				"Reuses mass and stiffness matrix for linear problems with time-independent coefficients")
+			.add_method("invalidate_linear_cache", &T::invalidate_linear_cache, "", "",
+				"Forces reassembling of the reused mass and stiffness matrix");
 		reg.add_class_to_group(name, "MultiStepTimeDiscretization", tag);
 	}
 
@@ -261,6 +266,23 @@ static void Algebra(Registry& reg, string parentGroup)
 			.set_construct_as_smart_pointer(true);
 		reg.add_class_to_group(name, "AssembledLinearOperator", tag);
 	}
+
+//	MatrixFreeOperator
+	{
+		std::string grp = parentGroup; grp.append("/Discretization");
+		typedef MatrixFreeOperator<TAlgebra> T;
+		typedef IMatrixFreeOperator<vector_type> TBase;
+		string name = string("MatrixFreeOperator").append(suffix);
+		reg.add_class_<T, TBase>(name, grp)
+			.add_constructor()
+			.template add_constructor<void (*)(SmartPtr<IAssemble<TAlgebra> >)>("Assembling Routine")
+			.template add_constructor<void (*)(SmartPtr<IAssemble<TAlgebra> >, const GridLevel&)>("AssemblingRoutine#GridLevel")
+			.add_method("set_discretization", &T::set_discretization)
+			.add_method("set_level", &T::set_level)
+			.add_method("level", &T::level)
+			.set_construct_as_smart_pointer(true);
+		reg.add_class_to_group(name, "MatrixFreeOperator", tag);
+	}
 	
 
 //	NewtonSolver
@@ -279,6 +301,11 @@ static void Algebra(Registry& reg, string parentGroup)
 			.add_method("set_line_search", &T::set_line_search, "", "lineSeach")
 			.add_method("disable_line_search", &T::disable_line_search)
 			.add_method("line_search", &T::line_search, "lineSeach", "")
+			.add_method("set_max_jacobian_reuse", &T::set_max_jacobian_reuse, "", "maxReuse", "reuse Jacobian and linear solver for at most maxReuse Newton steps")
+			.add_method("set_jacobian_reuse_rate", &T::set_jacobian_reuse_rate, "", "rate", "reassemble reused Jacobian if Newton contraction rate exceeds rate")
+			.add_method("reset_jacobian", &T::reset_jacobian)
+			.add_method("set_adaptive_forcing", &T::set_adaptive_forcing, "", "bForcing", "Eisenstat-Walker forcing terms for the linear solver")
+			.add_method("set_forcing_parameters", &T::set_forcing_parameters, "", "etaMax#gamma#alpha")
 			.add_method("init", &T::init, "success", "op")
 			.add_method("prepare", &T::prepare, "success", "u")
 			.add_method("apply", &T::apply, "success", "u")
@@ -292,6 +319,7 @@ static void Algebra(Registry& reg, string parentGroup)
 			.add_method("total_linsolver_steps", &T::total_linsolver_steps, "total number of linsolver steps", "")
 			.add_method("total_average_linear_steps", &T::total_average_linear_steps, "total average number of linsolver steps per linsolver call", "")
 			.add_method("last_num_newton_steps", &T::last_num_newton_steps, "Number of newton steps performed in last iteration")
+			.add_method("num_jacobian_assemblies", &T::num_jacobian_assemblies, "Number of Jacobian assemblies since last clear")
 			.add_method("add_inner_step_update", &T::add_inner_step_update, "data update called before every linsolver step", "")
 			.add_method("clear_inner_step_update", &T::clear_inner_step_update, "clear inner step update", "")
 			.add_method("add_step_update", &T::add_step_update, "data update called before every Newton step", "")
@@ -239,6 +239,12 @@ static void Algebra(Registry& reg, string grp)
 		reg.add_class_<T>(name+suffix, grp)
 			.add_method("set_matrix_is_const", &T::set_matrix_is_const, "",
 						"whether matrix is constant in time", "")
+			.add_method("set_num_threads", &T::set_num_threads, "",
+						"numThreads", "sets the number of threads used in the element loops (requires OPENMP)")
+			.add_method("num_threads", &T::num_threads, "number of threads")
+			.add_method("set_reuse_matrix_pattern", &T::set_reuse_matrix_pattern, "",
+						"bReuse", "reuses the matrix pattern in repeated assemblings")
+			.add_method("reuse_matrix_pattern", &T::reuse_matrix_pattern, "reuse")
 			.set_construct_as_smart_pointer(true);
 		reg.add_class_to_group(name+suffix, name, tag);
 	}
@@ -571,6 +571,8 @@ static void Common(Registry& reg, string grp)
 		.add_method("init_levels", &T::init_levels)
 		.add_method("init_surfaces", &T::init_surfaces)
 		.add_method("init_top_surface", &T::init_top_surface)
+		.add_method("set_index_cache", &T::set_index_cache, "", "bEnable",
+					"caches the indices of all elements in flattened tables")
 
 		.add_method("clear", &T::clear)
 		.add_method("add_fct", static_cast<void (T::*)(const char*, const char*, int, const char*)>(&T::add),
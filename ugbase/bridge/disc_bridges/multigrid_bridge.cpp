@@ -209,6 +209,8 @@ static void DomainAlgebra(Registry& reg, string grp)
 			.add_method("set_rap", &T::set_rap)
 			.add_method("set_smooth_on_surface_rim", &T::set_smooth_on_surface_rim)
 			.add_method("set_comm_comp_overlap", &T::set_comm_comp_overlap)
+			.add_method("set_cache_smoother_eigenvalues", &T::set_cache_smoother_eigenvalues)
+			.add_method("set_smoother_eigenvalue_reuse", &T::set_smoother_eigenvalue_reuse)
 			.add_method("ignore_init_for_base_solver", static_cast<void (T::*)(bool)>(&T::ignore_init_for_base_solver), "", "ignore")
 			.add_method("ignore_init_for_base_solver", static_cast<bool (T::*)() const>(&T::ignore_init_for_base_solver), "is ignored", "")
 			.add_method("force_reinit", &T::force_reinit)
@@ -38,13 +38,15 @@
 // include bridge
 #include "bridge/bridge.h"
 #include "bridge/util.h"
-#include "bridge/util_domain_dependent.h"
+#include "bridge/util_domain_algebra_dependent.h"
 
 // lib_disc includes
 #include "lib_disc/domain.h"
 #include "lib_disc/dof_manager/ordering/cuthill_mckee.h"
 #include "lib_disc/dof_manager/ordering/lexorder.h"
 #include "lib_disc/dof_manager/ordering/downwindorder.h"
+#include "lib_disc/dof_manager/ordering/space_filling_curve_order.h"
+#include "lib_disc/dof_manager/ordering/ordering_benchmark.h"
 
 using namespace std;
 
@@ -79,6 +81,16 @@ static void DomainAlgebra(Registry& reg, string grp)
 {
 	string suffix = GetDomainAlgebraSuffix<TDomain,TAlgebra>();
 	string tag = GetDomainAlgebraTag<TDomain,TAlgebra>();
+
+//	group string
+	grp.append("/ApproximationSpace");
+
+//	Benchmark of the orderings
+	{
+		reg.add_function("OrderingBenchmark", &OrderingBenchmark<TDomain, TAlgebra>, grp,
+				"", "assembling#u#orderings#numRuns",
+				"measures assembling and matrix-vector product for a comma-separated list of orderings");
+	}
 }
 
 /**
@@ -109,6 +121,13 @@ static void Domain(Registry& reg, string grp)
 	{
 		reg.add_function("OrderLex", static_cast<void (*)(approximation_space_type&, const char*)>(&OrderLex<TDomain>), grp);
 	}
+
+//	Order along space filling curve
+	{
+		reg.add_function("OrderSpaceFillingCurve", static_cast<void (*)(approximation_space_type&)>(&OrderSpaceFillingCurve<TDomain>), grp);
+		reg.add_function("OrderSpaceFillingCurve", static_cast<void (*)(approximation_space_type&, const char*)>(&OrderSpaceFillingCurve<TDomain>), grp);
+		reg.add_function("OrderGridSpaceFillingCurve", static_cast<void (*)(TDomain&, const char*)>(&OrderGridSpaceFillingCurve<TDomain>), grp);
+	}
 //	Order in downwind direction
 	{
 		reg.add_function("OrderDownwind", static_cast<void (*)(approximation_space_type&, SmartPtr<UserData<MathVector<TDomain::dim>, TDomain::dim> >)> (&ug::OrderDownwind<TDomain>), grp);
@@ -188,7 +207,7 @@ void RegisterBridge_Ordering(Registry& reg, string grp)
 //		RegisterDimensionDependent<Functionality>(reg,grp);
 		RegisterDomainDependent<Functionality>(reg,grp);
 //		RegisterAlgebraDependent<Functionality>(reg,grp);
-//		RegisterDomainAlgebraDependent<Functionality>(reg,grp);
+		RegisterDomainAlgebraDependent<Functionality>(reg,grp);
 	}
 	UG_REGISTRY_CATCH_THROW(grp);
 }
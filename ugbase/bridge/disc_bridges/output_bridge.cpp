@@ -46,7 +46,9 @@
 #include "lib_disc/function_spaces/approximation_space.h"
 
 #include "lib_disc/io/vtkoutput.h"
+#include "lib_disc/io/grid_checkpoint.h"
 #include "common/profiler/profiler.h"
+#include "common/util/async_output_queue.h"
 
 #include "../util_overloaded.h"
 
@@ -185,6 +187,23 @@ static void DomainAlgebra(Registry& reg, string grp)
 		reg.add_class_to_group(name, "GridFunctionVectorWriterDirichlet0", tag);
 	}
 
+//	GridCheckpoint
+	{
+		typedef GridCheckpoint<TDomain, TAlgebra> T;
+		string name = string("GridCheckpoint").append(suffix);
+		reg.add_class_<T>(name, grp)
+			.template add_constructor<void (*)(SmartPtr<TDomain>)>("Domain")
+			.add_method("add", &T::add, "", "GridFunction#Name", "adds a grid function to the checkpoint")
+		#ifdef UG_PARALLEL
+			.add_method("set_load_balancer", &T::set_load_balancer, "", "LoadBalancer",
+						"redistributes after a restart on a different number of processes")
+		#endif
+			.add_method("save", &T::save, "", "Filename", "writes the domain and all added grid functions")
+			.add_method("load", &T::load, "", "Filename", "restores the domain and all added grid functions")
+			.set_construct_as_smart_pointer(true);
+		reg.add_class_to_group(name, "GridCheckpoint", tag);
+	}
+
 //	WriteGridToVTK
 	{
 		reg.add_function("WriteGridFunctionToVTK",
@@ -267,6 +286,10 @@ static void Dimension(Registry& reg, string grp)
 			.add_method("select_element", static_cast<void (T::*)(SmartPtr<UserData<number, dim> >, const char*)>(&T::select_element))
 			.add_method("select_element", static_cast<void (T::*)(SmartPtr<UserData<MathVector<dim>, dim> >, const char*)>(&T::select_element))
 			.add_method("set_binary", &T::set_binary, "", "bBinary", "should values be printed in binary (base64 encoded way ) or plain ascii")
+			.add_method("set_binary_format", &T::set_binary_format, "", "format", "storage of binary values: 'base64' (inline), 'raw', 'zlib' or 'lz4' (appended)")
+			.add_method("set_num_procs_per_file", &T::set_num_procs_per_file, "", "numProcs", "number of processes whose pieces are written to one file")
+			.add_method("set_async", &T::set_async, "", "bAsync", "write files by a background thread while the computation proceeds")
+			.add_method("flush", &T::flush, "", "", "waits until all asynchronously written files are on disk")
 			.set_construct_as_smart_pointer(true);
 		reg.add_class_to_group(name, "VTKOutput", tag);
 	}
@@ -291,6 +314,14 @@ static void Common(Registry& reg, string grp)
 				"", "filename.mtx|save-dialog|endings=[\"mtx\"];description=\"MatrixMarket Files\"#mat#comment", "Save the assembled matrix of a matrix operator to MatrixMarket format");
 	}
 #endif
+
+//	asynchronous output
+	{
+		reg.add_function("WaitForAsyncOutput", &WaitForAsyncOutput, grp,
+				"", "", "waits until all asynchronously written output is on disk");
+		reg.add_function("SetAsyncOutputMemoryLimit", &SetAsyncOutputMemoryLimit, grp,
+				"", "megaBytes", "sets the maximal memory buffered by pending asynchronous output");
+	}
 }
 
 }; // end Functionality
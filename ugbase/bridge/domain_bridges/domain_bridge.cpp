@@ -448,9 +448,15 @@ static void Domain(Registry& reg, string grp)
 					"", "Domain # Filename # NumRefines | load-dialog | endings=[\"ugx\"]; description=\"*.ugx-Files\" # Number Refinements",
 					"Loads a domain and performs global refinement", "No help");
 //	SaveDomain
-	reg.add_function("SaveDomain", &SaveDomain<TDomain>, grp,
+	reg.add_function("SaveDomain", static_cast<void (*)(TDomain&, const char*)>(
+					 &SaveDomain<TDomain>), grp,
 					"", "Domain # Filename|save-dialog| endings=[\"ugx\"]",
 					"Saves a domain", "No help");
+	reg.add_function("SaveDomain", static_cast<void (*)(TDomain&, const char*, const char*)>(
+					 &SaveDomain<TDomain>), grp,
+					"", "Domain # Filename|save-dialog| endings=[\"ugx\"] # DataMode",
+					"Saves a domain. The vertices, elements and subsets of ugx files "
+					"are written as 'ascii', 'base64' or 'raw' appended data.", "No help");
 
 //	SavePartitionMap
 	reg.add_function("SavePartitionMap", &SavePartitionMap<TDomain>, grp,
@@ -463,6 +469,13 @@ static void Domain(Registry& reg, string grp)
 		static_cast<bool (*)(TDomain&, PartitionMap&, bool)>(&DistributeDomain<TDomain>),
 		grp);
 
+	reg.add_function("SavePartitionedDomain", &SavePartitionedDomain<TDomain>, grp,
+					"", "Domain # PartitionMap # Filename|save-dialog",
+					"Saves the parts of a domain into one pre-partitioned grid file");
+	reg.add_function("LoadPartitionedDomain", &LoadPartitionedDomain<TDomain>, grp,
+					"", "Domain # Filename|load-dialog",
+					"Each process loads its own part of a pre-partitioned grid file");
+
 //	PartitionDomain
 	reg.add_function("PartitionDomain_MetisKWay",
 					 static_cast<bool (*)(TDomain&, PartitionMap&, int, size_t, int, int)>(&PartitionDomain_MetisKWay<TDomain>), grp);
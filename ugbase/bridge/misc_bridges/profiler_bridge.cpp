@@ -34,6 +34,8 @@
 #include "bridge/bridge.h"
 #include "common/profiler/profiler.h"
 #include "common/profiler/profile_node.h"
+#include "common/profiler/profile_counter.h"
+#include "common/profiler/hardware_counter.h"
 #include "ug.h" // Required for UGOutputProfileStatsOnExit.
 #include <string>
 #include <sstream>
@@ -50,6 +52,11 @@ static void UpdateProfiler_BridgeImpl(number damping){
 	PROFILER_UPDATE(damping);
 }
 
+static void PrintProfileCounters()
+{
+	UG_LOG(ProfileCounter::summary());
+}
+
 static void SetShinyCallLoggingMaxFrequency(int maxFreq)
 {
 #ifdef SHINY_CALL_LOGGING
@@ -140,6 +147,14 @@ void RegisterBridge_Profiler(Registry &reg, string parentGroup)
 				"time in milliseconds spend in this node excluding subnodes", "")
 		.add_method("get_avg_total_time_ms", &UGProfileNode::get_avg_total_time_ms,
 				"time in milliseconds spend in this node including subnodes", "")
+		.add_method("get_ipc", &UGProfileNode::get_ipc,
+				"instructions per cycle in this node including subnodes", "")
+		.add_method("get_bytes_per_flop", &UGProfileNode::get_bytes_per_flop,
+				"estimated memory traffic per flop in this node including subnodes", "")
+		.add_method("get_bytes_per_instruction", &UGProfileNode::get_bytes_per_instruction,
+				"estimated memory traffic per instruction in this node including subnodes", "")
+		.add_method("get_mem_bandwidth", &UGProfileNode::get_mem_bandwidth,
+				"estimated memory bandwidth in GB/s in this node including subnodes", "")
 		.add_method("is_valid", &UGProfileNode::valid, "true if node has been found", "")
 
 	  		.add_method("groups", &UGProfileNode::groups, "", "")
@@ -180,6 +195,15 @@ void RegisterBridge_Profiler(Registry &reg, string parentGroup)
 
 	reg.add_function("UpdateProfiler", &UpdateProfiler_BridgeImpl, grp);
 
+	reg.add_function("PrintProfileCounters", &PrintProfileCounters, grp,
+	                 "", "", "prints event counters (e.g. allocations per assembled element)");
+	reg.add_function("ResetProfileCounters", &ProfileCounter::reset_all, grp);
+
+	reg.add_function("EnableHardwareCounters", &EnableHardwareCounters, grp,
+	                 "true if enabled", "bEnable", "starts/pauses counting cycles, instructions, cache misses and flops per profile node (linux only)");
+	reg.add_function("AddHardwareFlopEvent", &AddHardwareFlopEvent, grp,
+	                 "", "rawEvent#flopsPerEvent", "adds a cpu specific raw event counted as flops (before EnableHardwareCounters)");
+
 	reg.add_function("SetShinyCallLoggingMaxFrequency", &SetShinyCallLoggingMaxFrequency, grp, "", "maxFreq");
 
 	reg.add_function("SetFrequency", &SetFrequency, grp, "", "CSV-File");
@@ -0,0 +1,246 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+
+#include <new>
+#include <cassert>
+#include <algorithm>
+#include "slab_allocator.h"
+
+#ifdef UG_OPENMP
+	#include <omp.h>
+	#define SLAB_ASSERT_SERIAL()	assert(!omp_in_parallel())
+#else
+	#define SLAB_ASSERT_SERIAL()
+#endif
+
+namespace ug{
+
+SlabAllocator::
+SlabAllocator(std::size_t blockSize, std::size_t slabSize) :
+	m_pFreeList(NULL),
+	m_pSlabPos(NULL),
+	m_pSlabEnd(NULL),
+	m_numAllocated(0)
+{
+//	blocks have to hold the free list pointer and must keep pointer alignment
+	const std::size_t ptrSize = sizeof(void*);
+	if(blockSize < ptrSize) blockSize = ptrSize;
+	m_blockSize = ((blockSize + ptrSize - 1) / ptrSize) * ptrSize;
+
+//	each slab holds at least one block
+	m_slabSize = (slabSize / m_blockSize) * m_blockSize;
+	if(m_slabSize == 0) m_slabSize = m_blockSize;
+}
+
+SlabAllocator::
+~SlabAllocator()
+{
+	for(std::size_t i = 0; i < m_vSlab.size(); ++i)
+		::operator delete(m_vSlab[i]);
+}
+
+void SlabAllocator::
+new_slab()
+{
+	unsigned char* pSlab = static_cast<unsigned char*>(::operator new(m_slabSize));
+	m_vSlab.push_back(pSlab);
+	m_pSlabPos = pSlab;
+	m_pSlabEnd = pSlab + m_slabSize;
+}
+
+void* SlabAllocator::
+allocate()
+{
+	SLAB_ASSERT_SERIAL();
+	++m_numAllocated;
+
+//	reuse freed blocks first
+	if(m_pFreeList){
+		FreeBlock* pBlock = m_pFreeList;
+		m_pFreeList = pBlock->next;
+		return pBlock;
+	}
+
+//	take next block of the current slab
+	if(m_pSlabPos == m_pSlabEnd)
+		new_slab();
+
+	void* p = m_pSlabPos;
+	m_pSlabPos += m_blockSize;
+	return p;
+}
+
+void SlabAllocator::
+deallocate(void* p)
+{
+	if(!p) return;
+	SLAB_ASSERT_SERIAL();
+	assert(m_numAllocated > 0);
+	--m_numAllocated;
+
+	FreeBlock* pBlock = static_cast<FreeBlock*>(p);
+	pBlock->next = m_pFreeList;
+	m_pFreeList = pBlock;
+}
+
+void SlabAllocator::
+release_free_slabs()
+{
+	SLAB_ASSERT_SERIAL();
+	if(m_vSlab.empty()) return;
+
+//	without blocks in use, all slabs are released
+	if(m_numAllocated == 0){
+		for(std::size_t i = 0; i < m_vSlab.size(); ++i)
+			::operator delete(m_vSlab[i]);
+		m_vSlab.clear();
+		m_pFreeList = NULL;
+		m_pSlabPos = m_pSlabEnd = NULL;
+		return;
+	}
+
+//	count the free bytes per slab (slabs sorted by address for the lookup)
+	std::sort(m_vSlab.begin(), m_vSlab.end());
+	std::vector<std::size_t> vFreeBytes(m_vSlab.size(), 0);
+	for(FreeBlock* pBlock = m_pFreeList; pBlock; pBlock = pBlock->next){
+		unsigned char* p = reinterpret_cast<unsigned char*>(pBlock);
+		const std::size_t s = std::upper_bound(m_vSlab.begin(), m_vSlab.end(), p)
+								- m_vSlab.begin() - 1;
+		vFreeBytes[s] += m_blockSize;
+	}
+
+//	the unused rest of the current slab is free as well
+	if(m_pSlabPos != m_pSlabEnd){
+		const std::size_t s = std::upper_bound(m_vSlab.begin(), m_vSlab.end(),
+									m_pSlabPos) - m_vSlab.begin() - 1;
+		vFreeBytes[s] += m_pSlabEnd - m_pSlabPos;
+	}
+
+//	release slabs without blocks in use
+	std::vector<bool> vReleased(m_vSlab.size(), false);
+	bool bReleased = false;
+	for(std::size_t s = 0; s < m_vSlab.size(); ++s){
+		if(vFreeBytes[s] != m_slabSize) continue;
+		vReleased[s] = true;
+		bReleased = true;
+		if(m_pSlabPos >= m_vSlab[s] && m_pSlabPos < m_vSlab[s] + m_slabSize)
+			m_pSlabPos = m_pSlabEnd = NULL;
+	}
+	if(!bReleased) return;
+
+//	remove the blocks of released slabs from the free list
+	FreeBlock** ppNext = &m_pFreeList;
+	while(*ppNext){
+		unsigned char* p = reinterpret_cast<unsigned char*>(*ppNext);
+		const std::size_t s = std::upper_bound(m_vSlab.begin(), m_vSlab.end(), p)
+								- m_vSlab.begin() - 1;
+		if(vReleased[s]) *ppNext = (*ppNext)->next;
+		else ppNext = &(*ppNext)->next;
+	}
+
+	std::size_t numKept = 0;
+	for(std::size_t s = 0; s < m_vSlab.size(); ++s){
+		if(vReleased[s]) ::operator delete(m_vSlab[s]);
+		else m_vSlab[numKept++] = m_vSlab[s];
+	}
+	m_vSlab.resize(numKept);
+}
+
+
+SlabObjectAllocator& SlabObjectAllocator::
+inst()
+{
+//	never destroyed, since objects may be deleted during static destruction
+	static SlabObjectAllocator* pInst = new SlabObjectAllocator;
+	return *pInst;
+}
+
+SlabObjectAllocator::
+SlabObjectAllocator()
+{
+	const std::size_t numClasses = size_class(maxObjSize) + 1;
+	m_vAllocator.resize(numClasses, NULL);
+	for(std::size_t i = 1; i < numClasses; ++i)
+		m_vAllocator[i] = new SlabAllocator(i * granularity);
+}
+
+SlabObjectAllocator::
+~SlabObjectAllocator()
+{
+	for(std::size_t i = 0; i < m_vAllocator.size(); ++i)
+		delete m_vAllocator[i];
+}
+
+void* SlabObjectAllocator::
+allocate(std::size_t size)
+{
+	if(size == 0 || size > maxObjSize)
+		return ::operator new(size);
+
+	return m_vAllocator[size_class(size)]->allocate();
+}
+
+void SlabObjectAllocator::
+deallocate(void* p, std::size_t size)
+{
+	if(size == 0 || size > maxObjSize)
+		::operator delete(p);
+	else
+		m_vAllocator[size_class(size)]->deallocate(p);
+}
+
+void SlabObjectAllocator::
+release_free_slabs()
+{
+	for(std::size_t i = 0; i < m_vAllocator.size(); ++i)
+		if(m_vAllocator[i]) m_vAllocator[i]->release_free_slabs();
+}
+
+std::size_t SlabObjectAllocator::
+num_allocated() const
+{
+	std::size_t num = 0;
+	for(std::size_t i = 0; i < m_vAllocator.size(); ++i)
+		if(m_vAllocator[i]) num += m_vAllocator[i]->num_allocated();
+	return num;
+}
+
+std::size_t SlabObjectAllocator::
+num_reserved_bytes() const
+{
+	std::size_t num = 0;
+	for(std::size_t i = 0; i < m_vAllocator.size(); ++i)
+		if(m_vAllocator[i]) num += m_vAllocator[i]->num_reserved_bytes();
+	return num;
+}
+
+}//	end of namespace
@@ -0,0 +1,167 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+
+#ifndef __H__UG__COMMON__SLAB_ALLOCATOR__
+#define __H__UG__COMMON__SLAB_ALLOCATOR__
+
+#include <cstddef>
+#include <vector>
+
+namespace ug{
+
+/**	Allocates blocks of one fixed size from large slabs of memory.
+ *	Freed blocks are kept in a free list and are reused by subsequent calls
+ *	to allocate, so that both allocation and deallocation are O(1). Memory of
+ *	slabs is returned by release_free_slabs, if none of their blocks is in
+ *	use, and when the allocator is destroyed.
+ *
+ *	Successively allocated blocks are contiguous in memory, which gives good
+ *	locality if objects are created in the order they are traversed later on.
+ *
+ *	\note	The allocator is not thread safe. All calls have to be made from
+ *			one thread at a time (asserted for OpenMP parallel regions).
+ */
+class SlabAllocator
+{
+	public:
+	///	blockSize is rounded up to a multiple of sizeof(void*)
+		SlabAllocator(std::size_t blockSize, std::size_t slabSize = 65536);
+		~SlabAllocator();
+
+		void* allocate();
+		void deallocate(void* p);
+
+	///	returns the memory of all slabs, of which no block is in use
+	/**	The cost is linear in the number of free blocks (times the logarithm
+	 *	of the number of slabs), thus this should not be called frequently.*/
+		void release_free_slabs();
+
+	///	size of the blocks returned by allocate
+		std::size_t block_size() const			{return m_blockSize;}
+
+	///	number of blocks currently in use
+		std::size_t num_allocated() const		{return m_numAllocated;}
+
+	///	total number of bytes reserved in slabs
+		std::size_t num_reserved_bytes() const	{return m_vSlab.size() * m_slabSize;}
+
+	private:
+	///	not copyable
+		SlabAllocator(const SlabAllocator&);
+		SlabAllocator& operator=(const SlabAllocator&);
+
+	///	allocates a new slab, from which blocks are taken
+		void new_slab();
+
+	///	freed blocks store a pointer to the next free block
+		struct FreeBlock {FreeBlock* next;};
+
+	private:
+		std::size_t m_blockSize;
+		std::size_t m_slabSize;
+		std::vector<unsigned char*> m_vSlab;
+		FreeBlock* m_pFreeList;
+		unsigned char* m_pSlabPos;
+		unsigned char* m_pSlabEnd;
+		std::size_t m_numAllocated;
+};
+
+
+/**	A singleton holding one SlabAllocator for each size class up to
+ *	maxObjSize bytes. Requests of larger size are forwarded to the global
+ *	operator new.
+ *
+ *	The singleton is shared by all objects of the process, e.g. by the
+ *	elements of all grids. Slabs without objects in use are returned by
+ *	release_free_slabs, which is called when a grid is destroyed.
+ *
+ *	The singleton is never destroyed, so that objects may safely be deleted
+ *	during static destruction.
+ *
+ *	\note	As the SlabAllocator, this class is not thread safe, i.e. objects
+ *			must not be created or deleted concurrently.
+ */
+class SlabObjectAllocator
+{
+	public:
+		static const std::size_t maxObjSize = 512;
+		static const std::size_t granularity = 16;
+
+	///	returns the instance of this singleton
+		static SlabObjectAllocator& inst();
+
+		void* allocate(std::size_t size);
+
+	///	size has to be the same as in the call to allocate
+		void deallocate(void* p, std::size_t size);
+
+	///	returns the memory of slabs without objects in use (of all size classes)
+		void release_free_slabs();
+
+	///	number of objects currently allocated through slabs
+		std::size_t num_allocated() const;
+
+	///	number of bytes reserved in slabs
+		std::size_t num_reserved_bytes() const;
+
+	private:
+		SlabObjectAllocator();
+		~SlabObjectAllocator();
+
+		static std::size_t size_class(std::size_t size)
+		{return (size + granularity - 1) / granularity;}
+
+	private:
+		std::vector<SlabAllocator*> m_vAllocator;
+};
+
+
+/**	By deriving from this class, instances of derived classes are allocated
+ *	through the SlabObjectAllocator. Derived classes are deleted through the
+ *	virtual destructor, so that the size passed to operator delete is always
+ *	the size of the allocated object.
+ */
+class SlabObject
+{
+	public:
+		static void* operator new(std::size_t size)
+		{return SlabObjectAllocator::inst().allocate(size);}
+
+		static void operator delete(void* p, std::size_t size)
+		{SlabObjectAllocator::inst().deallocate(p, size);}
+
+		virtual ~SlabObject()	{}
+};
+
+}//	end of namespace
+
+#endif
@@ -48,6 +48,19 @@ private:
 };
 
 
+/// sets target = min(target, value), atomically if compiled with OpenMP
+static inline void AtomicMin(size_t& target, size_t value)
+{
+#ifdef UG_OPENMP
+	size_t cur = *(volatile size_t*)&target;
+	while(value < cur && !__sync_bool_compare_and_swap(&target, cur, value))
+		cur = *(volatile size_t*)&target;
+#else
+	if(value < target) target = value;
+#endif
+}
+
+
 /// greatest common divisor
 static size_t gcd(size_t a, size_t b)
 {
@@ -102,11 +115,16 @@ void ComputeCuthillMcKeeOrder(std::vector<size_t>& vNewIndex,
 	const std::size_t nDoF = vvConnection.size();
 
 //	create flag list to remember already handled indices
-	std::vector<bool> vHandled(nDoF, false);
+//	(char instead of bool, since the flags are written concurrently)
+	std::vector<char> vHandled(nDoF, false);
 
 //	Sort neighbours by degree (i.e. by number of neighbours those have)
 	CompareDegree myCompDegree(vvConnection);
-	for(size_t i = 0; i < nDoF; ++i)
+	const int numDoF = (int)nDoF;
+	#ifdef UG_OPENMP
+	#pragma omp parallel for schedule(dynamic, 1024)
+	#endif
+	for(int i = 0; i < numDoF; ++i)
 	{
 	//	indices with no adjacent indices are marked as handled (and skipped)
 		if(vvConnection[i].size() == 0){
@@ -126,11 +144,35 @@ void ComputeCuthillMcKeeOrder(std::vector<size_t>& vNewIndex,
 	// also sort vvConnection itself, this is extremely useful if there are many
 	// identity rows, as finding the "start" index again and again will take
 	// REALLY much time in that case
+	// (a counting sort by degree gives the same result as a stable sort)
 	std::vector<size_t> sorting(nDoF);
 	size_t szSort = sorting.size();
-	for (size_t i = 0; i < szSort; ++i)
-		sorting[i] = i;
-	std::stable_sort(sorting.begin(), sorting.end(), myCompDegree);
+	{
+		size_t maxDegree = 0;
+		for (size_t i = 0; i < nDoF; ++i)
+			maxDegree = std::max(maxDegree, vvConnection[i].size());
+
+		std::vector<size_t> vOffset(maxDegree + 2, 0);
+		for (size_t i = 0; i < nDoF; ++i)
+			++vOffset[vvConnection[i].size() + 1];
+		for (size_t d = 1; d < vOffset.size(); ++d)
+			vOffset[d] += vOffset[d-1];
+		for (size_t i = 0; i < nDoF; ++i)
+			sorting[vOffset[vvConnection[i].size()]++] = i;
+	}
+
+//	The breadth-first search is performed level by level: Every index of the
+//	next level is appended by the first index of the current level it is
+//	adjacent to, in the order of the sorted neighbours. This results in the
+//	same ordering as the classical queue-based implementation, but allows to
+//	process the indices of a level concurrently.
+//	vOwner[i] holds the position (in vNewOrder) of the first index appending
+//	index i, vCount and vOffset the number and positions of appended indices
+//	of every index of a level
+	const size_t noOwner = (size_t) -1;
+	std::vector<size_t> vOwner(nDoF, noOwner);
+	std::vector<size_t> vCount;
+	vNewOrder.reserve(nDoF);
 
 //	start with first index
 	size_t firstNonHandled = 0;
@@ -147,47 +189,79 @@ void ComputeCuthillMcKeeOrder(std::vector<size_t>& vNewIndex,
 	//	check if one unhandled vertex left
 		if(i_notHandled == szSort) break;
 
-/* // This is no longer necessary as firstUnhandled automatically
-      has smallest degree due to sorting.
-	//	Find node with smallest degree for all remaining indices
-		size_t start = firstNonHandled;
-		for(size_t i = start+1; i < vHandled.size(); ++i)
-		{
-			if(!vHandled[i] && vvConnection[i].size() < vvConnection[start].size())
-				start = i;
-		}
-*/
 		size_t start = sorting[firstNonHandled];
+		vHandled[start] = true;
+		vNewOrder.push_back(start);
 
-	//	Create queue of adjacent vertices
-		std::queue<size_t> qAdjacent;
-		qAdjacent.push(start);
-
-	//	add adjacent vertices to mapping
-		while(!qAdjacent.empty())
+	//	add adjacent vertices level by level
+		size_t levelBegin = vNewOrder.size() - 1;
+		while(levelBegin < vNewOrder.size())
 		{
-		//	get next index
-			const size_t front = qAdjacent.front();
+			const size_t levelEnd = vNewOrder.size();
+			const int levelSize = (int)(levelEnd - levelBegin);
+			vCount.resize(levelSize + 1);
+
+		//	find the first index of the level appending an adjacent index
+			#ifdef UG_OPENMP
+			#pragma omp parallel for schedule(dynamic, 64) if(levelSize > 1024)
+			#endif
+			for(int k = 0; k < levelSize; ++k)
+			{
+				const size_t pos = levelBegin + k;
+				const std::vector<size_t>& vCon = vvConnection[vNewOrder[pos]];
+				for(size_t i = 0; i < vCon.size(); ++i)
+				{
+					const size_t ind = vCon[i];
+					if(vHandled[ind]) continue;
+					AtomicMin(vOwner[ind], pos);
+				}
+			}
 
-		//	if not handled
-			if(!vHandled[front])
+		//	count appended indices
+			#ifdef UG_OPENMP
+			#pragma omp parallel for schedule(dynamic, 64) if(levelSize > 1024)
+			#endif
+			for(int k = 0; k < levelSize; ++k)
 			{
-			//	Add to mapping
-				vNewOrder.push_back(front);
-				vHandled[front] = true;
+				const size_t pos = levelBegin + k;
+				const std::vector<size_t>& vCon = vvConnection[vNewOrder[pos]];
+				size_t cnt = 0;
+				for(size_t i = 0; i < vCon.size(); ++i)
+					if(!vHandled[vCon[i]] && vOwner[vCon[i]] == pos) ++cnt;
+				vCount[k+1] = cnt;
+			}
 
-			//	add adjacent to queue
-				for(size_t i = 0; i < vvConnection[front].size(); ++i)
-				{
-					const size_t ind = vvConnection[front][i];
+			vCount[0] = levelEnd;
+			for(int k = 0; k < levelSize; ++k)
+				vCount[k+1] += vCount[k];
+			vNewOrder.resize(vCount[levelSize]);
 
-					if(!vHandled[ind])
-						qAdjacent.push(ind);
+		//	append indices to mapping
+			#ifdef UG_OPENMP
+			#pragma omp parallel for schedule(dynamic, 64) if(levelSize > 1024)
+			#endif
+			for(int k = 0; k < levelSize; ++k)
+			{
+				const size_t pos = levelBegin + k;
+				const std::vector<size_t>& vCon = vvConnection[vNewOrder[pos]];
+				size_t next = vCount[k];
+				for(size_t i = 0; i < vCon.size(); ++i)
+				{
+					const size_t ind = vCon[i];
+					if(!vHandled[ind] && vOwner[ind] == pos)
+						vNewOrder[next++] = ind;
 				}
 			}
 
-		//	pop index
-			qAdjacent.pop();
+		//	mark appended indices as handled
+			const int numNew = (int)(vNewOrder.size() - levelEnd);
+			#ifdef UG_OPENMP
+			#pragma omp parallel for schedule(static) if(numNew > 1024)
+			#endif
+			for(int k = 0; k < numNew; ++k)
+				vHandled[vNewOrder[levelEnd + k]] = true;
+
+			levelBegin = levelEnd;
 		}
 	}
 
@@ -0,0 +1,195 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+
+#include <vector>
+#include <cstring>
+#include <cerrno>
+#include "hardware_counter.h"
+#include "common/log.h"
+#include "common/error.h"
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <sys/ioctl.h>
+#include <unistd.h>
+#endif
+
+namespace ug{
+
+bool g_bHardwareCountersEnabled = false;
+
+namespace{
+
+///	an opened event and the counter it contributes to
+struct HardwareEvent
+{
+	int fd;
+	int counter;
+	uint64 weight;
+};
+
+///	raw flop event added by AddHardwareFlopEvent
+struct FlopEvent
+{
+	int rawEvent;
+	int flopsPerEvent;
+};
+
+std::vector<HardwareEvent> s_vEvent;
+std::vector<FlopEvent> s_vFlopEvent;
+std::vector<uint64> s_vBuffer;
+bool s_bOpened = false;
+
+#ifdef __linux__
+int OpenPerfEvent(uint32 type, uint64 config, int groupFd)
+{
+	perf_event_attr attr;
+	memset(&attr, 0, sizeof(attr));
+	attr.size = sizeof(attr);
+	attr.type = type;
+	attr.config = config;
+//	the group is started explicitly by its leader
+	attr.disabled = (groupFd == -1) ? 1 : 0;
+	attr.exclude_kernel = 1;
+	attr.exclude_hv = 1;
+	attr.read_format = PERF_FORMAT_GROUP;
+	return (int)syscall(__NR_perf_event_open, &attr, 0, -1, groupFd, 0);
+}
+
+void AddPerfEvent(uint32 type, uint64 config, int counter, uint64 weight,
+                  const char* name)
+{
+	const int leader = s_vEvent.empty() ? -1 : s_vEvent[0].fd;
+	const int fd = OpenPerfEvent(type, config, leader);
+	if(fd == -1)
+	{
+		UG_LOG("WARNING: Hardware counter '" << name << "' not available ("
+				<< strerror(errno) << ").\n");
+		return;
+	}
+	HardwareEvent ev = {fd, counter, weight};
+	s_vEvent.push_back(ev);
+}
+
+bool OpenPerfEvents()
+{
+	AddPerfEvent(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES, HWC_CYCLES, 1,
+	             "cycles");
+	if(s_vEvent.empty())
+	{
+		UG_LOG("WARNING: Hardware counters can not be enabled. Check "
+				"/proc/sys/kernel/perf_event_paranoid.\n");
+		return false;
+	}
+	AddPerfEvent(PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS,
+	             HWC_INSTRUCTIONS, 1, "instructions");
+	AddPerfEvent(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES,
+	             HWC_LLC_MISSES, 1, "cache misses");
+	for(size_t i = 0; i < s_vFlopEvent.size(); ++i)
+		AddPerfEvent(PERF_TYPE_RAW, s_vFlopEvent[i].rawEvent, HWC_FLOPS,
+		             s_vFlopEvent[i].flopsPerEvent, "flops");
+	s_vBuffer.resize(1 + s_vEvent.size());
+	return true;
+}
+#endif
+
+} // end anonymous namespace
+
+bool EnableHardwareCounters(bool b)
+{
+#ifdef __linux__
+	if(!s_bOpened && b)
+	{
+		if(!OpenPerfEvents()) return false;
+		s_bOpened = true;
+	}
+	if(!s_bOpened) return false;
+
+	const int leader = s_vEvent[0].fd;
+	if(b) ioctl(leader, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+	else ioctl(leader, PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+	g_bHardwareCountersEnabled = b;
+	return b;
+#else
+	if(b) UG_LOG("WARNING: Hardware counters are only available on linux.\n");
+	return false;
+#endif
+}
+
+bool HasHardwareCounterData()
+{
+	return s_bOpened;
+}
+
+bool HasHardwareFlopCounter()
+{
+	for(size_t i = 0; i < s_vEvent.size(); ++i)
+		if(s_vEvent[i].counter == HWC_FLOPS) return true;
+	return false;
+}
+
+void AddHardwareFlopEvent(int rawEvent, int flopsPerEvent)
+{
+	UG_COND_THROW(s_bOpened, "AddHardwareFlopEvent: Flop events must be "
+	              "added before the hardware counters are enabled.");
+	FlopEvent ev = {rawEvent, flopsPerEvent};
+	s_vFlopEvent.push_back(ev);
+}
+
+size_t HardwareCounterCacheLineSize()
+{
+#if defined(__linux__) && defined(_SC_LEVEL3_CACHE_LINESIZE)
+	static const long size = sysconf(_SC_LEVEL3_CACHE_LINESIZE);
+	if(size > 0) return size;
+#endif
+	return 64;
+}
+
+void ReadHardwareCounters(uint64* values)
+{
+	for(int i = 0; i < HWC_NUM_COUNTERS; ++i) values[i] = 0;
+#ifdef __linux__
+	if(!s_bOpened) return;
+
+//	with PERF_FORMAT_GROUP, the leader returns the number of events followed
+//	by the values of all events of the group in the order they were opened
+	uint64* buffer = &s_vBuffer[0];
+	if(read(s_vEvent[0].fd, buffer, s_vBuffer.size() * sizeof(uint64)) <= 0)
+		return;
+
+	for(size_t i = 0; i < s_vEvent.size() && i < buffer[0]; ++i)
+		values[s_vEvent[i].counter] += s_vEvent[i].weight * buffer[1 + i];
+#endif
+}
+
+} // end namespace ug
@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+
+#ifndef __H__UG__COMMON__PROFILER__HARDWARE_COUNTER__
+#define __H__UG__COMMON__PROFILER__HARDWARE_COUNTER__
+
+#include <cstddef>
+#include "common/types.h"
+
+namespace ug{
+
+/**
+ * Hardware performance counters of the profiler
+ *
+ * If enabled with EnableHardwareCounters(true), the profiler reads the
+ * hardware counters of the cpu (via the linux perf_event_open interface)
+ * whenever a profile node is entered or left and accumulates the events of
+ * every node, just as it does with the ticks. The profile output then contains
+ * the instructions per cycle (IPC) and the memory traffic per flop of every
+ * node, which allows to distinguish memory-bound phases (e.g. matrix-vector
+ * products, smoothing) from compute-bound ones (e.g. assembling).
+ *
+ * The memory traffic is estimated by the last level cache misses times the
+ * cache line size. Since there is no portable flop event, the flops are only
+ * counted if raw events have been added with AddHardwareFlopEvent, e.g. on
+ * Intel cpus since Broadwell
+ * \code
+ * AddHardwareFlopEvent(0x01c7, 1) -- FP_ARITH_INST_RETIRED.SCALAR_DOUBLE
+ * AddHardwareFlopEvent(0x04c7, 2) -- FP_ARITH_INST_RETIRED.128B_PACKED_DOUBLE
+ * AddHardwareFlopEvent(0x10c7, 4) -- FP_ARITH_INST_RETIRED.256B_PACKED_DOUBLE
+ * EnableHardwareCounters(true)
+ * \endcode
+ * Otherwise, the traffic per instruction is printed instead.
+ *
+ * \note Only the events of the calling thread are counted, i.e. work done in
+ * OpenMP threads is not included.
+ * \note The counters may not be accessible for unprivileged users, depending
+ * on /proc/sys/kernel/perf_event_paranoid.
+ */
+enum HardwareCounter
+{
+	HWC_CYCLES = 0,
+	HWC_INSTRUCTIONS,
+	HWC_LLC_MISSES,
+	HWC_FLOPS,
+	HWC_NUM_COUNTERS
+};
+
+extern bool g_bHardwareCountersEnabled;
+
+/**
+ * Starts (b = true) or pauses (b = false) the counting of hardware events.
+ * @return true if the hardware counters are enabled afterwards
+ */
+bool EnableHardwareCounters(bool b);
+
+///	true if hardware events are currently counted
+inline bool IsHardwareCounterEnabled() {return g_bHardwareCountersEnabled;}
+
+///	true if hardware counters have been enabled at some time
+bool HasHardwareCounterData();
+
+///	true if flop events have been added
+bool HasHardwareFlopCounter();
+
+/**
+ * Adds a raw (i.e. cpu specific) event which is counted as flops. The counts
+ * of all flop events are multiplied by flopsPerEvent and summed up. Must be
+ * called before the hardware counters are enabled.
+ * @param rawEvent		raw event code (umask << 8 | event select)
+ * @param flopsPerEvent	number of flops per counted event
+ */
+void AddHardwareFlopEvent(int rawEvent, int flopsPerEvent);
+
+///	size of the cache lines in bytes used to estimate the memory traffic
+size_t HardwareCounterCacheLineSize();
+
+///	writes the current values of all hardware counters to values
+void ReadHardwareCounters(uint64* values);
+
+} // end namespace ug
+
+#endif /* __H__UG__COMMON__PROFILER__HARDWARE_COUNTER__ */
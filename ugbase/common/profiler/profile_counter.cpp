@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+
+#include <algorithm>
+#include <iomanip>
+#include <sstream>
+#include "profile_counter.h"
+
+namespace ug{
+
+ProfileCounter::ProfileCounter(const char* name, const ProfileCounter* pPer,
+                               const char* perName)
+	: m_name(name), m_pPer(pPer), m_perName(perName ? perName : ""), m_count(0)
+{
+	if(m_pPer != NULL && m_perName.empty()) m_perName = m_pPer->name();
+	counters().push_back(this);
+}
+
+ProfileCounter::~ProfileCounter()
+{
+	std::vector<ProfileCounter*>& vCounter = counters();
+	vCounter.erase(std::remove(vCounter.begin(), vCounter.end(), this),
+	               vCounter.end());
+}
+
+std::vector<ProfileCounter*>& ProfileCounter::counters()
+{
+	static std::vector<ProfileCounter*> vCounter;
+	return vCounter;
+}
+
+std::string ProfileCounter::summary()
+{
+	const std::vector<ProfileCounter*>& vCounter = counters();
+
+	bool bUsed = false;
+	for(size_t i = 0; i < vCounter.size(); ++i)
+		if(vCounter[i]->count() > 0) bUsed = true;
+	if(!bUsed) return std::string();
+
+	std::stringstream ss;
+	ss << "Profile counters:\n";
+	for(size_t i = 0; i < vCounter.size(); ++i)
+	{
+		const ProfileCounter& c = *vCounter[i];
+		ss << "  " << std::left << std::setw(40) << c.name()
+		   << std::right << std::setw(14) << c.count();
+		if(c.m_pPer != NULL && c.m_pPer->count() > 0)
+			ss << "  (" << (double)c.count() / (double)c.m_pPer->count()
+			   << " per " << c.m_perName << ")";
+		ss << "\n";
+	}
+	return ss.str();
+}
+
+void ProfileCounter::reset_all()
+{
+	std::vector<ProfileCounter*>& vCounter = counters();
+	for(size_t i = 0; i < vCounter.size(); ++i)
+		vCounter[i]->reset();
+}
+
+} // end namespace ug
@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+
+#ifndef __H__UG__COMMON__PROFILER__PROFILE_COUNTER__
+#define __H__UG__COMMON__PROFILER__PROFILE_COUNTER__
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace ug{
+
+/// named event counter printed together with the profiler output
+/**
+ * A ProfileCounter counts events that are not visible in a timing profile,
+ * e.g. heap allocations in a hot loop. All counters register themselves on
+ * construction and are listed by ProfileCounter::summary(), which is appended
+ * to the profiler output on exit (see UGOutputProfileStatsOnExit).
+ *
+ * If a reference counter is passed, the summary additionally prints the ratio
+ * of both counts, e.g. "allocations per assembled element".
+ *
+ * Counters are meant to be created as function-local statics:
+ * \code
+ * ProfileCounter& MyCounter()
+ * {
+ * 	static ProfileCounter counter("my events");
+ * 	return counter;
+ * }
+ * \endcode
+ */
+class ProfileCounter
+{
+	public:
+	///	constructor
+		ProfileCounter(const char* name, const ProfileCounter* pPer = NULL,
+		               const char* perName = NULL);
+
+	///	destructor
+		~ProfileCounter();
+
+	///	adds to the count
+		void add(size_t n = 1)
+		{
+#ifdef UG_OPENMP
+			#pragma omp atomic
+#endif
+			m_count += n;
+		}
+
+	///	returns the count
+		size_t count() const {return m_count;}
+
+	///	resets the count
+		void reset() {m_count = 0;}
+
+	///	returns the name
+		const std::string& name() const {return m_name;}
+
+	///	returns a table of all registered counters (empty if no counter used)
+		static std::string summary();
+
+	///	resets all registered counters
+		static void reset_all();
+
+	protected:
+	///	list of all registered counters
+		static std::vector<ProfileCounter*>& counters();
+
+	protected:
+		std::string m_name;
+		const ProfileCounter* m_pPer;
+		std::string m_perName;
+		size_t m_count;
+};
+
+} // end namespace ug
+
+///	adds n to a counter, compiled out (and counter not evaluated) without profiler
+/**
+ * Counting in hot loops should use this macro, such that production builds
+ * do not pay for the atomic update. Counts should be summed up locally (e.g.
+ * per element loop) and added once.
+ */
+#ifdef UG_PROFILER
+	#define PROFILE_COUNTER_ADD(counter, n)		(counter).add(n)
+#else
+	#define PROFILE_COUNTER_ADD(counter, n)		((void)0)
+#endif
+
+#endif /* __H__UG__COMMON__PROFILER__PROFILE_COUNTER__ */
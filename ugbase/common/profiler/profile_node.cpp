@@ -48,6 +48,7 @@
 #include "pcl/pcl_base.h"
 #include "common/error.h"
 #include "memtracker.h"
+#include "hardware_counter.h"
 
 #ifdef UG_PARALLEL
 #include "pcl/pcl.h"
@@ -144,6 +145,68 @@ string UGProfileNode::get_mem_info(double fullMem) const
 		return "";
 }
 
+double UGProfileNode::get_avg_self_hw_counter(int counter) const
+{
+	if(!valid()) return 0.0;
+	return data.selfHwCounters[counter].avg;
+}
+
+double UGProfileNode::get_avg_total_hw_counter(int counter) const
+{
+	if(!valid()) return 0.0;
+	return data.totalHwCounterAvg(counter);
+}
+
+double UGProfileNode::get_ipc() const
+{
+	const double cycles = get_avg_total_hw_counter(HWC_CYCLES);
+	if(cycles == 0.0) return 0.0;
+	return get_avg_total_hw_counter(HWC_INSTRUCTIONS) / cycles;
+}
+
+double UGProfileNode::get_mem_traffic() const
+{
+	return get_avg_total_hw_counter(HWC_LLC_MISSES) * HardwareCounterCacheLineSize();
+}
+
+double UGProfileNode::get_bytes_per_flop() const
+{
+	const double flops = get_avg_total_hw_counter(HWC_FLOPS);
+	if(flops == 0.0) return 0.0;
+	return get_mem_traffic() / flops;
+}
+
+double UGProfileNode::get_bytes_per_instruction() const
+{
+	const double instructions = get_avg_total_hw_counter(HWC_INSTRUCTIONS);
+	if(instructions == 0.0) return 0.0;
+	return get_mem_traffic() / instructions;
+}
+
+double UGProfileNode::get_mem_bandwidth() const
+{
+	const double time = get_avg_total_time() * Shiny::GetTickInvFreq();
+	if(time == 0.0) return 0.0;
+	return get_mem_traffic() / time * 1e-9;
+}
+
+string UGProfileNode::get_hw_counter_info() const
+{
+	if(HasHardwareCounterData())
+	{
+		stringstream s;
+		s << fixed << setprecision(2) << setw(6) << get_ipc() << "  ";
+		if(HasHardwareFlopCounter())
+			s << setw(8) << get_bytes_per_flop() << "  ";
+		else
+			s << setw(8) << get_bytes_per_instruction() << "  ";
+		s << setw(8) << get_mem_bandwidth() << "  ";
+		return s.str();
+	}
+	else
+		return "";
+}
+
 string UGProfileNode::call_tree(double dSkipMarginal) const
 {
 	if(!valid()) return "Profile Node not valid!";
@@ -244,6 +307,15 @@ void UGProfileNode::PDXML_rec_write(ostream &s) const
 		s << "<totalMemory>" << get_total_mem() << "</totalMemory>\n";
 		s << "<selfMemory>" << get_self_mem() << "</selfMemory>\n";
 	}
+
+	if(HasHardwareCounterData())
+	{
+		s << "<cycles>" << get_avg_total_hw_counter(HWC_CYCLES) << "</cycles>\n";
+		s << "<instructions>" << get_avg_total_hw_counter(HWC_INSTRUCTIONS) << "</instructions>\n";
+		s << "<llcMisses>" << get_avg_total_hw_counter(HWC_LLC_MISSES) << "</llcMisses>\n";
+		if(HasHardwareFlopCounter())
+			s << "<flops>" << get_avg_total_hw_counter(HWC_FLOPS) << "</flops>\n";
+	}
 			
 	for(const UGProfileNode *p=get_first_child(); p != NULL; p=p->get_next_sibling())
 	{
@@ -322,6 +394,7 @@ string UGProfileNode::print_node(double fullMs, double fullMem, size_t offset) c
 			right << setw(PROFILER_BRIDGE_OUTPUT_WIDTH_PERC) << floor(get_avg_total_time_ms() / fullMs * 100) << "%  ";
 	if(fullMem >= 0.0)
 		s << get_mem_info(fullMem);
+	s << get_hw_counter_info();
 	if(zone->groups != NULL)
 		s << zone->groups;
 	return s.str();
@@ -470,6 +543,12 @@ void UGProfileNode::log_header(stringstream &s, const char *name)
 		s << "  " << setw(10+5+3) << "self mem" << "   " <<
 				setw(10) << "total mem";
 	}
+	if(HasHardwareCounterData())
+	{
+		s << "  " << setw(6) << "IPC" << "  " <<
+				setw(8) << (HasHardwareFlopCounter() ? "B/flop" : "B/instr") << "  " <<
+				setw(8) << "GB/s";
+	}
 
 	s << "\n";
 }
@@ -970,6 +1049,41 @@ double UGProfileNode::get_self_mem() const
 {
 	return 0.0;
 }
+
+double UGProfileNode::get_avg_self_hw_counter(int counter) const
+{
+	return 0.0;
+}
+
+double UGProfileNode::get_avg_total_hw_counter(int counter) const
+{
+	return 0.0;
+}
+
+double UGProfileNode::get_ipc() const
+{
+	return 0.0;
+}
+
+double UGProfileNode::get_mem_traffic() const
+{
+	return 0.0;
+}
+
+double UGProfileNode::get_bytes_per_flop() const
+{
+	return 0.0;
+}
+
+double UGProfileNode::get_bytes_per_instruction() const
+{
+	return 0.0;
+}
+
+double UGProfileNode::get_mem_bandwidth() const
+{
+	return 0.0;
+}
 ///////////////////////////////////////////////////////////////////
 string UGProfileNode::call_tree(double dSkipMarginal) const
 {
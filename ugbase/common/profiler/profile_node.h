@@ -72,6 +72,27 @@ public:
 	double get_self_mem() const;
 	double get_total_mem() const;
 
+	/// \return number of events of a hardware counter (see HardwareCounter) in this node excluding subnodes
+	double get_avg_self_hw_counter(int counter) const;
+
+	/// \return number of events of a hardware counter (see HardwareCounter) in this node including subnodes
+	double get_avg_total_hw_counter(int counter) const;
+
+	/// \return instructions per cycle in this node including subnodes
+	double get_ipc() const;
+
+	/// \return estimated memory traffic in bytes (LLC misses times cache line size) in this node including subnodes
+	double get_mem_traffic() const;
+
+	/// \return memory traffic per flop in this node including subnodes (0 if no flop events are counted)
+	double get_bytes_per_flop() const;
+
+	/// \return memory traffic per instruction in this node including subnodes
+	double get_bytes_per_instruction() const;
+
+	/// \return estimated memory bandwidth in GB/s in this node including subnodes
+	double get_mem_bandwidth() const;
+
 	/**
 	 * @param dSkipMarginal 	nodes with full*dSkipMarginal > node->full[ms or mem] are skipped
 	 * @return call tree profile information
@@ -167,6 +188,11 @@ private:
 	 */
 	std::string get_mem_info(double fullMem) const;
 
+	/**
+	 * @brief prints the derived hardware counter metrics (IPC, memory traffic per flop, bandwidth) of a node
+	 */
+	std::string get_hw_counter_info() const;
+
 
 	/**
 	 * @brief recursive print this node and its subnodes into stringstream s
@@ -36,6 +36,7 @@ restrictions:
 #define SHINY_DATA_H
 
 #include "ShinyPrereqs.h"
+#include "common/profiler/hardware_counter.h"
 
 namespace Shiny {
 
@@ -45,6 +46,7 @@ namespace Shiny {
 	struct ProfileLastData {
 		uint32_t entryCount;
 		tick_t selfTicks;
+		uint64_t selfHwCounters[ug::HWC_NUM_COUNTERS];
 	};
 
 
@@ -70,26 +72,44 @@ namespace Shiny {
 		Data<tick_t> selfTicks;
 		Data<tick_t> childTicks;
 
+	//	hardware counters (see ug::EnableHardwareCounters), only updated for nodes
+		Data<uint64_t> selfHwCounters[ug::HWC_NUM_COUNTERS];
+		Data<uint64_t> childHwCounters[ug::HWC_NUM_COUNTERS];
+
 
 		tick_t totalTicksCur(void) const { return selfTicks.cur + childTicks.cur; }
 		float totalTicksAvg(void) const { return selfTicks.avg + childTicks.avg; }
 
+		float totalHwCounterAvg(int i) const { return selfHwCounters[i].avg + childHwCounters[i].avg; }
+
 		void computeAverage(float a_damping) {
 			entryCount.computeAverage(a_damping);
 			selfTicks.computeAverage(a_damping);
 			childTicks.computeAverage(a_damping);
+			for(int i = 0; i < ug::HWC_NUM_COUNTERS; ++i) {
+				selfHwCounters[i].computeAverage(a_damping);
+				childHwCounters[i].computeAverage(a_damping);
+			}
 		}
 
 		void clearAll(void) {
 			entryCount.clear();
 			selfTicks.clear();
 			childTicks.clear();
+			for(int i = 0; i < ug::HWC_NUM_COUNTERS; ++i) {
+				selfHwCounters[i].clear();
+				childHwCounters[i].clear();
+			}
 		}
 
 		void clearCurrent(void) {
 			entryCount.cur = 0;
 			selfTicks.cur = 0;
 			childTicks.cur = 0;
+			for(int i = 0; i < ug::HWC_NUM_COUNTERS; ++i) {
+				selfHwCounters[i].cur = 0;
+				childHwCounters[i].cur = 0;
+			}
 		}
 	};
 
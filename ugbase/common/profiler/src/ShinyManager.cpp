@@ -77,7 +77,8 @@ namespace Shiny {
 			/* data = */ { { 0, 0 }, { 0, 0 }, { 0, 0 } }
 		},
 		/* _initialized = */ false,
-		/* _firstUpdate = */ true
+		/* _firstUpdate = */ true,
+		/* _lastHwCounters = */ { 0 }
 	};
 
 	ProfileNode* ProfileManager::_dummyNodeTable[] = { NULL };
@@ -136,6 +137,21 @@ namespace Shiny {
 	}
 
 
+//-----------------------------------------------------------------------------
+
+	void ProfileManager::_appendHwCountersToCurNode(void) {
+		uint64_t curHwCounters[ug::HWC_NUM_COUNTERS];
+		ug::ReadHardwareCounters(curHwCounters);
+
+		for(int i = 0; i < ug::HWC_NUM_COUNTERS; ++i) {
+			const uint64_t last = _lastHwCounters[i];
+			_lastHwCounters[i] = curHwCounters[i];
+			curHwCounters[i] -= last;
+		}
+		_curNode->appendHwCounters(curHwCounters);
+	}
+
+
 //-----------------------------------------------------------------------------
 
 	void ProfileManager::update(float a_damping) {
@@ -76,6 +76,8 @@ namespace Shiny {
 		bool _initialized;
 		bool _firstUpdate;
 
+		uint64_t _lastHwCounters[ug::HWC_NUM_COUNTERS];
+
 		static ProfileNode* _dummyNodeTable[];
 
 		static ProfileManager instance;
@@ -88,8 +90,12 @@ namespace Shiny {
 
 			_curNode->appendTicks(curTick - _lastTick);
 			_lastTick = curTick;
+
+			if(ug::IsHardwareCounterEnabled()) _appendHwCountersToCurNode();
 		}
 
+		void _appendHwCountersToCurNode(void);
+
 		ProfileNode* _lookupNode(ProfileNodeCache* a_cache, ProfileZone* a_zone);
 
 		void _createNodeTable(uint32_t a_count);
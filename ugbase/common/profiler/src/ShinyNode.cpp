@@ -55,6 +55,12 @@ namespace Shiny {
 		_last.selfTicks = 0;
 		_last.entryCount = 0;
 
+		for(int i = 0; i < ug::HWC_NUM_COUNTERS; ++i) {
+			data.selfHwCounters[i].cur = _last.selfHwCounters[i];
+			data.childHwCounters[i].cur = 0;
+			_last.selfHwCounters[i] = 0;
+		}
+
 		if (!zone->isUpdating()) {
 
 			zone->enableUpdating();
@@ -70,7 +76,11 @@ namespace Shiny {
 
 		data.computeAverage(a_damping);
 
-		if (!isRoot()) parent->data.childTicks.cur += data.selfTicks.cur + data.childTicks.cur;
+		if (!isRoot()) {
+			parent->data.childTicks.cur += data.selfTicks.cur + data.childTicks.cur;
+			for(int i = 0; i < ug::HWC_NUM_COUNTERS; ++i)
+				parent->data.childHwCounters[i].cur += data.selfHwCounters[i].cur + data.childHwCounters[i].cur;
+		}
 		if (nextSibling) nextSibling->updateTree(a_damping);
 	}
 
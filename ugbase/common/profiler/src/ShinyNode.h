@@ -89,6 +89,10 @@ namespace Shiny {
 		SHINY_INLINE void appendTicks(tick_t a_elapsedTicks) { _last.selfTicks += a_elapsedTicks; }
 		SHINY_INLINE void beginEntry(void) { _last.entryCount++; }
 
+		SHINY_INLINE void appendHwCounters(const uint64_t* a_elapsed) {
+			for(int i = 0; i < ug::HWC_NUM_COUNTERS; ++i) _last.selfHwCounters[i] += a_elapsed[i];
+		}
+
 		bool isRoot(void) const { return (entryLevel == 0); }
 		bool isDummy(void) const { return (this == &_dummy); }
 
@@ -0,0 +1,226 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+
+#include "async_output_queue.h"
+
+#include <exception>
+
+#include "common/error.h"
+#include "common/log.h"
+#include "common/profiler/profiler.h"
+
+namespace ug{
+
+AsyncOutputQueue& AsyncOutputQueue::inst()
+{
+	static AsyncOutputQueue queue;
+	return queue;
+}
+
+AsyncOutputQueue::AsyncOutputQueue()
+	: m_maxMemory(size_t(1) << 30)
+#ifdef UG_POSIX
+	  , m_memory(0), m_bBusy(false), m_bStop(false), m_bThreadStarted(false)
+#endif
+{
+#ifdef UG_POSIX
+	pthread_mutex_init(&m_mutex, NULL);
+	pthread_cond_init(&m_condJob, NULL);
+	pthread_cond_init(&m_condDone, NULL);
+#endif
+}
+
+AsyncOutputQueue::~AsyncOutputQueue()
+{
+#ifdef UG_POSIX
+//	write all pending jobs and stop the writer thread
+	if(m_bThreadStarted)
+	{
+		pthread_mutex_lock(&m_mutex);
+		m_bStop = true;
+		pthread_cond_broadcast(&m_condJob);
+		pthread_mutex_unlock(&m_mutex);
+		pthread_join(m_thread, NULL);
+	}
+	if(!m_error.empty())
+		UG_LOG("ERROR in AsyncOutputQueue: " << m_error << "\n");
+
+	pthread_cond_destroy(&m_condDone);
+	pthread_cond_destroy(&m_condJob);
+	pthread_mutex_destroy(&m_mutex);
+#endif
+}
+
+void AsyncOutputQueue::set_memory_limit(size_t bytes)
+{
+	m_maxMemory = bytes;
+}
+
+std::string AsyncOutputQueue::execute(AsyncOutputJob* job)
+{
+	std::string error;
+	try{
+		job->run();
+	}
+	catch(UGError& err){
+		error = err.get_msg();
+	}
+	catch(std::exception& ex){
+		error = ex.what();
+	}
+	delete job;
+	return error;
+}
+
+void AsyncOutputQueue::throw_error()
+{
+#ifdef UG_POSIX
+	std::string error;
+	pthread_mutex_lock(&m_mutex);
+	error.swap(m_error);
+	pthread_mutex_unlock(&m_mutex);
+
+	if(!error.empty())
+		UG_THROW("AsyncOutputQueue: Asynchronous output failed: " << error);
+#endif
+}
+
+void AsyncOutputQueue::push(AsyncOutputJob* job)
+{
+	PROFILE_FUNC();
+#ifdef UG_POSIX
+	throw_error();
+
+	const size_t mem = job->memory();
+
+	pthread_mutex_lock(&m_mutex);
+	if(!m_bThreadStarted)
+	{
+		if(pthread_create(&m_thread, NULL, worker, this) != 0)
+		{
+			pthread_mutex_unlock(&m_mutex);
+			delete job;
+			UG_THROW("AsyncOutputQueue: Cannot create writer thread.");
+		}
+		m_bThreadStarted = true;
+	}
+
+//	bound the buffered memory
+	while(m_memory > 0 && m_memory + mem > m_maxMemory)
+		pthread_cond_wait(&m_condDone, &m_mutex);
+
+	m_queue.push_back(job);
+	m_memory += mem;
+	pthread_cond_signal(&m_condJob);
+	pthread_mutex_unlock(&m_mutex);
+#else
+	const std::string error = execute(job);
+	if(!error.empty())
+		UG_THROW("AsyncOutputQueue: Output failed: " << error);
+#endif
+}
+
+void AsyncOutputQueue::wait()
+{
+	PROFILE_FUNC();
+#ifdef UG_POSIX
+	pthread_mutex_lock(&m_mutex);
+	while(!m_queue.empty() || m_bBusy)
+		pthread_cond_wait(&m_condDone, &m_mutex);
+	pthread_mutex_unlock(&m_mutex);
+
+	throw_error();
+#endif
+}
+
+size_t AsyncOutputQueue::num_pending()
+{
+#ifdef UG_POSIX
+	pthread_mutex_lock(&m_mutex);
+	const size_t num = m_queue.size() + (m_bBusy ? 1 : 0);
+	pthread_mutex_unlock(&m_mutex);
+	return num;
+#else
+	return 0;
+#endif
+}
+
+#ifdef UG_POSIX
+void* AsyncOutputQueue::worker(void* pQueue)
+{
+	static_cast<AsyncOutputQueue*>(pQueue)->run_worker();
+	return NULL;
+}
+
+void AsyncOutputQueue::run_worker()
+{
+	pthread_mutex_lock(&m_mutex);
+	while(true)
+	{
+		while(m_queue.empty() && !m_bStop)
+			pthread_cond_wait(&m_condJob, &m_mutex);
+
+		if(m_queue.empty()) break;
+
+		AsyncOutputJob* job = m_queue.front();
+		m_queue.pop_front();
+		const size_t mem = job->memory();
+		m_bBusy = true;
+		pthread_mutex_unlock(&m_mutex);
+
+		const std::string error = execute(job);
+
+		pthread_mutex_lock(&m_mutex);
+		m_bBusy = false;
+		m_memory -= mem;
+		if(!error.empty())
+		{
+			if(!m_error.empty()) m_error.append("\n");
+			m_error.append(error);
+		}
+		pthread_cond_broadcast(&m_condDone);
+	}
+	pthread_mutex_unlock(&m_mutex);
+}
+#endif
+
+void WaitForAsyncOutput()
+{
+	AsyncOutputQueue::inst().wait();
+}
+
+void SetAsyncOutputMemoryLimit(size_t megaBytes)
+{
+	AsyncOutputQueue::inst().set_memory_limit(megaBytes << 20);
+}
+
+} // end namespace ug
@@ -0,0 +1,137 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+
+#ifndef __H__UG__COMMON__UTIL__ASYNC_OUTPUT_QUEUE__
+#define __H__UG__COMMON__UTIL__ASYNC_OUTPUT_QUEUE__
+
+#include <deque>
+#include <string>
+
+#ifdef UG_POSIX
+#include <pthread.h>
+#endif
+
+namespace ug{
+
+/// \addtogroup ugbase_common_util
+/// \{
+
+///	a job writing output, e.g. encoding buffered data and writing it to a file
+class AsyncOutputJob
+{
+	public:
+		virtual ~AsyncOutputJob() {}
+
+	///	performs the output (may throw)
+		virtual void run() = 0;
+
+	///	returns the number of bytes buffered by the job
+		virtual size_t memory() const = 0;
+};
+
+///	executes output jobs on a background thread
+/**
+ * Jobs passed to push() are executed in the order of their submission by a
+ * writer thread, such that the computation proceeds while the data is written.
+ * The queue takes ownership of the jobs. The memory buffered by the pending jobs
+ * is bounded: push() blocks while the memory of the pending jobs exceeds the
+ * limit (a single job larger than the limit is accepted if the queue is empty).
+ *
+ * wait() blocks until all pending jobs are written. Errors raised by a job are
+ * thrown by the next call of push() or wait(). At exit, all pending jobs are
+ * written.
+ *
+ * If the build has no POSIX threads, jobs are executed directly in push().
+ */
+class AsyncOutputQueue
+{
+	public:
+	///	returns the queue
+		static AsyncOutputQueue& inst();
+
+	///	sets the maximal number of bytes buffered by pending jobs
+		void set_memory_limit(size_t bytes);
+
+	///	adds a job to the queue (the queue takes ownership)
+		void push(AsyncOutputJob* job);
+
+	///	waits until all pending jobs are written
+		void wait();
+
+	///	returns the number of pending jobs
+		size_t num_pending();
+
+	private:
+		AsyncOutputQueue();
+		~AsyncOutputQueue();
+		AsyncOutputQueue(const AsyncOutputQueue&);
+		AsyncOutputQueue& operator=(const AsyncOutputQueue&);
+
+	///	executes a job and deletes it, returns an error message
+		static std::string execute(AsyncOutputJob* job);
+
+	///	throws a stored error message
+		void throw_error();
+
+	private:
+		size_t m_maxMemory;
+
+#ifdef UG_POSIX
+		static void* worker(void* pQueue);
+		void run_worker();
+
+		std::deque<AsyncOutputJob*> m_queue;
+		size_t m_memory;
+		bool m_bBusy;
+		bool m_bStop;
+		bool m_bThreadStarted;
+		std::string m_error;
+
+		pthread_t m_thread;
+		pthread_mutex_t m_mutex;
+		pthread_cond_t m_condJob;
+		pthread_cond_t m_condDone;
+#endif
+};
+
+///	waits until all pending asynchronous output is written
+void WaitForAsyncOutput();
+
+///	sets the maximal memory buffered by pending asynchronous output (in MiB)
+void SetAsyncOutputMemoryLimit(size_t megaBytes);
+
+// end group ugbase_common_util
+/// \}
+
+} // end namespace ug
+
+#endif /* __H__UG__COMMON__UTIL__ASYNC_OUTPUT_QUEUE__ */
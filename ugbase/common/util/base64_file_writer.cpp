@@ -32,6 +32,9 @@
 
 #include "common/util/base64_file_writer.h"
 
+#include <algorithm>
+#include <iterator>
+
 // for base64 encoding with boost
 #include <boost/archive/iterators/transform_width.hpp>
 #include <boost/archive/iterators/base64_from_binary.hpp>
@@ -309,6 +312,56 @@ void Base64FileWriter::flushInputBuffer(bool force)
 	}
 }
 
+void EncodeBase64(std::string& out, const char* data, size_t len)
+{
+	// full triplets are encoded directly, the rest is padded with zeros since
+	// boost reads up to the triplet boundary
+	const size_t lenFull = len - len % 3;
+	std::copy(base64_text(data), base64_text(data + lenFull),
+			  std::back_inserter(out));
+
+	const size_t rest = len - lenFull;
+	if (rest > 0) {
+		char tmp[3] = {0, 0, 0};
+		std::copy(data + lenFull, data + len, tmp);
+		std::copy(base64_text(tmp), base64_text(tmp + rest),
+				  std::back_inserter(out));
+		out.append(3 - rest, '=');
+	}
+}
+
+/// returns the value of a base64 character or -1 for other characters
+static inline int Base64Value(char c)
+{
+	if (c >= 'A' && c <= 'Z') return c - 'A';
+	if (c >= 'a' && c <= 'z') return c - 'a' + 26;
+	if (c >= '0' && c <= '9') return c - '0' + 52;
+	if (c == '+') return 62;
+	if (c == '/') return 63;
+	return -1;
+}
+
+void DecodeBase64(std::vector<char>& out, const char* data, size_t len)
+{
+	out.clear();
+	out.reserve(len / 4 * 3);
+
+	unsigned int buffer = 0;
+	int numBits = 0;
+	for (size_t i = 0; i < len; ++i) {
+		const int value = Base64Value(data[i]);
+		if (value < 0)
+			continue;
+
+		buffer = (buffer << 6) | (unsigned int) value;
+		numBits += 6;
+		if (numBits >= 8) {
+			numBits -= 8;
+			out.push_back((char) ((buffer >> numBits) & 0xFF));
+		}
+	}
+}
+
 void Base64FileWriter::close()
 {
 	PROFILE_FUNC();
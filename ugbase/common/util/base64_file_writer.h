@@ -35,6 +35,7 @@
 
 #include <sstream>
 #include <fstream>
+#include <string>
 #include <vector>
 
 namespace ug {
@@ -192,6 +193,24 @@ private:
 	inline void assertFileOpen();
 };
 
+/**
+ * \brief Appends the base64 encoding of the given data including padding to \c out
+ * \param[out] out  string to which the encoded data is appended
+ * \param[in]  data binary data
+ * \param[in]  len  number of bytes
+ */
+void EncodeBase64(std::string& out, const char* data, size_t len);
+
+/**
+ * \brief Decodes base64 encoded data into \c out
+ * \details Characters outside of the base64 alphabet (whitespace and padding)
+ *   are ignored.
+ * \param[out] out  decoded binary data (previous content is discarded)
+ * \param[in]  data base64 encoded characters
+ * \param[in]  len  number of characters
+ */
+void DecodeBase64(std::vector<char>& out, const char* data, size_t len);
+
 // end group ugbase_common_io
 
 } // namespace: ug
@@ -0,0 +1,168 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+
+#ifndef __H__UG__COMMON__UTIL__PER_THREAD__
+#define __H__UG__COMMON__UTIL__PER_THREAD__
+
+#ifdef UG_OPENMP
+#include <omp.h>
+#endif
+
+#include "common/error.h"
+
+namespace ug{
+
+/// \addtogroup ugbase_common_util
+/// \{
+
+///	maximal number of threads that may access a PerThread object
+const int PER_THREAD_MAX_THREADS = 256;
+
+///	holds an instance of a type for each OpenMP thread
+/**
+ * This class holds an own instance of T for each thread that accesses it. It
+ * is used for the per-element state of objects that are shared by several
+ * threads, e.g. the ip series and values of user data during thread-parallel
+ * assembling. The master thread (and every caller outside of a parallel
+ * region) uses the instance constructed together with the PerThread object,
+ * the instances of the other threads are default-constructed on their first
+ * access. Thus, state set up by the master thread is not seen by the other
+ * threads.
+ *
+ * If ug4 is compiled without OpenMP, the class simply wraps an instance of T.
+ *
+ * \tparam	T	type of the per-thread instances (default constructible)
+ */
+template <typename T>
+class PerThread
+{
+	public:
+	///	constructor
+		PerThread() : m_inst()
+#ifdef UG_OPENMP
+			, m_ppInst(NULL)
+#endif
+		{}
+
+	///	copy constructor (copies the instance of the calling thread)
+		PerThread(const PerThread& other) : m_inst(other.get())
+#ifdef UG_OPENMP
+			, m_ppInst(NULL)
+#endif
+		{}
+
+	///	assignment (assigns the instance of the calling thread)
+		PerThread& operator=(const PerThread& other)
+		{
+			if(this != &other) get() = other.get();
+			return *this;
+		}
+
+	///	destructor
+		~PerThread()
+		{
+#ifdef UG_OPENMP
+			if(m_ppInst == NULL) return;
+			for(int t = 1; t < PER_THREAD_MAX_THREADS; ++t)
+				delete m_ppInst[t];
+			delete[] m_ppInst;
+#endif
+		}
+
+	///	returns the instance of the calling thread
+		T& get()
+		{
+#ifdef UG_OPENMP
+			const int t = omp_get_thread_num();
+			if(t != 0) return thread_instance(t);
+#endif
+			return m_inst;
+		}
+
+	///	returns the instance of the calling thread
+		const T& get() const {return const_cast<PerThread*>(this)->get();}
+
+	///	access to the instance of the calling thread
+	/// \{
+		T& operator*() {return get();}
+		const T& operator*() const {return get();}
+		T* operator->() {return &get();}
+		const T* operator->() const {return &get();}
+	/// \}
+
+	protected:
+#ifdef UG_OPENMP
+	///	returns the instance of a non-master thread, creates it if needed
+		T& thread_instance(const int t)
+		{
+			UG_COND_THROW(t >= PER_THREAD_MAX_THREADS, "PerThread: at most "
+						<<PER_THREAD_MAX_THREADS<<" threads supported.");
+
+		//	the pointer array is created by the first non-master thread
+			T** ppInst;
+			#pragma omp atomic read
+			ppInst = m_ppInst;
+			if(ppInst == NULL)
+			{
+				#pragma omp critical (PerThreadAlloc)
+				{
+					ppInst = m_ppInst;
+					if(ppInst == NULL)
+					{
+						ppInst = new T*[PER_THREAD_MAX_THREADS]();
+						#pragma omp atomic write
+						m_ppInst = ppInst;
+					}
+				}
+			}
+
+		//	each slot is only written by its own thread
+			if(ppInst[t] == NULL) ppInst[t] = new T();
+			return *ppInst[t];
+		}
+#endif
+
+	protected:
+	///	instance of the master thread
+		T m_inst;
+
+#ifdef UG_OPENMP
+	///	instances of the other threads (slot 0 unused)
+		T** m_ppInst;
+#endif
+};
+
+/// \}
+
+} // end namespace ug
+
+#endif /* __H__UG__COMMON__UTIL__PER_THREAD__ */
@@ -326,6 +326,7 @@ public:
 		// Convert layouts (vector->slice)
 		replace_indices_in_layout(type, slice_layouts->master());
 		replace_indices_in_layout(type, slice_layouts->slave());
+		slice_layouts->layouts_changed();
 
 		UG_DLOG(SchurDebug, 3, "BEFORE:")
 		UG_DLOG(SchurDebug, 3, *fullLayouts);
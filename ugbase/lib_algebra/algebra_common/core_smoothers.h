@@ -34,6 +34,10 @@
 #define __H__UG__CPU_ALGEBRA__CORE_SMOOTHERS__
 ////////////////////////////////////////////////////////////////////////////////////////////////
 
+#include <vector>
+#include "common/error.h"
+#include "level_schedule.h"
+
 namespace ug
 {
 
@@ -200,6 +204,186 @@ void sgs_step(const Matrix_type &A, Vector_type &c, const Vector_type &d, const
 	gs_step_UR(A, c, c, relaxFactor);
 }
 
+/////////////////////////////////////////////////////////////////////////////////////////////
+//	gs_step_LL (level-scheduled)
+/**
+ * \brief Performs a forward gauss-seidel-step using a level schedule.
+ * The result coincides with gs_step_LL. The rows of each level of the lower
+ * triangular part do not depend on each other and are processed concurrently
+ * if ug4 is compiled with OPENMP.
+ *
+ * \param A		Matrix \f$A = D - L - U\f$
+ * \param c		Vector. \f$ c = N * d = (D-L)^{-1} * d \f$
+ * \param d		Vector d.
+ * \param sched	level schedule of A
+ * \sa gs_step_LL, TriangularLevelSchedule
+ */
+template<typename Matrix_type, typename Vector_type>
+void gs_step_LL(const Matrix_type &A, Vector_type &c, const Vector_type &d,
+                const number relaxFactor, const TriangularLevelSchedule& sched)
+{
+	UG_ASSERT(sched.valid(A), "Level schedule does not match matrix.");
+
+//	exceptions must not leave the parallel region, they are rethrown below
+	std::vector<UGError> vErr;
+
+#ifdef UG_OPENMP
+	#pragma omp parallel
+#endif
+	{
+		typename Vector_type::value_type s;
+		for(size_t l = 0; l < sched.num_lower_levels(); ++l)
+		{
+			const int kBegin = (int) sched.lower_level_begin(l);
+			const int kEnd = (int) sched.lower_level_end(l);
+
+#ifdef UG_OPENMP
+			#pragma omp for schedule(static)
+#endif
+			for(int k = kBegin; k < kEnd; ++k)
+			{
+				const size_t i = sched.lower_row(k);
+				try{
+					s = d[i];
+
+					for(typename Matrix_type::const_row_iterator it = A.begin_row(i); it != A.end_row(i)
+					&& it.index() < i; ++it)
+						// s -= it.value() * c[it.index()];
+						MatMultAdd(s, 1.0, s, -1.0, it.value(), c[it.index()]);
+
+					// c[i] = relaxFactor * s/A(i,i)
+					InverseMatMult(c[i], relaxFactor, A(i,i), s);
+				}
+				catch(UGError& err)
+				{
+					#pragma omp critical (LevelScheduleError)
+					vErr.push_back(err);
+				}
+				catch(const std::exception& ex)
+				{
+					#pragma omp critical (LevelScheduleError)
+					vErr.push_back(UGError("Exception in row", ex, __FILE__, __LINE__));
+				}
+			}
+		}
+	}
+
+	if(!vErr.empty()){
+		vErr[0].push_msg("gs_step_LL: Cannot perform step using the level schedule.", __FILE__, __LINE__);
+		throw vErr[0];
+	}
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+//	gs_step_UR (level-scheduled)
+/**
+ * \brief Performs a backward gauss-seidel-step using a level schedule.
+ * The result coincides with gs_step_UR. The rows of each level of the upper
+ * triangular part do not depend on each other and are processed concurrently
+ * if ug4 is compiled with OPENMP.
+ *
+ * \param A		Matrix \f$A = D - L - U\f$
+ * \param c		will be \f$c = N * d = (D-U)^{-1} * d \f$
+ * \param d		the vector d.
+ * \param sched	level schedule of A
+ * \sa gs_step_UR, TriangularLevelSchedule
+ */
+template<typename Matrix_type, typename Vector_type>
+void gs_step_UR(const Matrix_type &A, Vector_type &c, const Vector_type &d,
+                const number relaxFactor, const TriangularLevelSchedule& sched)
+{
+	UG_ASSERT(sched.valid(A), "Level schedule does not match matrix.");
+
+//	exceptions must not leave the parallel region, they are rethrown below
+	std::vector<UGError> vErr;
+
+#ifdef UG_OPENMP
+	#pragma omp parallel
+#endif
+	{
+		typename Vector_type::value_type s;
+		for(size_t l = 0; l < sched.num_upper_levels(); ++l)
+		{
+			const int kBegin = (int) sched.upper_level_begin(l);
+			const int kEnd = (int) sched.upper_level_end(l);
+
+#ifdef UG_OPENMP
+			#pragma omp for schedule(static)
+#endif
+			for(int k = kBegin; k < kEnd; ++k)
+			{
+				const size_t i = sched.upper_row(k);
+				try{
+					s = d[i];
+					typename Matrix_type::const_row_iterator diag = A.get_connection(i, i);
+
+					typename Matrix_type::const_row_iterator it = diag; ++it;
+					for(; it != A.end_row(i); ++it)
+						// s -= it.value() * x[it.index()];
+						MatMultAdd(s, 1.0, s, -1.0, it.value(), c[it.index()]);
+
+					// c[i] = relaxFactor * s/A(i,i)
+					InverseMatMult(c[i], relaxFactor, diag.value(), s);
+				}
+				catch(UGError& err)
+				{
+					#pragma omp critical (LevelScheduleError)
+					vErr.push_back(err);
+				}
+				catch(const std::exception& ex)
+				{
+					#pragma omp critical (LevelScheduleError)
+					vErr.push_back(UGError("Exception in row", ex, __FILE__, __LINE__));
+				}
+			}
+		}
+	}
+
+	if(!vErr.empty()){
+		vErr[0].push_msg("gs_step_UR: Cannot perform step using the level schedule.", __FILE__, __LINE__);
+		throw vErr[0];
+	}
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+//	sgs_step (level-scheduled)
+/**
+ * \brief Performs a symmetric gauss-seidel step using a level schedule.
+ * The result coincides with sgs_step.
+ *
+ * \param A		Matrix \f$A = D - L - R\f$
+ * \param c		will be \f$c = N * d = (D-U)^{-1} D (D-L)^{-1} d \f$
+ * \param d		the vector d.
+ * \param sched	level schedule of A
+ * \sa sgs_step, TriangularLevelSchedule
+ */
+template<typename Matrix_type, typename Vector_type>
+void sgs_step(const Matrix_type &A, Vector_type &c, const Vector_type &d,
+              const number relaxFactor, const TriangularLevelSchedule& sched)
+{
+	// c1 = (D-L)^{-1} d
+	gs_step_LL(A, c, d, relaxFactor, sched);
+
+	// c2 = D c1
+#ifdef UG_OPENMP
+	#pragma omp parallel
+#endif
+	{
+		typename Vector_type::value_type s;
+#ifdef UG_OPENMP
+		#pragma omp for schedule(static)
+#endif
+		for(int i = 0; i < (int) c.size(); i++)
+		{
+			s=c[i];
+			MatMult(c[i], 1.0, A(i, i), s);
+		}
+	}
+
+	// c3 = (D-U)^{-1} c2
+	gs_step_UR(A, c, c, relaxFactor, sched);
+}
+
 /////////////////////////////////////////////////////////////////////////////////////////////
 //	diag_step
 /**
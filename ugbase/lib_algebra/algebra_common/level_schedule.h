@@ -0,0 +1,175 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+
+#ifndef __H__UG__LIB_ALGEBRA__ALGEBRA_COMMON__LEVEL_SCHEDULE__
+#define __H__UG__LIB_ALGEBRA__ALGEBRA_COMMON__LEVEL_SCHEDULE__
+
+#include <vector>
+#include <algorithm>
+#include "common/profiler/profiler.h"
+
+namespace ug{
+
+/// \addtogroup lib_algebra
+///	@{
+
+///	level sets of the triangular parts of a sparse matrix
+/**
+ * For the solution with the lower (upper) triangular part of a matrix, a row
+ * i depends on all rows j < i (j > i) it is connected to. The level of a row
+ * is the length of the longest chain of such dependencies, i.e. all rows of
+ * a level only depend on rows of smaller levels. Thus, all rows of one level
+ * can be processed concurrently, if the levels are processed in order.
+ *
+ * The schedule only depends on the sparsity pattern and is computed once
+ * (e.g. in the preprocess of a preconditioner) and reused for every solve.
+ * The rows of every level are stored in ascending order.
+ */
+class TriangularLevelSchedule
+{
+	public:
+	///	constructor
+		TriangularLevelSchedule() : m_numRows(0), m_numConn(0) {}
+
+	///	computes the level sets of the lower and upper triangular part
+		template <typename TMatrix>
+		void init(const TMatrix& A)
+		{
+			PROFILE_FUNC_GROUP("algebra");
+			typedef typename TMatrix::const_row_iterator const_row_iterator;
+
+			m_numRows = A.num_rows();
+			m_numConn = A.total_num_connections();
+			std::vector<size_t> vLevel(m_numRows, 0);
+
+		//	lower triangular part: rows depend on smaller indices
+			for(size_t i = 0; i < m_numRows; ++i)
+			{
+				size_t level = 0;
+				for(const_row_iterator it = A.begin_row(i); it != A.end_row(i); ++it)
+					if(it.index() < i) level = std::max(level, vLevel[it.index()] + 1);
+				vLevel[i] = level;
+			}
+			sort_by_level(m_vLowerRow, m_vLowerLevelStart, vLevel);
+
+		//	upper triangular part: rows depend on larger indices
+			for(size_t i = m_numRows; i-- != 0; )
+			{
+				size_t level = 0;
+				for(const_row_iterator it = A.begin_row(i); it != A.end_row(i); ++it)
+					if(it.index() > i) level = std::max(level, vLevel[it.index()] + 1);
+				vLevel[i] = level;
+			}
+			sort_by_level(m_vUpperRow, m_vUpperLevelStart, vLevel);
+		}
+
+	///	forgets the schedule
+		void clear()
+		{
+			m_numRows = 0;
+			m_numConn = 0;
+			m_vLowerRow.clear(); m_vLowerLevelStart.clear();
+			m_vUpperRow.clear(); m_vUpperLevelStart.clear();
+		}
+
+	///	returns if the schedule has been computed for the pattern of a matrix
+	/**	The pattern is compared by the number of rows and connections, i.e.
+	 * the schedule must be recomputed if the pattern of a matrix changes.*/
+		template <typename TMatrix>
+		bool valid(const TMatrix& A) const
+		{
+			return m_numRows == A.num_rows()
+					&& m_numConn == A.total_num_connections()
+					&& m_vLowerLevelStart.size() > 0
+					&& m_vUpperLevelStart.size() > 0;
+		}
+
+	///	number of rows
+		size_t num_rows() const {return m_numRows;}
+
+	///	levels of lower triangular part
+	///	\{
+		size_t num_lower_levels() const {return m_vLowerLevelStart.size() - 1;}
+		size_t lower_level_begin(size_t l) const {return m_vLowerLevelStart[l];}
+		size_t lower_level_end(size_t l) const {return m_vLowerLevelStart[l+1];}
+		size_t lower_row(size_t k) const {return m_vLowerRow[k];}
+	///	\}
+
+	///	levels of upper triangular part
+	///	\{
+		size_t num_upper_levels() const {return m_vUpperLevelStart.size() - 1;}
+		size_t upper_level_begin(size_t l) const {return m_vUpperLevelStart[l];}
+		size_t upper_level_end(size_t l) const {return m_vUpperLevelStart[l+1];}
+		size_t upper_row(size_t k) const {return m_vUpperRow[k];}
+	///	\}
+
+	protected:
+	///	sorts the rows by level (counting sort, stable)
+		static void sort_by_level(std::vector<size_t>& vRow,
+		                          std::vector<size_t>& vLevelStart,
+		                          const std::vector<size_t>& vLevel)
+		{
+			size_t numLevel = 0;
+			for(size_t i = 0; i < vLevel.size(); ++i)
+				numLevel = std::max(numLevel, vLevel[i] + 1);
+
+			vLevelStart.assign(numLevel + 1, 0);
+			for(size_t i = 0; i < vLevel.size(); ++i)
+				++vLevelStart[vLevel[i] + 1];
+			for(size_t l = 0; l < numLevel; ++l)
+				vLevelStart[l+1] += vLevelStart[l];
+
+			std::vector<size_t> vPos(vLevelStart.begin(), vLevelStart.end() - 1);
+			vRow.resize(vLevel.size());
+			for(size_t i = 0; i < vLevel.size(); ++i)
+				vRow[vPos[vLevel[i]]++] = i;
+		}
+
+	protected:
+	///	number of rows and connections of the matrix
+	///	\{
+		size_t m_numRows;
+		size_t m_numConn;
+	///	\}
+
+	///	rows sorted by level and start of every level
+	///	\{
+		std::vector<size_t> m_vLowerRow, m_vLowerLevelStart;
+		std::vector<size_t> m_vUpperRow, m_vUpperLevelStart;
+	///	\}
+};
+
+/// @}
+
+} // end namespace ug
+
+#endif /* __H__UG__LIB_ALGEBRA__ALGEBRA_COMMON__LEVEL_SCHEDULE__ */
@@ -38,7 +38,9 @@
 #include "common/error.h"
 #include "common/cuthill_mckee.h"
 //#include "lib_disc/dof_manager/ordering/cuthill_mckee.h"
+#include "lib_algebra/common/graph/nested_dissection.h"
 #include <vector>
+#include <string>
 
 namespace ug{
 /**
@@ -109,6 +111,43 @@ void GetCuthillMcKeeOrder(const TSparseMatrix &mat, std::vector<size_t> &newInde
 
 	ComputeCuthillMcKeeOrder(newIndex, neighbors, true, false);
 }
+
+/**
+ * @param mat 			A sparse matrix
+ * @param newIndex		the nested dissection ordered new indices (computed
+ * 						for the symmetrized connection graph of mat)
+ */
+template<typename TSparseMatrix>
+void GetNestedDissectionOrder(const TSparseMatrix &mat, std::vector<size_t> &newIndex)
+{
+	cgraph graph(mat.num_rows());
+	for(size_t i=0; i<mat.num_rows(); i++)
+		for(typename TSparseMatrix::const_row_iterator i_it = mat.begin_row(i); i_it != mat.end_row(i); ++i_it)
+		{
+			const size_t j = i_it.index();
+			if(i == j) continue;
+			graph.set_connection(i, j);
+			graph.set_connection(j, i);
+		}
+
+	ComputeNestedDissectionOrder(newIndex, graph);
+}
+
+/**
+ * computes a fill-reducing ordering of a sparse matrix
+ * @param mat 			A sparse matrix
+ * @param newIndex		the new indices
+ * @param type			"cuthill-mckee" (reverse) or "nested-dissection"
+ */
+template<typename TSparseMatrix>
+void GetSortOrder(const TSparseMatrix &mat, std::vector<size_t> &newIndex,
+                  const std::string &type)
+{
+	if(type == "cuthill-mckee") GetCuthillMcKeeOrder(mat, newIndex);
+	else if(type == "nested-dissection") GetNestedDissectionOrder(mat, newIndex);
+	else UG_THROW("GetSortOrder: Unknown sort type '" << type << "', use "
+	              "'cuthill-mckee' or 'nested-dissection'.");
+}
 /// @}
 } // end namespace ug
 
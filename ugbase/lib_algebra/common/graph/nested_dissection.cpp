@@ -0,0 +1,292 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+
+#include "nested_dissection.h"
+#include "common/profiler/profiler.h"
+#include "common/error.h"
+#include "lib_algebra/algebra_common/permutation_util.h"
+
+namespace ug{
+
+namespace{
+
+///	recursive nested dissection of the parts of a graph
+/**
+ * Every part is identified by one of its indices, stored in m_vPart for all
+ * indices of the part. Separator indices are marked with noPart. Since there
+ * are no connections between two parts that originate from a common part,
+ * both can be ordered concurrently.
+ */
+class NestedDissection
+{
+	public:
+		NestedDissection(const cgraph& graph, std::vector<size_t>& vNewIndex,
+		                 size_t minSize)
+			: m_graph(graph), m_vNewIndex(vNewIndex), m_minSize(minSize),
+			  m_vPart(graph.size(), 0), m_vLevel(graph.size(), noLevel)
+		{}
+
+	///	orders the indices of a part, assigning the new indices [first, first+size)
+		void dissect(std::vector<size_t>& vInd, size_t first);
+
+	private:
+	///	computes a level structure of the part of root, returns number of levels
+		size_t level_structure(size_t root, std::vector<size_t>& vOrder);
+
+	///	resets the levels of the indices of a part
+		void reset_levels(const std::vector<size_t>& vInd)
+		{
+			for(size_t i = 0; i < vInd.size(); ++i) m_vLevel[vInd[i]] = noLevel;
+		}
+
+	///	assigns the new indices [first, first+size) in the current order
+		void order_leaf(const std::vector<size_t>& vInd, size_t first)
+		{
+			for(size_t i = 0; i < vInd.size(); ++i)
+			{
+				m_vNewIndex[vInd[i]] = first + i;
+				m_vPart[vInd[i]] = noPart;
+			}
+		}
+
+	///	orders the connected components of a part one after the other
+		void dissect_components(std::vector<std::vector<size_t> >& vvComp,
+		                        size_t first);
+
+	///	orders two parts (concurrently, if large enough)
+		void dissect_parts(std::vector<size_t>& vA, size_t firstA,
+		                   std::vector<size_t>& vB, size_t firstB);
+
+	private:
+		static const size_t noPart = (size_t) -1;
+		static const size_t noLevel = (size_t) -1;
+
+	///	parts larger than this are ordered in separate tasks
+		static const size_t taskSize = 10000;
+
+		const cgraph& m_graph;
+		std::vector<size_t>& m_vNewIndex;
+		size_t m_minSize;
+
+		std::vector<size_t> m_vPart;
+		std::vector<size_t> m_vLevel;
+};
+
+size_t NestedDissection::level_structure(size_t root, std::vector<size_t>& vOrder)
+{
+	const size_t part = m_vPart[root];
+	vOrder.clear();
+	vOrder.push_back(root);
+	m_vLevel[root] = 0;
+	size_t numLevel = 1;
+	for(size_t k = 0; k < vOrder.size(); ++k)
+	{
+		const size_t ind = vOrder[k];
+		const size_t level = m_vLevel[ind];
+		for(cgraph::const_row_iterator it = m_graph.begin_row(ind);
+				it != m_graph.end_row(ind); ++it)
+		{
+			const size_t nb = *it;
+			if(m_vPart[nb] != part || m_vLevel[nb] != noLevel) continue;
+			m_vLevel[nb] = level + 1;
+			numLevel = level + 2;
+			vOrder.push_back(nb);
+		}
+	}
+	return numLevel;
+}
+
+void NestedDissection::dissect(std::vector<size_t>& vInd, size_t first)
+{
+	const size_t n = vInd.size();
+	if(n <= m_minSize) {order_leaf(vInd, first); return;}
+
+	std::vector<size_t> vOrder;
+	size_t numLevel = level_structure(vInd[0], vOrder);
+
+//	if the part is not connected, the components are ordered separately
+	if(vOrder.size() < n)
+	{
+		std::vector<std::vector<size_t> > vvComp(1);
+		vvComp[0].swap(vOrder);
+		for(size_t i = 0; i < n; ++i)
+		{
+			if(m_vLevel[vInd[i]] != noLevel) continue;
+			vvComp.resize(vvComp.size() + 1);
+			level_structure(vInd[i], vvComp.back());
+		}
+		vInd.clear();
+		dissect_components(vvComp, first);
+		return;
+	}
+
+//	find a pseudo-peripheral root, i.e. a root with a (nearly) maximal number
+//	of levels, by restarting from an index of minimal degree in the last level
+	for(size_t iter = 0; iter < 4; ++iter)
+	{
+		size_t root = vOrder.back();
+		for(size_t k = vOrder.size(); k-- > 0 && m_vLevel[vOrder[k]] == numLevel-1;)
+			if(m_graph.num_connections(vOrder[k]) < m_graph.num_connections(root))
+				root = vOrder[k];
+
+		reset_levels(vOrder);
+		std::vector<size_t> vNewOrder;
+		const size_t newNumLevel = level_structure(root, vNewOrder);
+		vOrder.swap(vNewOrder);
+		if(newNumLevel <= numLevel) {numLevel = newNumLevel; break;}
+		numLevel = newNumLevel;
+	}
+
+//	a separator needs at least three levels
+	if(numLevel < 3)
+	{
+		reset_levels(vOrder);
+		order_leaf(vOrder, first);
+		return;
+	}
+
+//	the middle level (w.r.t. the number of indices) is the separator
+	std::vector<size_t> vLevelSize(numLevel, 0);
+	for(size_t k = 0; k < vOrder.size(); ++k) ++vLevelSize[m_vLevel[vOrder[k]]];
+	size_t sepLevel = 1, numBelow = vLevelSize[0];
+	while(sepLevel < numLevel - 2 && 2 * (numBelow + vLevelSize[sepLevel]) < n)
+		numBelow += vLevelSize[sepLevel++];
+
+//	indices of the separator level without connections to the next level are
+//	moved to the first part
+	std::vector<size_t> vA, vB, vSep;
+	vA.reserve(numBelow + vLevelSize[sepLevel]);
+	vB.reserve(n - numBelow - vLevelSize[sepLevel]);
+	for(size_t k = 0; k < vOrder.size(); ++k)
+	{
+		const size_t ind = vOrder[k];
+		const size_t level = m_vLevel[ind];
+		if(level < sepLevel) vA.push_back(ind);
+		else if(level > sepLevel) vB.push_back(ind);
+		else
+		{
+			bool bSeparates = false;
+			for(cgraph::const_row_iterator it = m_graph.begin_row(ind);
+					it != m_graph.end_row(ind); ++it)
+				if(m_vPart[*it] == m_vPart[ind] && m_vLevel[*it] == sepLevel + 1)
+					{bSeparates = true; break;}
+			if(bSeparates) vSep.push_back(ind);
+			else vA.push_back(ind);
+		}
+	}
+	reset_levels(vOrder);
+	vOrder.clear();
+	vInd.clear();
+
+	for(size_t i = 0; i < vSep.size(); ++i) m_vPart[vSep[i]] = noPart;
+	for(size_t i = 0; i < vA.size(); ++i) m_vPart[vA[i]] = vA[0];
+	for(size_t i = 0; i < vB.size(); ++i) m_vPart[vB[i]] = vB[0];
+
+//	order both parts, the separator last
+	const size_t firstSep = first + vA.size() + vB.size();
+	dissect_parts(vA, first, vB, first + vA.size());
+	order_leaf(vSep, firstSep);
+}
+
+void NestedDissection::dissect_components(std::vector<std::vector<size_t> >& vvComp,
+                                          size_t first)
+{
+	for(size_t c = 0; c < vvComp.size(); ++c)
+	{
+		std::vector<size_t>& vComp = vvComp[c];
+		reset_levels(vComp);
+		for(size_t i = 0; i < vComp.size(); ++i) m_vPart[vComp[i]] = vComp[0];
+	}
+
+	for(size_t c = 0; c < vvComp.size(); ++c)
+	{
+		const size_t size = vvComp[c].size();
+#ifdef UG_OPENMP
+		#pragma omp task shared(vvComp) if(size > taskSize)
+#endif
+		dissect(vvComp[c], first);
+		first += size;
+	}
+#ifdef UG_OPENMP
+	#pragma omp taskwait
+#endif
+}
+
+void NestedDissection::dissect_parts(std::vector<size_t>& vA, size_t firstA,
+                                     std::vector<size_t>& vB, size_t firstB)
+{
+#ifdef UG_OPENMP
+	if(vA.size() > taskSize && vB.size() > taskSize)
+	{
+		#pragma omp task shared(vA)
+		dissect(vA, firstA);
+		dissect(vB, firstB);
+		#pragma omp taskwait
+		return;
+	}
+#endif
+	dissect(vA, firstA);
+	dissect(vB, firstB);
+}
+
+} // end anonymous namespace
+
+
+void ComputeNestedDissectionOrder(std::vector<size_t>& vNewIndex,
+                                  const cgraph& graph, size_t minSize)
+{
+	PROFILE_FUNC_GROUP("algebra");
+	const size_t n = graph.size();
+	vNewIndex.clear(); vNewIndex.resize(n, (size_t) -1);
+	if(n == 0) return;
+
+	std::vector<size_t> vInd(n);
+	for(size_t i = 0; i < n; ++i) vInd[i] = i;
+
+	NestedDissection nd(graph, vNewIndex, std::max(minSize, (size_t) 1));
+#ifdef UG_OPENMP
+	#pragma omp parallel
+	{
+		#pragma omp single
+		nd.dissect(vInd, 0);
+	}
+#else
+	nd.dissect(vInd, 0);
+#endif
+
+#ifdef UG_DEBUG
+	std::vector<size_t> vOldIndex;
+	GetInversePermutation(vNewIndex, vOldIndex);
+#endif
+}
+
+} // end namespace ug
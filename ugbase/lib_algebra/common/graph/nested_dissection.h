@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+
+#ifndef __H__UG__LIB_ALGEBRA__COMMON__GRAPH__NESTED_DISSECTION__
+#define __H__UG__LIB_ALGEBRA__COMMON__GRAPH__NESTED_DISSECTION__
+
+#include <vector>
+#include "graph.h"
+
+namespace ug{
+
+/// returns an index mapping for a nested dissection ordering of a graph
+/**
+ * The graph is recursively split into two parts by a vertex separator, which
+ * is taken from a level structure rooted at a pseudo-peripheral vertex. The
+ * indices of both parts are ordered first (recursively), followed by those of
+ * the separator. Parts with at most minSize indices are not split any further.
+ * For matrices of discretizations, this ordering reduces the fill-in of a
+ * (complete) LU factorization considerably compared to a banded ordering like
+ * Cuthill-McKee. If compiled with OpenMP, both parts are ordered concurrently.
+ *
+ * On exit, the index field vNewIndex is filled with the index mapping:
+ * newInd = vNewIndex[oldInd]
+ *
+ * \param[out]	vNewIndex	vector returning new index for old index
+ * \param[in]	graph		symmetric adjacency graph (connections of an
+ * 							index to itself are ignored)
+ * \param[in]	minSize		size of parts which are not split any more
+ */
+void ComputeNestedDissectionOrder(std::vector<size_t>& vNewIndex,
+                                  const cgraph& graph, size_t minSize = 64);
+
+} // end namespace ug
+
+#endif /* __H__UG__LIB_ALGEBRA__COMMON__GRAPH__NESTED_DISSECTION__ */
@@ -0,0 +1,150 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+
+#ifndef __H__UG__LIB_ALGEBRA__MULTI_VECTOR__
+#define __H__UG__LIB_ALGEBRA__MULTI_VECTOR__
+
+#include <vector>
+#include "common/types.h"
+#include "common/assert.h"
+#include "common/error.h"
+#include "common/util/smart_pointer.h"
+
+namespace ug{
+
+/// a collection of vectors of the same layout
+/**
+ * A MultiVector groups k vectors of the same size (and parallel layout) in
+ * order to process them at once, e.g. when a linear system has to be solved
+ * for several right-hand sides. Operations that are limited by the memory
+ * bandwidth (like the matrix-vector product) can then read the matrix once
+ * for all k vectors (see SparseMatrix::apply_multi).
+ *
+ * The vectors are held by smart pointers, i.e. the vectors (or grid
+ * functions) added to a MultiVector are shared and not copied.
+ *
+ * \tparam	TVector		vector type
+ */
+template <typename TVector>
+class MultiVector
+{
+	public:
+	///	Vector type
+		typedef TVector vector_type;
+
+	///	this type
+		typedef MultiVector<TVector> this_type;
+
+	public:
+	///	creates an empty multi-vector
+		MultiVector() {}
+
+	///	creates num vectors with the layout of v (values are not copied)
+		MultiVector(const TVector& v, size_t num) {resize(v, num);}
+
+	///	resizes to num vectors with the layout of v (values are not copied)
+	/**
+	 * Already existing vectors are kept, new vectors are created as clones
+	 * (without values) of v.
+	 */
+		void resize(const TVector& v, size_t num)
+		{
+			const size_t oldNum = m_vVec.size();
+			m_vVec.resize(num);
+			for(size_t i = oldNum; i < num; ++i)
+				m_vVec[i] = v.clone_without_values();
+		}
+
+	///	adds a vector
+		void add_vector(SmartPtr<TVector> spVec)
+		{
+			if(!m_vVec.empty() && m_vVec[0]->size() != spVec->size())
+				UG_THROW("MultiVector::add_vector: Size of added vector ("
+						<<spVec->size()<<") does not match size of other vectors ("
+						<<m_vVec[0]->size()<<").");
+			m_vVec.push_back(spVec);
+		}
+
+	///	removes all vectors
+		void clear() {m_vVec.clear();}
+
+	///	returns the number of vectors
+		size_t size() const {return m_vVec.size();}
+
+	///	returns the number of vectors
+		size_t num_vectors() const {return m_vVec.size();}
+
+	///	access to the i'th vector
+	/// \{
+		TVector& operator[](size_t i) {UG_ASSERT(i < m_vVec.size(), "index out of range"); return *m_vVec[i];}
+		const TVector& operator[](size_t i) const {UG_ASSERT(i < m_vVec.size(), "index out of range"); return *m_vVec[i];}
+	/// \}
+
+	///	returns the i'th vector
+	/// \{
+		SmartPtr<TVector> vector(size_t i) {return m_vVec.at(i);}
+		ConstSmartPtr<TVector> vector(size_t i) const {return m_vVec.at(i);}
+	/// \}
+
+	///	sets all entries of all vectors to a value
+		void set(number w)
+		{
+			for(size_t i = 0; i < m_vVec.size(); ++i)
+				m_vVec[i]->set(w);
+		}
+
+	///	returns a deep copy
+		SmartPtr<this_type> clone() const
+		{
+			SmartPtr<this_type> spClone = make_sp(new this_type);
+			for(size_t i = 0; i < m_vVec.size(); ++i)
+				spClone->m_vVec.push_back(m_vVec[i]->clone());
+			return spClone;
+		}
+
+	///	returns a copy with the same layout, but without values
+		SmartPtr<this_type> clone_without_values() const
+		{
+			SmartPtr<this_type> spClone = make_sp(new this_type);
+			for(size_t i = 0; i < m_vVec.size(); ++i)
+				spClone->m_vVec.push_back(m_vVec[i]->clone_without_values());
+			return spClone;
+		}
+
+	protected:
+	///	the vectors
+		std::vector<SmartPtr<TVector> > m_vVec;
+};
+
+} // end namespace ug
+
+#endif /* __H__UG__LIB_ALGEBRA__MULTI_VECTOR__ */
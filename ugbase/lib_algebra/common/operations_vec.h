@@ -33,6 +33,9 @@
 #ifndef __H__UG__LIB_ALGEBRA__OPERATIONS_VEC__
 #define __H__UG__LIB_ALGEBRA__OPERATIONS_VEC__
 
+#include <vector>
+#include <algorithm>
+
 namespace ug
 {
 
@@ -202,6 +205,130 @@ inline void VecHadamardProd(vector_t &dest, const vector_t &v1, const vector_t &
 		VecHadamardProd(dest[i], v1[i], v2[i]);
 }
 
+
+// Fused operations: These functions combine several operations in one loop,
+// such that every vector is only traversed once
+
+//! calculates x = x + alpha*q, r = beta1*s + beta2*t and returns norm_2^2(r)
+template<typename vector_t>
+inline double VecUpdateNormSquared(vector_t &x, double alpha, const vector_t &q,
+                                   vector_t &r, double beta1, const vector_t &s,
+                                   double beta2, const vector_t &t)
+{
+	double sum=0;
+	for(size_t i=0; i<x.size(); i++)
+	{
+		VecScaleAdd(x[i], 1.0, x[i], alpha, q[i]);
+		VecScaleAdd(r[i], beta1, s[i], beta2, t[i]);
+		VecNormSquaredAdd(r[i], sum);
+	}
+	return sum;
+}
+
+//! calculates s1 = scal<a, b1> and s2 = scal<a, b2>
+template<typename vector_t>
+inline void VecProd2(const vector_t &a, const vector_t &b1, const vector_t &b2,
+                     double &s1, double &s2)
+{
+	s1 = 0; s2 = 0;
+	for(size_t i=0; i<a.size(); i++)
+	{
+		VecProdAdd(a[i], b1[i], s1);
+		VecProdAdd(a[i], b2[i], s2);
+	}
+}
+
+//! calculates vS[k] = scal<a, vB[k]> for all k
+template<typename vector_t>
+inline void VecMultiProd(const vector_t &a, const std::vector<const vector_t*> &vB,
+                         std::vector<double> &vS)
+{
+	const size_t n = vB.size();
+	vS.assign(n, 0.0);
+	for(size_t i=0; i<a.size(); i++)
+		for(size_t k=0; k<n; k++)
+			VecProdAdd(a[i], (*vB[k])[i], vS[k]);
+}
+
+//! calculates a = a + sum_k vAlpha[k]*vB[k] and returns norm_2^2(a)
+template<typename vector_t>
+inline double VecMultiScaleAppendNormSquared(vector_t &a,
+                                             const std::vector<const vector_t*> &vB,
+                                             const std::vector<double> &vAlpha)
+{
+	const size_t n = vB.size();
+	double sum=0;
+	for(size_t i=0; i<a.size(); i++)
+	{
+		for(size_t k=0; k<n; k++)
+			VecScaleAdd(a[i], 1.0, a[i], vAlpha[k], (*vB[k])[i]);
+		VecNormSquaredAdd(a[i], sum);
+	}
+	return sum;
+}
+
+//! calculates vS[i*m+j] = scal<vA[i], vB[j]> for all i and j < m = vB.size()
+/**
+ * The vectors are processed in chunks of entries that fit into the cache
+ * together, such that every vector is read from memory only once.
+ */
+template<typename vector_t>
+inline void VecBlockProd(const std::vector<const vector_t*> &vA,
+                         const std::vector<const vector_t*> &vB,
+                         std::vector<double> &vS)
+{
+	const size_t n = vA.size(), m = vB.size();
+	vS.assign(n*m, 0.0);
+	if(n == 0 || m == 0) return;
+	const size_t size = vA[0]->size(), chunk = 128;
+	for(size_t l0=0; l0<size; l0+=chunk)
+	{
+		const size_t l1 = std::min(size, l0+chunk);
+		for(size_t i=0; i<n; i++)
+		{
+			const vector_t &a = *vA[i];
+			for(size_t j=0; j<m; j++)
+			{
+				const vector_t &b = *vB[j];
+				double sum = 0.0;
+				for(size_t l=l0; l<l1; l++)
+					VecProdAdd(a[l], b[l], sum);
+				vS[i*m+j] += sum;
+			}
+		}
+	}
+}
+
+//! calculates vA[j] = vA[j] + sum_i vAlpha[i*m+j]*vB[i] for all j < m = vA.size()
+/**
+ * The vectors are processed in chunks of entries that fit into the cache
+ * together, such that every vector is read from memory only once.
+ */
+template<typename vector_t>
+inline void VecBlockScaleAppend(const std::vector<vector_t*> &vA,
+                                const std::vector<const vector_t*> &vB,
+                                const std::vector<double> &vAlpha)
+{
+	const size_t n = vB.size(), m = vA.size();
+	if(n == 0 || m == 0) return;
+	const size_t size = vA[0]->size(), chunk = 128;
+	for(size_t l0=0; l0<size; l0+=chunk)
+	{
+		const size_t l1 = std::min(size, l0+chunk);
+		for(size_t j=0; j<m; j++)
+		{
+			vector_t &a = *vA[j];
+			for(size_t i=0; i<n; i++)
+			{
+				const vector_t &b = *vB[i];
+				const double alpha = vAlpha[i*m+j];
+				for(size_t l=l0; l<l1; l++)
+					VecScaleAdd(a[l], 1.0, a[l], alpha, b[l]);
+			}
+		}
+	}
+}
+
 } // namespace ug
 
 #endif /* __H__UG__LIB_ALGEBRA__OPERATIONS_VEC__ */
@@ -0,0 +1,331 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+
+#ifndef __H__UG__CPU_ALGEBRA__SELL_SPARSEMATRIX__
+#define __H__UG__CPU_ALGEBRA__SELL_SPARSEMATRIX__
+
+#include <vector>
+#include <algorithm>
+#include "common/common.h"
+#include "common/profiler/profiler.h"
+
+namespace ug{
+
+/// \addtogroup cpu_algebra
+///	@{
+
+///	read-only sparse matrix in the sliced ELLPACK format SELL-C-sigma
+/**
+ * The rows of the matrix are grouped into chunks of C consecutive rows. Each
+ * chunk is stored like an ELLPACK matrix: it is padded to the length of its
+ * longest row and its entries are stored column by column, i.e. the j-th
+ * entries of the C rows of a chunk are contiguous. Thus, the matrix-vector
+ * product processes C rows at once in the innermost loop, which can be
+ * vectorized by the compiler (using gather instructions for the vector).
+ *
+ * In order to reduce the padding, the rows are sorted by their length
+ * (descending) within windows of sigma rows before they are grouped into
+ * chunks. The result of a product is written back to the original row
+ * ordering, thus the vectors are the usual (unpermuted) vectors.
+ *
+ * The matrix is created as a copy of a SparseMatrix and cannot be changed
+ * afterwards. Only scalar entries (double, float) are supported.
+ *
+ * References:
+ * <ul>
+ * <li> M. Kreutzer, G. Hager, G. Wellein, H. Fehske, A. R. Bishop. A unified
+ *      sparse matrix data format for efficient general sparse matrix-vector
+ *      multiplication on modern processors with wide SIMD units.
+ *      SIAM J. Sci. Comput. 36(5), 2014
+ * </ul>
+ *
+ * \tparam	TValueType		type of the entries (double or float)
+ */
+template<typename TValueType>
+class SellSparseMatrix
+{
+	public:
+		typedef TValueType value_type;
+
+	public:
+	///	constructor
+		SellSparseMatrix() : m_numRows(0), m_numCols(0), m_nnz(0), m_chunkSize(8), m_sigma(256) {}
+
+	///	creates the matrix as a copy of a (CRS) matrix
+	/**
+	 * \param A				matrix to copy (e.g. a SparseMatrix)
+	 * \param chunkSize		number of rows per chunk (C), one of 1, 2, 4, 8, 16, 32
+	 * \param sigma			size of the sorting window (a multiple of C, 1 disables sorting)
+	 */
+		template<typename TMatrix>
+		void set_as_copy_of(const TMatrix& A, size_t chunkSize = 8, size_t sigma = 256);
+
+	///	removes all entries
+		void clear();
+
+	///	number of rows
+		size_t num_rows() const {return m_numRows;}
+
+	///	number of columns
+		size_t num_cols() const {return m_numCols;}
+
+	///	number of nonzero entries (without padding)
+		size_t total_num_connections() const {return m_nnz;}
+
+	///	number of stored entries (including padding)
+		size_t num_stored_entries() const {return m_values.size();}
+
+	///	ratio of nonzero entries to stored entries (1 if there is no padding)
+		number fill_efficiency() const
+		{
+			return m_values.empty() ? 1.0 : (number) m_nnz / (number) m_values.size();
+		}
+
+	///	number of rows per chunk
+		size_t chunk_size() const {return m_chunkSize;}
+
+	///	size of the sorting window
+		size_t sigma() const {return m_sigma;}
+
+	///	diagonal entry of row i
+		const value_type& diag(size_t i) const {return m_diag[i];}
+
+	///	calculates dest = alpha1*v1 + beta1*A*w1 (A = this matrix)
+		template<typename vector_t>
+		void axpy(vector_t &dest,
+				const number &alpha1, const vector_t &v1,
+				const number &beta1, const vector_t &w1) const;
+
+	///	calculates res = A*x
+		template<typename vector_t>
+		bool apply(vector_t &res, const vector_t &x) const
+		{
+			axpy(res, 0.0, res, 1.0, x);
+			return true;
+		}
+
+	///	calculates res = res - A*x
+		template<typename vector_t>
+		bool matmul_minus(vector_t &res, const vector_t &x) const
+		{
+			axpy(res, 1.0, res, -1.0, x);
+			return true;
+		}
+
+	protected:
+	///	product for a fixed chunk size
+		template<size_t C, typename vector_t>
+		void axpy_chunks(vector_t &dest,
+				const number &alpha1, const vector_t &v1,
+				const number &beta1, const vector_t &w1) const;
+
+	protected:
+		size_t m_numRows, m_numCols, m_nnz;
+		size_t m_chunkSize, m_sigma;
+
+	///	offset of the first entry of each chunk (size: num chunks + 1)
+		std::vector<size_t> m_chunkStart;
+
+	///	original row index of the rows of the chunks (num_rows() for padding rows)
+		std::vector<size_t> m_rowIndex;
+
+	///	entries and column indices, chunk-wise column-major
+		std::vector<value_type> m_values;
+		std::vector<int> m_cols;
+
+	///	diagonal in original ordering
+		std::vector<value_type> m_diag;
+};
+
+
+template<typename T>
+void SellSparseMatrix<T>::clear()
+{
+	m_numRows = m_numCols = m_nnz = 0;
+	m_chunkStart.clear();
+	m_rowIndex.clear();
+	m_values.clear();
+	m_cols.clear();
+	m_diag.clear();
+}
+
+
+template<typename T>
+template<typename TMatrix>
+void SellSparseMatrix<T>::set_as_copy_of(const TMatrix& A, size_t chunkSize, size_t sigma)
+{
+	PROFILE_BEGIN_GROUP(SellSparseMatrix_set_as_copy_of, "algebra SELL");
+	typedef typename TMatrix::const_row_iterator const_row_iterator;
+
+	if(chunkSize != 1 && chunkSize != 2 && chunkSize != 4 && chunkSize != 8
+		&& chunkSize != 16 && chunkSize != 32)
+		UG_THROW("SellSparseMatrix: Chunk size must be one of 1, 2, 4, 8, 16, 32,"
+				" but is " << chunkSize << ".");
+	if(sigma == 0 || (sigma > 1 && sigma % chunkSize != 0))
+		UG_THROW("SellSparseMatrix: Sorting window sigma = " << sigma << " must"
+				" be 1 or a multiple of the chunk size " << chunkSize << ".");
+
+	clear();
+	m_chunkSize = chunkSize;
+	m_sigma = sigma;
+	m_numRows = A.num_rows();
+	m_numCols = A.num_cols();
+
+//	row lengths and diagonal
+	std::vector<size_t> vRowLen(m_numRows, 0);
+	m_diag.resize(m_numRows, 0.0);
+	for(size_t i = 0; i < m_numRows; ++i)
+		for(const_row_iterator it = A.begin_row(i); it != A.end_row(i); ++it)
+		{
+			++vRowLen[i];
+			if(it.index() == i) m_diag[i] = it.value();
+		}
+
+//	sort the rows by length within the windows of sigma rows
+	const size_t numChunks = (m_numRows + m_chunkSize - 1) / m_chunkSize;
+	std::vector<std::pair<size_t, size_t> > vSort(m_numRows);
+	for(size_t i = 0; i < m_numRows; ++i)
+		vSort[i] = std::make_pair(m_numRows - vRowLen[i], i);
+	if(m_sigma > 1)
+		for(size_t w = 0; w < m_numRows; w += m_sigma)
+			std::sort(vSort.begin() + w, vSort.begin() + std::min(w + m_sigma, m_numRows));
+
+	m_rowIndex.resize(numChunks * m_chunkSize, m_numRows);
+	for(size_t k = 0; k < m_numRows; ++k)
+		m_rowIndex[k] = vSort[k].second;
+
+//	chunk offsets
+	m_chunkStart.resize(numChunks + 1);
+	m_chunkStart[0] = 0;
+	for(size_t c = 0; c < numChunks; ++c)
+	{
+		size_t len = 0;
+		for(size_t r = 0; r < m_chunkSize; ++r)
+		{
+			const size_t i = m_rowIndex[c*m_chunkSize + r];
+			if(i < m_numRows) len = std::max(len, vRowLen[i]);
+		}
+		m_chunkStart[c+1] = m_chunkStart[c] + len * m_chunkSize;
+	}
+
+//	copy entries, padding entries are zero and refer to the last column of the row
+	m_values.resize(m_chunkStart[numChunks], 0.0);
+	m_cols.resize(m_chunkStart[numChunks], 0);
+	for(size_t c = 0; c < numChunks; ++c)
+	{
+		const size_t len = (m_chunkStart[c+1] - m_chunkStart[c]) / m_chunkSize;
+		for(size_t r = 0; r < m_chunkSize; ++r)
+		{
+			const size_t i = m_rowIndex[c*m_chunkSize + r];
+			if(i >= m_numRows) continue;
+
+			size_t pos = m_chunkStart[c] + r, j = 0;
+			int lastCol = 0;
+			for(const_row_iterator it = A.begin_row(i); it != A.end_row(i); ++it, ++j)
+			{
+				m_values[pos + j*m_chunkSize] = it.value();
+				m_cols[pos + j*m_chunkSize] = lastCol = (int) it.index();
+			}
+			for(; j < len; ++j)
+				m_cols[pos + j*m_chunkSize] = lastCol;
+			m_nnz += vRowLen[i];
+		}
+	}
+}
+
+
+template<typename T>
+template<size_t C, typename vector_t>
+void SellSparseMatrix<T>::axpy_chunks(vector_t &dest,
+		const number &alpha1, const vector_t &v1,
+		const number &beta1, const vector_t &w1) const
+{
+	const int numChunks = (int) m_chunkStart.size() - 1;
+	const value_type* pValues = m_values.empty() ? NULL : &m_values[0];
+	const int* pCols = m_cols.empty() ? NULL : &m_cols[0];
+
+#ifdef UG_OPENMP
+	#pragma omp parallel for schedule(static)
+#endif
+	for(int c = 0; c < numChunks; ++c)
+	{
+		number sum[C];
+		for(size_t r = 0; r < C; ++r) sum[r] = 0.0;
+
+	//	the C rows of the chunk are processed at once
+		const value_type* val = pValues + m_chunkStart[c];
+		const int* col = pCols + m_chunkStart[c];
+		const size_t len = (m_chunkStart[c+1] - m_chunkStart[c]) / C;
+		for(size_t j = 0; j < len; ++j, val += C, col += C)
+			for(size_t r = 0; r < C; ++r)
+				sum[r] += val[r] * w1[col[r]];
+
+	//	write back to original ordering
+		const size_t* rowIndex = &m_rowIndex[c*C];
+		for(size_t r = 0; r < C; ++r)
+		{
+			const size_t i = rowIndex[r];
+			if(i >= m_numRows) continue;
+			if(alpha1 == 0.0) dest[i] = beta1 * sum[r];
+			else dest[i] = alpha1 * v1[i] + beta1 * sum[r];
+		}
+	}
+}
+
+
+template<typename T>
+template<typename vector_t>
+void SellSparseMatrix<T>::axpy(vector_t &dest,
+		const number &alpha1, const vector_t &v1,
+		const number &beta1, const vector_t &w1) const
+{
+	PROFILE_BEGIN_GROUP(SellSparseMatrix_axpy, "algebra SELL");
+	UG_ASSERT(dest.size() == m_numRows && w1.size() == m_numCols,
+	          "SellSparseMatrix::axpy: Size mismatch.");
+
+	switch(m_chunkSize)
+	{
+		case 1: axpy_chunks<1>(dest, alpha1, v1, beta1, w1); break;
+		case 2: axpy_chunks<2>(dest, alpha1, v1, beta1, w1); break;
+		case 4: axpy_chunks<4>(dest, alpha1, v1, beta1, w1); break;
+		case 8: axpy_chunks<8>(dest, alpha1, v1, beta1, w1); break;
+		case 16: axpy_chunks<16>(dest, alpha1, v1, beta1, w1); break;
+		case 32: axpy_chunks<32>(dest, alpha1, v1, beta1, w1); break;
+		default: UG_THROW("SellSparseMatrix::axpy: Unsupported chunk size " << m_chunkSize << ".");
+	}
+}
+
+/// @}
+
+} // end namespace ug
+
+#endif /* __H__UG__CPU_ALGEBRA__SELL_SPARSEMATRIX__ */
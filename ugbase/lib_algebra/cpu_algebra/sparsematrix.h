@@ -55,6 +55,9 @@ namespace ug{
 /// \addtogroup cpu_algebra
 ///	@{
 
+/// returns a new revision for the pattern of a SparseMatrix \sa SparseMatrix::pattern_revision
+size_t NewSparseMatrixPatternRevision();
+
 
 // example for the variable CRS storage structure:
 // say we have:
@@ -131,6 +134,33 @@ public:
 	void resize_and_clear(size_t newRows, size_t newCols);
 	void resize_and_keep_values(size_t newRows, size_t newCols);
 
+	/**
+	 * \brief finalizes the sparsity pattern
+	 * The matrix is defragmented into a contiguous CRS layout and the pattern
+	 * is marked as finalized. As long as the pattern is finalized, the
+	 * positions of the connections in the value array (\sa value_index) do
+	 * not change. Use clear_values to reassemble the matrix in the finalized
+	 * pattern. Creating a new connection or resize_and_clear releases the
+	 * pattern.
+	 */
+	void finalize_pattern();
+
+	//! releases a finalized sparsity pattern \sa finalize_pattern
+	void release_pattern() { m_bPatternFinalized = false; }
+
+	//! returns if the sparsity pattern is finalized \sa finalize_pattern
+	bool pattern_finalized() const { return m_bPatternFinalized; }
+
+	//! sets all values to zero, keeps the sparsity pattern
+	void clear_values();
+
+	//! returns the revision of the sparsity pattern
+	/**	The revision changes whenever the pattern is dropped (i.e. on
+	 * resize_and_clear and clear_and_free). Revisions are unique among all
+	 * matrices, thus a matrix constructed at the address of a destroyed one
+	 * never repeats its revision.*/
+	size_t pattern_revision() const { return m_patternRevision; }
+
 	/**
 	 * \brief write in a empty SparseMatrix (this) the transpose SparseMatrix of B.
 	 * \param B			the matrix of which to create the transpose of
@@ -146,6 +176,15 @@ public:
 	 * \return			true on success
 	 */
 	void set_as_copy_of(const SparseMatrix<value_type> &B, double scale=1.0);
+
+	/**
+	 * \brief create/recreate this as a copy of SparseMatrix B with entries of another type
+	 * (e.g. a single precision copy of a double matrix)
+	 * \param B			the matrix of which to create a copy of
+	 */
+	template<typename TOtherValue>
+	void set_as_converted_copy_of(const SparseMatrix<TOtherValue> &B);
+
 	SparseMatrix<value_type> &operator = (const SparseMatrix<value_type> &B)
 	{
 		set_as_copy_of(B);
@@ -176,6 +215,15 @@ public:
 	void apply_transposed_ignore_zero_rows(vector_t &dest,
 			const number &beta1, const vector_t &w1) const;
 
+	//! calculate res[j] = A*x[j] for all vectors of the multi-vectors res, x
+	/**
+	 * The rows are processed in blocks that fit into the cache and each block
+	 * is applied to all vectors before the next block is loaded. Thus, the
+	 * matrix is read from memory only once for all vectors.
+	 */
+	template<typename multi_vector_t>
+	void apply_multi(multi_vector_t &res, const multi_vector_t &x) const;
+
 	// DEPRECATED!
 	//! calculate res = A x
 		// apply is deprecated because of axpy(res, 0.0, res, 1.0, beta, w1)
@@ -296,6 +344,22 @@ public:
         return values[j];
     }
 
+	/** value_index
+	 * \param r row
+	 * \param c column
+	 * \return position of connection (r, c) in the value array, -1 if not existing
+	 * \note the position is only stable while the pattern is finalized
+	 */
+	int value_index(size_t r, size_t c) const
+	{
+		check_rc(r, c);
+		return get_index_const(r, c);
+	}
+
+	//! access to a value by its position in the value array \sa value_index
+	value_type &value_by_index(size_t i) { return values[i]; }
+	const value_type &value_by_index(size_t i) const { return values[i]; }
+
 public:
 	// row functions
 
@@ -636,6 +700,8 @@ protected:
     size_t fragmented;
     size_t nnz;
     bool bNeedsValues;
+    bool m_bPatternFinalized;
+    size_t m_patternRevision;
 
     std::vector<value_type> values;
     int maxValues;
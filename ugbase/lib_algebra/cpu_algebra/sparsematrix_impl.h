@@ -41,6 +41,7 @@
 #include "lib_algebra/common/operations_vec.h"
 #include "common/profiler/profiler.h"
 #include "sparsematrix.h"
+#include "sparsematrix_kernels.h"
 #include <vector>
 #include <algorithm>
 
@@ -53,6 +54,8 @@ SparseMatrix<T>::SparseMatrix()
 {
 	PROFILE_SPMATRIX(SparseMatrix_constructor);
 	bNeedsValues = true;
+	m_bPatternFinalized = false;
+	m_patternRevision = NewSparseMatrixPatternRevision();
 	iIterators=0;
 	nnz = 0;
 	m_numCols = 0;
@@ -64,6 +67,8 @@ SparseMatrix<T>::SparseMatrix()
 template<typename T>
 void SparseMatrix<T>::clear_and_free()
 {
+	m_bPatternFinalized = false;
+	m_patternRevision = NewSparseMatrixPatternRevision();
 	std::vector<int>().swap(rowStart);
 	std::vector<int>().swap(rowMax);
 	std::vector<int>().swap(rowEnd);
@@ -84,6 +89,9 @@ template<typename T>
 void SparseMatrix<T>::resize_and_clear(size_t newRows, size_t newCols)
 {
 	PROFILE_SPMATRIX(SparseMatrix_resize_and_clear);
+	m_bPatternFinalized = false;
+	m_patternRevision = NewSparseMatrixPatternRevision();
+
 	rowStart.clear(); rowStart.resize(newRows+1, -1);
 	rowMax.clear(); rowMax.resize(newRows);
 	rowEnd.clear(); rowEnd.resize(newRows, -1);
@@ -109,6 +117,9 @@ void SparseMatrix<T>::resize_and_keep_values(size_t newRows, size_t newCols)
 	if(newRows == 0 && newCols == 0)
 		return resize_and_clear(0,0);
 
+	if(newRows != num_rows() || (int)newCols != m_numCols)
+		m_bPatternFinalized = false;
+
 	if(newRows != num_rows())
 	{
 		size_t oldrows = num_rows();
@@ -131,6 +142,24 @@ void SparseMatrix<T>::resize_and_keep_values(size_t newRows, size_t newCols)
 }
 
 
+template<typename T>
+void SparseMatrix<T>::finalize_pattern()
+{
+	PROFILE_SPMATRIX(SparseMatrix_finalize_pattern);
+	defragment();
+	m_bPatternFinalized = true;
+}
+
+
+template<typename T>
+void SparseMatrix<T>::clear_values()
+{
+	PROFILE_SPMATRIX(SparseMatrix_clear_values);
+	for(size_t i=0; i < values.size(); i++)
+		values[i] = 0.0;
+}
+
+
 template<typename T>
 void SparseMatrix<T>::set_as_transpose_of(const SparseMatrix<value_type> &B, double scale)
 {
@@ -173,9 +202,9 @@ template<typename vector_t>
 inline void SparseMatrix<T>::mat_mult_add_row(size_t row, typename vector_t::value_type &dest, double alpha, const vector_t &v) const
 {
 
-	size_t itEnd=rowEnd[row];
-	for(size_t rowIt=rowStart[row]; rowIt != itEnd; ++rowIt)
-		MatMultAdd(dest, 1.0, dest, alpha, values[rowIt], v[cols[rowIt]]);
+	if(rowStart[row] == rowEnd[row]) return;
+	SpMVKernel<value_type, typename vector_t::value_type>::mult_add_row
+		(dest, alpha, &values[0], &cols[0], rowStart[row], rowEnd[row], v);
 
 	//for(const_row_iterator conn = begin_row(row); conn != end_row(row); ++conn)
 		//MatMultAdd(dest, 1.0, dest, alpha, conn.value(), v[conn.index()]);
@@ -187,17 +216,14 @@ template<typename vector_t>
 void SparseMatrix<T>::apply_ignore_zero_rows(vector_t &dest,
 		const number &beta1, const vector_t &w1) const
 {
+	typedef SpMVKernel<value_type, typename vector_t::value_type> kernel_type;
 	for(size_t i=0; i < num_rows(); i++)
 	{
-		size_t rowIt=rowStart[i];
-		size_t itEnd=rowEnd[i];
-		if(rowIt == itEnd)
+		if(rowStart[i] == rowEnd[i])
 			continue;
 
-		MatMult(dest[i], beta1, values[rowIt], w1[cols[rowIt]]);
-		for(++rowIt; rowIt != itEnd; ++rowIt)
-			// res[i] += conn.value() * x[conn.index()];
-			MatMultAdd(dest[i], 1.0, dest[i], beta1, values[rowIt], w1[cols[rowIt]]);
+		kernel_type::mult_row(dest[i], beta1, &values[0], &cols[0],
+		                      rowStart[i], rowEnd[i], w1);
 	}
 }
 
@@ -213,20 +239,16 @@ void SparseMatrix<T>::axpy(vector_t &dest,
 	check_fragmentation();
 	if(alpha1 == 0.0)
 	{
-		for(size_t i=0; i < num_rows(); i++)
+		typedef SpMVKernel<value_type, typename vector_t::value_type> kernel_type;
+		if(values.empty())
 		{
-			size_t rowIt=rowStart[i];
-			size_t itEnd=rowEnd[i];
-			if(rowIt == itEnd)
-			{
+			for(size_t i=0; i < num_rows(); i++)
 				dest[i] = 0.0;
-				continue;
-			}
-			MatMult(dest[i], beta1, values[rowIt], w1[cols[rowIt]]);
-			for(++rowIt; rowIt != itEnd; ++rowIt)
-				// res[i] += conn.value() * x[conn.index()];
-				MatMultAdd(dest[i], 1.0, dest[i], beta1, values[rowIt], w1[cols[rowIt]]);
+			return;
 		}
+		for(size_t i=0; i < num_rows(); i++)
+			kernel_type::mult_row(dest[i], beta1, &values[0], &cols[0],
+			                      rowStart[i], rowEnd[i], w1);
 	}
 	else if(&dest == &v1)
 	{
@@ -260,6 +282,7 @@ void SparseMatrix<T>::axpy_transposed(vector_t &dest,
 		const number &beta1, const vector_t &w1) const
 {
 	PROFILE_SPMATRIX(SparseMatrix_axpy_transposed);
+	typedef SpMVKernel<value_type, typename vector_t::value_type> kernel_type;
 	check_fragmentation();
 	if(&dest == &v1) {
 		if(alpha1 == 0.0)
@@ -279,7 +302,58 @@ void SparseMatrix<T>::axpy_transposed(vector_t &dest,
 		for(size_t rowIt=rowStart[i]; rowIt != itEnd; ++rowIt)
 			// dest[conn.index()] += beta1 * conn.value() * w1[i];
 			if(values[rowIt] != 0.0)
-				MatMultTransposedAdd(dest[cols[rowIt]], 1.0, dest[cols[rowIt]], beta1, values[rowIt], w1[i]);
+				kernel_type::mult_transposed_add(dest[cols[rowIt]], beta1, values[rowIt], w1[i]);
+	}
+}
+
+
+// calculate res[j] = A*x[j] for all vectors of the multi-vectors (A = this matrix)
+template<typename T>
+template<typename multi_vector_t>
+void SparseMatrix<T>::apply_multi(multi_vector_t &res, const multi_vector_t &x) const
+{
+	PROFILE_SPMATRIX(SparseMatrix_apply_multi);
+	typedef typename multi_vector_t::vector_type vector_t;
+	typedef SpMVKernel<value_type, typename vector_t::value_type> kernel_type;
+	UG_COND_THROW(res.size() != x.size(), "SparseMatrix::apply_multi: number "
+				"of vectors does not match ("<<res.size()<<" != "<<x.size()<<").");
+	check_fragmentation();
+
+	const size_t numVec = x.size();
+	if(values.empty())
+	{
+		for(size_t j=0; j < numVec; j++)
+			for(size_t i=0; i < num_rows(); i++)
+				res[j][i] = 0.0;
+		return;
+	}
+
+//	size of the matrix blocks that are kept in the cache
+	const size_t blockBytes = 256*1024;
+	const size_t connBytes = sizeof(value_type) + sizeof(int);
+
+	size_t blockBegin = 0;
+	while(blockBegin < num_rows())
+	{
+	//	collect rows until the block is filled
+		size_t blockEnd = blockBegin, bytes = 0;
+		while(blockEnd < num_rows() && (blockEnd == blockBegin || bytes < blockBytes))
+		{
+			bytes += (rowEnd[blockEnd] - rowStart[blockEnd]) * connBytes;
+			++blockEnd;
+		}
+
+	//	apply the block to all vectors, only the first pass reads from memory
+		for(size_t j=0; j < numVec; j++)
+		{
+			vector_t& dest = res[j];
+			const vector_t& w = x[j];
+			for(size_t i=blockBegin; i < blockEnd; i++)
+				kernel_type::mult_row(dest[i], 1.0, &values[0], &cols[0],
+				                      rowStart[i], rowEnd[i], w);
+		}
+
+		blockBegin = blockEnd;
 	}
 }
 
@@ -289,9 +363,10 @@ template<typename vector_t>
 void SparseMatrix<T>::apply_transposed_ignore_zero_rows(vector_t &dest,
 		const number &beta1, const vector_t &w1) const
 {
+	typedef SpMVKernel<value_type, typename vector_t::value_type> kernel_type;
 	for(size_t i=0; i<num_rows(); i++)
 	{
-		row_iterator itEnd = end_row(i);
+		const_row_iterator itEnd = end_row(i);
 		for(const_row_iterator conn = begin_row(i); conn != itEnd; ++conn)
 			dest[conn.index()] = 0.0;
 	}
@@ -302,7 +377,7 @@ void SparseMatrix<T>::apply_transposed_ignore_zero_rows(vector_t &dest,
 		for(size_t rowIt=rowStart[i]; rowIt != itEnd; ++rowIt)
 			// dest[conn.index()] += beta1 * conn.value() * w1[i];
 			if(values[rowIt] != 0.0)
-				MatMultTransposedAdd(dest[cols[rowIt]], 1.0, dest[cols[rowIt]], beta1, values[rowIt], w1[i]);
+				kernel_type::mult_transposed_add(dest[cols[rowIt]], beta1, values[rowIt], w1[i]);
 	}
 }
 
@@ -396,6 +471,19 @@ void SparseMatrix<T>::set_as_copy_of(const SparseMatrix<T> &B, double scale)
 }
 
 
+template<typename T>
+template<typename TOtherValue>
+void SparseMatrix<T>::set_as_converted_copy_of(const SparseMatrix<TOtherValue> &B)
+{
+	resize_and_clear(B.num_rows(), B.num_cols());
+	for(size_t i=0; i < B.num_rows(); i++)
+	{
+		typename SparseMatrix<TOtherValue>::const_row_iterator itEnd = B.end_row(i);
+		for(typename SparseMatrix<TOtherValue>::const_row_iterator it = B.begin_row(i); it != itEnd; ++it)
+			operator()(i, it.index()) = (value_type) it.value();
+	}
+}
+
 
 template<typename T>
 void SparseMatrix<T>::scale(double d)
@@ -514,6 +602,7 @@ int SparseMatrix<T>::get_index(int r, int c)
 	if(rowStart[r] == -1 || rowStart[r] == rowEnd[r])
 	{
 //		UG_LOG("new row\n");
+		m_bPatternFinalized = false;
 		// row did not start, start new row at the end of cols array
 		assureValuesSize(maxValues+1);
 		rowStart[r] = maxValues;
@@ -543,6 +632,7 @@ int SparseMatrix<T>::get_index(int r, int c)
 	// we did not find it, so we have to add it
 
 	check_row_modifiable(r);
+	m_bPatternFinalized = false;
 
 #ifndef NDEBUG
 	assert(index == rowEnd[r] || cols[index] > c);
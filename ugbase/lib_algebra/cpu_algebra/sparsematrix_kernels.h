@@ -0,0 +1,482 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+
+#ifndef __H__UG__CPU_ALGEBRA__SPARSEMATRIX_KERNELS__
+#define __H__UG__CPU_ALGEBRA__SPARSEMATRIX_KERNELS__
+
+//	explicitly vectorized kernels are used if the instruction sets are enabled
+//	(e.g. by the cmake option SIMD=AVX2 or SIMD=AVX512)
+#if defined(__AVX2__) && defined(__FMA__) && !defined(UG_SINGLE_PRECISION)
+	#define UG_SPMV_AVX2
+	#if defined(__AVX512F__)
+		#define UG_SPMV_AVX512
+	#endif
+	#include <immintrin.h>
+#endif
+
+#include "lib_algebra/small_algebra/small_algebra.h"
+
+namespace ug{
+
+/// \addtogroup cpu_algebra
+///	@{
+
+///	returns the instruction set used by the explicitly vectorized SpMV kernels
+inline const char* SpMVKernelInstructionSet()
+{
+#if defined(UG_SPMV_AVX512)
+	return "AVX-512";
+#elif defined(UG_SPMV_AVX2)
+	return "AVX2";
+#else
+	return "none (compiler vectorization only)";
+#endif
+}
+
+#ifdef UG_SPMV_AVX2
+///	returns the sum of all entries of a register
+inline number SimdHorizontalSum(__m256d s)
+{
+	__m128d lo = _mm_add_pd(_mm256_castpd256_pd128(s), _mm256_extractf128_pd(s, 1));
+	return _mm_cvtsd_f64(_mm_add_sd(lo, _mm_unpackhi_pd(lo, lo)));
+}
+
+///	returns the sum of all entries of a register
+inline number SimdHorizontalSum(__m128d s)
+{
+	return _mm_cvtsd_f64(_mm_add_sd(s, _mm_unpackhi_pd(s, s)));
+}
+#endif
+
+/**
+ * Registers holding a vector of N doubles, used by the block kernels for
+ * column-major blocks, where every column of a block is contiguous in
+ * memory. fmadd adds column*x, dot returns the scalar product of a column
+ * and a vector. Columns not fitting a register are split into registers and
+ * scalars (with AVX-512, sizes 5 and 6 use one register and masked loads), so
+ * that no memory behind the block is accessed.
+ *
+ * The generic version is not available, i.e. the block kernels fall back to
+ * the plain loops (which the compiler may vectorize).
+ */
+template<size_t N>
+struct SimdColumn
+{
+	enum{available = false};
+};
+
+#ifdef UG_SPMV_AVX2
+template<>
+struct SimdColumn<2>
+{
+	enum{available = true};
+	__m128d s;
+	inline void load(const number* v) {s = _mm_loadu_pd(v);}
+	inline void store(number* v) const {_mm_storeu_pd(v, s);}
+	inline void fmadd(const number* col, number x)
+		{s = _mm_fmadd_pd(_mm_loadu_pd(col), _mm_set1_pd(x), s);}
+	static inline number dot(const number* col, const number* v)
+		{return SimdHorizontalSum(_mm_mul_pd(_mm_loadu_pd(col), _mm_loadu_pd(v)));}
+};
+
+template<>
+struct SimdColumn<3>
+{
+	enum{available = true};
+	__m128d s; number s2;
+	inline void load(const number* v) {s = _mm_loadu_pd(v); s2 = v[2];}
+	inline void store(number* v) const {_mm_storeu_pd(v, s); v[2] = s2;}
+	inline void fmadd(const number* col, number x)
+		{s = _mm_fmadd_pd(_mm_loadu_pd(col), _mm_set1_pd(x), s); s2 += col[2] * x;}
+	static inline number dot(const number* col, const number* v)
+	{
+		return SimdHorizontalSum(_mm_mul_pd(_mm_loadu_pd(col), _mm_loadu_pd(v)))
+				+ col[2] * v[2];
+	}
+};
+
+template<>
+struct SimdColumn<4>
+{
+	enum{available = true};
+	__m256d s;
+	inline void load(const number* v) {s = _mm256_loadu_pd(v);}
+	inline void store(number* v) const {_mm256_storeu_pd(v, s);}
+	inline void fmadd(const number* col, number x)
+		{s = _mm256_fmadd_pd(_mm256_loadu_pd(col), _mm256_set1_pd(x), s);}
+	static inline number dot(const number* col, const number* v)
+		{return SimdHorizontalSum(_mm256_mul_pd(_mm256_loadu_pd(col), _mm256_loadu_pd(v)));}
+};
+
+#ifdef UG_SPMV_AVX512
+///	block sizes 5 to 8 fit into one AVX-512 register
+template<size_t N>
+struct SimdColumnAVX512
+{
+	enum{available = true};
+	__m512d s;
+	static inline __mmask8 mask() {return (__mmask8)((1u << N) - 1);}
+	inline void load(const number* v) {s = _mm512_maskz_loadu_pd(mask(), v);}
+	inline void store(number* v) const {_mm512_mask_storeu_pd(v, mask(), s);}
+	inline void fmadd(const number* col, number x)
+		{s = _mm512_fmadd_pd(_mm512_maskz_loadu_pd(mask(), col), _mm512_set1_pd(x), s);}
+	static inline number dot(const number* col, const number* v)
+	{
+		return _mm512_reduce_add_pd(_mm512_mul_pd(_mm512_maskz_loadu_pd(mask(), col),
+		                                          _mm512_maskz_loadu_pd(mask(), v)));
+	}
+};
+
+template<> struct SimdColumn<5> : public SimdColumnAVX512<5> {};
+template<> struct SimdColumn<6> : public SimdColumnAVX512<6> {};
+#else
+template<>
+struct SimdColumn<5>
+{
+	enum{available = true};
+	__m256d s; number s4;
+	inline void load(const number* v) {s = _mm256_loadu_pd(v); s4 = v[4];}
+	inline void store(number* v) const {_mm256_storeu_pd(v, s); v[4] = s4;}
+	inline void fmadd(const number* col, number x)
+		{s = _mm256_fmadd_pd(_mm256_loadu_pd(col), _mm256_set1_pd(x), s); s4 += col[4] * x;}
+	static inline number dot(const number* col, const number* v)
+	{
+		return SimdHorizontalSum(_mm256_mul_pd(_mm256_loadu_pd(col), _mm256_loadu_pd(v)))
+				+ col[4] * v[4];
+	}
+};
+
+template<>
+struct SimdColumn<6>
+{
+	enum{available = true};
+	__m256d s; __m128d s4;
+	inline void load(const number* v) {s = _mm256_loadu_pd(v); s4 = _mm_loadu_pd(v+4);}
+	inline void store(number* v) const {_mm256_storeu_pd(v, s); _mm_storeu_pd(v+4, s4);}
+	inline void fmadd(const number* col, number x)
+	{
+		s = _mm256_fmadd_pd(_mm256_loadu_pd(col), _mm256_set1_pd(x), s);
+		s4 = _mm_fmadd_pd(_mm_loadu_pd(col+4), _mm_set1_pd(x), s4);
+	}
+	static inline number dot(const number* col, const number* v)
+	{
+		return SimdHorizontalSum(_mm256_add_pd(
+					_mm256_mul_pd(_mm256_loadu_pd(col), _mm256_loadu_pd(v)),
+					_mm256_castpd128_pd256(_mm_mul_pd(_mm_loadu_pd(col+4), _mm_loadu_pd(v+4)))));
+	}
+};
+#endif
+#endif
+
+/**
+ * Row operations on fixed-size blocks, used by the block kernels of SpMVKernel.
+ * The generic version loops over the entries of the blocks, since the block
+ * size is known at compile time, the compiler unrolls these loops. For
+ * column-major blocks of the sizes supported by SimdColumn, the explicitly
+ * vectorized version is used.
+ */
+template<size_t N, eMatrixOrdering TOrdering,
+         bool bSimd = (TOrdering == ColMajor) && SimdColumn<N>::available>
+struct SpMVBlockOps
+{
+	typedef DenseMatrix<FixedArray2<number, N, N, TOrdering> > matrix_block;
+	typedef DenseVector<FixedArray1<number, N> > vector_block;
+
+	///	accumulates sum += A[k] * w[cols[k]] for k in [begin, end)
+	template<typename vector_t>
+	static inline void accumulate_row(number* sum, const matrix_block* A,
+	                                  const int* cols, size_t begin, size_t end,
+	                                  const vector_t& w)
+	{
+		for(size_t k = begin; k != end; ++k)
+		{
+			const matrix_block& a = A[k];
+			const vector_block& x = w[cols[k]];
+			for(size_t c = 0; c < N; ++c)
+			{
+				const number xc = x[c];
+				for(size_t r = 0; r < N; ++r)
+					sum[r] += a(r,c) * xc;
+			}
+		}
+	}
+
+	///	computes dest += beta * a^T * w
+	static inline void mult_transposed_add(vector_block& dest, const number& beta,
+	                                       const matrix_block& a, const vector_block& w)
+	{
+		for(size_t c = 0; c < N; ++c)
+		{
+			number sum = 0.0;
+			for(size_t r = 0; r < N; ++r)
+				sum += a(r,c) * w[r];
+			dest[c] += beta * sum;
+		}
+	}
+};
+
+///	explicitly vectorized row operations on column-major blocks
+template<size_t N>
+struct SpMVBlockOps<N, ColMajor, true>
+{
+	typedef DenseMatrix<FixedArray2<number, N, N, ColMajor> > matrix_block;
+	typedef DenseVector<FixedArray1<number, N> > vector_block;
+
+	template<typename vector_t>
+	static inline void accumulate_row(number* sum, const matrix_block* A,
+	                                  const int* cols, size_t begin, size_t end,
+	                                  const vector_t& w)
+	{
+		SimdColumn<N> s;
+		s.load(sum);
+		for(size_t k = begin; k != end; ++k)
+		{
+			const number* a = &A[k](0,0);
+			const vector_block& x = w[cols[k]];
+			for(size_t c = 0; c < N; ++c)
+				s.fmadd(a + c*N, x[c]);
+		}
+		s.store(sum);
+	}
+
+	static inline void mult_transposed_add(vector_block& dest, const number& beta,
+	                                       const matrix_block& a, const vector_block& w)
+	{
+		const number* pa = &a(0,0);
+		const number* pw = &w[0];
+		for(size_t c = 0; c < N; ++c)
+			dest[c] += beta * SimdColumn<N>::dot(pa + c*N, pw);
+	}
+};
+
+/**
+ * Row kernels used by the matrix-vector products of SparseMatrix.
+ *
+ * The generic version uses MatMult/MatMultAdd for every connection. For the
+ * fixed-size blocks of the CPUBlockAlgebra and for scalar entries,
+ * specializations accumulate the whole row in registers and write the result
+ * only once per row. If AVX2 (and FMA) or AVX-512 are enabled by the compiler
+ * flags (cmake option SIMD), explicitly vectorized versions are used for
+ * scalar rows and for column-major blocks of size 2 to 6 (see SimdColumn).
+ * Otherwise, the block size is known at compile time and the compiler unrolls
+ * and possibly vectorizes the block loops.
+ *
+ * \tparam	TValue			type of matrix entries
+ * \tparam	TVectorValue	type of vector entries
+ */
+template<typename TValue, typename TVectorValue>
+struct SpMVKernel
+{
+	///	computes dest += beta * sum_k A[k] * w[cols[k]] for k in [begin, end)
+	template<typename vector_t>
+	static inline void mult_add_row(TVectorValue& dest, const number& beta,
+	                                const TValue* A, const int* cols,
+	                                size_t begin, size_t end, const vector_t& w)
+	{
+		for(size_t k = begin; k != end; ++k)
+			MatMultAdd(dest, 1.0, dest, beta, A[k], w[cols[k]]);
+	}
+
+	///	computes dest = beta * sum_k A[k] * w[cols[k]] for k in [begin, end)
+	template<typename vector_t>
+	static inline void mult_row(TVectorValue& dest, const number& beta,
+	                            const TValue* A, const int* cols,
+	                            size_t begin, size_t end, const vector_t& w)
+	{
+		if(begin == end) {dest = 0.0; return;}
+		MatMult(dest, beta, A[begin], w[cols[begin]]);
+		mult_add_row(dest, beta, A, cols, begin+1, end, w);
+	}
+
+	///	computes dest += beta * a^T * w
+	static inline void mult_transposed_add(TVectorValue& dest, const number& beta,
+	                                       const TValue& a, const TVectorValue& w)
+	{
+		MatMultTransposedAdd(dest, 1.0, dest, beta, a, w);
+	}
+};
+
+///	specialization for scalar entries
+/**	The vectorized versions load the column indices and gather the vector
+ * entries of 4 (AVX2) or 8 (AVX-512) connections at once.*/
+template<>
+struct SpMVKernel<number, number>
+{
+	template<typename vector_t>
+	static inline void mult_add_row(number& dest, const number& beta,
+	                                const number* A, const int* cols,
+	                                size_t begin, size_t end, const vector_t& w)
+	{
+		number sum = 0.0;
+		size_t k = begin;
+#if defined(UG_SPMV_AVX512)
+		if(end - begin >= 8)
+		{
+			const number* pw = &w[0];
+			__m512d s = _mm512_setzero_pd();
+			for(; k + 8 <= end; k += 8)
+			{
+				const __m256i idx = _mm256_loadu_si256((const __m256i*)(cols + k));
+				s = _mm512_fmadd_pd(_mm512_loadu_pd(A + k),
+				                    _mm512_i32gather_pd(idx, pw, 8), s);
+			}
+			sum = _mm512_reduce_add_pd(s);
+		}
+#elif defined(UG_SPMV_AVX2)
+		if(end - begin >= 4)
+		{
+			const number* pw = &w[0];
+			__m256d s = _mm256_setzero_pd();
+			for(; k + 4 <= end; k += 4)
+			{
+				const __m128i idx = _mm_loadu_si128((const __m128i*)(cols + k));
+				s = _mm256_fmadd_pd(_mm256_loadu_pd(A + k),
+				                    _mm256_i32gather_pd(pw, idx, 8), s);
+			}
+			sum = SimdHorizontalSum(s);
+		}
+#endif
+		for(; k != end; ++k)
+			sum += A[k] * w[cols[k]];
+		dest += beta * sum;
+	}
+
+	template<typename vector_t>
+	static inline void mult_row(number& dest, const number& beta,
+	                            const number* A, const int* cols,
+	                            size_t begin, size_t end, const vector_t& w)
+	{
+		dest = 0.0;
+		mult_add_row(dest, beta, A, cols, begin, end, w);
+	}
+
+	static inline void mult_transposed_add(number& dest, const number& beta,
+	                                       const number& a, const number& w)
+	{
+		dest += beta * a * w;
+	}
+};
+
+#ifndef UG_SINGLE_PRECISION
+///	specialization for float entries applied to vectors of doubles
+/**	The entries are converted to double on load and the row is accumulated
+ * in double, such that only the memory traffic of the matrix is reduced.*/
+template<>
+struct SpMVKernel<float, number>
+{
+	template<typename vector_t>
+	static inline void mult_add_row(number& dest, const number& beta,
+	                                const float* A, const int* cols,
+	                                size_t begin, size_t end, const vector_t& w)
+	{
+		number sum = 0.0;
+		size_t k = begin;
+#ifdef UG_SPMV_AVX2
+		if(end - begin >= 4)
+		{
+			const number* pw = &w[0];
+			__m256d s = _mm256_setzero_pd();
+			for(; k + 4 <= end; k += 4)
+			{
+				const __m128i idx = _mm_loadu_si128((const __m128i*)(cols + k));
+				s = _mm256_fmadd_pd(_mm256_cvtps_pd(_mm_loadu_ps(A + k)),
+				                    _mm256_i32gather_pd(pw, idx, 8), s);
+			}
+			sum = SimdHorizontalSum(s);
+		}
+#endif
+		for(; k != end; ++k)
+			sum += (number)A[k] * w[cols[k]];
+		dest += beta * sum;
+	}
+
+	template<typename vector_t>
+	static inline void mult_row(number& dest, const number& beta,
+	                            const float* A, const int* cols,
+	                            size_t begin, size_t end, const vector_t& w)
+	{
+		dest = 0.0;
+		mult_add_row(dest, beta, A, cols, begin, end, w);
+	}
+
+	static inline void mult_transposed_add(number& dest, const number& beta,
+	                                       const float& a, const number& w)
+	{
+		dest += beta * (number)a * w;
+	}
+};
+#endif
+
+///	specialization for fixed-size blocks
+template<size_t N, eMatrixOrdering TOrdering>
+struct SpMVKernel<DenseMatrix<FixedArray2<number, N, N, TOrdering> >,
+                  DenseVector<FixedArray1<number, N> > >
+{
+	typedef DenseMatrix<FixedArray2<number, N, N, TOrdering> > matrix_block;
+	typedef DenseVector<FixedArray1<number, N> > vector_block;
+	typedef SpMVBlockOps<N, TOrdering> block_ops;
+
+	template<typename vector_t>
+	static inline void mult_add_row(vector_block& dest, const number& beta,
+	                                const matrix_block* A, const int* cols,
+	                                size_t begin, size_t end, const vector_t& w)
+	{
+		number sum[N];
+		for(size_t r = 0; r < N; ++r) sum[r] = 0.0;
+		block_ops::accumulate_row(sum, A, cols, begin, end, w);
+		for(size_t r = 0; r < N; ++r) dest[r] += beta * sum[r];
+	}
+
+	template<typename vector_t>
+	static inline void mult_row(vector_block& dest, const number& beta,
+	                            const matrix_block* A, const int* cols,
+	                            size_t begin, size_t end, const vector_t& w)
+	{
+		number sum[N];
+		for(size_t r = 0; r < N; ++r) sum[r] = 0.0;
+		block_ops::accumulate_row(sum, A, cols, begin, end, w);
+		for(size_t r = 0; r < N; ++r) dest[r] = beta * sum[r];
+	}
+
+	static inline void mult_transposed_add(vector_block& dest, const number& beta,
+	                                       const matrix_block& a, const vector_block& w)
+	{
+		block_ops::mult_transposed_add(dest, beta, a, w);
+	}
+};
+
+// end group cpu_algebra
+/// \}
+
+} // end namespace ug
+
+#endif /* __H__UG__CPU_ALGEBRA__SPARSEMATRIX_KERNELS__ */
@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+
+#ifndef __H__UG__CPU_ALGEBRA__SPMV_BENCHMARK__
+#define __H__UG__CPU_ALGEBRA__SPMV_BENCHMARK__
+
+#include "common/log.h"
+#include "common/stopwatch.h"
+#include "common/error.h"
+#include "sparsematrix_kernels.h"
+
+namespace ug{
+
+/// \addtogroup cpu_algebra
+///	@{
+
+///	computes dest = A*w using MatMultAdd for every connection (reference)
+template<typename matrix_type, typename vector_type>
+void SpMVReference(vector_type& dest, const matrix_type& A, const vector_type& w)
+{
+	typedef typename matrix_type::const_row_iterator const_row_iterator;
+	for(size_t i = 0; i < A.num_rows(); ++i)
+	{
+		dest[i] = 0.0;
+		const const_row_iterator itEnd = A.end_row(i);
+		for(const_row_iterator it = A.begin_row(i); it != itEnd; ++it)
+			MatMultAdd(dest[i], 1.0, dest[i], 1.0, it.value(), w[it.index()]);
+	}
+}
+
+/**
+ * Measures the matrix-vector product of a SparseMatrix. The product dest = A*x
+ * is computed numRuns times by the (block-specialized) kernels of
+ * SparseMatrix::axpy and by the generic per-connection loop. For both, the
+ * time per product, the floating point rate and the effective memory bandwidth
+ * (based on the minimal data traffic of matrix, column indices and vectors)
+ * are written to the log.
+ *
+ * \param[in]	A			matrix
+ * \param[in]	x			vector to be multiplied (size must match A)
+ * \param[in]	numRuns		number of products per measurement
+ */
+template<typename matrix_type, typename vector_type>
+void SpMVBenchmark(const matrix_type& A, const vector_type& x, size_t numRuns)
+{
+	if(x.size() != A.num_cols())
+		UG_THROW("SpMVBenchmark: Size of vector ("<<x.size()<<") does not match"
+				" number of columns of matrix ("<<A.num_cols()<<").");
+	if(numRuns == 0) numRuns = 1;
+
+	vector_type dest(A.num_rows());
+	A.defragment();
+
+//	data traffic and operations per product
+	const size_t nnz = A.total_num_connections();
+	size_t blockRows = 1, blockCols = 1;
+	if(A.num_rows() > 0 && A.num_connections(0) > 0)
+	{
+		blockRows = GetRows(A.begin_row(0).value());
+		blockCols = GetCols(A.begin_row(0).value());
+	}
+	const double flop = 2.0 * nnz * blockRows * blockCols;
+	const double bytes = nnz * (blockRows * blockCols * sizeof(number) + sizeof(int))
+						+ (A.num_rows() * blockRows + A.num_cols() * blockCols) * sizeof(number)
+						+ 2 * A.num_rows() * sizeof(int);
+
+//	kernel path
+	A.axpy(dest, 0.0, dest, 1.0, x);
+	double start = get_clock_s();
+	for(size_t i = 0; i < numRuns; ++i)
+		A.axpy(dest, 0.0, dest, 1.0, x);
+	const double tKernel = (get_clock_s() - start) / numRuns;
+
+//	reference path
+	SpMVReference(dest, A, x);
+	start = get_clock_s();
+	for(size_t i = 0; i < numRuns; ++i)
+		SpMVReference(dest, A, x);
+	const double tRef = (get_clock_s() - start) / numRuns;
+
+	UG_LOG("SpMVBenchmark: " << A.num_rows() << " rows, " << nnz << " connections"
+			" of size " << blockRows << "x" << blockCols << ", " << numRuns << " runs\n");
+	UG_LOG("  instruction set of kernels: " << SpMVKernelInstructionSet() << "\n");
+	UG_LOG("  kernel    : " << tKernel*1e3 << " ms, "
+			<< (tKernel > 0 ? flop/tKernel*1e-9 : 0.0) << " GFLOP/s, "
+			<< (tKernel > 0 ? bytes/tKernel*1e-9 : 0.0) << " GB/s\n");
+	UG_LOG("  reference : " << tRef*1e3 << " ms, "
+			<< (tRef > 0 ? flop/tRef*1e-9 : 0.0) << " GFLOP/s, "
+			<< (tRef > 0 ? bytes/tRef*1e-9 : 0.0) << " GB/s\n");
+	if(tKernel > 0)
+		UG_LOG("  speedup   : " << tRef/tKernel << "\n");
+}
+
+// end group cpu_algebra
+/// \}
+
+} // end namespace ug
+
+#endif /* __H__UG__CPU_ALGEBRA__SPMV_BENCHMARK__ */
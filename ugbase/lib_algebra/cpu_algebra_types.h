@@ -90,6 +90,31 @@ struct CPUAlgebra
 	}
 };
 
+/// mixed precision variant of the CPUAlgebra
+/**
+ * The matrix entries are stored in single precision, the vectors are the
+ * double precision vectors of the CPUAlgebra. Matrices of this algebra are
+ * not assembled, but converted from the CPUAlgebra in order to store
+ * preconditioners (e.g. ILU factors) in single precision and to halve the
+ * memory traffic of their matrix products (see MixedPrecisionIterator).
+ */
+struct CPUMixedAlgebra
+{
+#ifdef UG_PARALLEL
+		typedef ParallelMatrix<SparseMatrix<float> > matrix_type;
+		typedef ParallelVector<Vector<double> > vector_type;
+#else
+		typedef SparseMatrix<float> matrix_type;
+		typedef Vector<double> vector_type;
+#endif
+
+	static const int blockSize = 1;
+	static AlgebraType get_type()
+	{
+		return AlgebraType(AlgebraType::CPU, 1);
+	}
+};
+
 // end group cpu_algebra
 /// \}
 
@@ -210,6 +210,17 @@ public:
 			return axpy(res, 1.0, res, -1.0, x);
 		}
 
+		//! calculate res[j] = A x[j] for all vectors of the multi-vectors
+		// (one cuSPARSE product per vector)
+		template<typename multi_vector_t>
+		bool apply_multi(multi_vector_t &res, const multi_vector_t &x) const
+		{
+			bool bRes = true;
+			for(size_t j=0; j<x.size(); j++)
+				bRes &= apply(res[j], x[j]);
+			return bRes;
+		}
+
 
 
 	/**
@@ -83,6 +83,11 @@ class IConvergenceCheck
 		/// computes the defect and sets it a the next defect value
 		virtual void update(const TVector& d) = 0;
 
+		/// returns if the defect is the euclidean norm of the defect vector
+		/**	If true, solvers may compute the norm within fused vector operations
+		 * and pass it by update_defect instead of calling update.*/
+		virtual bool defect_is_euclidean_norm() const {return false;}
+
 		/** iteration_ended
 		 *
 		 *	Checks if the iteration must be ended.
@@ -198,6 +203,8 @@ class StdConvCheck : public IConvergenceCheck<TVector>
 
 		void update(const TVector& d);
 
+		bool defect_is_euclidean_norm() const {return true;}
+
 		bool iteration_ended();
 
 		bool post();
@@ -210,6 +217,7 @@ class StdConvCheck : public IConvergenceCheck<TVector>
 		}
 
 		number reduction() const {return m_currentDefect/m_initialDefect;};
+		number get_reduction() const {return m_relReduction;}
 		number defect() const {return m_currentDefect;};
 		number previous_defect() const { return m_lastDefect; }
 		int step() const {return m_currentStep;}
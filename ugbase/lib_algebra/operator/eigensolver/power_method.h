@@ -92,6 +92,9 @@ class PowerMethod
 		size_t m_maxIterations;
 		double m_dPrecision;
 
+	//	print convergence information
+		bool m_bVerbose;
+
 	//	Residual
 		SmartPtr<vector_type> m_spResidual;
 
@@ -105,13 +108,14 @@ class PowerMethod
 
 		PowerMethod()
 		{
-			UG_LOG("Initializing PowerMethod." << std::endl);
+			UG_DLOG(LIB_ALG_LINEAR_SOLVER, 1, "Initializing PowerMethod." << std::endl);
 			m_spLinOpA = SPNULL;
 			m_spLinOpB = SPNULL;
 			m_spMatOpA = SPNULL;
 			m_spMatOpB = SPNULL;
 			m_maxIterations = 1000;
 			m_dPrecision = 1e-8;
+			m_bVerbose = true;
 			m_iteration = 0;
 			m_dMaxEigenvalue = 0.0;
 			m_dMinEigenvalue = 0.0;
@@ -126,9 +130,13 @@ class PowerMethod
 		void set_linear_operator_A(SmartPtr<ILinearOperator<vector_type> > loA)
 		{
 			m_spLinOpA = loA;
+			m_vbDirichlet.clear();
+			m_numDirichletRows = 0;
 
-		// 	get dirichlet nodes
+		// 	get dirichlet nodes (only available for matrix operators)
 			m_spMatOpA = m_spLinOpA.template cast_dynamic<MatrixOperator<matrix_type, vector_type> >();
+			if(m_spMatOpA.invalid()) return;
+
 			matrix_type& A = m_spMatOpA->get_matrix();
 			m_vbDirichlet.resize(A.num_rows());
 
@@ -162,6 +170,11 @@ class PowerMethod
 			m_dPrecision = precision;
 		}
 
+		void set_verbose(bool verbose)
+		{
+			m_bVerbose = verbose;
+		}
+
 		int calculate_max_eigenvalue()
 		{
 			PROFILE_FUNC_GROUP("PowerMethod");
@@ -171,6 +184,7 @@ class PowerMethod
 				m_spSolver->init(m_spLinOpB);
 
 			m_spResidual = create_approximation_vector();
+			m_vbDirichlet.resize(m_spEigenvector->size(), false);
 
 			for(m_iteration = 0; m_iteration < m_maxIterations; ++m_iteration)
 			{
@@ -213,11 +227,12 @@ class PowerMethod
 
 				if(m_spResidual->norm() <= m_dPrecision)
 				{
-					UG_LOG("PowerMethod::calculate_max_eigenvalue() converged after " << m_iteration << " iterations." << std::endl);
+					if(m_bVerbose)
+						UG_LOG("PowerMethod::calculate_max_eigenvalue() converged after " << m_iteration << " iterations." << std::endl);
 					break;
 				}
 
-				if(m_iteration == m_maxIterations-1)
+				if(m_iteration == m_maxIterations-1 && m_bVerbose)
 					UG_LOG("PowerMethod::calculate_max_eigenvalue() reached precision of " << m_spResidual->norm() << " after " << m_maxIterations << " iterations." << std::endl);
 			}
 
@@ -236,6 +251,7 @@ class PowerMethod
 			UG_COND_THROW(m_spSolver == SPNULL, "PowerMethod::calculate_min_eigenvalue(): Solver not set, please specify.");
 
 			m_spResidual = create_approximation_vector();
+			m_vbDirichlet.resize(m_spEigenvector->size(), false);
 
 			m_spSolver->init(m_spLinOpA);
 
@@ -285,11 +301,12 @@ class PowerMethod
 
 				if(m_spResidual->norm() <= m_dPrecision)
 				{
-					UG_LOG("PowerMethod::calculate_min_eigenvalue() converged after " << m_iteration << " iterations." << std::endl);
+					if(m_bVerbose)
+						UG_LOG("PowerMethod::calculate_min_eigenvalue() converged after " << m_iteration << " iterations." << std::endl);
 					break;
 				}
 
-				if(m_iteration == m_maxIterations-1)
+				if(m_iteration == m_maxIterations-1 && m_bVerbose)
 					UG_LOG("PowerMethod::calculate_min_eigenvalue() reached precision of " << m_spResidual->norm() << " after " << m_maxIterations << " iterations." << std::endl);
 			}
 
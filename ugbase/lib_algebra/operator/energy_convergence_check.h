@@ -67,6 +67,8 @@ class EnergyConvCheck : public StdConvCheck<TVector>
 		base_type::update_defect(energy_norm(d));
 	}
 
+	bool defect_is_euclidean_norm() const {return false;}
+
 	double energy_norm(const TVector &d)
 	{
 		if(tmp.valid() == false || tmp->size() != d.size())
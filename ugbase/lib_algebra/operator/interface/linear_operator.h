@@ -34,6 +34,8 @@
 #define __H__LIB_ALGEBRA__OPERATOR__INTERFACE__LINEAR_OPERATOR__
 
 #include "operator.h"
+#include "common/error.h"
+#include "lib_algebra/common/multi_vector.h"
 
 namespace ug{
 
@@ -138,6 +140,25 @@ class ILinearOperator : public IOperator<X,Y>
 	 */
 		virtual void apply_sub(Y& f, const X& u) = 0;
 
+	// 	applies the operator to several functions at once
+	/**
+	 * This method applies the operator to all vectors of a multi-vector, i.e.
+	 * f[j] = L*u[j]. The default implementation calls apply for every vector.
+	 * Matrix based operators overwrite this method in order to read the
+	 * matrix only once for all vectors.
+	 *
+	 * \param[in]	u		domain functions
+	 * \param[out]	f		codomain functions
+	 */
+		virtual void apply_multi(MultiVector<Y>& f, const MultiVector<X>& u)
+		{
+			if(f.size() != u.size())
+				UG_THROW("ILinearOperator::apply_multi: Number of vectors does "
+						"not match ("<<f.size()<<" != "<<u.size()<<").");
+			for(size_t j = 0; j < u.size(); ++j)
+				apply(f[j], u[j]);
+		}
+
 	/// virtual	destructor
 		virtual ~ILinearOperator() {};
 };
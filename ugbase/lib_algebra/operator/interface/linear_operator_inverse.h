@@ -192,6 +192,29 @@ class ILinearOperatorInverse : public ILinearIterator<X,Y>
 			return apply_return_defect(u,f);
 		}
 
+	///	applies inverse operator for several right-hand sides, i.e. returns u[j] = A^{-1} f[j]
+	/**
+	 * This method solves for all vectors of the multi-vector f. The default
+	 * implementation calls apply for every right-hand side. Block solvers
+	 * (e.g. BlockCG, BlockGMRES) overwrite this method in order to solve for
+	 * all right-hand sides at once.
+	 *
+	 * \param[in]	f		right-hand sides
+	 * \param[out]	u		solutions
+	 * \returns		bool	success flag
+	 */
+		virtual bool apply_multi(MultiVector<Y>& u, const MultiVector<X>& f)
+		{
+			if(u.size() != f.size())
+				UG_THROW(name() << "::apply_multi: Number of solutions ("
+						<<u.size()<<") does not match number of right-hand "
+						"sides ("<<f.size()<<").");
+			bool bRes = true;
+			for(size_t j = 0; j < f.size(); ++j)
+				bRes &= apply(u[j], f[j]);
+			return bRes;
+		}
+
 		virtual SmartPtr<ILinearIterator<X,Y> > clone()
 		{
 			UG_THROW("No cloning implemented.");
@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+
+#ifndef __H__LIB_ALGEBRA__OPERATOR__INTERFACE__MATRIX_FREE_OPERATOR__
+#define __H__LIB_ALGEBRA__OPERATOR__INTERFACE__MATRIX_FREE_OPERATOR__
+
+#include "linear_operator.h"
+
+namespace ug{
+
+///////////////////////////////////////////////////////////////////////////////
+// Matrix-free linear operator
+///////////////////////////////////////////////////////////////////////////////
+
+///	describes a linear operator that is applied without assembling a matrix
+/**
+ * This class is the base class for linear operators that compute the action
+ * f = L*u without storing L as a matrix. Since no matrix entries are available,
+ * only the diagonal of the operator is provided in addition. This is sufficient
+ * for smoothers like (damped) Jacobi or Chebyshev iterations.
+ *
+ * The diagonal is returned in consistent storage type.
+ *
+ * \tparam	X 	Domain space function
+ * \tparam	Y	Range space function
+ */
+template <typename X, typename Y = X>
+class IMatrixFreeOperator : public virtual ILinearOperator<X,Y>
+{
+	public:
+	///	Domain space
+		typedef X domain_function_type;
+
+	///	Range space
+		typedef Y codomain_function_type;
+
+	public:
+	///	returns the diagonal of the operator (consistent)
+		virtual const Y& diagonal() = 0;
+
+	///	virtual destructor
+		virtual ~IMatrixFreeOperator() {};
+};
+
+} // end namespace ug
+#endif /* __H__LIB_ALGEBRA__OPERATOR__INTERFACE__MATRIX_FREE_OPERATOR__ */
@@ -70,6 +70,9 @@ class MatrixOperator :	public virtual ILinearOperator<X,Y>,
 	// 	Apply Operator, i.e. f = f - L*u;
 		virtual void apply_sub(Y& f, const X& u) {matrix_type::matmul_minus(f,u);}
 
+	// 	Apply Operator to several functions, i.e. f[j] = L*u[j]
+		virtual void apply_multi(MultiVector<Y>& f, const MultiVector<X>& u) {matrix_type::apply_multi(f,u);}
+
 	// 	Access to matrix
 		virtual M& get_matrix() {return *this;};
 };
@@ -147,6 +147,9 @@ class BiCGStab
 		//	restart flag (set to true at first run)
 			bool bRestart = true;
 
+		//	compute defect norm in fused vector operations
+			const bool bFusedDefect = convergence_check()->defect_is_euclidean_norm();
+
 			write_debugXR(x, r, convergence_check()->step(), 'i');
 
 		// 	Iteration loop
@@ -276,14 +279,18 @@ class BiCGStab
 			//	alpha = rho/(v,r)
 				alpha = rho/alpha;
 
-			// 	add: x := x + alpha * q
-				VecScaleAdd(x, 1.0, x, alpha, q);
-
-			//  compute s = r - alpha*v
-				VecScaleAdd(s, 1.0, r, -alpha, v);
+			// 	add: x := x + alpha * q and compute s = r - alpha*v
+				if(bFusedDefect)
+					convergence_check()->update_defect(
+						sqrt(VecUpdateNormSquared(x, alpha, q, s, 1.0, r, -alpha, v)));
+				else
+				{
+					VecScaleAdd(x, 1.0, x, alpha, q);
+					VecScaleAdd(s, 1.0, r, -alpha, v);
 
-			// 	check convergence
-				convergence_check()->update(s);
+				// 	check convergence
+					convergence_check()->update(s);
+				}
 
 				write_debugXR(x, s, convergence_check()->step(), 'a');
 
@@ -329,18 +336,15 @@ class BiCGStab
 					UG_THROW("BiCGStab: Cannot convert t to unique vector.");
 				#endif
 
-			// 	tt = (t,t)
+			// 	tt = (t,t) and omega = (s,t)
 				number tt;
 				if (!t.size())
+				{
 					tt = 1.0;
-				else
-					tt = VecProd(t, t);
-
-			// 	omega = (s,t)
-				if (!s.size())
 					omega = 1.0;
+				}
 				else
-					omega = VecProd(s, t);
+					VecProd2(t, t, s, tt, omega);
 
 			//	check tt
 				if(tt == 0.0)
@@ -353,14 +357,18 @@ class BiCGStab
 			// 	omega = (s,t)/(t,t)
 				omega = omega/tt;
 
-			// 	add: x := x + omega * q
-				VecScaleAdd(x, 1.0, x, omega, q);
-
-			//  compute r = s - omega*t
-				VecScaleAdd(r, 1.0, s, -omega, t);
+			// 	add: x := x + omega * q and compute r = s - omega*t
+				if(bFusedDefect)
+					convergence_check()->update_defect(
+						sqrt(VecUpdateNormSquared(x, omega, q, r, 1.0, s, -omega, t)));
+				else
+				{
+					VecScaleAdd(x, 1.0, x, omega, q);
+					VecScaleAdd(r, 1.0, s, -omega, t);
 
-			// 	check convergence
-				convergence_check()->update(r);
+				// 	check convergence
+					convergence_check()->update(r);
+				}
 
 				write_debugXR(x, r, convergence_check()->step(), 'b');
 
@@ -0,0 +1,427 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+
+#ifndef __H__UG__LIB_DISC__OPERATOR__LINEAR_SOLVER__BLOCK_CG__
+#define __H__UG__LIB_DISC__OPERATOR__LINEAR_SOLVER__BLOCK_CG__
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <cmath>
+
+#include "lib_algebra/operator/interface/operator.h"
+#include "lib_algebra/operator/interface/preconditioned_linear_operator_inverse.h"
+#include "lib_algebra/common/multi_vector.h"
+#include "lib_algebra/small_algebra/small_algebra.h"
+#include "common/profiler/profiler.h"
+#ifdef UG_PARALLEL
+	#include "lib_algebra/parallelization/parallelization.h"
+#endif
+
+namespace ug{
+
+///	the block CG method as a solver for several right-hand sides
+/**
+ * This class implements the block CG method for the solution of linear
+ * operator problems A*X = B with k right-hand sides at once. The search
+ * directions of all right-hand sides span a common block Krylov space, i.e.
+ * the coefficients alpha and beta of the CG method become k x k matrices.
+ * Per iteration, the operator (and the preconditioner) is applied to k
+ * vectors at once (see ILinearOperator::apply_multi) and all inner products
+ * of an iteration are computed in one pass (with one global reduction).
+ *
+ * The convergence check is applied to the largest defect of all right-hand
+ * sides. In order to avoid the breakdown of the block method when the
+ * search directions become linearly dependent (e.g. if one right-hand side
+ * converges faster than the others, or for linearly dependent right-hand
+ * sides), the search directions are orthonormalized in every iteration and
+ * directions that are linearly dependent (up to the deflation tolerance) on
+ * the others are removed from the block (breakdown-free block CG).
+ *
+ * For a single right-hand side, the method reduces to the standard CG method.
+ *
+ * For detailed description of the algorithm, please refer to:
+ *
+ * - O'Leary, "The block conjugate gradient algorithm and related methods",
+ *   Linear Algebra and its Applications 29 (1980), 293-322
+ *
+ * - Ji, Li, "A breakdown-free block conjugate gradient method", BIT
+ *   Numerical Mathematics 57 (2017), 379-403
+ *
+ * \tparam 	TVector		vector type
+ */
+template <typename TVector>
+class BlockCG
+	: public IPreconditionedLinearOperatorInverse<TVector>
+{
+	public:
+	///	Vector type
+		typedef TVector vector_type;
+
+	///	Multi-Vector type
+		typedef MultiVector<TVector> multi_vector_type;
+
+	///	Base type
+		typedef IPreconditionedLinearOperatorInverse<vector_type> base_type;
+
+	protected:
+		using base_type::convergence_check;
+		using base_type::linear_operator;
+		using base_type::preconditioner;
+
+	public:
+	///	constructors
+		BlockCG() : base_type(), m_deflationTol(1e-8) {}
+
+		BlockCG(SmartPtr<ILinearIterator<vector_type,vector_type> > spPrecond)
+			: base_type ( spPrecond ), m_deflationTol(1e-8)  {}
+
+		BlockCG(SmartPtr<ILinearIterator<vector_type,vector_type> > spPrecond, SmartPtr<IConvergenceCheck<vector_type> > spConvCheck)
+			: base_type ( spPrecond, spConvCheck), m_deflationTol(1e-8)  {}
+
+	///	name of solver
+		virtual const char* name() const {return "BlockCG";}
+
+	///	returns if parallel solving is supported
+		virtual bool supports_parallel() const
+		{
+			if(preconditioner().valid())
+				return preconditioner()->supports_parallel();
+			return true;
+		}
+
+	///	sets the relative norm below which a search direction is considered linearly dependent
+		void set_deflation_tolerance(number tol) {m_deflationTol = tol;}
+
+	///	Solve J(u)*x = b, such that x = J(u)^{-1} b
+		virtual bool apply_return_defect(vector_type& x, vector_type& b)
+		{
+			std::vector<vector_type*> vX(1, &x);
+			std::vector<vector_type*> vR(1, &b);
+			return solve(vX, vR);
+		}
+
+	///	Solve J(u)*u[j] = f[j] for all right-hand sides at once
+		virtual bool apply_multi(multi_vector_type& u, const multi_vector_type& f)
+		{
+			if(u.size() != f.size())
+				UG_THROW("BlockCG::apply_multi: Number of solutions ("
+						<<u.size()<<") does not match number of right-hand "
+						"sides ("<<f.size()<<").");
+
+		//	copy right-hand sides, they are replaced by the defects
+			std::vector<SmartPtr<vector_type> > vspR(f.size());
+			std::vector<vector_type*> vX(f.size()), vR(f.size());
+			for(size_t j = 0; j < f.size(); ++j)
+			{
+				vspR[j] = f[j].clone();
+				vR[j] = vspR[j].get();
+				vX[j] = &u[j];
+			}
+
+			return solve(vX, vR);
+		}
+
+		virtual std::string config_string() const
+		{
+			std::stringstream ss;
+			ss << "BlockCG ( deflation tolerance = " << m_deflationTol << ")\n";
+			ss << base_type::config_string_preconditioner_convergence_check();
+			return ss.str();
+		}
+
+	protected:
+	///	solves for all right-hand sides, vR contains the right-hand sides on entry and the defects on exit
+		bool solve(std::vector<vector_type*>& vX, std::vector<vector_type*>& vR)
+		{
+			PROFILE_BEGIN_GROUP(BlockCG_solve, "CG algebra");
+			const size_t k = vX.size();
+			if(k == 0) return true;
+
+		//	check parallel storage types
+			#ifdef UG_PARALLEL
+			for(size_t j = 0; j < k; ++j)
+				if(!vR[j]->has_storage_type(PST_ADDITIVE) || !vX[j]->has_storage_type(PST_CONSISTENT))
+					UG_THROW("BlockCG::solve: Inadequate storage format of Vectors.");
+			#endif
+
+		// 	build defects:  r[j] := b[j] - A*x[j]
+			for(size_t j = 0; j < k; ++j)
+				linear_operator()->apply_sub(*vR[j], *vX[j]);
+
+		//	help vectors (z, p, w are consistent, q is additive)
+			std::vector<SmartPtr<vector_type> > vZ(k), vP(k), vW(k), vQ(k);
+			for(size_t j = 0; j < k; ++j)
+			{
+				vZ[j] = vX[j]->clone_without_values();
+				vP[j] = vX[j]->clone_without_values();
+				vW[j] = vX[j]->clone_without_values();
+				vQ[j] = vX[j]->clone_without_values();
+			}
+
+		//	compute start defect
+			prepare_conv_check();
+			convergence_check()->start_defect(max_defect(vR));
+
+		// 	preconditioning z := M^{-1} r
+			for(size_t j = 0; j < k; ++j)
+				if(!precondition(*vZ[j], *vR[j])) return false;
+
+		// 	start search directions P := orth(Z)
+			for(size_t j = 0; j < k; ++j) *vW[j] = *vZ[j];
+			size_t s = orthonormalize(vP, vW);
+
+			std::vector<number> vPQR, vPQ, vQZ, vAlpha, vBeta;
+
+		// 	Iteration loop
+			while(!convergence_check()->iteration_ended())
+			{
+				if(s == 0)
+				{
+					UG_LOG("ERROR in 'BlockCG::solve': No linearly independent "
+							"search directions left. Aborting solver.\n");
+					return false;
+				}
+
+			// 	build Q = A*P (q is additive afterwards)
+				multi_vector_type mvP, mvQ;
+				for(size_t i = 0; i < s; ++i)
+				{
+					mvP.add_vector(vP[i]);
+					mvQ.add_vector(vQ[i]);
+				}
+				linear_operator()->apply_multi(mvQ, mvP);
+
+			//	compute P^T*Q and P^T*R with one reduction
+				std::vector<const vector_type*> vConstP = const_ptrs(vP, s);
+				std::vector<const vector_type*> vQR = const_ptrs(vQ, s);
+				vQR.insert(vQR.end(), vR.begin(), vR.end());
+				VecBlockProd(vConstP, vQR, vPQR);
+				split_columns(vPQ, vAlpha, vPQR, s, s, k);
+
+			//	alpha = (P^T Q)^{-1} (P^T R)
+				if(!solve_small(vAlpha, vPQ, vAlpha, s, k))
+				{
+					UG_LOG("ERROR in 'BlockCG::solve': P^T*A*P is singular. "
+							"Aborting solver.\n");
+					return false;
+				}
+
+			// 	update X := X + P*alpha and R := R - Q*alpha
+				VecBlockScaleAppend(vX, vConstP, vAlpha);
+				for(size_t i = 0; i < vAlpha.size(); ++i) vAlpha[i] *= -1.0;
+				VecBlockScaleAppend(vR, const_ptrs(vQ, s), vAlpha);
+
+			// 	check convergence
+				convergence_check()->update_defect(max_defect(vR));
+				if(convergence_check()->iteration_ended()) break;
+
+			// 	preconditioning z := M^{-1} r
+				for(size_t j = 0; j < k; ++j)
+					if(!precondition(*vZ[j], *vR[j])) return false;
+
+			//	beta = -(P^T Q)^{-1} (Q^T Z)
+				VecBlockProd(const_ptrs(vQ, s), const_ptrs(vZ, k), vQZ);
+				if(!solve_small(vBeta, vPQ, vQZ, s, k))
+				{
+					UG_LOG("ERROR in 'BlockCG::solve': P^T*A*P is singular. "
+							"Aborting solver.\n");
+					return false;
+				}
+				for(size_t i = 0; i < vBeta.size(); ++i) vBeta[i] *= -1.0;
+
+			// 	new directions P := orth(Z + P*beta)
+				for(size_t j = 0; j < k; ++j) *vW[j] = *vZ[j];
+				VecBlockScaleAppend(ptrs(vW, k), vConstP, vBeta);
+				s = orthonormalize(vP, vW);
+			}
+
+		//	post output
+			return convergence_check()->post();
+		}
+
+	///	orthonormalizes the vectors vW and swaps the linearly independent ones to vP
+	/**
+	 * The vectors are orthonormalized by classical Gram-Schmidt (applied twice
+	 * and fused with the norm computation). A vector whose norm is reduced
+	 * below the deflation tolerance times its original norm is linearly
+	 * dependent on the previous ones and dropped. The returned number s of
+	 * independent vectors is stored in vP[0, s), the vectors are consistent.
+	 */
+		size_t orthonormalize(std::vector<SmartPtr<vector_type> >& vP,
+		                      std::vector<SmartPtr<vector_type> >& vW)
+		{
+			std::vector<const vector_type*> vKept;
+			std::vector<number> vH;
+			size_t s = 0;
+			for(size_t j = 0; j < vW.size(); ++j)
+			{
+				vector_type& w = *vW[j];
+				#ifdef UG_PARALLEL
+				if(!w.change_storage_type(PST_UNIQUE))
+					UG_THROW("BlockCG: Cannot convert w to unique vector.");
+				#endif
+				const number normBefore = w.norm();
+				number norm = normBefore;
+				for(int pass = 0; pass < 2 && !vKept.empty(); ++pass)
+				{
+					VecMultiProd(w, vKept, vH);
+					for(size_t i = 0; i < vH.size(); ++i) vH[i] *= -1.0;
+					norm = std::sqrt(VecMultiScaleAppendNormSquared(w, vKept, vH));
+				}
+
+				if(norm == 0.0 || norm <= m_deflationTol * normBefore) continue;
+
+				w *= 1./norm;
+				std::swap(vP[s], vW[j]);
+				vKept.push_back(vP[s].get());
+				++s;
+			}
+
+			#ifdef UG_PARALLEL
+			for(size_t i = 0; i < s; ++i)
+				if(!vP[i]->change_storage_type(PST_CONSISTENT))
+					UG_THROW("BlockCG: Cannot convert p to consistent vector.");
+			#endif
+			return s;
+		}
+
+	///	returns the maximum of the defect norms of all columns
+		number max_defect(std::vector<vector_type*>& vR)
+		{
+			number maxDefect = 0.0;
+			for(size_t j = 0; j < vR.size(); ++j)
+				maxDefect = std::max(maxDefect, vR[j]->norm());
+			return maxDefect;
+		}
+
+	///	computes z = M^{-1} r (or z = r without preconditioner) and makes z consistent
+		bool precondition(vector_type& z, vector_type& r)
+		{
+			if(preconditioner().valid())
+			{
+				if(!preconditioner()->apply(z, r))
+				{
+					UG_LOG("ERROR in 'BlockCG::solve': "
+							"Cannot apply preconditioner. Aborting.\n");
+					return false;
+				}
+			}
+			else z = r;
+
+			#ifdef UG_PARALLEL
+			if(!z.change_storage_type(PST_CONSISTENT))
+				UG_THROW("BlockCG::solve: Cannot convert z to consistent vector.");
+			#endif
+			return true;
+		}
+
+	///	splits the rows x (m1 + m2) matrix vS (row-major) into its first m1 and last m2 columns
+		static void split_columns(std::vector<number>& vS1, std::vector<number>& vS2,
+		                          const std::vector<number>& vS, size_t rows,
+		                          size_t m1, size_t m2)
+		{
+			vS1.resize(rows*m1); vS2.resize(rows*m2);
+			for(size_t r = 0; r < rows; ++r)
+			{
+				for(size_t c = 0; c < m1; ++c) vS1[r*m1+c] = vS[r*(m1+m2)+c];
+				for(size_t c = 0; c < m2; ++c) vS2[r*m2+c] = vS[r*(m1+m2)+m1+c];
+			}
+		}
+
+	///	solves the s x s system S*X = B with k right-hand sides (row-major storage)
+		bool solve_small(std::vector<number>& vX, const std::vector<number>& vS,
+		                 const std::vector<number>& vB, size_t s, size_t k) const
+		{
+			DenseMatrix<VariableArray2<number> > S;
+			S.resize(s, s);
+			for(size_t r = 0; r < s; ++r)
+				for(size_t c = 0; c < s; ++c)
+					S(r,c) = vS[r*s+c];
+
+			DenseMatrixInverse<VariableArray2<number> > invS;
+			if(!invS.set_as_inverse_of(S)) return false;
+
+			std::vector<number> vRes(s*k);
+			DenseVector<VariableArray1<number> > col;
+			col.resize(s);
+			for(size_t c = 0; c < k; ++c)
+			{
+				for(size_t r = 0; r < s; ++r) col[r] = vB[r*k+c];
+				invS.apply(col);
+				for(size_t r = 0; r < s; ++r) vRes[r*k+c] = col[r];
+			}
+			vX.swap(vRes);
+			return true;
+		}
+
+	///	returns pointers to the first num vectors
+	/// \{
+		static std::vector<vector_type*> ptrs(std::vector<SmartPtr<vector_type> >& vVec, size_t num)
+		{
+			std::vector<vector_type*> vRes(num);
+			for(size_t i = 0; i < num; ++i) vRes[i] = vVec[i].get();
+			return vRes;
+		}
+		static std::vector<const vector_type*> const_ptrs(std::vector<SmartPtr<vector_type> >& vVec, size_t num)
+		{
+			std::vector<const vector_type*> vRes(num);
+			for(size_t i = 0; i < num; ++i) vRes[i] = vVec[i].get();
+			return vRes;
+		}
+	/// \}
+
+	///	adjust output of convergence check
+		void prepare_conv_check()
+		{
+		//	set iteration symbol and name
+			convergence_check()->set_name(name());
+			convergence_check()->set_symbol('%');
+
+		//	set preconditioner string
+			std::string s;
+			if(preconditioner().valid())
+			  s = std::string(" (Precond: ") + preconditioner()->name() + ")";
+			else
+				s = " (No Preconditioner) ";
+			convergence_check()->set_info(s);
+		}
+
+	protected:
+	///	relative norm below which a search direction is considered linearly dependent
+		number m_deflationTol;
+};
+
+} // end namespace ug
+
+#endif /* __H__UG__LIB_DISC__OPERATOR__LINEAR_SOLVER__BLOCK_CG__ */
@@ -0,0 +1,504 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+
+#ifndef __H__UG__LIB_DISC__OPERATOR__LINEAR_SOLVER__BLOCK_GMRES__
+#define __H__UG__LIB_DISC__OPERATOR__LINEAR_SOLVER__BLOCK_GMRES__
+
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "lib_algebra/operator/interface/operator.h"
+#include "lib_algebra/operator/interface/preconditioned_linear_operator_inverse.h"
+#include "lib_algebra/common/multi_vector.h"
+#include "common/profiler/profiler.h"
+#ifdef UG_PARALLEL
+	#include "lib_algebra/parallelization/parallelization.h"
+#endif
+
+namespace ug{
+
+///	the block GMRES method as a solver for several right-hand sides
+/**
+ * This class implements the restarted block GMRES method for the solution of
+ * linear operator problems A*X = B with k right-hand sides at once. The
+ * method builds a block Krylov space with k new vectors per iteration, such
+ * that the operator is applied to k vectors at once (see
+ * ILinearOperator::apply_multi) and the orthogonalization against the
+ * previous blocks is done with fused inner products (one global reduction
+ * per Gram-Schmidt pass).
+ *
+ * In contrast to GMRES, the preconditioner is applied from the right and the
+ * preconditioned directions are stored (as in flexible GMRES). Thus, the
+ * residual norms of the least squares problem are the norms of the true
+ * defects and the convergence check is updated in every iteration with the
+ * largest defect of all right-hand sides. Columns whose defect is smaller
+ * than the deflation tolerance times the largest defect are not iterated in
+ * the next restart cycle. Note, that a restart cycle stores (restart+1)*k
+ * Krylov vectors and restart*k preconditioned directions, i.e. the restart
+ * parameter counts blocks and may be chosen smaller than for GMRES.
+ *
+ * For detailed description of the algorithm, please refer to:
+ *
+ * - Saad, "Iterative Methods For Sparse Linear Systems", p208, Alg. 6.23
+ *
+ * \tparam 	TVector		vector type
+ */
+template <typename TVector>
+class BlockGMRES
+	: public IPreconditionedLinearOperatorInverse<TVector>
+{
+	public:
+	///	Vector type
+		typedef TVector vector_type;
+
+	///	Multi-Vector type
+		typedef MultiVector<TVector> multi_vector_type;
+
+	///	Base type
+		typedef IPreconditionedLinearOperatorInverse<vector_type> base_type;
+
+	protected:
+		using base_type::convergence_check;
+		using base_type::linear_operator;
+		using base_type::preconditioner;
+
+	public:
+	///	constructor setting the number of blocks per restart cycle
+		BlockGMRES(size_t restart) : m_restart(restart), m_deflationTol(1e-10) {}
+
+	///	constructor setting the preconditioner and the convergence check
+		BlockGMRES( size_t restart,
+		            SmartPtr<ILinearIterator<vector_type> > spPrecond,
+		            SmartPtr<IConvergenceCheck<vector_type> > spConvCheck)
+			: base_type(spPrecond, spConvCheck), m_restart(restart),
+			  m_deflationTol(1e-10)
+		{}
+
+	///	name of solver
+		virtual const char* name() const {return "BlockGMRES";}
+
+	///	returns if parallel solving is supported
+		virtual bool supports_parallel() const
+		{
+			if(preconditioner().valid())
+				return preconditioner()->supports_parallel();
+			return true;
+		}
+
+	///	sets the relative defect below which a column is not iterated
+		void set_deflation_tolerance(number tol) {m_deflationTol = tol;}
+
+	// 	Solve J(u)*x = b, such that x = J(u)^{-1} b
+		virtual bool apply_return_defect(vector_type& x, vector_type& b)
+		{
+			SmartPtr<vector_type> spB = b.clone();
+			std::vector<vector_type*> vX(1, &x), vR(1, &b);
+			std::vector<const vector_type*> vB(1, spB.get());
+			return solve(vX, vB, vR);
+		}
+
+	///	Solve J(u)*u[j] = f[j] for all right-hand sides at once
+		virtual bool apply_multi(multi_vector_type& u, const multi_vector_type& f)
+		{
+			if(u.size() != f.size())
+				UG_THROW("BlockGMRES::apply_multi: Number of solutions ("
+						<<u.size()<<") does not match number of right-hand "
+						"sides ("<<f.size()<<").");
+
+			std::vector<SmartPtr<vector_type> > vspR(f.size());
+			std::vector<vector_type*> vX(f.size()), vR(f.size());
+			std::vector<const vector_type*> vB(f.size());
+			for(size_t j = 0; j < f.size(); ++j)
+			{
+				vspR[j] = f[j].clone();
+				vR[j] = vspR[j].get();
+				vB[j] = &f[j];
+				vX[j] = &u[j];
+			}
+
+			return solve(vX, vB, vR);
+		}
+
+		virtual std::string config_string() const
+		{
+			std::stringstream ss;
+			ss << "BlockGMRES ( restart = " << m_restart << ", deflation tolerance = "
+			   << m_deflationTol << ")\n";
+			ss << base_type::config_string_preconditioner_convergence_check();
+			return ss.str();
+		}
+
+	protected:
+	///	solves for all right-hand sides vB, vR contains the defects on exit
+		bool solve(std::vector<vector_type*>& vX,
+		           const std::vector<const vector_type*>& vB,
+		           std::vector<vector_type*>& vR)
+		{
+			PROFILE_BEGIN_GROUP(BlockGMRES_solve, "GMRES algebra");
+			const size_t k = vX.size();
+			if(k == 0) return true;
+			if(m_restart == 0)
+				UG_THROW("BlockGMRES: restart must be at least 1.");
+
+		//	check correct storage type in parallel
+			#ifdef UG_PARALLEL
+			for(size_t j = 0; j < k; ++j)
+				if(!vB[j]->has_storage_type(PST_ADDITIVE) || !vX[j]->has_storage_type(PST_CONSISTENT))
+					UG_THROW("BlockGMRES: Inadequate storage format of Vectors.");
+			#endif
+
+		// 	build defects:  r[j] := b[j] - A*x[j]
+			for(size_t j = 0; j < k; ++j)
+				linear_operator()->apply_sub(*vR[j], *vX[j]);
+
+		//	prepare convergence check
+			prepare_conv_check();
+
+		//	compute start defect norms
+			std::vector<number> vDefect(k);
+			convergence_check()->start_defect(compute_defects(vDefect, vR));
+
+		//	storage for the Krylov vectors v (unique), the preconditioned
+		//	directions z (consistent), the Hessenberg matrix h and the right
+		//	hand side g of the least squares problem
+			std::vector<SmartPtr<vector_type> > v, z;
+			std::vector<std::vector<number> > h, g;
+			std::vector<size_t> vRotRow;
+			std::vector<number> vRotC, vRotS, vS, vRefNorm(k);
+			std::vector<size_t> vActive;
+
+		// 	Iteration loop
+			while(!convergence_check()->iteration_ended())
+			{
+			//	select columns iterated in this cycle
+				select_active(vActive, vDefect);
+				const size_t p = vActive.size();
+				if(p == 0) break;
+
+			//	get storage
+				const size_t numV = (m_restart+1)*p;
+				if(v.size() < numV) v.resize(numV);
+				if(z.size() < numV - p) z.resize(numV - p);
+				for(size_t i = 0; i < numV; ++i)
+					if(v[i].invalid()) v[i] = vX[0]->clone_without_values();
+				for(size_t i = 0; i < numV - p; ++i)
+					if(z[i].invalid()) z[i] = vX[0]->clone_without_values();
+
+				h.assign(numV, std::vector<number>(numV - p, 0.0));
+				g.assign(numV, std::vector<number>(p, 0.0));
+				vRotRow.clear(); vRotC.clear(); vRotS.clear();
+
+			//	first block: QR decomposition of the defects, V_0 * S = R
+				for(size_t c = 0; c < p; ++c)
+				{
+					*v[c] = *vR[vActive[c]];
+					vRefNorm[c] = vDefect[vActive[c]];
+				}
+				orthonormalize_block(v, 0, p, g, 0, 0, vRefNorm);
+
+			//	loop block gmres iterations
+				size_t numBlocks = 0;
+				for(size_t j = 0; j < m_restart; ++j)
+				{
+					numBlocks = j+1;
+
+				//	z_j = M^{-1} * v_j
+					for(size_t c = 0; c < p; ++c)
+						if(!precondition(*z[j*p+c], *v[j*p+c])) return false;
+
+				//	v_{j+1} = A * z_j
+					multi_vector_type mvZ, mvV;
+					for(size_t c = 0; c < p; ++c)
+					{
+						mvZ.add_vector(z[j*p+c]);
+						mvV.add_vector(v[(j+1)*p+c]);
+					}
+					linear_operator()->apply_multi(mvV, mvZ);
+
+				//	orthogonalize against previous blocks (classical Gram-Schmidt,
+				//	applied twice for stability)
+					for(size_t c = 0; c < p; ++c)
+						vRefNorm[c] = v[(j+1)*p+c]->norm();
+					std::vector<const vector_type*> vPrev((j+1)*p);
+					std::vector<vector_type*> vNew(p);
+					for(size_t i = 0; i < vPrev.size(); ++i) vPrev[i] = v[i].get();
+					for(size_t c = 0; c < p; ++c) vNew[c] = v[(j+1)*p+c].get();
+					for(int pass = 0; pass < 2; ++pass)
+					{
+						VecBlockProd(vPrev, std::vector<const vector_type*>(vNew.begin(), vNew.end()), vS);
+						for(size_t i = 0; i < vPrev.size(); ++i)
+							for(size_t c = 0; c < p; ++c)
+							{
+								h[i][j*p+c] += vS[i*p+c];
+								vS[i*p+c] *= -1.0;
+							}
+						VecBlockScaleAppend(vNew, vPrev, vS);
+					}
+
+				//	orthonormalize the new block, the coefficients are the
+				//	subdiagonal block of h
+					orthonormalize_block(v, (j+1)*p, p, h, (j+1)*p, j*p, vRefNorm);
+
+				//	triangularize the new columns of h by givens rotations
+					for(size_t c = 0; c < p; ++c)
+					{
+						const size_t col = j*p+c;
+
+					//	apply previous rotations
+						for(size_t r = 0; r < vRotRow.size(); ++r)
+							rotate(h, col, vRotRow[r], vRotC[r], vRotS[r]);
+
+					//	eliminate the subdiagonal entries from bottom to top
+						for(size_t row = (j+1)*p+c; row > col; --row)
+						{
+							const number a = h[row-1][col], b = h[row][col];
+							if(b == 0.0) continue;
+							const number rr = std::sqrt(a*a + b*b);
+							vRotRow.push_back(row);
+							vRotC.push_back(a/rr);
+							vRotS.push_back(b/rr);
+							h[row-1][col] = rr; h[row][col] = 0.0;
+							for(size_t q = 0; q < p; ++q)
+								rotate(g, q, row, a/rr, b/rr);
+						}
+					}
+
+				//	the last block of g contains the defects of the least squares problem
+					for(size_t c = 0; c < p; ++c)
+					{
+						number sum = 0.0;
+						for(size_t row = (j+1)*p; row < (j+2)*p; ++row)
+							sum += g[row][c]*g[row][c];
+						vDefect[vActive[c]] = std::sqrt(sum);
+					}
+					convergence_check()->update_defect(*std::max_element(vDefect.begin(), vDefect.end()));
+					if(convergence_check()->iteration_ended()) break;
+				}
+
+			//	solve upper triangular system h * y = g (stored in g)
+				const size_t n = numBlocks*p;
+				for(size_t i = n; i-- > 0; )
+				{
+					for(size_t q = 0; q < p; ++q)
+					{
+						for(size_t l = i+1; l < n; ++l)
+							g[i][q] -= h[i][l] * g[l][q];
+						if(std::fabs(h[i][i]) > std::numeric_limits<number>::min())
+							g[i][q] /= h[i][i];
+						else
+							g[i][q] = 0.0;
+					}
+				}
+
+			//	x := x + Z * y
+				std::vector<const vector_type*> vZ(n);
+				for(size_t i = 0; i < n; ++i) vZ[i] = z[i].get();
+				std::vector<vector_type*> vXAct(p);
+				for(size_t c = 0; c < p; ++c) vXAct[c] = vX[vActive[c]];
+				vS.resize(n*p);
+				for(size_t i = 0; i < n; ++i)
+					for(size_t q = 0; q < p; ++q)
+						vS[i*p+q] = g[i][q];
+				VecBlockScaleAppend(vXAct, vZ, vS);
+
+			//	compute fresh defects: r := b - A*x
+				for(size_t c = 0; c < p; ++c)
+				{
+					*vR[vActive[c]] = *vB[vActive[c]];
+					linear_operator()->apply_sub(*vR[vActive[c]], *vX[vActive[c]]);
+				}
+				compute_defects(vDefect, vR);
+			}
+
+		//	print ending output
+			return convergence_check()->post();
+		}
+
+	///	orthonormalizes the vectors v[first, first+p) by modified Gram-Schmidt
+	/**
+	 * The coefficients of the QR decomposition are written to
+	 * h[rowOffset + i][colOffset + c]. The vectors must already be orthogonal
+	 * to v[0, first). A vector whose remaining norm is negligible compared to
+	 * its reference norm vRefNorm[c] (the norm before the orthogonalization)
+	 * is linearly dependent on the previous ones. It gets a zero diagonal
+	 * coefficient and is replaced by a random vector
+	 * orthonormal to all previous vectors, such that the basis remains
+	 * orthonormal.
+	 */
+		void orthonormalize_block(std::vector<SmartPtr<vector_type> >& v,
+		                          size_t first, size_t p,
+		                          std::vector<std::vector<number> >& h,
+		                          size_t rowOffset, size_t colOffset,
+		                          const std::vector<number>& vRefNorm)
+		{
+			for(size_t c = 0; c < p; ++c)
+			{
+				vector_type& w = *v[first+c];
+				#ifdef UG_PARALLEL
+				if(!w.change_storage_type(PST_UNIQUE))
+					UG_THROW("BlockGMRES: Cannot convert v to unique vector.");
+				#endif
+
+				for(size_t i = 0; i < c; ++i)
+				{
+					const number s = w.dotprod(*v[first+i]);
+					h[rowOffset+i][colOffset+c] = s;
+					VecScaleAdd(w, 1.0, w, -s, *v[first+i]);
+				}
+
+				const number norm = w.norm();
+				if(norm > 1e-12 * vRefNorm[c] && norm > 0.0)
+				{
+					h[rowOffset+c][colOffset+c] = norm;
+					w *= 1./norm;
+				}
+				else
+				{
+					h[rowOffset+c][colOffset+c] = 0.0;
+					random_orthonormal(v, first+c);
+				}
+			}
+		}
+
+	///	sets v[num] to a random vector orthonormal to v[0, num)
+		void random_orthonormal(std::vector<SmartPtr<vector_type> >& v, size_t num)
+		{
+			vector_type& w = *v[num];
+			w.set_random(-1.0, 1.0);
+			#ifdef UG_PARALLEL
+			if(!w.change_storage_type(PST_UNIQUE))
+				UG_THROW("BlockGMRES: Cannot convert v to unique vector.");
+			#endif
+			const number normBefore = w.norm();
+
+		//	classical Gram-Schmidt, applied twice
+			std::vector<const vector_type*> vPrev(num);
+			for(size_t i = 0; i < num; ++i) vPrev[i] = v[i].get();
+			std::vector<number> vH;
+			number norm = normBefore;
+			for(int pass = 0; pass < 2 && num > 0; ++pass)
+			{
+				VecMultiProd(w, vPrev, vH);
+				for(size_t i = 0; i < vH.size(); ++i) vH[i] *= -1.0;
+				norm = std::sqrt(VecMultiScaleAppendNormSquared(w, vPrev, vH));
+			}
+
+		//	if the whole space is spanned already, the vector is set to zero
+			if(norm > 1e-12 * normBefore && norm > 0.0) w *= 1./norm;
+			else w *= 0.0;
+		}
+
+	///	applies the givens rotation of rows (row-1, row) to column col of m
+		static void rotate(std::vector<std::vector<number> >& m, size_t col,
+		                   size_t row, number c, number s)
+		{
+			const number x = m[row-1][col], y = m[row][col];
+			m[row-1][col] =  c*x + s*y;
+			m[row][col]   = -s*x + c*y;
+		}
+
+	///	computes the defect norms of all columns and returns the maximum
+		number compute_defects(std::vector<number>& vDefect,
+		                       std::vector<vector_type*>& vR)
+		{
+			number maxDefect = 0.0;
+			for(size_t j = 0; j < vR.size(); ++j)
+			{
+				vDefect[j] = vR[j]->norm();
+				maxDefect = std::max(maxDefect, vDefect[j]);
+			}
+			return maxDefect;
+		}
+
+	///	selects the columns with a defect that is not small compared to the largest one
+		void select_active(std::vector<size_t>& vActive,
+		                   const std::vector<number>& vDefect) const
+		{
+			const number maxDefect = *std::max_element(vDefect.begin(), vDefect.end());
+			vActive.clear();
+			for(size_t j = 0; j < vDefect.size(); ++j)
+				if(vDefect[j] > m_deflationTol * maxDefect)
+					vActive.push_back(j);
+		}
+
+	///	computes z = M^{-1} v (or z = v without preconditioner) and makes z consistent
+		bool precondition(vector_type& z, vector_type& v)
+		{
+			if(preconditioner().valid())
+			{
+				if(!preconditioner()->apply(z, v))
+				{
+					UG_LOG("BlockGMRES: Cannot apply preconditioner.\n");
+					return false;
+				}
+			}
+			else z = v;
+
+			#ifdef UG_PARALLEL
+			if(!z.change_storage_type(PST_CONSISTENT))
+				UG_THROW("BlockGMRES: Cannot convert z to consistent vector.");
+			#endif
+			return true;
+		}
+
+	///	prepares the output of the convergence check
+		void prepare_conv_check()
+		{
+		//	set iteration symbol and name
+			convergence_check()->set_name(name());
+			convergence_check()->set_symbol('%');
+
+		//	set preconditioner string
+			std::string s;
+			if(preconditioner().valid())
+			  s = std::string(" (Precond: ") + preconditioner()->name() + ")";
+			else
+				s = " (No Preconditioner) ";
+			convergence_check()->set_info(s);
+		}
+
+	protected:
+	///	number of blocks per restart cycle
+		size_t m_restart;
+
+	///	relative defect below which a column is not iterated
+		number m_deflationTol;
+};
+
+} // end namespace ug
+
+#endif /* __H__UG__LIB_DISC__OPERATOR__LINEAR_SOLVER__BLOCK_GMRES__ */
@@ -159,12 +159,29 @@ class CG
 		// 	start rho
 			number rhoOld = VecProd(z, r), rho;
 
+		//	compute defect norm in fused vector operations
+			const bool bFusedDefect = convergence_check()->defect_is_euclidean_norm();
+
+		//	the fused norm needs a unique defect (r stays unique for unique q)
+			#ifdef UG_PARALLEL
+			if(bFusedDefect && !r.change_storage_type(PST_UNIQUE))
+				UG_THROW("CG::apply_return_defect: "
+								"Cannot convert r to unique vector.");
+			#endif
+
 		// 	Iteration loop
 			while(!convergence_check()->iteration_ended())
 			{
 			// 	Build q = A*p (q is additive afterwards)
 				linear_operator()->apply(q, p);
 
+			//	make q unique, such that the defect norm is computed locally
+				#ifdef UG_PARALLEL
+				if(bFusedDefect && !q.change_storage_type(PST_UNIQUE))
+					UG_THROW("CG::apply_return_defect: "
+									"Cannot convert q to unique vector.");
+				#endif
+
 			// 	lambda = (q,p)
 				number lambda = VecProd(q, p);
 
@@ -186,16 +203,22 @@ class CG
 			//	alpha = rho / (q,p)
 				const number alpha = rhoOld/lambda;
 
-			// 	Update x := x + alpha*p
-				VecScaleAdd(x, 1.0, x, alpha, p);
-
-			// 	Update r := r - alpha*t
-				VecScaleAdd(r, 1.0, r, -alpha, q);
+			// 	Update x := x + alpha*p and r := r - alpha*q
+			//	(if possible, the defect norm is computed in the same loop)
+				number defect = 0.0;
+				if(bFusedDefect)
+					defect = sqrt(VecUpdateNormSquared(x, alpha, p, r, 1.0, r, -alpha, q));
+				else
+				{
+					VecScaleAdd(x, 1.0, x, alpha, p);
+					VecScaleAdd(r, 1.0, r, -alpha, q);
+				}
 
 				write_debugXR(x, r, convergence_check()->step());
 
 			// 	Check convergence
-				convergence_check()->update(r);
+				if(bFusedDefect) convergence_check()->update_defect(defect);
+				else convergence_check()->update(r);
 				if(convergence_check()->iteration_ended()) break;
 
 			// 	Preconditioning
@@ -0,0 +1,325 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+
+#ifndef __H__UG__LIB_ALGEBRA__OPERATOR__LINEAR_SOLVER__CHRONOPOULOS_GEAR_CG__
+#define __H__UG__LIB_ALGEBRA__OPERATOR__LINEAR_SOLVER__CHRONOPOULOS_GEAR_CG__
+
+#include <iostream>
+#include <string>
+
+#include "lib_algebra/operator/interface/operator.h"
+#include "lib_algebra/operator/interface/preconditioned_linear_operator_inverse.h"
+#include "common/profiler/profiler.h"
+#ifdef UG_PARALLEL
+	#include "lib_algebra/parallelization/parallelization.h"
+#endif
+
+namespace ug{
+
+///	the CG method of Chronopoulos and Gear as a solver for linear operators
+/**
+ * This class implements the single-reduction CG method of Chronopoulos and
+ * Gear. Mathematically, it is equivalent to the preconditioned CG method (see
+ * CG), but the search direction s = A*p is computed by a recurrence, such that
+ * the inner products (r,u) and (A*u,u) (and the norm of the defect, if the
+ * convergence check uses the euclidean norm) can be summed up in one global
+ * reduction per iteration instead of two. The reduction is started non-blocking
+ * and overlapped with the update of the solution.
+ *
+ * For detailed description of the algorithm, please refer to:
+ *
+ * - Chronopoulos, Gear, "s-step iterative methods for symmetric linear
+ *   systems", J. Comput. Appl. Math. 25 (1989), pp. 153-168
+ *
+ * - Ghysels, Vanroose, "Hiding global synchronization latency in the
+ *   preconditioned Conjugate Gradient algorithm", Parallel Computing 40 (2014),
+ *   pp. 224-238, Alg. 2
+ *
+ * \tparam 	TVector		vector type
+ */
+template <typename TVector>
+class ChronopoulosGearCG
+	: public IPreconditionedLinearOperatorInverse<TVector>
+{
+	public:
+	///	Vector type
+		typedef TVector vector_type;
+
+	///	Base type
+		typedef IPreconditionedLinearOperatorInverse<vector_type> base_type;
+
+	protected:
+		using base_type::convergence_check;
+		using base_type::linear_operator;
+		using base_type::preconditioner;
+		using base_type::write_debug;
+
+	public:
+	///	constructors
+		ChronopoulosGearCG() : base_type() {}
+
+		ChronopoulosGearCG(SmartPtr<ILinearIterator<vector_type,vector_type> > spPrecond)
+			: base_type ( spPrecond )  {}
+
+		ChronopoulosGearCG(SmartPtr<ILinearIterator<vector_type,vector_type> > spPrecond, SmartPtr<IConvergenceCheck<vector_type> > spConvCheck)
+			: base_type ( spPrecond, spConvCheck)  {}
+
+	///	name of solver
+		virtual const char* name() const {return "ChronopoulosGearCG";}
+
+	///	returns if parallel solving is supported
+		virtual bool supports_parallel() const
+		{
+			if(preconditioner().valid())
+				return preconditioner()->supports_parallel();
+			return true;
+		}
+
+	///	Solve J(u)*x = b, such that x = J(u)^{-1} b
+		virtual bool apply_return_defect(vector_type& x, vector_type& b)
+		{
+			PROFILE_BEGIN_GROUP(ChronopoulosGearCG_apply_return_defect, "CG algebra");
+		//	check parallel storage types
+			#ifdef UG_PARALLEL
+			if(!b.has_storage_type(PST_ADDITIVE) || !x.has_storage_type(PST_CONSISTENT))
+				UG_THROW("ChronopoulosGearCG::apply_return_defect:"
+								"Inadequate storage format of Vectors.");
+			#endif
+
+		// 	rename r as b (for convenience)
+			vector_type& r = b;
+
+		// 	create help vectors
+			SmartPtr<vector_type> spU = x.clone_without_values(); vector_type& u = *spU;
+			SmartPtr<vector_type> spW = x.clone_without_values(); vector_type& w = *spW;
+			SmartPtr<vector_type> spS = x.clone_without_values(); vector_type& s = *spS;
+			SmartPtr<vector_type> spP = x.clone_without_values(); vector_type& p = *spP;
+
+		// 	Build defect:  r := b - J(u)*x
+			linear_operator()->apply_sub(r, x);
+			make_unique(r);
+
+			write_debugXR(x, r, convergence_check()->step());
+
+		//	compute start defect
+			prepare_conv_check();
+			convergence_check()->start(r);
+
+		//	compute defect norm in the reduction of the inner products
+			const bool bFusedDefect = convergence_check()->defect_is_euclidean_norm();
+			const size_t numProd = bFusedDefect ? 3 : 2;
+
+		//	previous search directions are not used in first iteration
+			s.set(0.0); p.set(0.0);
+
+		//	u := M^-1 r, w := A*u, gamma = (r,u), delta = (w,u)
+			if(!apply_precond_and_op(u, w, r)) return false;
+
+			double vLocal[3], vProd[3];
+			vLocal[0] = local_prod(r, u);
+			vLocal[1] = local_prod(w, u);
+			sum_up(r, vLocal, vProd, 2, NULL);
+
+			number gamma = vProd[0], delta = vProd[1];
+			number gammaOld = 0.0, alphaOld = 0.0;
+			bool bFirst = true;
+
+		// 	Iteration loop
+			while(!convergence_check()->iteration_ended())
+			{
+			//	compute alpha and beta
+				number beta = 0.0, lambda = delta;
+				if(!bFirst)
+				{
+					beta = gamma / gammaOld;
+					lambda = delta - beta * gamma / alphaOld;
+				}
+
+			//	check lambda
+				if(lambda == 0.0)
+				{
+					if (p.size())
+					{
+						UG_LOG("ERROR in 'ChronopoulosGearCG::apply_return_defect': lambda=" <<
+							lambda<< " is not admitted. Aborting solver.\n");
+						return false;
+					}
+				// 	in cases where a proc has no geometry, we do not want to fail here
+				// 	so we set lambda = 1, this is not harmful
+					else
+						lambda = 1.0;
+				}
+				const number alpha = gamma / lambda;
+
+			//	update directions: p := u + beta*p, s := w + beta*s
+				VecScaleAdd(p, 1.0, u, beta, p);
+				VecScaleAdd(s, 1.0, w, beta, s);
+
+			//	update r := r - alpha*s
+				VecScaleAdd(r, 1.0, r, -alpha, s);
+
+			//	u := M^-1 r, w := A*u
+				if(!apply_precond_and_op(u, w, r)) return false;
+
+			//	start reduction of gamma = (r,u), delta = (w,u) and (r,r)
+			//	and update x := x + alpha*p meanwhile
+				vLocal[0] = local_prod(r, u);
+				vLocal[1] = local_prod(w, u);
+				if(bFusedDefect) vLocal[2] = local_prod(r, r);
+				sum_up(r, vLocal, vProd, numProd, &p, &x, alpha);
+
+				write_debugXR(x, r, convergence_check()->step());
+
+			// 	check convergence
+				if(bFusedDefect) convergence_check()->update_defect(sqrt(vProd[2]));
+				else convergence_check()->update(r);
+
+			// 	remember old values
+				gammaOld = gamma;
+				alphaOld = alpha;
+				gamma = vProd[0];
+				delta = vProd[1];
+				bFirst = false;
+			}
+
+		//	post output
+			return convergence_check()->post();
+		}
+
+	protected:
+	///	sums up the local values over all processes
+	/**
+	 * If pP is given, x := x + alpha*p is computed while the values are summed
+	 * up non-blocking.
+	 */
+		void sum_up(const vector_type& v, const double* pLocal, double* pVal,
+		            size_t n, const vector_type* pP, vector_type* pX = NULL,
+		            number alpha = 0.0)
+		{
+			#ifdef UG_PARALLEL
+			MPI_Request request;
+			VecIAllreduceSum(v, pLocal, pVal, n, request);
+			#else
+			for(size_t i = 0; i < n; ++i) pVal[i] = pLocal[i];
+			#endif
+
+			if(pP != NULL) VecScaleAdd(*pX, 1.0, *pX, alpha, *pP);
+
+			#ifdef UG_PARALLEL
+			PROFILE_BEGIN_GROUP(ChronopoulosGearCG_wait_reduction, "CG algebra");
+			pcl::MPI_Wait(&request);
+			#endif
+		}
+
+	///	computes c := M^-1 d (consistent) and e := A*c (unique)
+		bool apply_precond_and_op(vector_type& c, vector_type& e, vector_type& d)
+		{
+			if(preconditioner().valid())
+			{
+				enter_precond_debug_section(convergence_check()->step());
+				if(!preconditioner()->apply(c, d))
+				{
+					UG_LOG("ERROR in 'ChronopoulosGearCG::apply_return_defect': "
+							"Cannot apply preconditioner. Aborting.\n");
+					this->leave_vector_debug_writer_section();
+					return false;
+				}
+				this->leave_vector_debug_writer_section();
+			}
+			else c = d;
+
+			#ifdef UG_PARALLEL
+			if(!c.change_storage_type(PST_CONSISTENT))
+				UG_THROW("ChronopoulosGearCG::apply_return_defect: "
+								"Cannot convert correction to consistent vector.");
+			#endif
+
+			linear_operator()->apply(e, c);
+			make_unique(e);
+			return true;
+		}
+
+	///	makes an additive vector unique, such that its norm can be computed locally
+		void make_unique(vector_type& v)
+		{
+			#ifdef UG_PARALLEL
+			if(!v.change_storage_type(PST_UNIQUE))
+				UG_THROW("ChronopoulosGearCG::apply_return_defect: "
+								"Cannot convert vector to unique vector.");
+			#endif
+		}
+
+	///	returns the process-local part of the inner product (a,b)
+		number local_prod(const vector_type& a, const vector_type& b)
+		{
+			typedef typename vector_type::vector_type local_vector_type;
+			return VecProd(static_cast<const local_vector_type&>(a),
+			               static_cast<const local_vector_type&>(b));
+		}
+
+	///	adjust output of convergence check
+		void prepare_conv_check()
+		{
+		//	set iteration symbol and name
+			convergence_check()->set_name(name());
+			convergence_check()->set_symbol('%');
+
+		//	set preconditioner string
+			std::string s;
+			if(preconditioner().valid())
+			  s = std::string(" (Precond: ") + preconditioner()->name() + ")";
+			else
+				s = " (No Preconditioner) ";
+			convergence_check()->set_info(s);
+		}
+
+	/// debugger output: solution and residual
+		void write_debugXR(vector_type &x, vector_type &r, int loopCnt)
+		{
+			if(!this->vector_debug_writer_valid()) return;
+			char ext[20]; sprintf(ext, "_iter%03d", loopCnt);
+			write_debug(r, std::string("ChronopoulosGearCG_Residual") + ext + ".vec");
+			write_debug(x, std::string("ChronopoulosGearCG_Solution") + ext + ".vec");
+		}
+
+	/// debugger section for the preconditioner
+		void enter_precond_debug_section(int loopCnt)
+		{
+			if(!this->vector_debug_writer_valid()) return;
+			char ext[20]; sprintf(ext, "_iter%03d", loopCnt);
+			this->enter_vector_debug_writer_section(std::string("ChronopoulosGearCG_Precond_") + ext);
+		}
+};
+
+} // end namespace ug
+
+#endif /* __H__UG__LIB_ALGEBRA__OPERATOR__LINEAR_SOLVER__CHRONOPOULOS_GEAR_CG__ */
@@ -126,6 +126,7 @@ class FetiLayouts
 							m_masterPrimalLayout, m_slavePrimalLayout,
 							stdLayouts->master(), stdLayouts->slave(),
 							(int)(numIndices - 1), DDInfo);
+			m_spInnerLayouts->layouts_changed();
 			UG_LOG("[BuildDomainDecompositionLayouts done]");
 
 		//	create intra feti subdomain communicator
@@ -79,13 +79,14 @@ class GMRES
 
 	public:
 	///	default constructor
-		GMRES(size_t restart) : m_restart(restart) {};
+		GMRES(size_t restart) : m_restart(restart), m_bClassicalGramSchmidt(false) {};
 
 	///	constructor setting the preconditioner and the convergence check
 		GMRES( size_t restart,
 		       SmartPtr<ILinearIterator<vector_type> > spPrecond,
 		       SmartPtr<IConvergenceCheck<vector_type> > spConvCheck)
-			: base_type(spPrecond, spConvCheck), m_restart(restart)
+			: base_type(spPrecond, spConvCheck), m_restart(restart),
+			  m_bClassicalGramSchmidt(false)
 		{};
 
 	///	name of solver
@@ -127,6 +128,7 @@ class GMRES
 			std::vector<number> gamma(m_restart+1);
 			std::vector<number> c(m_restart+1);
 			std::vector<number> s(m_restart+1);
+			std::vector<number> vH;
 
 		//	old norm
 			number oldNorm;
@@ -204,18 +206,37 @@ class GMRES
 				//	post-process the correction
 					m_corr_post_process.apply (*v[j+1]);
 
-				//	loop previous steps
-					for(size_t i = 0; i <= j; ++i)
+					if(m_bClassicalGramSchmidt)
 					{
-					//	h_ij := (r, v[j])
-						h[i][j] = VecProd(*v[j+1], *v[i]);
+						std::vector<const vector_type*> vV(j+1);
+						for(size_t i = 0; i <= j; ++i) vV[i] = v[i].get();
 
-					//	v[j+1] -= h_ij * v[i]
-						VecScaleAppend(*v[j+1], *v[i], (-1)*h[i][j]);
+					//	h_ij := (r, v[i]) for all previous steps at once
+						VecMultiProd(*v[j+1], vV, vH);
+
+					//	v[j+1] -= sum_i h_ij * v[i] and h_{j+1,j} = ||v[j+1]||
+						for(size_t i = 0; i <= j; ++i)
+						{
+							h[i][j] = vH[i];
+							vH[i] = (-1)*vH[i];
+						}
+						h[j+1][j] = sqrt(VecMultiScaleAppendNormSquared(*v[j+1], vV, vH));
 					}
+					else
+					{
+					//	loop previous steps
+						for(size_t i = 0; i <= j; ++i)
+						{
+						//	h_ij := (r, v[j])
+							h[i][j] = VecProd(*v[j+1], *v[i]);
+
+						//	v[j+1] -= h_ij * v[i]
+							VecScaleAppend(*v[j+1], *v[i], (-1)*h[i][j]);
+						}
 
-				//	compute h_{j+1,j}
-					h[j+1][j] = v[j+1]->norm();
+					//	compute h_{j+1,j}
+						h[j+1][j] = v[j+1]->norm();
+					}
 
 				//	update h
 					for(size_t i = 0; i < j; ++i)
@@ -280,6 +301,17 @@ class GMRES
 		}
 
 	public:
+	///	sets if the classical Gram-Schmidt orthogonalization is used
+	/**
+	 * The classical Gram-Schmidt method computes all inner products of a
+	 * new Krylov vector with the previous ones in one pass over the vectors
+	 * (and with one global reduction in parallel) and subtracts all
+	 * projections together with the norm computation in a second pass. The
+	 * default modified Gram-Schmidt method needs one pass (and one reduction)
+	 * per previous vector, but is numerically more stable.
+	 */
+		void set_classical_gram_schmidt(bool bCGS) {m_bClassicalGramSchmidt = bCGS;}
+
 		virtual std::string config_string() const
 		{
 			std::stringstream ss;
@@ -321,6 +353,9 @@ class GMRES
 	///	restart parameter
 		size_t m_restart;
 
+	///	flag if classical Gram-Schmidt orthogonalization is used
+		bool m_bClassicalGramSchmidt;
+
 	///	postprocessor for the correction in the iterations
 		/**
 		 * These postprocess operations are applied to the preconditioned
@@ -75,7 +75,7 @@ class LU
 
 	public:
 	///	constructor
-		LU() : m_spOperator(NULL), m_mat(), m_bSortSparse(true), m_bInfo(false), m_bShowProgress(true)
+		LU() : m_spOperator(NULL), m_mat(), m_bSortSparse(true), m_sortType("cuthill-mckee"), m_bInfo(false), m_bShowProgress(true)
 		{
 #ifdef LAPACK_AVAILABLE
 			m_iMinimumForSparse = 4000;
@@ -98,6 +98,14 @@ class LU
 			m_bSortSparse = b;
 		}
 
+	///	sets the ordering of the sparse LU, "cuthill-mckee" (default) or "nested-dissection"
+		void set_sort_type(const std::string& type)
+		{
+			UG_COND_THROW(type != "cuthill-mckee" && type != "nested-dissection",
+			              "LU: Unknown sort type '" << type << "'.");
+			m_sortType = type;
+		}
+
 		void set_info(bool b)
 		{
 			m_bInfo = b;
@@ -192,6 +200,7 @@ class LU
 			}
 			ilut_scalar = make_sp(new ILUTScalarPreconditioner<algebra_type>(0.0));
 			ilut_scalar->set_sort(m_bSortSparse);
+			ilut_scalar->set_sort_type(m_sortType);
 			ilut_scalar->set_info(m_bInfo);
 			ilut_scalar->set_show_progress(m_bShowProgress);
 			ilut_scalar->preprocess(A);
@@ -410,7 +419,9 @@ class LU
 		bool m_bDense;
 		SmartPtr<ILUTScalarPreconditioner<algebra_type> > ilut_scalar;
 		size_t m_iMinimumForSparse;
-		bool m_bSortSparse, m_bInfo, m_bShowProgress;
+		bool m_bSortSparse;
+		std::string m_sortType;
+		bool m_bInfo, m_bShowProgress;
 };
 
 } // end namespace ug
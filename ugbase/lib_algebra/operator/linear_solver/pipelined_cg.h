@@ -0,0 +1,364 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+
+#ifndef __H__UG__LIB_ALGEBRA__OPERATOR__LINEAR_SOLVER__PIPELINED_CG__
+#define __H__UG__LIB_ALGEBRA__OPERATOR__LINEAR_SOLVER__PIPELINED_CG__
+
+#include <iostream>
+#include <string>
+
+#include "lib_algebra/operator/interface/operator.h"
+#include "lib_algebra/operator/interface/preconditioned_linear_operator_inverse.h"
+#include "common/profiler/profiler.h"
+#ifdef UG_PARALLEL
+	#include "lib_algebra/parallelization/parallelization.h"
+#endif
+
+namespace ug{
+
+///	the pipelined CG method as a solver for linear operators
+/**
+ * This class implements the pipelined CG method. Mathematically, it is
+ * equivalent to the preconditioned CG method (see CG), but the recurrences are
+ * rearranged such that all inner products of one iteration are summed up in one
+ * global reduction. This reduction is started non-blocking and overlapped with
+ * the application of the preconditioner and of the linear operator. On large
+ * process counts, where the latency of the global reductions dominates the
+ * iteration, this hides the reductions at the price of additional vector
+ * updates and a reduced numerical stability. The latter can be improved by
+ * recomputing the residuals regularly (see set_residual_replacement).
+ *
+ * If the convergence check uses the euclidean norm of the defect, the norm is
+ * computed in the same reduction. Note, that the reported defect is the one of
+ * the previous iterate, such that the method needs one additional iteration
+ * compared to CG.
+ *
+ * For detailed description of the algorithm, please refer to:
+ *
+ * - Ghysels, Vanroose, "Hiding global synchronization latency in the
+ *   preconditioned Conjugate Gradient algorithm", Parallel Computing 40 (2014),
+ *   pp. 224-238, Alg. 3
+ *
+ * \tparam 	TVector		vector type
+ */
+template <typename TVector>
+class PipelinedCG
+	: public IPreconditionedLinearOperatorInverse<TVector>
+{
+	public:
+	///	Vector type
+		typedef TVector vector_type;
+
+	///	Base type
+		typedef IPreconditionedLinearOperatorInverse<vector_type> base_type;
+
+	protected:
+		using base_type::convergence_check;
+		using base_type::linear_operator;
+		using base_type::preconditioner;
+		using base_type::write_debug;
+
+	public:
+	///	constructors
+		PipelinedCG() : base_type(), m_numReplace(0) {}
+
+		PipelinedCG(SmartPtr<ILinearIterator<vector_type,vector_type> > spPrecond)
+			: base_type ( spPrecond ), m_numReplace(0)  {}
+
+		PipelinedCG(SmartPtr<ILinearIterator<vector_type,vector_type> > spPrecond, SmartPtr<IConvergenceCheck<vector_type> > spConvCheck)
+			: base_type ( spPrecond, spConvCheck), m_numReplace(0)  {}
+
+	///	name of solver
+		virtual const char* name() const {return "PipelinedCG";}
+
+	///	returns if parallel solving is supported
+		virtual bool supports_parallel() const
+		{
+			if(preconditioner().valid())
+				return preconditioner()->supports_parallel();
+			return true;
+		}
+
+	///	sets the number of iterations after which the residuals are recomputed (0 = never)
+		void set_residual_replacement(int numReplace) {m_numReplace = numReplace;}
+
+	///	Solve J(u)*x = b, such that x = J(u)^{-1} b
+		virtual bool apply_return_defect(vector_type& x, vector_type& b)
+		{
+			PROFILE_BEGIN_GROUP(PipelinedCG_apply_return_defect, "CG algebra");
+		//	check parallel storage types
+			#ifdef UG_PARALLEL
+			if(!b.has_storage_type(PST_ADDITIVE) || !x.has_storage_type(PST_CONSISTENT))
+				UG_THROW("PipelinedCG::apply_return_defect:"
+								"Inadequate storage format of Vectors.");
+			#endif
+
+		//	keep right-hand side if residuals are replaced
+			SmartPtr<vector_type> spB;
+			if(m_numReplace > 0) spB = b.clone();
+
+		// 	rename r as b (for convenience)
+			vector_type& r = b;
+
+		// 	create help vectors
+			SmartPtr<vector_type> spU = x.clone_without_values(); vector_type& u = *spU;
+			SmartPtr<vector_type> spW = x.clone_without_values(); vector_type& w = *spW;
+			SmartPtr<vector_type> spM = x.clone_without_values(); vector_type& m = *spM;
+			SmartPtr<vector_type> spN = x.clone_without_values(); vector_type& n = *spN;
+			SmartPtr<vector_type> spZ = x.clone_without_values(); vector_type& z = *spZ;
+			SmartPtr<vector_type> spQ = x.clone_without_values(); vector_type& q = *spQ;
+			SmartPtr<vector_type> spS = x.clone_without_values(); vector_type& s = *spS;
+			SmartPtr<vector_type> spP = x.clone_without_values(); vector_type& p = *spP;
+
+		// 	Build defect r := b - J(u)*x, u := M^-1 r, w := A*u
+			if(!compute_residuals(x, r, u, w)) return false;
+
+			write_debugXR(x, r, convergence_check()->step());
+
+		//	compute start defect
+			prepare_conv_check();
+			convergence_check()->start(r);
+
+		//	compute defect norm in the reduction of the inner products
+			const bool bFusedDefect = convergence_check()->defect_is_euclidean_norm();
+			const size_t numProd = bFusedDefect ? 3 : 2;
+
+		//	previous search directions are not used in first iteration
+			z.set(0.0); q.set(0.0); s.set(0.0); p.set(0.0);
+
+			number gammaOld = 0.0, alphaOld = 0.0;
+			double vLocal[3], vProd[3];
+			bool bFirst = true;
+
+		// 	Iteration loop
+			while(!convergence_check()->iteration_ended())
+			{
+			//	start reduction of gamma = (r,u), delta = (w,u) and (r,r)
+				vLocal[0] = local_prod(r, u);
+				vLocal[1] = local_prod(w, u);
+				if(bFusedDefect) vLocal[2] = local_prod(r, r);
+
+				#ifdef UG_PARALLEL
+				MPI_Request request;
+				VecIAllreduceSum(r, vLocal, vProd, numProd, request);
+				#else
+				for(size_t i = 0; i < numProd; ++i) vProd[i] = vLocal[i];
+				#endif
+
+			//	while reducing: m := M^-1 w, n := A*m
+				if(!apply_precond_and_op(m, n, w)) return false;
+
+				#ifdef UG_PARALLEL
+				{
+					PROFILE_BEGIN_GROUP(PipelinedCG_wait_reduction, "CG algebra");
+					pcl::MPI_Wait(&request);
+				}
+				#endif
+
+			// 	check convergence of the current iterate
+				if(!bFirst)
+				{
+					if(bFusedDefect) convergence_check()->update_defect(sqrt(vProd[2]));
+					else convergence_check()->update(r);
+					if(convergence_check()->iteration_ended()) break;
+				}
+
+				const number gamma = vProd[0], delta = vProd[1];
+
+			//	compute alpha and beta
+				number beta = 0.0, lambda = delta;
+				if(!bFirst)
+				{
+					beta = gamma / gammaOld;
+					lambda = delta - beta * gamma / alphaOld;
+				}
+
+			//	check lambda
+				if(lambda == 0.0)
+				{
+					if (p.size())
+					{
+						UG_LOG("ERROR in 'PipelinedCG::apply_return_defect': lambda=" <<
+							lambda<< " is not admitted. Aborting solver.\n");
+						return false;
+					}
+				// 	in cases where a proc has no geometry, we do not want to fail here
+				// 	so we set lambda = 1, this is not harmful
+					else
+						lambda = 1.0;
+				}
+				const number alpha = gamma / lambda;
+
+			//	update directions: z := n + beta*z, q := m + beta*q,
+			//	                   s := w + beta*s, p := u + beta*p
+				VecScaleAdd(z, 1.0, n, beta, z);
+				VecScaleAdd(q, 1.0, m, beta, q);
+				VecScaleAdd(s, 1.0, w, beta, s);
+				VecScaleAdd(p, 1.0, u, beta, p);
+
+			// 	update x := x + alpha*p
+				VecScaleAdd(x, 1.0, x, alpha, p);
+
+			//	recompute residuals or update r := r - alpha*s, u := u - alpha*q,
+			//	w := w - alpha*z
+				if(m_numReplace > 0 && (convergence_check()->step() + 1) % m_numReplace == 0)
+				{
+					r = *spB;
+					if(!compute_residuals(x, r, u, w)) return false;
+
+				//	s := A*p, q := M^-1 s, z := A*q
+					linear_operator()->apply(s, p);
+					make_unique(s);
+					if(!apply_precond_and_op(q, z, s)) return false;
+				}
+				else
+				{
+					VecScaleAdd(r, 1.0, r, -alpha, s);
+					VecScaleAdd(u, 1.0, u, -alpha, q);
+					VecScaleAdd(w, 1.0, w, -alpha, z);
+				}
+
+				write_debugXR(x, r, convergence_check()->step());
+
+			// 	remember old values
+				gammaOld = gamma;
+				alphaOld = alpha;
+				bFirst = false;
+			}
+
+		//	post output
+			return convergence_check()->post();
+		}
+
+	protected:
+	///	computes r := r - A*x, u := M^-1 r, w := A*u
+		bool compute_residuals(vector_type& x, vector_type& r,
+		                       vector_type& u, vector_type& w)
+		{
+			linear_operator()->apply_sub(r, x);
+			make_unique(r);
+			return apply_precond_and_op(u, w, r);
+		}
+
+	///	computes c := M^-1 d (consistent) and e := A*c (unique)
+		bool apply_precond_and_op(vector_type& c, vector_type& e, vector_type& d)
+		{
+			if(!apply_precond(c, d)) return false;
+			linear_operator()->apply(e, c);
+			make_unique(e);
+			return true;
+		}
+
+	///	makes an additive vector unique, such that its norm can be computed locally
+		void make_unique(vector_type& v)
+		{
+			#ifdef UG_PARALLEL
+			if(!v.change_storage_type(PST_UNIQUE))
+				UG_THROW("PipelinedCG::apply_return_defect: "
+								"Cannot convert vector to unique vector.");
+			#endif
+		}
+
+	///	computes c := M^-1 d and makes c consistent
+		bool apply_precond(vector_type& c, vector_type& d)
+		{
+			if(preconditioner().valid())
+			{
+				enter_precond_debug_section(convergence_check()->step());
+				if(!preconditioner()->apply(c, d))
+				{
+					UG_LOG("ERROR in 'PipelinedCG::apply_return_defect': "
+							"Cannot apply preconditioner. Aborting.\n");
+					this->leave_vector_debug_writer_section();
+					return false;
+				}
+				this->leave_vector_debug_writer_section();
+			}
+			else c = d;
+
+			#ifdef UG_PARALLEL
+			if(!c.change_storage_type(PST_CONSISTENT))
+				UG_THROW("PipelinedCG::apply_return_defect: "
+								"Cannot convert correction to consistent vector.");
+			#endif
+			return true;
+		}
+
+	///	returns the process-local part of the inner product (a,b)
+		number local_prod(const vector_type& a, const vector_type& b)
+		{
+			typedef typename vector_type::vector_type local_vector_type;
+			return VecProd(static_cast<const local_vector_type&>(a),
+			               static_cast<const local_vector_type&>(b));
+		}
+
+	///	adjust output of convergence check
+		void prepare_conv_check()
+		{
+		//	set iteration symbol and name
+			convergence_check()->set_name(name());
+			convergence_check()->set_symbol('%');
+
+		//	set preconditioner string
+			std::string s;
+			if(preconditioner().valid())
+			  s = std::string(" (Precond: ") + preconditioner()->name() + ")";
+			else
+				s = " (No Preconditioner) ";
+			convergence_check()->set_info(s);
+		}
+
+	/// debugger output: solution and residual
+		void write_debugXR(vector_type &x, vector_type &r, int loopCnt)
+		{
+			if(!this->vector_debug_writer_valid()) return;
+			char ext[20]; sprintf(ext, "_iter%03d", loopCnt);
+			write_debug(r, std::string("PipelinedCG_Residual") + ext + ".vec");
+			write_debug(x, std::string("PipelinedCG_Solution") + ext + ".vec");
+		}
+
+	/// debugger section for the preconditioner
+		void enter_precond_debug_section(int loopCnt)
+		{
+			if(!this->vector_debug_writer_valid()) return;
+			char ext[20]; sprintf(ext, "_iter%03d", loopCnt);
+			this->enter_vector_debug_writer_section(std::string("PipelinedCG_Precond_") + ext);
+		}
+
+	protected:
+	///	number of iterations after which the residuals are recomputed
+		int m_numReplace;
+};
+
+} // end namespace ug
+
+#endif /* __H__UG__LIB_ALGEBRA__OPERATOR__LINEAR_SOLVER__PIPELINED_CG__ */
@@ -0,0 +1,429 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+
+#ifndef __H__UG__LIB_ALGEBRA__OPERATOR__PRECONDITIONER__CHEBYSHEV__
+#define __H__UG__LIB_ALGEBRA__OPERATOR__PRECONDITIONER__CHEBYSHEV__
+
+#include <string>
+#include <sstream>
+#include <cmath>
+
+#include "matrix_free_jacobi.h"
+#include "lib_algebra/operator/eigensolver/power_method.h"
+
+namespace ug{
+
+///	symmetrically scaled operator D^{-1/2} A D^{-1/2}
+/**
+ * This operator has the same eigenvalues as D^{-1}A, but is symmetric if A
+ * is symmetric. It is used to estimate the largest eigenvalue of D^{-1}A by
+ * the PowerMethod.
+ */
+template <typename TVector>
+class DiagonalScaledOperator : public ILinearOperator<TVector>
+{
+	public:
+	///	Constructor (diagonal scaling D^{-1/2} must be consistent)
+		DiagonalScaledOperator(SmartPtr<ILinearOperator<TVector> > spOp,
+		                       SmartPtr<TVector> spScale)
+			: m_spOp(spOp), m_spScale(spScale) {}
+
+		virtual void init(const TVector& u) {}
+		virtual void init() {}
+
+	///	computes f = D^{-1/2} A D^{-1/2} u
+		virtual void apply(TVector& f, const TVector& u)
+		{
+			if(m_spTmp.invalid() || m_spTmp->size() != u.size())
+				m_spTmp = u.clone_without_values();
+
+		//	scaling of a consistent vector is consistent
+			ApplyInverseDiagonal(*m_spTmp, *m_spScale, u);
+			#ifdef UG_PARALLEL
+			m_spTmp->set_storage_type(PST_CONSISTENT);
+			#endif
+
+		//	scaling of an additive vector is additive
+			m_spOp->apply(f, *m_spTmp);
+			ApplyInverseDiagonal(f, *m_spScale, f);
+		}
+
+	///	computes f -= D^{-1/2} A D^{-1/2} u
+		virtual void apply_sub(TVector& f, const TVector& u)
+		{
+			SmartPtr<TVector> spF = f.clone_without_values();
+			apply(*spF, u);
+			f -= *spF;
+		}
+
+	protected:
+		SmartPtr<ILinearOperator<TVector> > m_spOp;
+		SmartPtr<TVector> m_spScale;
+		SmartPtr<TVector> m_spTmp;
+};
+
+///	Chebyshev iteration preconditioned by the diagonal
+/**
+ * This iteration applies a Chebyshev polynomial of given degree in the
+ * Jacobi preconditioned operator D^{-1}A to the defect, i.e. it computes
+ * c = p(D^{-1}A) D^{-1} d, where the polynomial damps all error components
+ * with eigenvalues of D^{-1}A in [lambda_min, lambda_max]. As a smoother, the
+ * upper bound lambda_max has to be an (over-)estimate of the largest
+ * eigenvalue, while lambda_min = lambda_max / ratio selects the smoothed range.
+ *
+ * Only the diagonal and the application of the operator are needed, thus the
+ * iteration can be used with matrix-free operators (IMatrixFreeOperator). A
+ * polynomial of degree k needs k-1 applications of the operator.
+ *
+ * Unless set explicitly, lambda_max is estimated in init() by a few steps of
+ * the PowerMethod and multiplied by a safety factor. The estimate can also be
+ * passed from outside (e.g. from a previous init on the same level, see
+ * set_max_eigenvalue_estimate), which skips the power iteration for the
+ * next init.
+ *
+ *	References:
+ * <ul>
+ * <li> Y. Saad. Iterative methods for sparse linear systems, Sec. 12.3
+ * <li> M. Adams, M. Brezina, J. Hu, R. Tuminaro. Parallel multigrid smoothing:
+ * 		polynomial versus Gauss-Seidel. J. Comput. Phys. 188 (2003)
+ * </ul>
+ */
+template <typename TAlgebra>
+class Chebyshev : public ILinearIterator<typename TAlgebra::vector_type>
+{
+	public:
+	///	Algebra type
+		typedef TAlgebra algebra_type;
+
+	///	Vector type
+		typedef typename TAlgebra::vector_type vector_type;
+
+	///	Base type
+		typedef ILinearIterator<vector_type> base_type;
+
+	protected:
+		using base_type::damping;
+
+	public:
+	///	default constructor
+		Chebyshev()
+			: m_degree(3), m_lambdaMin(2.0/30.0), m_lambdaMax(2.0), m_ratio(30.0),
+			  m_bEstimate(true), m_numPowerSteps(10), m_safetyFactor(1.1),
+			  m_lambdaMaxEst(0.0), m_bEstimateGiven(false)
+		{}
+
+	/// clone constructor
+		Chebyshev(const Chebyshev<TAlgebra>& parent)
+			: base_type(parent),
+			  m_degree(parent.m_degree),
+			  m_lambdaMin(parent.m_lambdaMin), m_lambdaMax(parent.m_lambdaMax),
+			  m_ratio(parent.m_ratio),
+			  m_bEstimate(parent.m_bEstimate),
+			  m_numPowerSteps(parent.m_numPowerSteps),
+			  m_safetyFactor(parent.m_safetyFactor),
+			  m_lambdaMaxEst(0.0), m_bEstimateGiven(false)
+		{}
+
+	///	Clone
+		virtual SmartPtr<ILinearIterator<vector_type> > clone()
+		{
+			return make_sp(new Chebyshev<algebra_type>(*this));
+		}
+
+	///	returns if parallel solving is supported
+		virtual bool supports_parallel() const {return true;}
+
+	///	Name of preconditioner
+		virtual const char* name() const {return "Chebyshev";}
+
+	///	sets the degree of the polynomial
+		void set_degree(size_t degree)
+		{
+			if(degree < 1) UG_THROW(name() << ": Degree must be at least 1.");
+			m_degree = degree;
+		}
+
+	///	sets the bounds of the eigenvalues of D^{-1}A to be damped (disables estimation)
+		void set_eigenvalue_bounds(number lambdaMin, number lambdaMax)
+		{
+			if(!(lambdaMin > 0.0) || !(lambdaMax > lambdaMin))
+				UG_THROW(name() << ": Need 0 < lambda_min < lambda_max.");
+			m_lambdaMin = lambdaMin; m_lambdaMax = lambdaMax;
+			m_ratio = lambdaMax / lambdaMin;
+			m_bEstimate = false;
+		}
+
+	///	enables the estimation of lambda_max by the power method in init
+		void set_estimate_max_eigenvalue(bool bEstimate) {m_bEstimate = bEstimate;}
+
+	///	sets the number of power method steps used for the estimate
+		void set_power_method_steps(size_t numSteps)
+		{
+			if(numSteps < 1) UG_THROW(name() << ": Need at least one power method step.");
+			m_numPowerSteps = numSteps;
+		}
+
+	///	sets the factor the estimate of lambda_max is multiplied with
+		void set_safety_factor(number factor)
+		{
+			if(!(factor >= 1.0)) UG_THROW(name() << ": Safety factor must be >= 1.");
+			m_safetyFactor = factor;
+		}
+
+	///	passes an estimate of lambda_max to be used in the next init
+		void set_max_eigenvalue_estimate(number lambdaMaxEst)
+		{
+			m_lambdaMaxEst = lambdaMaxEst;
+			m_bEstimateGiven = true;
+		}
+
+	///	returns the estimate of lambda_max used in the last init (0 if not estimated)
+		number max_eigenvalue_estimate() const {return m_lambdaMaxEst;}
+
+	///	returns if lambda_max is estimated in init
+		bool estimates_max_eigenvalue() const {return m_bEstimate;}
+
+	///	sets the ratio lambda_max / lambda_min of the damped range
+		void set_eigenvalue_ratio(number ratio)
+		{
+			if(!(ratio > 1.0)) UG_THROW(name() << ": Ratio must be greater 1.");
+			m_ratio = ratio;
+			m_lambdaMin = m_lambdaMax / m_ratio;
+		}
+
+	///	returns information about configuration parameters
+		virtual std::string config_string() const
+		{
+			std::stringstream ss;
+			ss << name() << "( degree = " << m_degree << ", lambda = ["
+			   << m_lambdaMin << ", " << m_lambdaMax << "]";
+			if(m_bEstimate)
+				ss << ", power method steps = " << m_numPowerSteps
+				   << ", safety factor = " << m_safetyFactor;
+			ss << ", damping = "
+			   << base_type::m_spDamping->config_string() << ")";
+			return ss.str();
+		}
+
+	///	initialize for linear operator L
+		virtual bool init(SmartPtr<ILinearOperator<vector_type> > L)
+		{
+			PROFILE_BEGIN_GROUP(Chebyshev_init, "algebra Chebyshev");
+			m_spOp = L;
+			try{
+				m_spDiagInv = InverseOperatorDiagonal<algebra_type>(m_spOp);
+			}
+			UG_CATCH_THROW(name() << "::init: Cannot compute inverse diagonal.");
+
+		//	estimate largest eigenvalue
+			if(m_bEstimate)
+			{
+				if(!m_bEstimateGiven)
+				{
+					try{
+						m_lambdaMaxEst = estimate_max_eigenvalue();
+					}
+					UG_CATCH_THROW(name() << "::init: Cannot estimate largest eigenvalue.");
+				}
+				m_bEstimateGiven = false;
+
+				m_lambdaMax = m_safetyFactor * m_lambdaMaxEst;
+				m_lambdaMin = m_lambdaMax / m_ratio;
+			}
+			return true;
+		}
+
+	///	initialize for linearized operator J(u)
+		virtual bool init(SmartPtr<ILinearOperator<vector_type> > J, const vector_type& u)
+		{
+			return init(J);
+		}
+
+	///	compute new correction c = B*d
+		virtual bool apply(vector_type& c, const vector_type& d)
+		{
+			PROFILE_BEGIN_GROUP(Chebyshev_apply, "algebra Chebyshev");
+			if(m_spDiagInv.invalid())
+				UG_THROW(name() << "::apply: Iterator not initialized.");
+
+		//	Check parallel status
+			#ifdef UG_PARALLEL
+			if(!d.has_storage_type(PST_ADDITIVE))
+				UG_THROW(name() << "::apply: Wrong parallel "
+				               "storage format. Defect must be additive.");
+			#endif
+
+			if(c.size() != m_spDiagInv->size() || d.size() != m_spDiagInv->size())
+				UG_THROW(name() << "::apply: Size of correction ["<<c.size()<<"] "
+						"and defect ["<<d.size()<<"] must match size of operator ["
+						<<m_spDiagInv->size()<<"].");
+
+		//	resize help vectors
+			if(m_spR.invalid() || m_spR->size() != d.size())
+			{
+				m_spR = d.clone_without_values();
+				m_spP = d.clone_without_values();
+				m_spZ = d.clone_without_values();
+			}
+			vector_type& r = *m_spR;
+			vector_type& p = *m_spP;
+			vector_type& z = *m_spZ;
+
+		//	parameters of the polynomial
+			const number theta = 0.5 * (m_lambdaMax + m_lambdaMin);
+			const number delta = 0.5 * (m_lambdaMax - m_lambdaMin);
+			const number sigma = theta / delta;
+			number rho = 1.0 / sigma;
+
+		//	r = d, p = 1/theta D^{-1} r, c = p
+			r = d;
+			ApplyInverseDiagonal(p, *m_spDiagInv, r);
+			make_consistent(p);
+			p *= 1.0 / theta;
+			c = p;
+
+			for(size_t k = 1; k < m_degree; ++k)
+			{
+			//	r -= A * p
+				m_spOp->apply_sub(r, p);
+
+			//	z = D^{-1} r
+				ApplyInverseDiagonal(z, *m_spDiagInv, r);
+				make_consistent(z);
+
+			//	p = rho_new * rho * p + 2 rho_new / delta * z
+				const number rhoNew = 1.0 / (2.0*sigma - rho);
+				VecScaleAdd(p, rhoNew * rho, p, 2.0 * rhoNew / delta, z);
+				rho = rhoNew;
+
+			//	c += p
+				c += p;
+			}
+
+		//	apply scaling
+			const number kappa = damping()->damping(c, d, m_spOp);
+			if(kappa != 1.0) c *= kappa;
+
+			return true;
+		}
+
+	///	compute new correction c = B*d and update defect d := d - A*c
+		virtual bool apply_update_defect(vector_type& c, vector_type& d)
+		{
+			if(!apply(c, d)) return false;
+
+		//	update defect
+			m_spOp->apply_sub(d, c);
+			return true;
+		}
+
+	protected:
+	///	estimates the largest eigenvalue of D^{-1}A by the power method
+		number estimate_max_eigenvalue()
+		{
+			PROFILE_BEGIN_GROUP(Chebyshev_estimate, "algebra Chebyshev");
+
+		//	scaling D^{-1/2}
+			SmartPtr<vector_type> spScale = m_spDiagInv->clone();
+			for(size_t i = 0; i < spScale->size(); ++i)
+				for(size_t k = 0; k < (size_t)GetSize((*spScale)[i]); ++k)
+				{
+					number& d = BlockRef((*spScale)[i], k);
+					if(d < 0.0)
+						UG_THROW(name() << ": Negative diagonal entry at index "
+								<< i << ", power method needs positive diagonal.");
+					d = sqrt(d);
+				}
+
+		//	random start vector
+			SmartPtr<vector_type> spStart = m_spDiagInv->clone_without_values();
+			spStart->set_random(-1.0, 1.0);
+
+			PowerMethod<algebra_type> powerMethod;
+			powerMethod.set_linear_operator_A(make_sp(
+				new DiagonalScaledOperator<vector_type>(m_spOp, spScale)));
+			powerMethod.set_start_vector(spStart);
+			powerMethod.set_max_iterations(m_numPowerSteps);
+			powerMethod.set_precision(0.0);
+			powerMethod.set_verbose(false);
+			powerMethod.calculate_max_eigenvalue();
+
+			const number lambdaMax = powerMethod.get_max_eigenvalue();
+			if(!(lambdaMax > 0.0))
+				UG_THROW(name() << ": Estimated largest eigenvalue " << lambdaMax
+						<< " is not positive.");
+			return lambdaMax;
+		}
+
+	///	changes an additive vector to consistent storage
+		void make_consistent(vector_type& v)
+		{
+			#ifdef 	UG_PARALLEL
+			v.set_storage_type(PST_ADDITIVE);
+			if(!v.change_storage_type(PST_CONSISTENT))
+				UG_THROW(name() << ": Cannot change "
+						"parallel storage type of vector to consistent.");
+			#endif
+		}
+
+	protected:
+	///	degree of the polynomial
+		size_t m_degree;
+
+	///	bounds of the damped range of eigenvalues
+		number m_lambdaMin, m_lambdaMax;
+
+	///	ratio lambda_max / lambda_min
+		number m_ratio;
+
+	///	flag if lambda_max is estimated, number of power method steps and safety factor
+		bool m_bEstimate;
+		size_t m_numPowerSteps;
+		number m_safetyFactor;
+
+	///	estimate of lambda_max and flag if passed from outside for the next init
+		number m_lambdaMaxEst;
+		bool m_bEstimateGiven;
+
+	///	underlying operator
+		SmartPtr<ILinearOperator<vector_type> > m_spOp;
+
+	///	inverse of the diagonal (consistent)
+		SmartPtr<vector_type> m_spDiagInv;
+
+	///	help vectors
+		SmartPtr<vector_type> m_spR, m_spP, m_spZ;
+};
+
+} // end namespace ug
+
+#endif /* __H__UG__LIB_ALGEBRA__OPERATOR__PRECONDITIONER__CHEBYSHEV__ */
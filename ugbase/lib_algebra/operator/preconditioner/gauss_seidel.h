@@ -73,13 +73,15 @@ class GaussSeidelBase : public IPreconditioner<TAlgebra>
 		GaussSeidelBase() :
 			m_relax(1.0),
 			m_bConsistentInterfaces(false),
-			m_useOverlap(false) {};
+			m_useOverlap(false),
+			m_bLevelScheduling(false) {};
 
 	/// clone constructor
 		GaussSeidelBase( const GaussSeidelBase<TAlgebra> &parent )
 			: base_type(parent),
 			  m_bConsistentInterfaces(parent.m_bConsistentInterfaces),
-			  m_useOverlap(parent.m_useOverlap)
+			  m_useOverlap(parent.m_useOverlap),
+			  m_bLevelScheduling(parent.m_bLevelScheduling)
 		{
 			set_sor_relax(parent.m_relax);
 		}
@@ -92,6 +94,23 @@ class GaussSeidelBase : public IPreconditioner<TAlgebra>
 
 		void enable_overlap (bool enable) {m_useOverlap = enable;}
 
+	///	enables the thread-parallel sweeps based on a level schedule of the matrix
+	/**
+	 * If enabled, the rows of the matrix are grouped into levels in the
+	 * preprocess, such that the rows of a level only depend on rows of
+	 * previous levels. In every step, the rows of a level are processed
+	 * concurrently by the OPENMP threads. The result does not change.
+	 */
+		void enable_level_scheduling(bool enable)
+		{
+#ifndef UG_OPENMP
+			if(enable)
+				UG_THROW(name() << ": Level scheduling requires ug4 to be"
+						" compiled with OPENMP=ON.");
+#endif
+			m_bLevelScheduling = enable;
+		}
+
 		virtual const char* name() const = 0;
 	protected:
 
@@ -137,6 +156,9 @@ class GaussSeidelBase : public IPreconditioner<TAlgebra>
 			THROW_IF_NOT_EQUAL(pA->num_rows(), pA->num_cols());
 //			UG_ASSERT(CheckDiagonalInvertible(A), "GS: A has noninvertible diagonal");
 			UG_COND_THROW(CheckDiagonalInvertible(*pA) == false, name() << ": A has noninvertible diagonal");
+
+			if(m_bLevelScheduling) m_schedule.init(*pA);
+			else m_schedule.clear();
 			return true;
 		}
 
@@ -145,6 +167,12 @@ class GaussSeidelBase : public IPreconditioner<TAlgebra>
 
 		virtual void step(const matrix_type &A, vector_type &c, const vector_type &d, const number relax) = 0;
 
+	///	returns if the level schedule can be used for the matrix
+		bool level_scheduling_used(const matrix_type &A) const
+		{
+			return m_bLevelScheduling && m_schedule.valid(A);
+		}
+
 	//	Stepping routine
 		virtual bool step(SmartPtr<MatrixOperator<matrix_type, vector_type> > pOp, vector_type& c, const vector_type& d)
 		{
@@ -230,6 +258,10 @@ class GaussSeidelBase : public IPreconditioner<TAlgebra>
 
 		bool m_bConsistentInterfaces;
 		bool m_useOverlap;
+
+	///	level schedule for thread-parallel sweeps
+		bool m_bLevelScheduling;
+		TriangularLevelSchedule m_schedule;
 };
 
 /// Gauss-Seidel preconditioner for the 'forward' ordering of the dofs
@@ -273,7 +305,10 @@ public:
 	//	Stepping routine
 		virtual void step(const matrix_type &A, vector_type &c, const vector_type &d, const number relax)
 		{
-			gs_step_LL(A, c, d, relax);
+			if(base_type::level_scheduling_used(A))
+				gs_step_LL(A, c, d, relax, base_type::m_schedule);
+			else
+				gs_step_LL(A, c, d, relax);
 		}
 };
 
@@ -318,7 +353,10 @@ public:
 	//	Stepping routine
 		virtual void step(const matrix_type &A, vector_type &c, const vector_type &d, const number relax)
 		{
-			gs_step_UR(A, c, d, relax);
+			if(base_type::level_scheduling_used(A))
+				gs_step_UR(A, c, d, relax, base_type::m_schedule);
+			else
+				gs_step_UR(A, c, d, relax);
 		}
 };
 
@@ -352,7 +390,10 @@ public:
 	//	Stepping routine
 		virtual void step(const matrix_type &A, vector_type &c, const vector_type &d, const number relax)
 		{
-			sgs_step(A, c, d, relax);
+			if(base_type::level_scheduling_used(A))
+				sgs_step(A, c, d, relax, base_type::m_schedule);
+			else
+				sgs_step(A, c, d, relax);
 		}
 };
 
@@ -46,6 +46,7 @@
 	#include "lib_algebra/parallelization/overlap_writer.h"
 #endif
 #include "lib_algebra/algebra_common/permutation_util.h"
+#include "lib_algebra/algebra_common/level_schedule.h"
 
 namespace ug{
 
@@ -246,20 +247,16 @@ bool invert_L(const Matrix_type &A, Vector_type &x, const Vector_type &b)
 	return true;
 }
 
-// solve x = U^-1 * b
-// Returns true on success, or false on issues that lead to some changes in the solution
-// (the solution is computed unless no exceptions are thrown)
+// solve the last row of x = U^-1 * b
+// Returns true on success, or false if the diagonal entry is near-zero
 template<typename Matrix_type, typename Vector_type>
-bool invert_U(const Matrix_type &A, Vector_type &x, const Vector_type &b,
-			  const number eps = 1e-8)
+bool invert_U_last_row(const Matrix_type &A, Vector_type &x, const Vector_type &b,
+					   const number eps)
 {
-	PROFILE_FUNC_GROUP("algebra ILU");
-	typedef typename Matrix_type::const_row_iterator const_row_iterator;
-
 	typename Vector_type::value_type s;
-	
+
 	bool result = true;
-	
+
 	// last row diagonal U entry might be close to zero with corresponding close to zero rhs
 	// when solving Navier Stokes system, therefore handle separately
 	if(x.size() > 0)
@@ -293,6 +290,23 @@ bool invert_U(const Matrix_type &A, Vector_type &x, const Vector_type &b,
 			InverseMatMult(x[i], 1.0, A(i,i), s);
 		}
 	}
+
+	return result;
+}
+
+// solve x = U^-1 * b
+// Returns true on success, or false on issues that lead to some changes in the solution
+// (the solution is computed unless no exceptions are thrown)
+template<typename Matrix_type, typename Vector_type>
+bool invert_U(const Matrix_type &A, Vector_type &x, const Vector_type &b,
+			  const number eps = 1e-8)
+{
+	PROFILE_FUNC_GROUP("algebra ILU");
+	typedef typename Matrix_type::const_row_iterator const_row_iterator;
+
+	typename Vector_type::value_type s;
+	
+	bool result = invert_U_last_row(A, x, b, eps);
 	if(x.size() <= 1) return result;
 
 	// handle all other rows
@@ -314,6 +328,116 @@ bool invert_U(const Matrix_type &A, Vector_type &x, const Vector_type &b,
 	return result;
 }
 
+// solve x = L^-1 b using a level schedule of A
+// The rows of a level are processed concurrently (if compiled with OPENMP);
+// the result coincides with invert_L.
+template<typename Matrix_type, typename Vector_type>
+bool invert_L(const Matrix_type &A, Vector_type &x, const Vector_type &b,
+			  const TriangularLevelSchedule &sched)
+{
+	PROFILE_FUNC_GROUP("algebra ILU");
+	typedef typename Matrix_type::const_row_iterator const_row_iterator;
+	UG_ASSERT(sched.valid(A), "Level schedule does not match matrix.");
+
+#ifdef UG_OPENMP
+	#pragma omp parallel
+#endif
+	{
+		typename Vector_type::value_type s;
+		for(size_t l = 0; l < sched.num_lower_levels(); ++l)
+		{
+			const int kBegin = (int) sched.lower_level_begin(l);
+			const int kEnd = (int) sched.lower_level_end(l);
+
+#ifdef UG_OPENMP
+			#pragma omp for schedule(static)
+#endif
+			for(int k = kBegin; k < kEnd; ++k)
+			{
+				const size_t i = sched.lower_row(k);
+				s = b[i];
+				for(const_row_iterator it = A.begin_row(i); it != A.end_row(i); ++it)
+				{
+					if(it.index() >= i) continue;
+					MatMultAdd(s, 1.0, s, -1.0, it.value(), x[it.index()]);
+				}
+				x[i] = s;
+			}
+		}
+	}
+
+	return true;
+}
+
+// solve x = U^-1 * b using a level schedule of A
+// The rows of a level are processed concurrently (if compiled with OPENMP);
+// the result coincides with invert_U.
+template<typename Matrix_type, typename Vector_type>
+bool invert_U(const Matrix_type &A, Vector_type &x, const Vector_type &b,
+			  const TriangularLevelSchedule &sched, const number eps = 1e-8)
+{
+	PROFILE_FUNC_GROUP("algebra ILU");
+	typedef typename Matrix_type::const_row_iterator const_row_iterator;
+	UG_ASSERT(sched.valid(A), "Level schedule does not match matrix.");
+
+	bool result = invert_U_last_row(A, x, b, eps);
+	if(x.size() <= 1) return result;
+	const size_t last = x.size()-1;
+
+//	exceptions must not leave the parallel region, they are rethrown below
+	std::vector<UGError> vErr;
+
+#ifdef UG_OPENMP
+	#pragma omp parallel
+#endif
+	{
+		typename Vector_type::value_type s;
+		for(size_t l = 0; l < sched.num_upper_levels(); ++l)
+		{
+			const int kBegin = (int) sched.upper_level_begin(l);
+			const int kEnd = (int) sched.upper_level_end(l);
+
+#ifdef UG_OPENMP
+			#pragma omp for schedule(static)
+#endif
+			for(int k = kBegin; k < kEnd; ++k)
+			{
+				const size_t i = sched.upper_row(k);
+				if(i == last) continue;
+
+				try{
+					s = b[i];
+					for(const_row_iterator it = A.begin_row(i); it != A.end_row(i); ++it)
+					{
+						if(it.index() <= i) continue;
+						// s -= it.value() * x[it.index()];
+						MatMultAdd(s, 1.0, s, -1.0, it.value(), x[it.index()]);
+					}
+					// x[i] = s/A(i,i);
+					InverseMatMult(x[i], 1.0, A(i,i), s);
+				}
+				catch(UGError& err)
+				{
+					#pragma omp critical (LevelScheduleError)
+					vErr.push_back(err);
+				}
+				catch(const std::exception& ex)
+				{
+					#pragma omp critical (LevelScheduleError)
+					vErr.push_back(UGError("Exception in row", ex, __FILE__, __LINE__));
+				}
+			}
+		}
+	}
+
+	if(!vErr.empty()){
+		vErr[0].push_msg("invert_U: Cannot invert U using the level schedule.", __FILE__, __LINE__);
+		throw vErr[0];
+	}
+
+	return result;
+}
+
 
 #ifdef UG_PARALLEL
 inline void
@@ -383,9 +507,11 @@ class ILU : public IPreconditioner<TAlgebra>
 			m_sortEps(1.e-50),
 			m_invEps(1.e-8),
 			m_bSort(false),
+			m_sortType("cuthill-mckee"),
 			m_bDisablePreprocessing(false),
 			m_useConsistentInterfaces(false),
-			m_useOverlap(false) {};
+			m_useOverlap(false),
+			m_bLevelScheduling(false) {};
 
 	/// clone constructor
 		ILU( const ILU<TAlgebra> &parent )
@@ -394,9 +520,11 @@ class ILU : public IPreconditioner<TAlgebra>
 			  m_sortEps(parent.m_sortEps),
 			  m_invEps(parent.m_invEps),
 			  m_bSort(parent.m_bSort),
+			  m_sortType(parent.m_sortType),
 			  m_bDisablePreprocessing(parent.m_bDisablePreprocessing),
 			  m_useConsistentInterfaces(parent.m_useConsistentInterfaces),
-			  m_useOverlap(parent.m_useOverlap)
+			  m_useOverlap(parent.m_useOverlap),
+			  m_bLevelScheduling(parent.m_bLevelScheduling)
 		{	}
 
 	///	Clone
@@ -420,6 +548,15 @@ class ILU : public IPreconditioner<TAlgebra>
 			m_bSort = b;
 		}
 
+	///	sets the ordering used if sorting is enabled
+	/**	type is "cuthill-mckee" (default) or "nested-dissection"*/
+		void set_sort_type(const std::string& type)
+		{
+			UG_COND_THROW(type != "cuthill-mckee" && type != "nested-dissection",
+			              "ILU: Unknown sort type '" << type << "'.");
+			m_sortType = type;
+		}
+
 	/// disable preprocessing (if underlying matrix has not changed)
 		void set_disable_preprocessing(bool bDisable)	{m_bDisablePreprocessing = bDisable;}
 
@@ -436,16 +573,30 @@ class ILU : public IPreconditioner<TAlgebra>
 
 		void enable_overlap (bool enable)				{m_useOverlap = enable;}
 
+	///	enables the thread-parallel triangular solves based on a level schedule
+	/**	The level schedule of the factorization is computed in the preprocess.
+	 * In every step, the rows of a level are processed concurrently by the
+	 * OPENMP threads. The result does not change.*/
+		void enable_level_scheduling(bool enable)
+		{
+#ifndef UG_OPENMP
+			if(enable)
+				UG_THROW("ILU: Level scheduling requires ug4 to be compiled"
+						" with OPENMP=ON.");
+#endif
+			m_bLevelScheduling = enable;
+		}
+
 	protected:
 	//	Name of preconditioner
 		virtual const char* name() const {return "ILU";}
 
 	protected:
-		// cuthill-mckee sorting
+		// cuthill-mckee (or nested dissection) sorting
 		void calc_cuthill_mckee()
 		{
 			PROFILE_BEGIN_GROUP(ILU_ReorderCuthillMcKey, "ilu algebra");
-			GetCuthillMcKeeOrder(m_ILU, m_newIndex);
+			GetSortOrder(m_ILU, m_newIndex, m_sortType);
 			m_bSortIsIdentity = GetInversePermutation(m_newIndex, m_oldIndex);
 
 			if(!m_bSortIsIdentity)
@@ -545,6 +696,10 @@ class ILU : public IPreconditioner<TAlgebra>
 			else FactorizeILU(m_ILU);
 			m_ILU.defragment();
 
+		//	level schedule for the triangular solves
+			if(m_bLevelScheduling) m_schedule.init(m_ILU);
+			else m_schedule.clear();
+
 		//	Debug output of matrices
 			#ifdef UG_PARALLEL
 			write_overlap_debug(m_ILU, "ILU_prep_04_A_AfterFactorize");
@@ -559,7 +714,9 @@ class ILU : public IPreconditioner<TAlgebra>
 
 		void applyLU(vector_type &c, const vector_type &d, vector_type &tmp)
 		{	
-			if(!m_bSort || m_bSortIsIdentity)
+			if(m_bLevelScheduling && m_schedule.valid(m_ILU))
+				applyLU_scheduled(c, d, tmp);
+			else if(!m_bSort || m_bSortIsIdentity)
 			{
 				// 	apply iterator: c = LU^{-1}*d
 				if(! invert_L(m_ILU, tmp, d)) // h := L^-1 d
@@ -579,6 +736,26 @@ class ILU : public IPreconditioner<TAlgebra>
 			}
 		}
 
+		void applyLU_scheduled(vector_type &c, const vector_type &d, vector_type &tmp)
+		{
+			if(!m_bSort || m_bSortIsIdentity)
+			{
+				if(! invert_L(m_ILU, tmp, d, m_schedule))
+					print_debugger_message("ILU: There were issues at inverting L\n");
+				if(! invert_U(m_ILU, c, tmp, m_schedule, m_invEps))
+					print_debugger_message("ILU: There were issues at inverting U\n");
+			}
+			else
+			{
+				SetVectorAsPermutation(tmp, d, m_newIndex);
+				if(! invert_L(m_ILU, c, tmp, m_schedule))
+					print_debugger_message("ILU: There were issues at inverting L (after permutation)\n");
+				if(! invert_U(m_ILU, tmp, c, m_schedule, m_invEps))
+					print_debugger_message("ILU: There were issues at inverting U (after permutation)\n");
+				SetVectorAsPermutation(c, tmp, m_oldIndex);
+			}
+		}
+
 	//	Stepping routine
 		virtual bool step(SmartPtr<MatrixOperator<matrix_type, vector_type> > pOp,
 		                  vector_type& c,
@@ -690,12 +867,17 @@ class ILU : public IPreconditioner<TAlgebra>
 		std::vector<size_t> m_newIndex, m_oldIndex;
 		bool m_bSortIsIdentity;
 		bool m_bSort;
+		std::string m_sortType;
 
 	/// whether or not to disable preprocessing
 		bool m_bDisablePreprocessing;
 
 		bool m_useConsistentInterfaces;
 		bool m_useOverlap;
+
+	///	level schedule for thread-parallel triangular solves
+		bool m_bLevelScheduling;
+		TriangularLevelSchedule m_schedule;
 };
 
 } // end namespace ug
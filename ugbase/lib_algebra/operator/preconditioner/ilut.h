@@ -50,7 +50,8 @@ class ILUTPreconditioner : public IPreconditioner<TAlgebra>
 	public:
 	///	Constructor
 		ILUTPreconditioner(double eps=1e-6)
-			: m_eps(eps), m_info(false), m_show_progress(true), m_bSort(true), m_bSortIsIdentity(false)
+			: m_eps(eps), m_info(false), m_show_progress(true), m_bSort(true),
+			  m_sortType("cuthill-mckee"), m_bSortIsIdentity(false)
 		{};
 
 	/// clone constructor
@@ -60,6 +61,7 @@ class ILUTPreconditioner : public IPreconditioner<TAlgebra>
 			m_eps = parent.m_eps;
 			set_info(parent.m_info);
 			set_sort(parent.m_bSort);
+			set_sort_type(parent.m_sortType);
 			m_bSortIsIdentity = parent.m_bSortIsIdentity;
 		}
 
@@ -98,7 +100,7 @@ class ILUTPreconditioner : public IPreconditioner<TAlgebra>
 		virtual std::string config_string() const
 		{
 			std::stringstream ss;
-			ss << "ILUT(threshold = " << m_eps << ", sort = " << (m_bSort?"true":"false") << ")";
+			ss << "ILUT(threshold = " << m_eps << ", sort = " << (m_bSort?m_sortType:"false") << ")";
 			if(m_eps == 0.0) ss << " = Sparse LU";
 			return ss.str();
 		}
@@ -108,6 +110,15 @@ class ILUTPreconditioner : public IPreconditioner<TAlgebra>
 			m_bSort = b;
 		}
 
+	///	sets the ordering used if sorting is enabled
+	/**	type is "cuthill-mckee" (default) or "nested-dissection"*/
+		void set_sort_type(const std::string& type)
+		{
+			UG_COND_THROW(type != "cuthill-mckee" && type != "nested-dissection",
+			              "ILUT: Unknown sort type '" << type << "'.");
+			m_sortType = type;
+		}
+
 
 	protected:
 	//	Name of preconditioner
@@ -116,7 +127,7 @@ class ILUTPreconditioner : public IPreconditioner<TAlgebra>
 		void calc_cuthill_mckee(matrix_type &permMat, const matrix_type &mat)
 		{
 			PROFILE_BEGIN_GROUP(ILUT_ReorderCuthillMcKey, "ilut algebra");
-			GetCuthillMcKeeOrder(mat, newIndex);
+			GetSortOrder(mat, newIndex, m_sortType);
 			m_bSortIsIdentity = GetInversePermutation(newIndex, oldIndex);
 
 			if(!m_bSortIsIdentity)
@@ -334,7 +345,7 @@ class ILUTPreconditioner : public IPreconditioner<TAlgebra>
 				UG_LOG(reset_floats << "	Total entries: " << totalentries << " (" << ((double)totalentries) / (A->num_rows()*A->num_rows()) << "% of dense)\n");
 				if(m_bSort)
 				{
-					UG_LOG("	Using Cuthill-McKey sorting. ")
+					UG_LOG("	Using " << m_sortType << " sorting. ")
 						if(m_bSortIsIdentity) UG_LOG("Sort is identity (already sorted).");
 					UG_LOG("\n");
 				}
@@ -548,6 +559,7 @@ class ILUTPreconditioner : public IPreconditioner<TAlgebra>
 		static const number m_small;
 		std::vector<size_t> newIndex, oldIndex;
 		bool m_bSort;
+		std::string m_sortType;
 
 		bool m_bSortIsIdentity;
 };
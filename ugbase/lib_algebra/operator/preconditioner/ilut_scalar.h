@@ -71,7 +71,8 @@ class ILUTScalarPreconditioner : public IPreconditioner<TAlgebra>
 	public:
 	//	Constructor
 		ILUTScalarPreconditioner(double eps=1e-6) :
-			m_eps(eps), m_info(false), m_show_progress(true), m_bSort(true)
+			m_eps(eps), m_info(false), m_show_progress(true), m_bSort(true),
+			m_sortType("cuthill-mckee")
 		{};
 
 	/// clone constructor
@@ -82,6 +83,7 @@ class ILUTScalarPreconditioner : public IPreconditioner<TAlgebra>
 			set_info(parent.m_info);
 			set_show_progress(parent.m_show_progress);
 			set_sort(parent.m_bSort);
+			set_sort_type(parent.m_sortType);
 		}
 
 	///	Clone
@@ -121,6 +123,15 @@ class ILUTScalarPreconditioner : public IPreconditioner<TAlgebra>
 			m_bSort = b;
 		}
 
+	///	sets the ordering used if sorting is enabled
+	/**	type is "cuthill-mckee" (default) or "nested-dissection"*/
+		void set_sort_type(const std::string& type)
+		{
+			UG_COND_THROW(type != "cuthill-mckee" && type != "nested-dissection",
+			              "ILUTScalar: Unknown sort type '" << type << "'.");
+			m_sortType = type;
+		}
+
 	public:
 		void preprocess(const matrix_type &M)
 		{
@@ -144,6 +155,7 @@ class ILUTScalarPreconditioner : public IPreconditioner<TAlgebra>
 			ilut->set_info(m_info);
 			ilut->set_show_progress(m_show_progress);
 			ilut->set_sort(m_bSort);
+			ilut->set_sort_type(m_sortType);
 
 			mo = make_sp(new MatrixOperator<CPUAlgebra::matrix_type, CPUAlgebra::vector_type>);
 			CPUAlgebra::matrix_type &mat = mo->get_matrix();
@@ -264,7 +276,7 @@ class ILUTScalarPreconditioner : public IPreconditioner<TAlgebra>
 	public:
 		virtual std::string config_string() const
 		{
-			std::stringstream ss ; ss << "ILUTScalar(threshold = " << m_eps << ", sort = " << (m_bSort?"true":"false") << ")";
+			std::stringstream ss ; ss << "ILUTScalar(threshold = " << m_eps << ", sort = " << (m_bSort?m_sortType:"false") << ")";
 			if(m_eps == 0.0) ss << " = Sparse LU";
 			return ss.str();
 		}
@@ -280,6 +292,7 @@ protected:
 	CPUAlgebra::vector_type m_c, m_d;
 	double m_eps;
 	bool m_info, m_show_progress, m_bSort;
+	std::string m_sortType;
 	size_t m_size;
 };
 
@@ -223,12 +223,7 @@ class Jacobi : public IPreconditioner<TAlgebra>
 			PROFILE_BEGIN_GROUP(Jacobi_step, "algebra Jacobi");
 
 		// 	multiply defect with diagonal, c = damp * D^{-1} * d
-		//	note, that the damping is already included in the inverse diagonal
-			for(size_t i = 0; i < m_diagInv.size(); ++i)
-			{
-			// 	c[i] = m_diagInv[i] * d[i];
-				MatMult(c[i], 1.0, m_diagInv[i], d[i]);
-			}
+			apply_inverse_diagonal(c, d);
 
 #ifdef UG_PARALLEL
 
@@ -247,6 +242,17 @@ class Jacobi : public IPreconditioner<TAlgebra>
 			return true;
 		}
 
+	///	computes c = damp * D^{-1} * d (without parallel communication)
+		void apply_inverse_diagonal(vector_type& c, const vector_type& d)
+		{
+		//	note, that the damping is already included in the inverse diagonal
+			for(size_t i = 0; i < m_diagInv.size(); ++i)
+			{
+			// 	c[i] = m_diagInv[i] * d[i];
+				MatMult(c[i], 1.0, m_diagInv[i], d[i]);
+			}
+		}
+
 	///	Postprocess routine
 		virtual bool postprocess() {return true;}
 
@@ -298,6 +304,39 @@ class Jacobi : public IPreconditioner<TAlgebra>
 			return true;
 		}
 
+	///	compute new correction c = B*d and update defect d := d - A*c
+	/**
+	 * If the defect is updated by a matrix with overlapped apply (see
+	 * ParallelMatrix::enable_overlapped_apply), the additive correction is
+	 * made consistent during the defect update, such that the interface
+	 * communication is overlapped with the computation of the interior rows.
+	 */
+		virtual bool apply_update_defect(vector_type& c, vector_type& d)
+		{
+#ifdef UG_PARALLEL
+			SmartPtr<matrix_operator_type> spDefectOp =
+				this->m_spDefectOperator.template cast_dynamic<matrix_operator_type>();
+
+			if(this->m_bInit && spDefectOp.valid()
+				&& spDefectOp->overlapped_apply_enabled()
+				&& damping()->constant_damping()
+				&& d.has_storage_type(PST_ADDITIVE))
+			{
+				PROFILE_BEGIN_GROUP(Jacobi_apply_update_defect, "algebra Jacobi");
+				THROW_IF_NOT_EQUAL_4(c.size(), d.size(), approx_operator()->num_rows(), approx_operator()->num_cols());
+
+			// 	c = damp * D^{-1} * d is additive
+				apply_inverse_diagonal(c, d);
+				c.set_storage_type(PST_ADDITIVE);
+
+			// 	update defect d := d - A*c (c is consistent afterwards)
+				spDefectOp->matmul_minus(d, c);
+				return true;
+			}
+#endif
+			return base_type::apply_update_defect(c, d);
+		}
+
 	protected:
 	///	type of block-inverse
 		typedef typename block_traits<typename matrix_type::value_type>::inverse_type inverse_type;
@@ -0,0 +1,247 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+
+#ifndef __H__UG__LIB_ALGEBRA__OPERATOR__PRECONDITIONER__MATRIX_FREE_JACOBI__
+#define __H__UG__LIB_ALGEBRA__OPERATOR__PRECONDITIONER__MATRIX_FREE_JACOBI__
+
+#include <string>
+
+#include "common/util/smart_pointer.h"
+#include "common/profiler/profiler.h"
+#include "lib_algebra/operator/interface/linear_iterator.h"
+#include "lib_algebra/operator/interface/matrix_operator.h"
+#include "lib_algebra/operator/interface/matrix_free_operator.h"
+#include "lib_algebra/small_algebra/small_algebra.h"
+
+#ifdef UG_PARALLEL
+	#include "lib_algebra/parallelization/parallelization.h"
+#endif
+
+namespace ug{
+
+///	returns the inverse of the pointwise diagonal of an operator (consistent)
+/**
+ * The diagonal is taken from an IMatrixFreeOperator or from the matrix of a
+ * MatrixOperator. For block algebras, only the diagonal entries of the
+ * diagonal blocks are used.
+ */
+template <typename TAlgebra>
+SmartPtr<typename TAlgebra::vector_type>
+InverseOperatorDiagonal(SmartPtr<ILinearOperator<typename TAlgebra::vector_type> > spOp)
+{
+	typedef typename TAlgebra::vector_type vector_type;
+	typedef typename TAlgebra::matrix_type matrix_type;
+
+	SmartPtr<vector_type> spDiagInv;
+
+//	matrix-free operator provides diagonal
+	SmartPtr<IMatrixFreeOperator<vector_type> > spMFOp =
+			spOp.template cast_dynamic<IMatrixFreeOperator<vector_type> >();
+	SmartPtr<MatrixOperator<matrix_type, vector_type> > spMatOp =
+			spOp.template cast_dynamic<MatrixOperator<matrix_type, vector_type> >();
+
+	if(spMFOp.valid())
+	{
+		spDiagInv = spMFOp->diagonal().clone();
+	}
+	else if(spMatOp.valid())
+	{
+		const matrix_type& mat = *spMatOp;
+		if(mat.num_rows() != mat.num_cols())
+			UG_THROW("InverseOperatorDiagonal: Square Matrix needed.");
+
+		spDiagInv = make_sp(new vector_type(mat.num_rows()));
+#ifdef UG_PARALLEL
+		spDiagInv->set_layouts(mat.layouts());
+#endif
+		vector_type& diag = *spDiagInv;
+		for(size_t i = 0; i < diag.size(); ++i)
+			for(size_t k = 0; k < (size_t)GetSize(diag[i]); ++k)
+				BlockRef(diag[i], k) = BlockRef(mat(i, i), k, k);
+
+	//	make diagonal consistent
+#ifdef UG_PARALLEL
+		diag.set_storage_type(PST_ADDITIVE);
+		diag.change_storage_type(PST_CONSISTENT);
+#endif
+	}
+	else
+		UG_THROW("InverseOperatorDiagonal: Operator must be a MatrixOperator "
+				"or an IMatrixFreeOperator.");
+
+// 	invert diagonal
+	vector_type& diagInv = *spDiagInv;
+	for(size_t i = 0; i < diagInv.size(); ++i)
+		for(size_t k = 0; k < (size_t)GetSize(diagInv[i]); ++k)
+		{
+			number& d = BlockRef(diagInv[i], k);
+			if(d == 0.0)
+				UG_THROW("InverseOperatorDiagonal: Zero diagonal entry at index "
+						<< i << ", component " << k << ".");
+			d = 1.0 / d;
+		}
+
+	return spDiagInv;
+}
+
+///	computes c = D^{-1} * d for a pointwise inverse diagonal
+template <typename TVector>
+void ApplyInverseDiagonal(TVector& c, const TVector& diagInv, const TVector& d)
+{
+	for(size_t i = 0; i < diagInv.size(); ++i)
+		for(size_t k = 0; k < (size_t)GetSize(diagInv[i]); ++k)
+			BlockRef(c[i], k) = BlockRef(diagInv[i], k) * BlockRef(d[i], k);
+}
+
+///	Jacobi iteration using only the diagonal of the operator
+/**
+ * This Jacobi iteration computes c = damp * D^{-1} * d, where D is the
+ * pointwise diagonal of the operator. In contrast to Jacobi, no matrix is
+ * needed, thus the iteration can be used with operators that are applied
+ * matrix-free (IMatrixFreeOperator). For MatrixOperators the diagonal of the
+ * matrix is used.
+ */
+template <typename TAlgebra>
+class MatrixFreeJacobi : public ILinearIterator<typename TAlgebra::vector_type>
+{
+	public:
+	///	Algebra type
+		typedef TAlgebra algebra_type;
+
+	///	Vector type
+		typedef typename TAlgebra::vector_type vector_type;
+
+	///	Base type
+		typedef ILinearIterator<vector_type> base_type;
+
+	protected:
+		using base_type::damping;
+
+	public:
+	///	default constructor
+		MatrixFreeJacobi() {this->set_damp(1.0);}
+
+	///	constructor setting the damping parameter
+		MatrixFreeJacobi(number damp) {this->set_damp(damp);}
+
+	/// clone constructor
+		MatrixFreeJacobi(const MatrixFreeJacobi<TAlgebra>& parent)
+			: base_type(parent) {}
+
+	///	Clone
+		virtual SmartPtr<ILinearIterator<vector_type> > clone()
+		{
+			return make_sp(new MatrixFreeJacobi<algebra_type>(*this));
+		}
+
+	///	returns if parallel solving is supported
+		virtual bool supports_parallel() const {return true;}
+
+	///	Name of preconditioner
+		virtual const char* name() const {return "MatrixFreeJacobi";}
+
+	///	initialize for linear operator L
+		virtual bool init(SmartPtr<ILinearOperator<vector_type> > L)
+		{
+			PROFILE_BEGIN_GROUP(MatrixFreeJacobi_init, "algebra MatrixFreeJacobi");
+			m_spOp = L;
+			try{
+				m_spDiagInv = InverseOperatorDiagonal<algebra_type>(m_spOp);
+			}
+			UG_CATCH_THROW(name() << "::init: Cannot compute inverse diagonal.");
+			return true;
+		}
+
+	///	initialize for linearized operator J(u)
+		virtual bool init(SmartPtr<ILinearOperator<vector_type> > J, const vector_type& u)
+		{
+			return init(J);
+		}
+
+	///	compute new correction c = B*d
+		virtual bool apply(vector_type& c, const vector_type& d)
+		{
+			PROFILE_BEGIN_GROUP(MatrixFreeJacobi_apply, "algebra MatrixFreeJacobi");
+			if(m_spDiagInv.invalid())
+				UG_THROW(name() << "::apply: Iterator not initialized.");
+
+		//	Check parallel status
+			#ifdef UG_PARALLEL
+			if(!d.has_storage_type(PST_ADDITIVE))
+				UG_THROW(name() << "::apply: Wrong parallel "
+				               "storage format. Defect must be additive.");
+			#endif
+
+			if(c.size() != m_spDiagInv->size() || d.size() != m_spDiagInv->size())
+				UG_THROW(name() << "::apply: Size of correction ["<<c.size()<<"] "
+						"and defect ["<<d.size()<<"] must match size of operator ["
+						<<m_spDiagInv->size()<<"].");
+
+		// 	c = D^{-1} * d
+			ApplyInverseDiagonal(c, *m_spDiagInv, d);
+
+		//	Correction is always consistent
+			#ifdef 	UG_PARALLEL
+			c.set_storage_type(PST_ADDITIVE);
+			if(!c.change_storage_type(PST_CONSISTENT))
+				UG_THROW(name() << "::apply': Cannot change "
+						"parallel storage type of correction to consistent.");
+			#endif
+
+		//	apply scaling
+			const number kappa = damping()->damping(c, d, m_spOp);
+			if(kappa != 1.0) c *= kappa;
+
+			return true;
+		}
+
+	///	compute new correction c = B*d and update defect d := d - A*c
+		virtual bool apply_update_defect(vector_type& c, vector_type& d)
+		{
+			if(!apply(c, d)) return false;
+
+		//	update defect
+			m_spOp->apply_sub(d, c);
+			return true;
+		}
+
+	protected:
+	///	underlying operator
+		SmartPtr<ILinearOperator<vector_type> > m_spOp;
+
+	///	inverse of the diagonal (consistent)
+		SmartPtr<vector_type> m_spDiagInv;
+};
+
+} // end namespace ug
+
+#endif /* __H__UG__LIB_ALGEBRA__OPERATOR__PRECONDITIONER__MATRIX_FREE_JACOBI__ */
@@ -0,0 +1,207 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+
+#ifndef __H__UG__LIB_ALGEBRA__OPERATOR__PRECONDITIONER__MIXED_PRECISION__
+#define __H__UG__LIB_ALGEBRA__OPERATOR__PRECONDITIONER__MIXED_PRECISION__
+
+#include "common/error.h"
+#include "common/util/smart_pointer.h"
+#include "lib_algebra/operator/interface/linear_iterator.h"
+#include "lib_algebra/operator/interface/matrix_operator.h"
+
+#ifdef UG_PARALLEL
+	#include "lib_algebra/parallelization/parallelization.h"
+#endif
+
+namespace ug{
+
+///	Iterator applying an inner iterator to a single precision copy of the operator
+/**
+ * This iterator converts the matrix of the operator it is initialized with
+ * into a matrix of the low precision algebra TLowAlgebra (e.g. the
+ * CPUMixedAlgebra, storing the matrix entries in float). The inner iterator
+ * (e.g. a preconditioner of TLowAlgebra or a Krylov solver with such a
+ * preconditioner) is initialized with this copy, i.e. all its matrix
+ * products and all factors computed in its preprocess are stored in single
+ * precision, while the vectors (correction, defect) remain double vectors.
+ *
+ * The defect is always updated using the original, double precision
+ * operator. Thus, using this iterator as the preconditioner of a
+ * LinearSolver results in a mixed precision iterative refinement: The outer
+ * loop computes the defects in double precision and converges to the
+ * accuracy of the double precision problem, while the inner iteration
+ * only has to reduce the defect by a moderate factor and runs at (about)
+ * half of the memory bandwidth. The same holds for a smoother of a
+ * multigrid method, where the iterator is cloned for each level.
+ *
+ * \tparam	TAlgebra		algebra of the operator (double precision)
+ * \tparam	TLowAlgebra		algebra used by the inner iterator (same vector_type)
+ */
+template <typename TAlgebra, typename TLowAlgebra>
+class MixedPrecisionIterator : public ILinearIterator<typename TAlgebra::vector_type>
+{
+	public:
+	///	Algebra type
+		typedef TAlgebra algebra_type;
+
+	///	Vector type
+		typedef typename TAlgebra::vector_type vector_type;
+
+	///	Matrix type
+		typedef typename TAlgebra::matrix_type matrix_type;
+
+	///	Matrix type of the inner iterator
+		typedef typename TLowAlgebra::matrix_type low_matrix_type;
+
+	///	Matrix Operator type
+		typedef MatrixOperator<matrix_type, vector_type> matrix_operator_type;
+
+	///	Matrix Operator type of the inner iterator
+		typedef MatrixOperator<low_matrix_type, vector_type> low_matrix_operator_type;
+
+	///	Base type
+		typedef ILinearIterator<vector_type> base_type;
+
+	public:
+	///	default constructor
+		MixedPrecisionIterator() {}
+
+	///	constructor setting the inner iterator
+		MixedPrecisionIterator(SmartPtr<base_type> spIterator)
+			: m_spIterator(spIterator) {}
+
+	///	sets the inner iterator (working on the low precision operator)
+		void set_iterator(SmartPtr<base_type> spIterator) {m_spIterator = spIterator;}
+
+	///	returns the inner iterator
+		SmartPtr<base_type> iterator() {return m_spIterator;}
+
+	///	Clone
+		virtual SmartPtr<base_type> clone()
+		{
+			SmartPtr<MixedPrecisionIterator<TAlgebra, TLowAlgebra> > newInst
+				(new MixedPrecisionIterator<TAlgebra, TLowAlgebra>());
+			newInst->set_damp(this->damping());
+			if(m_spIterator.valid())
+				newInst->set_iterator(m_spIterator->clone());
+			return newInst;
+		}
+
+	///	returns if parallel solving is supported
+		virtual bool supports_parallel() const
+		{
+			if(m_spIterator.valid())
+				return m_spIterator->supports_parallel();
+			return true;
+		}
+
+	///	name of iterator
+		virtual const char* name() const {return "MixedPrecisionIterator";}
+
+	///	initialize for operator J(u) and linearization point u
+		virtual bool init(SmartPtr<ILinearOperator<vector_type> > J,
+		                  const vector_type& u)
+		{
+			return init(J);
+		}
+
+	///	initialize for linear operator L
+		virtual bool init(SmartPtr<ILinearOperator<vector_type> > L)
+		{
+			PROFILE_BEGIN_GROUP(MixedPrecisionIterator_init, "algebra MixedPrecision");
+			if(m_spIterator.invalid())
+				UG_THROW(name() << "::init: No inner iterator set.");
+
+			SmartPtr<matrix_operator_type> spOp =
+					L.template cast_dynamic<matrix_operator_type>();
+			if(spOp.invalid())
+				UG_THROW(name() << "::init: Passed Operator is not based on matrix. "
+						"This iterator can only handle matrix-based operators.");
+
+			m_spOperator = spOp;
+
+		//	convert the matrix to low precision
+			const matrix_type& A = spOp->get_matrix();
+			m_spLowOperator = make_sp(new low_matrix_operator_type());
+			low_matrix_type& lowA = m_spLowOperator->get_matrix();
+			lowA.set_as_converted_copy_of(A);
+#ifdef UG_PARALLEL
+			lowA.set_layouts(A.layouts());
+			lowA.set_storage_type(A.get_storage_mask());
+#endif
+
+			return m_spIterator->init(m_spLowOperator);
+		}
+
+	///	compute new correction c = B*d
+		virtual bool apply(vector_type& c, const vector_type& d)
+		{
+			if(m_spLowOperator.invalid())
+				UG_THROW(name() << "::apply: Iterator not initialized.");
+
+			if(!m_spIterator->apply(c, d)) return false;
+
+		//	apply scaling
+			const number kappa = this->damping()->damping(c, d, m_spOperator);
+			if(kappa != 1.0) c *= kappa;
+
+			return true;
+		}
+
+	///	compute new correction c = B*d and update defect d := d - A*c
+	/**
+	 * The defect is updated by the double precision operator, such that
+	 * the inaccuracy of the inner iteration does not enter the defect.
+	 */
+		virtual bool apply_update_defect(vector_type& c, vector_type& d)
+		{
+			if(!apply(c, d)) return false;
+
+			PROFILE_BEGIN_GROUP(MixedPrecisionIterator_defect, "algebra MixedPrecision");
+			m_spOperator->apply_sub(d, c);
+			return true;
+		}
+
+	protected:
+	///	inner iterator
+		SmartPtr<base_type> m_spIterator;
+
+	///	double precision operator (used for the defect)
+		SmartPtr<matrix_operator_type> m_spOperator;
+
+	///	low precision copy of the operator (used by the inner iterator)
+		SmartPtr<low_matrix_operator_type> m_spLowOperator;
+};
+
+} // end namespace ug
+
+#endif /* __H__UG__LIB_ALGEBRA__OPERATOR__PRECONDITIONER__MIXED_PRECISION__ */
@@ -0,0 +1,266 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+
+#ifndef __H__UG__LIB_ALGEBRA__OPERATOR__SELL_MATRIX_OPERATOR__
+#define __H__UG__LIB_ALGEBRA__OPERATOR__SELL_MATRIX_OPERATOR__
+
+#include <string>
+#include <sstream>
+
+#include "common/stopwatch.h"
+#include "common/util/smart_pointer.h"
+#include "lib_algebra/cpu_algebra/sell_sparsematrix.h"
+#include "lib_algebra/operator/interface/matrix_operator.h"
+#include "lib_algebra/operator/interface/matrix_free_operator.h"
+
+#ifdef UG_PARALLEL
+	#include "lib_algebra/parallelization/parallelization.h"
+#endif
+
+namespace ug{
+
+///	linear operator applying a SELL-C-sigma copy of the matrix of a MatrixOperator
+/**
+ * This operator converts the (assembled) matrix of a MatrixOperator into the
+ * SellSparseMatrix format and uses this copy for all products. Since the
+ * diagonal of the matrix is provided by the IMatrixFreeOperator interface,
+ * the operator can be used by Krylov solvers and by the MatrixFreeJacobi and
+ * Chebyshev smoothers.
+ *
+ * The conversion is done in init() (or at the first application). Thus, it
+ * must be repeated (by calling init()) when the matrix has changed.
+ *
+ * If the report is enabled, the time of the conversion and the times of a
+ * product in CRS and in SELL format are measured and printed, as well as the
+ * number of products needed to amortize the conversion.
+ *
+ * \tparam	TAlgebra	algebra type (scalar)
+ */
+template <typename TAlgebra>
+class SellMatrixOperator :
+	public virtual IMatrixFreeOperator<typename TAlgebra::vector_type>
+{
+	public:
+	///	Type of Algebra
+		typedef TAlgebra algebra_type;
+
+	///	Type of Vector
+		typedef typename TAlgebra::vector_type vector_type;
+
+	///	Type of Matrix
+		typedef typename TAlgebra::matrix_type matrix_type;
+
+	///	Type of matrix entries
+		typedef typename matrix_type::value_type value_type;
+
+	///	Type of the matrix operator
+		typedef MatrixOperator<matrix_type, vector_type> matrix_operator_type;
+
+	public:
+	///	Default Constructor
+		SellMatrixOperator()
+			: m_chunkSize(8), m_sigma(256), m_bReport(false), m_bValid(false) {}
+
+	///	Constructor setting the matrix operator
+		SellMatrixOperator(SmartPtr<matrix_operator_type> spOp)
+			: m_spOp(spOp), m_chunkSize(8), m_sigma(256), m_bReport(false), m_bValid(false) {}
+
+	///	sets the matrix operator to be converted
+		void set_matrix_operator(SmartPtr<matrix_operator_type> spOp) {m_spOp = spOp; m_bValid = false;}
+
+	///	sets the number of rows per chunk (C)
+		void set_chunk_size(size_t chunkSize) {m_chunkSize = chunkSize; m_bValid = false;}
+
+	///	sets the size of the sorting window (sigma)
+		void set_sigma(size_t sigma) {m_sigma = sigma; m_bValid = false;}
+
+	///	enables the report of conversion cost and speedup
+		void set_report(bool bReport) {m_bReport = bReport;}
+
+	///	returns the report of the last conversion
+		std::string conversion_report() const {return m_report;}
+
+	///	returns the converted matrix
+		const SellSparseMatrix<value_type>& get_matrix() {update(); return m_sell;}
+
+	///	converts the matrix (linearization point is not needed)
+		virtual void init(const vector_type& u) {init();}
+
+	///	converts the matrix
+		virtual void init() {m_bValid = false; update();}
+
+	///	compute f = A*u
+		virtual void apply(vector_type& f, const vector_type& u)
+		{
+			update();
+#ifdef UG_PARALLEL
+			int type = check_storage_type(u);
+#endif
+			m_sell.apply(f, u);
+#ifdef UG_PARALLEL
+			if(type == 2) f.set_storage_type(PST_CONSISTENT);
+			else f.set_storage_type(PST_ADDITIVE);
+#endif
+		}
+
+	///	compute f := f - A*u
+		virtual void apply_sub(vector_type& f, const vector_type& u)
+		{
+			update();
+#ifdef UG_PARALLEL
+			if(!(m_storageMask & PST_ADDITIVE) || !u.has_storage_type(PST_CONSISTENT)
+				|| !f.has_storage_type(PST_ADDITIVE))
+				UG_THROW("SellMatrixOperator::apply_sub (f -= A*u): Wrong storage"
+						" type. A and f must be additive, u must be consistent.");
+#endif
+			m_sell.matmul_minus(f, u);
+#ifdef UG_PARALLEL
+			f.set_storage_type(PST_ADDITIVE);
+#endif
+		}
+
+	///	returns the diagonal of the matrix (consistent)
+		virtual const vector_type& diagonal()
+		{
+			update();
+			return *m_spDiag;
+		}
+
+	///	Destructor
+		virtual ~SellMatrixOperator() {};
+
+	protected:
+	///	converts the matrix if needed
+		void update()
+		{
+			if(m_bValid) return;
+			if(m_spOp.invalid())
+				UG_THROW("SellMatrixOperator: No matrix operator set.");
+
+			PROFILE_BEGIN_GROUP(SellMatrixOperator_update, "algebra SELL");
+			const matrix_type& A = *m_spOp;
+
+			double tStart = get_clock_s();
+			m_sell.set_as_copy_of(A, m_chunkSize, m_sigma);
+			const double tConvert = get_clock_s() - tStart;
+
+		//	diagonal
+			m_spDiag = make_sp(new vector_type(A.num_rows()));
+			vector_type& diag = *m_spDiag;
+			for(size_t i = 0; i < diag.size(); ++i)
+				diag[i] = m_sell.diag(i);
+#ifdef UG_PARALLEL
+			m_storageMask = A.get_storage_mask();
+			diag.set_layouts(A.layouts());
+			if(m_storageMask & PST_ADDITIVE){
+				diag.set_storage_type(PST_ADDITIVE);
+				diag.change_storage_type(PST_CONSISTENT);
+			}
+			else diag.set_storage_type(PST_CONSISTENT);
+#endif
+			m_bValid = true;
+
+			if(m_bReport) write_report(A, tConvert);
+		}
+
+	///	measures the products in both formats and writes the report
+		void write_report(const matrix_type& A, double tConvert)
+		{
+			const int numApply = 5;
+			vector_type u(A.num_rows()), f(A.num_rows());
+			u.set(1.0);
+
+			double tStart = get_clock_s();
+			for(int i = 0; i < numApply; ++i) A.axpy(f, 0.0, f, 1.0, u);
+			const double tCRS = (get_clock_s() - tStart) / numApply;
+
+			tStart = get_clock_s();
+			for(int i = 0; i < numApply; ++i) m_sell.apply(f, u);
+			const double tSELL = (get_clock_s() - tStart) / numApply;
+
+			std::stringstream ss;
+			ss << "SellMatrixOperator: SELL-" << m_sell.chunk_size() << "-" << m_sell.sigma()
+				<< ", " << m_sell.num_rows() << " rows, " << m_sell.total_num_connections()
+				<< " nonzeros, fill efficiency " << m_sell.fill_efficiency() << "\n"
+				<< "  conversion: " << tConvert << " s, product CRS: " << tCRS
+				<< " s, product SELL: " << tSELL << " s, speedup: " << tCRS / tSELL << "\n";
+			if(tSELL < tCRS)
+				ss << "  conversion is amortized after " << tConvert / (tCRS - tSELL) << " products\n";
+			else
+				ss << "  conversion is not amortized (SELL product is not faster)\n";
+			m_report = ss.str();
+			UG_LOG(m_report);
+		}
+
+	///	checks the parallel storage types for f = A*u, returns type as in ParallelMatrix::apply
+		int check_storage_type(const vector_type& u) const
+		{
+#ifdef UG_PARALLEL
+			if((m_storageMask & PST_ADDITIVE) && u.has_storage_type(PST_CONSISTENT)) return 0;
+			if((m_storageMask & PST_CONSISTENT) && u.has_storage_type(PST_ADDITIVE)) return 1;
+			if((m_storageMask & PST_CONSISTENT) && u.has_storage_type(PST_CONSISTENT)) return 2;
+			UG_THROW("SellMatrixOperator::apply (f = A*u): Wrong storage type. "
+					"Possibilities are: A additive and u consistent, A consistent"
+					" and u additive, A consistent and u consistent.");
+#endif
+			return 0;
+		}
+
+	protected:
+	///	matrix operator to be converted
+		SmartPtr<matrix_operator_type> m_spOp;
+
+	///	converted matrix
+		SellSparseMatrix<value_type> m_sell;
+
+	///	diagonal of the matrix (consistent)
+		SmartPtr<vector_type> m_spDiag;
+
+	///	parameters of the format
+		size_t m_chunkSize, m_sigma;
+
+	///	report of the conversion
+		bool m_bReport;
+		std::string m_report;
+
+	///	flag if the conversion is up to date
+		bool m_bValid;
+
+#ifdef UG_PARALLEL
+	///	storage type of the matrix
+		uint m_storageMask;
+#endif
+};
+
+} // end namespace ug
+
+#endif /* __H__UG__LIB_ALGEBRA__OPERATOR__SELL_MATRIX_OPERATOR__ */
@@ -42,6 +42,44 @@
 namespace ug
 {
 
+#ifdef UG_PARALLEL
+static void MarkInterfaceIndices(std::vector<bool>& vMask, const IndexLayout& layout)
+{
+	for(IndexLayout::const_iterator iter = layout.begin(); iter != layout.end(); ++iter)
+	{
+		const IndexLayout::Interface& interface = layout.interface(iter);
+		for(IndexLayout::Interface::const_iterator it = interface.begin();
+				it != interface.end(); ++it)
+		{
+			const size_t index = interface.get_element(it);
+			if(index >= vMask.size()) vMask.resize(index + 1, false);
+			vMask[index] = true;
+		}
+	}
+}
+
+void HorizontalAlgebraLayouts::layouts_changed()
+{
+//	a global counter, so that a new layout never repeats the revision of a
+//	previously destroyed one located at the same address
+	static size_t s_lastRevision = 0;
+	m_revision = ++s_lastRevision;
+	m_bInterfaceMaskValid = false;
+}
+
+const std::vector<bool>& HorizontalAlgebraLayouts::interface_index_mask() const
+{
+	if(!m_bInterfaceMaskValid)
+	{
+		m_vInterfaceMask.clear();
+		MarkInterfaceIndices(m_vInterfaceMask, masterLayout);
+		MarkInterfaceIndices(m_vInterfaceMask, slaveLayout);
+		m_bInterfaceMaskValid = true;
+	}
+	return m_vInterfaceMask;
+}
+#endif
+
 
 std::ostream &operator << (std::ostream &out, const HorizontalAlgebraLayouts &layouts)
 {
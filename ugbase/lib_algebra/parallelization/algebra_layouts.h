@@ -33,6 +33,8 @@
 #ifndef __H__UG4__LIB_ALGEBRA__PARALLELIZATION__ALGEBRA_LAYOUTS__
 #define __H__UG4__LIB_ALGEBRA__PARALLELIZATION__ALGEBRA_LAYOUTS__
 
+#include <vector>
+
 #ifdef UG_PARALLEL
 #include "pcl/pcl_base.h"
 #include "lib_algebra/parallelization/parallel_index_layout.h"
@@ -47,12 +49,17 @@ namespace ug{
 class HorizontalAlgebraLayouts
 {
 	public:
-		HorizontalAlgebraLayouts() : m_overlapEnabled(false) 	{}
+		HorizontalAlgebraLayouts()
+			: m_overlapEnabled(false), m_revision(0), m_bInterfaceMaskValid(false)
+		{
+			layouts_changed();
+		}
 
 	///	clears the struct
 		void clear()
 		{
 			masterLayout.clear();			slaveLayout.clear();
+			layouts_changed();
 		}
 
 	public:
@@ -83,6 +90,25 @@ class HorizontalAlgebraLayouts
 	///	Tells whether overlap interfaces should be considered
 		bool overlap_enabled() const		{return m_overlapEnabled;}
 
+	///	returns for each index, if it is contained in the master or slave layout
+	/**
+	 * The mask is computed on the first request and cached until
+	 * layouts_changed() is called or the layouts are cleared.
+	 * Indices beyond the largest interface index are not contained in the mask.
+	 */
+		const std::vector<bool>& interface_index_mask() const;
+
+	///	returns a number that changes each time layouts_changed() is called
+	/**	Revisions are unique among all layouts, i.e. two layouts share a
+	 * revision only if one is a copy of the other.*/
+		size_t revision() const {return m_revision;}
+
+	///	invalidates data cached for the layouts
+	/**	Has to be called whenever the master or slave layout has been modified
+	 * through the non-const accessors, since cached data (e.g. the
+	 * interface_index_mask) is not updated automatically.*/
+		void layouts_changed();
+
 	public:
 	/// returns the horizontal slave/master index layout
 	/// \{
@@ -114,6 +140,13 @@ class HorizontalAlgebraLayouts
 		pcl::InterfaceCommunicator<IndexLayout> communicator;
 
 		bool m_overlapEnabled;
+
+		///	revision of the layouts
+		size_t m_revision;
+
+		///	cached interface index mask
+		mutable std::vector<bool> m_vInterfaceMask;
+		mutable bool m_bInterfaceMaskValid;
 };
 
 ///	Extends the HorizontalAlgebraLayouts by vertical layouts.
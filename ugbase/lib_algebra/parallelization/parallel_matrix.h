@@ -78,12 +78,14 @@ class ParallelMatrix : public TMatrix
 	public:
 	///	Default Constructor
 		ParallelMatrix()
-			: TMatrix(), m_type(PST_UNDEFINED), m_spAlgebraLayouts(new AlgebraLayouts)
+			: TMatrix(), m_type(PST_UNDEFINED), m_spAlgebraLayouts(new AlgebraLayouts),
+			  m_bOverlappedApply(false), m_pSplitLayouts(NULL)
 		{}
 
 	///	Constructor setting the layouts
 		ParallelMatrix(SmartPtr<AlgebraLayouts> layouts)
-			: TMatrix(), m_type(PST_UNDEFINED), m_spAlgebraLayouts(layouts)
+			: TMatrix(), m_type(PST_UNDEFINED), m_spAlgebraLayouts(layouts),
+			  m_bOverlappedApply(false), m_pSplitLayouts(NULL)
 		{}
 
 		/////////////////////////
@@ -136,15 +138,83 @@ class ParallelMatrix : public TMatrix
 		template<typename TPVector>
 		bool matmul_minus(TPVector &res, const TPVector &x) const;
 
+	/// calculate res[j] = A x[j] for all vectors of the multi-vectors
+		template<typename TPMultiVector>
+		bool apply_multi(TPMultiVector &res, const TPMultiVector &x) const;
+
 	///	assignment
 		this_type &operator =(const this_type &M);
 
+	///	enables the overlap of interface communication and computation in apply
+	/**
+	 * If enabled, apply and matmul_minus also accept an additive (or unique)
+	 * vector x for an additive matrix. Only the interface values of x are
+	 * made consistent, in a buffer, while x itself is left unchanged: the
+	 * interface communication is started non-blocking and all rows are
+	 * computed with the local values of x meanwhile. Afterwards, the rows
+	 * coupling to interface indices are corrected by the difference between
+	 * the consistent and the local interface values. For an additive x, the
+	 * interior rows are computed while the values are summed up on the masters
+	 * and the boundary rows while the sums are copied back to the slaves, such
+	 * that both phases of the communication are overlapped.
+	 *
+	 * The split into interior and boundary rows is cached and recomputed if
+	 * the layouts, the number of rows or the number of connections change.
+	 */
+		void enable_overlapped_apply(bool bEnable) {m_bOverlappedApply = bEnable;}
+
+	///	returns if the overlap of communication and computation is enabled
+		bool overlapped_apply_enabled() const {return m_bOverlappedApply;}
+
+	protected:
+	///	computes res = alpha*res + beta*A*x for additive or unique x (overlapped)
+		template<typename TPVector>
+		void overlapped_axpy(TPVector &res, number alpha, const TPVector &x, number beta) const;
+
+	///	updates the cached split into interior and boundary rows
+		void update_row_split() const;
+
+	///	values of a vector on the interface indices, accessed by global index
+		template <typename TValue>
+		class InterfaceValues
+		{
+			public:
+				typedef TValue value_type;
+
+				InterfaceValues(const std::vector<int>& vPos, size_t size)
+					: m_pvPos(&vPos), m_vValue(size) {}
+
+				TValue& operator[](size_t i) {return m_vValue[(*m_pvPos)[i]];}
+				const TValue& operator[](size_t i) const {return m_vValue[(*m_pvPos)[i]];}
+
+			///	values by position in the buffer
+				std::vector<TValue>& values() {return m_vValue;}
+
+			protected:
+				const std::vector<int>* m_pvPos;
+				std::vector<TValue> m_vValue;
+		};
+
 	private:
 	/// type of storage  (i.e. consistent, additiv, additiv unique)
 		uint m_type;
 
 	/// algebra layouts and communicators
 		ConstSmartPtr<AlgebraLayouts> m_spAlgebraLayouts;
+
+	///	flag if communication and computation are overlapped in apply
+		bool m_bOverlappedApply;
+
+	///	rows without and with couplings to interface indices
+		mutable std::vector<size_t> m_vInteriorRow, m_vBoundaryRow;
+
+	///	interface indices and their buffer position per index (-1 if none)
+		mutable std::vector<size_t> m_vInterfaceIndex;
+		mutable std::vector<int> m_vInterfacePos;
+
+	///	layouts, revision and sizes the row split has been computed for
+		mutable const AlgebraLayouts* m_pSplitLayouts;
+		mutable size_t m_splitRevision, m_splitNumRows, m_splitNumConn;
 };
 
 //	predaclaration.
@@ -48,6 +48,8 @@ ParallelMatrix<TMatrix>::operator =(const typename ParallelMatrix<TMatrix>::this
 //	copy storage type and layouts
 	this->set_storage_type(M.get_storage_mask());
 	this->set_layouts(M.layouts());
+	m_bOverlappedApply = M.m_bOverlappedApply;
+	m_pSplitLayouts = NULL;
 
 //	we're done
 	return *this;
@@ -91,6 +93,8 @@ apply(TPVector &res, const TPVector &x) const
 			&& x.has_storage_type(PST_ADDITIVE)) type = 1;
 	if(has_storage_type(PST_CONSISTENT)
 			&& x.has_storage_type(PST_CONSISTENT)) type = 2;
+	if(type == -1 && m_bOverlappedApply && has_storage_type(PST_ADDITIVE)
+			&& x.has_storage_type(PST_ADDITIVE)) type = 3;
 
 //	if no admissible type is found, return error
 	if(type == -1)
@@ -99,11 +103,15 @@ apply(TPVector &res, const TPVector &x) const
 				"Wrong storage type of Matrix/Vector: Possibilities are:\n"
 				"    - A is PST_ADDITIVE and x is PST_CONSISTENT\n"
 				"    - A is PST_CONSISTENT and x is PST_ADDITIVE\n"
+				"    - A is PST_ADDITIVE and x is PST_ADDITIVE (overlapped apply only)\n"
 				"    (storage type of A = " << get_storage_type() << ", x = " << x.get_storage_type() << ")");
 	}
 
 //	apply on single process vector
-	TMatrix::axpy(res, 0.0, res, 1.0, x);
+	if(type == 3)
+		overlapped_axpy(res, 0.0, x, 1.0);
+	else
+		TMatrix::axpy(res, 0.0, res, 1.0, x);
 
 //	set outgoing vector to additive storage
 	switch(type)
@@ -111,6 +119,58 @@ apply(TPVector &res, const TPVector &x) const
 		case 0: res.set_storage_type(PST_ADDITIVE); break;
 		case 1: res.set_storage_type(PST_ADDITIVE); break;
 		case 2: res.set_storage_type(PST_CONSISTENT); break;
+		case 3: res.set_storage_type(PST_ADDITIVE); break;
+	}
+
+//	we're done.
+	return true;
+}
+
+// calculate res[j] = A x[j]
+template <typename TMatrix>
+template<typename TPMultiVector>
+bool
+ParallelMatrix<TMatrix>::
+apply_multi(TPMultiVector &res, const TPMultiVector &x) const
+{
+	PROFILE_FUNC_GROUP("algebra");
+	if(x.size() == 0) return true;
+
+//	check types combinations (must be the same for all vectors)
+	int type = -1;
+	for(size_t j = 0; j < x.size(); ++j)
+	{
+		int typeJ = -1;
+		if(has_storage_type(PST_ADDITIVE)
+				&& x[j].has_storage_type(PST_CONSISTENT)) typeJ = 0;
+		if(has_storage_type(PST_CONSISTENT)
+				&& x[j].has_storage_type(PST_ADDITIVE)) typeJ = 1;
+		if(has_storage_type(PST_CONSISTENT)
+				&& x[j].has_storage_type(PST_CONSISTENT)) typeJ = 2;
+
+		if(typeJ == -1 || (j > 0 && typeJ != type))
+		{
+			UG_THROW("ParallelMatrix::apply_multi (b[j] = A*x[j]): "
+					"Wrong storage type of Matrix/Vector: Possibilities are:\n"
+					"    - A is PST_ADDITIVE and all x[j] are PST_CONSISTENT\n"
+					"    - A is PST_CONSISTENT and all x[j] are PST_ADDITIVE\n"
+					"    (storage type of A = " << get_storage_type() << ", x["<<j<<"] = " << x[j].get_storage_type() << ")");
+		}
+		type = typeJ;
+	}
+
+//	apply on single process vectors
+	TMatrix::apply_multi(res, x);
+
+//	set outgoing vectors to additive storage
+	for(size_t j = 0; j < res.size(); ++j)
+	{
+		switch(type)
+		{
+			case 0: res[j].set_storage_type(PST_ADDITIVE); break;
+			case 1: res[j].set_storage_type(PST_ADDITIVE); break;
+			case 2: res[j].set_storage_type(PST_CONSISTENT); break;
+		}
 	}
 
 //	we're done.
@@ -172,6 +232,9 @@ matmul_minus(TPVector &res, const TPVector &x) const
 	if(this->has_storage_type(PST_ADDITIVE)
 			&& x.has_storage_type(PST_CONSISTENT)
 			&& res.has_storage_type(PST_ADDITIVE)) type = 0;
+	if(type == -1 && m_bOverlappedApply && this->has_storage_type(PST_ADDITIVE)
+			&& x.has_storage_type(PST_ADDITIVE)
+			&& res.has_storage_type(PST_ADDITIVE)) type = 1;
 
 //	if no admissible type is found, return error
 	if(type == -1)
@@ -179,17 +242,22 @@ matmul_minus(TPVector &res, const TPVector &x) const
 		UG_THROW("ParallelMatrix::matmul_minus (b -= A*x):"
 				" Wrong storage type of Matrix/Vector: Possibilities are:\n"
 				"    - A is PST_ADDITIVE and x is PST_CONSISTENT and b is PST_ADDITIVE\n"
+				"    - A is PST_ADDITIVE and x is PST_ADDITIVE and b is PST_ADDITIVE (overlapped apply only)\n"
 				"    (storage type of A = " << this->get_storage_type() << ", x = " << x.get_storage_type() << ", b = " << res.get_storage_type() << ")");
 	}
 
 //	apply on single process vector
-	TMatrix::axpy(res, 1.0, res, -1.0, x);
+	if(type == 1)
+		overlapped_axpy(res, 1.0, x, -1.0);
+	else
+		TMatrix::axpy(res, 1.0, res, -1.0, x);
 
 //	set outgoing vector to additive storage
 //	(it could have been PST_UNIQUE before)
 	switch(type)
 	{
 		case 0: res.set_storage_type(PST_ADDITIVE); break;
+		case 1: res.set_storage_type(PST_ADDITIVE); break;
 	}
 
 //	we're done.
@@ -197,6 +265,153 @@ matmul_minus(TPVector &res, const TPVector &x) const
 }
 
 
+template <typename TMatrix>
+void
+ParallelMatrix<TMatrix>::
+update_row_split() const
+{
+	const AlgebraLayouts* pLayouts = m_spAlgebraLayouts.get();
+	if(m_pSplitLayouts == pLayouts
+		&& m_splitRevision == pLayouts->revision()
+		&& m_splitNumRows == this->num_rows()
+		&& m_splitNumConn == this->total_num_connections())
+		return;
+
+	PROFILE_FUNC_GROUP("algebra parallelization");
+	const std::vector<bool>& vMask = pLayouts->interface_index_mask();
+
+//	a row is a boundary row, if it couples to an interface index
+	m_vInteriorRow.clear();
+	m_vBoundaryRow.clear();
+	for(size_t i = 0; i < this->num_rows(); ++i)
+	{
+		bool bBoundary = false;
+		for(typename TMatrix::const_row_iterator conn = this->begin_row(i);
+				conn != this->end_row(i); ++conn)
+		{
+			const size_t j = conn.index();
+			if(j < vMask.size() && vMask[j]) {bBoundary = true; break;}
+		}
+
+		if(bBoundary) m_vBoundaryRow.push_back(i);
+		else m_vInteriorRow.push_back(i);
+	}
+
+//	enumerate the interface indices
+	m_vInterfaceIndex.clear();
+	m_vInterfacePos.assign(this->num_cols(), -1);
+	for(size_t j = 0; j < vMask.size() && j < this->num_cols(); ++j)
+		if(vMask[j])
+		{
+			m_vInterfacePos[j] = (int)m_vInterfaceIndex.size();
+			m_vInterfaceIndex.push_back(j);
+		}
+
+	m_pSplitLayouts = pLayouts;
+	m_splitRevision = pLayouts->revision();
+	m_splitNumRows = this->num_rows();
+	m_splitNumConn = this->total_num_connections();
+}
+
+// calculate res = alpha*res + beta*A*x, with x made consistent in a buffer
+template <typename TMatrix>
+template<typename TPVector>
+void
+ParallelMatrix<TMatrix>::
+overlapped_axpy(TPVector &res, number alpha, const TPVector &x, number beta) const
+{
+	PROFILE_FUNC_GROUP("algebra parallelization");
+	const AlgebraLayouts& layouts = *m_spAlgebraLayouts;
+
+//	with overlap, further interfaces are involved: use a consistent copy
+	if(layouts.overlap_enabled())
+	{
+		SmartPtr<TPVector> spX = x.clone();
+		if(!spX->change_storage_type(PST_CONSISTENT))
+			UG_THROW("ParallelMatrix::apply: Cannot make vector consistent.");
+		TMatrix::axpy(res, alpha, res, beta, *spX);
+		return;
+	}
+
+	update_row_split();
+	UG_ASSERT(res.size() == this->num_rows() && x.size() == this->num_cols(),
+	          "ParallelMatrix::apply: size mismatch.");
+	if(alpha == 0.0) static_cast<typename TPVector::vector_type&>(res).set(0.0);
+
+//	copy the local interface values of x into the buffer
+	typedef InterfaceValues<typename TPVector::value_type> buffer_type;
+	buffer_type xIF(m_vInterfacePos, m_vInterfaceIndex.size());
+	std::vector<typename TPVector::value_type>& vValue = xIF.values();
+	for(size_t k = 0; k < m_vInterfaceIndex.size(); ++k)
+		vValue[k] = x[m_vInterfaceIndex[k]];
+
+//	start the interface communication on the buffer: a unique vector only
+//	needs the master values on the slaves, an additive one has to sum up on
+//	the masters first
+	pcl::InterfaceCommunicator<IndexLayout>& com = layouts.comm();
+	ComPol_VecAdd<buffer_type> cpVecAdd(&xIF);
+	ComPol_VecCopy<buffer_type> cpVecCopy(&xIF);
+	const bool bUnique = x.has_storage_type(PST_UNIQUE);
+	if(!bUnique)
+	{
+		com.send_data(layouts.slave(), cpVecAdd);
+		com.receive_data(layouts.master(), cpVecAdd);
+		com.communicate_and_resume();
+
+	//	compute the interior rows meanwhile
+		for(size_t k = 0; k < m_vInteriorRow.size(); ++k)
+		{
+			const size_t i = m_vInteriorRow[k];
+			if(alpha != 0.0 && alpha != 1.0) res[i] *= alpha;
+			this->mat_mult_add_row(i, res[i], beta, x);
+		}
+
+		PROFILE_BEGIN_GROUP(ParallelMatrix_overlapped_wait_add, "algebra parallelization");
+		com.wait();
+	}
+
+	com.send_data(layouts.master(), cpVecCopy);
+	com.receive_data(layouts.slave(), cpVecCopy);
+	com.communicate_and_resume();
+
+//	compute the remaining rows with the local values of x meanwhile
+	if(bUnique)
+		for(size_t k = 0; k < m_vInteriorRow.size(); ++k)
+		{
+			const size_t i = m_vInteriorRow[k];
+			if(alpha != 0.0 && alpha != 1.0) res[i] *= alpha;
+			this->mat_mult_add_row(i, res[i], beta, x);
+		}
+	for(size_t k = 0; k < m_vBoundaryRow.size(); ++k)
+	{
+		const size_t i = m_vBoundaryRow[k];
+		if(alpha != 0.0 && alpha != 1.0) res[i] *= alpha;
+		this->mat_mult_add_row(i, res[i], beta, x);
+	}
+
+	{
+		PROFILE_BEGIN_GROUP(ParallelMatrix_overlapped_wait, "algebra parallelization");
+		com.wait();
+	}
+
+//	the buffer now holds the difference of consistent and local values
+	for(size_t k = 0; k < m_vInterfaceIndex.size(); ++k)
+		vValue[k] -= x[m_vInterfaceIndex[k]];
+
+//	correct the boundary rows by the interface differences
+	for(size_t k = 0; k < m_vBoundaryRow.size(); ++k)
+	{
+		const size_t i = m_vBoundaryRow[k];
+		for(typename TMatrix::const_row_iterator conn = this->begin_row(i);
+				conn != this->end_row(i); ++conn)
+		{
+			const int pos = m_vInterfacePos[conn.index()];
+			if(pos >= 0)
+				MatMultAdd(res[i], 1.0, res[i], beta, conn.value(), vValue[pos]);
+		}
+	}
+}
+
 template<typename matrix_type, typename vector_type>
 ug::ParallelStorageType GetMultType(const ParallelMatrix<matrix_type> &A1, const ParallelVector<vector_type> &x)
 {
@@ -366,6 +366,7 @@ public:
 		ConstSmartPtr<AlgebraLayouts> b= spLayouts;
 		spLayouts->master() = m_totalMasterLayout;
 		spLayouts->slave() = m_totalSlaveLayout;
+		spLayouts->layouts_changed();
 		spLayouts->proc_comm() = m_mat.layouts()->proc_comm();
 		spLayouts->comm() = m_mat.layouts()->comm();
 		m_newMat.set_layouts(spLayouts);
@@ -521,6 +521,190 @@ inline void VecHadamardProd(ParallelVector<T> &dest, const ParallelVector<T> &v1
 	VecHadamardProd(*dynamic_cast<T*>(&dest), *dynamic_cast<const T*>(&v1), *dynamic_cast<const T*>(&v2));
 }
 
+// returns if the local parts of scal<a, b> can be summed up without communication
+template<typename T>
+inline bool VecProdStorageCompatible(const ParallelVector<T> &a, const ParallelVector<T> &b)
+{
+	return (a.has_storage_type(PST_ADDITIVE) && b.has_storage_type(PST_CONSISTENT))
+		|| (a.has_storage_type(PST_CONSISTENT) && b.has_storage_type(PST_ADDITIVE))
+		|| (a.has_storage_type(PST_UNIQUE) && b.has_storage_type(PST_UNIQUE));
+}
+
+// sums up local values over all processes of the vector
+template<typename T>
+inline void VecAllreduceSum(const ParallelVector<T> &v, double* pVal, size_t n)
+{
+	if(n == 0 || v.layouts()->proc_comm().empty()) return;
+	std::vector<double> vLocal(pVal, pVal + n);
+	v.layouts()->proc_comm().allreduce(&vLocal[0], pVal, n, PCL_RO_SUM);
+}
+
+// starts the non-blocking summation of local values over all processes of the
+// vector (completed by pcl::MPI_Wait(&request), buffers must be kept until then)
+template<typename T>
+inline void VecIAllreduceSum(const ParallelVector<T> &v, const double* pLocal,
+                             double* pVal, size_t n, MPI_Request &request)
+{
+	request = MPI_REQUEST_NULL;
+	if(n == 0 || v.layouts()->proc_comm().empty())
+	{
+		for(size_t i = 0; i < n; ++i) pVal[i] = pLocal[i];
+		return;
+	}
+	v.layouts()->proc_comm().iallreduce(pLocal, pVal, n, PCL_RO_SUM, request);
+}
+
+// x = x + alpha*q, r = beta1*s + beta2*t, returns norm_2^2(r)
+// (fused if r is unique, i.e. s and t are unique, otherwise the norm is
+// computed separately with an additional pass and communication; callers
+// should thus make s and t unique beforehand)
+template<typename T>
+inline double VecUpdateNormSquared(ParallelVector<T> &x, double alpha, const ParallelVector<T> &q,
+                                   ParallelVector<T> &r, double beta1, const ParallelVector<T> &s,
+                                   double beta2, const ParallelVector<T> &t)
+{
+	PROFILE_FUNC_GROUP("algebra");
+	uint maskX = x.get_storage_mask() & q.get_storage_mask();
+	uint maskR = s.get_storage_mask() & t.get_storage_mask();
+	UG_COND_THROW(maskX == 0 || maskR == 0, "VecUpdateNormSquared: cannot add vectors");
+	x.set_storage_type(maskX);
+	r.set_storage_type(maskR);
+
+	double sum = VecUpdateNormSquared((T&)x, alpha, (const T&)q,
+	                                  (T&)r, beta1, (const T&)s, beta2, (const T&)t);
+
+	if(r.has_storage_type(PST_UNIQUE))
+	{
+		VecAllreduceSum(r, &sum, 1);
+		return sum;
+	}
+
+	const double norm = r.norm();
+	return norm*norm;
+}
+
+// s1 = scal<a, b1>, s2 = scal<a, b2> (with one reduction if possible)
+template<typename T>
+inline void VecProd2(const ParallelVector<T> &a, const ParallelVector<T> &b1,
+                     const ParallelVector<T> &b2, double &s1, double &s2)
+{
+	PROFILE_FUNC_GROUP("algebra");
+	if(!VecProdStorageCompatible(a, b1) || !VecProdStorageCompatible(a, b2))
+	{
+		s1 = VecProd(a, b1);
+		s2 = VecProd(a, b2);
+		return;
+	}
+
+	double vSum[2];
+	VecProd2((const T&)a, (const T&)b1, (const T&)b2, vSum[0], vSum[1]);
+	VecAllreduceSum(a, vSum, 2);
+	s1 = vSum[0]; s2 = vSum[1];
+}
+
+// vS[k] = scal<a, vB[k]> (with one reduction if possible)
+template<typename T>
+inline void VecMultiProd(const ParallelVector<T> &a,
+                         const std::vector<const ParallelVector<T>*> &vB,
+                         std::vector<double> &vS)
+{
+	PROFILE_FUNC_GROUP("algebra");
+	bool bCompatible = true;
+	std::vector<const T*> vLocalB(vB.size());
+	for(size_t k = 0; k < vB.size(); ++k)
+	{
+		bCompatible &= VecProdStorageCompatible(a, *vB[k]);
+		vLocalB[k] = vB[k];
+	}
+
+	if(!bCompatible)
+	{
+		vS.resize(vB.size());
+		for(size_t k = 0; k < vB.size(); ++k)
+			vS[k] = VecProd(a, *vB[k]);
+		return;
+	}
+
+	VecMultiProd((const T&)a, vLocalB, vS);
+	if(!vS.empty()) VecAllreduceSum(a, &vS[0], vS.size());
+}
+
+// a = a + sum_k vAlpha[k]*vB[k], returns norm_2^2(a)
+// (fused if a is unique, otherwise the norm is computed separately)
+template<typename T>
+inline double VecMultiScaleAppendNormSquared(ParallelVector<T> &a,
+                                             const std::vector<const ParallelVector<T>*> &vB,
+                                             const std::vector<double> &vAlpha)
+{
+	PROFILE_FUNC_GROUP("algebra");
+	uint mask = a.get_storage_mask();
+	std::vector<const T*> vLocalB(vB.size());
+	for(size_t k = 0; k < vB.size(); ++k)
+	{
+		mask &= vB[k]->get_storage_mask();
+		vLocalB[k] = vB[k];
+	}
+	UG_COND_THROW(mask == 0, "VecMultiScaleAppendNormSquared: cannot add vectors");
+	a.set_storage_type(mask);
+
+	double sum = VecMultiScaleAppendNormSquared((T&)a, vLocalB, vAlpha);
+
+	if(a.has_storage_type(PST_UNIQUE))
+	{
+		VecAllreduceSum(a, &sum, 1);
+		return sum;
+	}
+
+	const double norm = a.norm();
+	return norm*norm;
+}
+
+// vS[i*m+j] = scal<vA[i], vB[j]> (with one reduction if possible)
+template<typename T>
+inline void VecBlockProd(const std::vector<const ParallelVector<T>*> &vA,
+                         const std::vector<const ParallelVector<T>*> &vB,
+                         std::vector<double> &vS)
+{
+	PROFILE_FUNC_GROUP("algebra");
+	const size_t n = vA.size(), m = vB.size();
+	bool bCompatible = true;
+	for(size_t i = 0; i < n; ++i)
+		for(size_t j = 0; j < m; ++j)
+			bCompatible &= VecProdStorageCompatible(*vA[i], *vB[j]);
+
+	if(!bCompatible)
+	{
+		vS.resize(n*m);
+		for(size_t i = 0; i < n; ++i)
+			for(size_t j = 0; j < m; ++j)
+				vS[i*m+j] = VecProd(*vA[i], *vB[j]);
+		return;
+	}
+
+	std::vector<const T*> vLocalA(vA.begin(), vA.end());
+	std::vector<const T*> vLocalB(vB.begin(), vB.end());
+	VecBlockProd(vLocalA, vLocalB, vS);
+	if(!vS.empty()) VecAllreduceSum(*vA[0], &vS[0], vS.size());
+}
+
+// vA[j] = vA[j] + sum_i vAlpha[i*m+j]*vB[i]
+template<typename T>
+inline void VecBlockScaleAppend(const std::vector<ParallelVector<T>*> &vA,
+                                const std::vector<const ParallelVector<T>*> &vB,
+                                const std::vector<double> &vAlpha)
+{
+	PROFILE_FUNC_GROUP("algebra");
+	uint mask = PST_CONSISTENT | PST_ADDITIVE | PST_UNIQUE;
+	for(size_t j = 0; j < vA.size(); ++j) mask &= vA[j]->get_storage_mask();
+	for(size_t i = 0; i < vB.size(); ++i) mask &= vB[i]->get_storage_mask();
+	UG_COND_THROW(mask == 0, "VecBlockScaleAppend: cannot add vectors");
+	for(size_t j = 0; j < vA.size(); ++j) vA[j]->set_storage_type(mask);
+
+	std::vector<T*> vLocalA(vA.begin(), vA.end());
+	std::vector<const T*> vLocalB(vB.begin(), vB.end());
+	VecBlockScaleAppend(vLocalA, vLocalB, vAlpha);
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////
 
 template<typename TVector>
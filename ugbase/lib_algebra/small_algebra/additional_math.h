@@ -146,6 +146,11 @@ inline void GetDiag(double &a, double b)
 	a = b;
 }
 
+inline void GetDiag(float &a, float b)
+{
+	a = b;
+}
+
 template<typename T1, typename T2>
 inline void GetDiag(T1 &m1, const T2 &m)
 {
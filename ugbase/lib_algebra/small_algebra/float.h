@@ -0,0 +1,198 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+
+/*
+ *  Specializations of the block functions for float entries. Matrices
+ *  with float entries are applied to vectors of doubles (e.g. in the mixed
+ *  precision algebra), therefore the products return doubles.
+ */
+
+#ifndef __H__UG__SMALL_ALGEBRA__FLOAT__
+#define __H__UG__SMALL_ALGEBRA__FLOAT__
+
+#include "double.h"
+
+namespace ug{
+
+
+//////////////////////////////////////////////////////
+template <>
+inline number BlockNorm(const float &a)
+{
+	return a>0 ? a : -a;
+}
+
+template <>
+inline number BlockNorm2(const float &a)
+{
+	return (number)a*a;
+}
+
+template <>
+inline number BlockMaxNorm(const float &a)
+{
+	return a>0 ? a : -a;
+}
+
+//////////////////////////////////////////////////////
+// get/set for floats
+
+inline float &BlockRef(float &m, size_t i)
+{
+	UG_ASSERT(i == 0, "block is float, doesnt have component (" << i << ").");
+	return m;
+}
+inline const float &BlockRef(const float &m, size_t i)
+{
+	UG_ASSERT(i == 0, "block is float, doesnt have component (" << i << ").");
+	return m;
+}
+
+inline float &BlockRef(float &m, size_t i, size_t j)
+{
+	UG_ASSERT(i == 0 && j == 0, "block is float, doesnt have component (" << i << ", " << j << ").");
+	return m;
+}
+inline const float &BlockRef(const float &m, size_t i, size_t j)
+{
+	UG_ASSERT(i == 0 && j == 0, "block is float, doesnt have component (" << i << ", " << j << ").");
+	return m;
+}
+
+//////////////////////////////////////////////////////
+// algebra stuff to avoid temporary variables
+
+inline void AssignMult(float &dest, const float &b, const float &vec)
+{
+	dest = b*vec;
+}
+// dest += vec*b
+inline void AddMult(float &dest, const float &b, const float &vec)
+{
+	dest += b*vec;
+}
+inline void AddMult(float &dest, const number &b, const float &vec)
+{
+	dest += (float)(b*vec);
+}
+
+// dest -= vec*b
+inline void SubMult(float &dest, const float &b, const float &vec)
+{
+	dest -= b*vec;
+}
+
+
+//////////////////////////////////////////////////////
+//setSize(t, a, b) for floats
+template<>
+inline void SetSize(float &d, size_t a)
+{
+	UG_ASSERT(a == 1, "block is float, cannot change size to " << a << ".");
+	return;
+}
+
+template<>
+inline void SetSize(float &d, size_t a, size_t b)
+{
+	UG_ASSERT(a == 1 && b == 1, "block is float, cannot change size to (" << a << ", " << b << ").");
+	return;
+}
+
+template<>
+inline size_t GetSize(const float &t)
+{
+	return 1;
+}
+
+template<>
+inline size_t GetRows(const float &t)
+{
+	return 1;
+}
+
+template<>
+inline size_t GetCols(const float &t)
+{
+	return 1;
+}
+///////////////////////////////////////////////////////////////////
+
+inline bool InverseMatMult(number &dest, const double &beta, const float &mat, const number &vec)
+{
+	dest = beta*vec/mat;
+	return true;
+}
+
+///////////////////////////////////////////////////////////////////
+// traits: information for floats
+
+
+template<>
+struct block_traits<float>
+{
+	typedef number vec_type;
+	typedef float inverse_type;
+
+	enum { is_static = true};
+	enum { static_num_rows = 1};
+	enum { static_num_cols = 1};
+	enum { static_size = 1 };
+	enum { depth = 0 };
+};
+
+template<> struct block_multiply_traits<float, number>
+{
+	typedef number ReturnType;
+};
+
+template<> struct block_multiply_traits<float, float>
+{
+	typedef float ReturnType;
+};
+
+inline bool GetInverse(float &inv, const float &m)
+{
+	inv = 1.0f/m;
+	return (m != 0.0f);
+}
+
+inline bool Invert(float &m)
+{
+	bool b = (m != 0.0f);
+	m = 1/m;
+	return b;
+}
+
+} // namespace ug
+
+#endif
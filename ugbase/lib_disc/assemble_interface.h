@@ -33,6 +33,9 @@
 #ifndef __H__UG__LIB_DISC__ASSEMBLE__
 #define __H__UG__LIB_DISC__ASSEMBLE__
 
+#include <cmath>
+#include <limits>
+
 #include "lib_grid/tools/selector_grid.h"
 #include "lib_grid/tools/grid_level.h"
 #include "lib_disc/spatial_disc/ass_tuner.h"
@@ -195,6 +198,73 @@ class IAssemble
 		void assemble_stiffness_matrix(matrix_type& A, const vector_type& u)
 		{assemble_stiffness_matrix(A,u,GridLevel());}
 
+	///	applies the Jacobian to a vector without assembling a matrix
+	/**
+	 * Computes f = J(u)*x. The default implementation approximates the action
+	 * of the Jacobian by the directional derivative of the defect,
+	 * \f$ J(u)*x \approx (d(u + \epsilon x) - d(u)) / \epsilon \f$, with
+	 * \f$ \epsilon = \sqrt{\epsilon_{mach}} (1 + \|u\|) / \|x\| \f$.
+	 * The rows of Dirichlet dofs (cf. dirichlet_mask) are identity rows as in
+	 * assemble_jacobian. Discretizations overwriting this method apply the
+	 * exact (local) Jacobians instead.
+	 *
+	 * \param[out]	f	J(u)*x
+	 * \param[in]	x	vector the Jacobian is applied to (consistent)
+	 * \param[in]	u	linearization point
+	 * \param[in]	gl	Grid Level
+	 */
+		virtual void apply_jacobian(vector_type& f, const vector_type& x,
+		                            const vector_type& u, const GridLevel& gl)
+		{
+		//	f = d(u)
+			assemble_defect(f, u, gl);
+
+			const number normX = x.norm();
+			if(normX == 0.0) {f.set(0.0); return;}
+
+			const number eps = sqrt(std::numeric_limits<number>::epsilon())
+								* (1.0 + u.norm()) / normX;
+
+		//	dEps = d(u + eps*x)
+			SmartPtr<vector_type> spUEps = u.clone();
+			VecScaleAdd(*spUEps, 1.0, u, eps, x);
+			SmartPtr<vector_type> spDEps = f.clone_without_values();
+			assemble_defect(*spDEps, *spUEps, gl);
+
+		//	f = (d(u + eps*x) - d(u)) / eps
+			VecScaleAdd(f, 1.0/eps, *spDEps, -1.0/eps, f);
+
+		//	rows of dirichlet dofs are identity rows (the defect is zero there)
+			ConstSmartPtr<vector_type> spMask = dirichlet_mask(gl);
+			if(spMask.valid())
+			{
+				for(size_t i = 0; i < f.size(); ++i)
+					for(size_t k = 0; k < (size_t)GetSize(f[i]); ++k)
+						if(BlockRef((*spMask)[i], k) == 0.0)
+							BlockRef(f[i], k) = BlockRef(x[i], k);
+			}
+		}
+
+	///	returns a mask that is zero for dirichlet dofs and one for all others
+	/**
+	 * Returns SPNULL, if there are no dofs fixed by dirichlet constraints. The
+	 * default implementation knows no constraints and returns SPNULL.
+	 *
+	 * \param[in]	gl	Grid Level
+	 */
+		virtual ConstSmartPtr<vector_type> dirichlet_mask(const GridLevel& gl)
+		{return SPNULL;}
+
+	///	assembles the diagonal of the Jacobian
+	/**
+	 * \param[out]	diag	diagonal of J(u)
+	 * \param[in]	u		linearization point
+	 * \param[in]	gl		Grid Level
+	 */
+		virtual void assemble_jacobian_diagonal(vector_type& diag, const vector_type& u,
+		                                        const GridLevel& gl)
+		{UG_THROW("IAssemble: assemble_jacobian_diagonal not implemented.");}
+
 	/// \{
 		virtual SmartPtr<AssemblingTuner<TAlgebra> > ass_tuner() = 0;
 		virtual ConstSmartPtr<AssemblingTuner<TAlgebra> > ass_tuner() const = 0;
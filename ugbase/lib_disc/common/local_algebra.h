@@ -41,10 +41,36 @@
 
 #include "./multi_index.h"
 #include "./function_group.h"
+#include "common/profiler/profile_counter.h"
 #include "lib_algebra/small_algebra/small_algebra.h"
 
 namespace ug{
 
+///	counts the heap (re-)allocations of local indices, vectors and matrices
+ProfileCounter& LocalAlgebraAllocations();
+
+///	counts the elements prepared for assembling
+ProfileCounter& AssembledElements();
+
+///	resizes a local algebra storage, that is never shrunk in capacity
+/**
+ * The storage of the local algebra is only grown, such that after the first
+ * elements of an element loop no heap allocations take place. Every growth of
+ * the capacity is counted by LocalAlgebraAllocations() (profiler builds only).
+ */
+template <typename T>
+inline void ResizeLocalAlgebraStorage(std::vector<T>& v, size_t size,
+                                      size_t capacity = 0)
+{
+	if(capacity < size) capacity = size;
+	if(capacity > v.capacity())
+	{
+		PROFILE_COUNTER_ADD(LocalAlgebraAllocations(), 1);
+		v.reserve(capacity);
+	}
+	v.resize(size);
+}
+
 
 class LocalIndices
 {
@@ -94,7 +120,24 @@ class LocalIndices
 		void reserve_dof(size_t fct, size_t numDoF)
 		{
 			check_fct(fct);
-			m_vvIndex[fct].reserve(numDoF);
+			if(numDoF > m_vvIndex[fct].capacity())
+			{
+				PROFILE_COUNTER_ADD(LocalAlgebraAllocations(), 1);
+				m_vvIndex[fct].reserve(numDoF);
+			}
+		}
+
+	///	returns the number of dofs memory is reserved for (sum over all fct)
+	/**
+	 * LocalVector and LocalMatrix resized for these indices allocate at least
+	 * this size, such that their storage can be reused for all elements.
+	 */
+		size_t num_reserved_dof() const
+		{
+			size_t num = 0;
+			for(size_t fct = 0; fct < num_fct(); ++fct)
+				num += m_vvIndex[fct].capacity();
+			return num;
 		}
 
 	///	adds an index (increases size)
@@ -104,9 +147,20 @@ class LocalIndices
 		void push_back_multi_index(size_t fct, size_t index, size_t comp)
 		{
 			check_fct(fct);
+			if(m_vvIndex[fct].size() == m_vvIndex[fct].capacity())
+				PROFILE_COUNTER_ADD(LocalAlgebraAllocations(), 1);
 			m_vvIndex[fct].push_back(DoFIndex(index,comp));
 		}
 
+	///	sets the dofs of a function to a contiguous range of indices
+		void assign_dof(size_t fct, const DoFIndex* pDoF, size_t numDoF)
+		{
+			check_fct(fct);
+			if(numDoF > m_vvIndex[fct].capacity())
+				PROFILE_COUNTER_ADD(LocalAlgebraAllocations(), 1);
+			m_vvIndex[fct].assign(pDoF, pDoF + numDoF);
+		}
+
 	///	clears all fct
 		void clear() {m_vvIndex.clear();}
 
@@ -195,19 +249,33 @@ class LocalVector
 
 	public:
 	///	default Constructor
-		LocalVector() : m_pIndex(NULL) {m_vvValue.clear();}
+		LocalVector() : m_pIndex(NULL), m_pFuncMap(NULL) {}
 
 	///	Constructor
-		LocalVector(const LocalIndices& ind) {resize(ind);}
+		LocalVector(const LocalIndices& ind) : m_pIndex(NULL), m_pFuncMap(NULL)
+		{
+			resize(ind);
+		}
 
 	///	resize for current local indices
+	/**
+	 * The values of all functions are stored in one contiguous array, that
+	 * is only grown (at least to the number of dofs reserved in the indices).
+	 * Thus, resizing for the elements of an element loop does not allocate.
+	 */
 		void resize(const LocalIndices& ind)
 		{
 			m_pIndex = &ind;
-			m_vvValue.resize(ind.num_fct());
-			m_vvValueAcc.resize(m_vvValue.size());
-			for(size_t fct = 0; fct < m_vvValue.size(); ++fct)
-				m_vvValue[fct].resize(ind.num_dof(fct));
+			const size_t numFct = ind.num_fct();
+
+			ResizeLocalAlgebraStorage(m_vOffset, numFct+1);
+			m_vOffset[0] = 0;
+			for(size_t fct = 0; fct < numFct; ++fct)
+				m_vOffset[fct+1] = m_vOffset[fct] + ind.num_dof(fct);
+
+			ResizeLocalAlgebraStorage(m_vValue, m_vOffset[numFct],
+			                          ind.num_reserved_dof());
+			ResizeLocalAlgebraStorage(m_vvValueAcc, numFct);
 			access_all();
 		}
 
@@ -221,9 +289,8 @@ class LocalVector
 	/// set all components of the vector
 		this_type& operator=(number val)
 		{
-			for(size_t fct = 0; fct < m_vvValue.size(); ++fct)
-				for(size_t dof = 0; dof < m_vvValue[fct].size(); ++dof)
-					m_vvValue[fct][dof] = val;
+			for(size_t i = 0; i < m_vValue.size(); ++i)
+				m_vValue[i] = val;
 			return *this;
 		}
 
@@ -236,9 +303,8 @@ class LocalVector
 	/// multiply all components of the vector
 		this_type& operator*=(number val)
 		{
-			for(size_t fct = 0; fct < m_vvValue.size(); ++fct)
-				for(size_t dof = 0; dof < m_vvValue[fct].size(); ++dof)
-					m_vvValue[fct][dof] *= val;
+			for(size_t i = 0; i < m_vValue.size(); ++i)
+				m_vValue[i] *= val;
 			return *this;
 		}
 
@@ -246,9 +312,8 @@ class LocalVector
 		this_type& operator+=(const this_type& rhs)
 		{
 			UG_LOCALALGEBRA_ASSERT(m_pIndex==rhs.m_pIndex, "Not same indices.");
-			for(size_t fct = 0; fct < m_vvValue.size(); ++fct)
-				for(size_t dof = 0; dof < m_vvValue[fct].size(); ++dof)
-					m_vvValue[fct][dof] += rhs.m_vvValue[fct][dof];
+			for(size_t i = 0; i < m_vValue.size(); ++i)
+				m_vValue[i] += rhs.m_vValue[i];
 			return *this;
 		}
 
@@ -256,9 +321,8 @@ class LocalVector
 		this_type& operator-=(const this_type& rhs)
 		{
 			UG_LOCALALGEBRA_ASSERT(m_pIndex==rhs.m_pIndex, "Not same indices.");
-			for(size_t fct = 0; fct < m_vvValue.size(); ++fct)
-				for(size_t dof = 0; dof < m_vvValue[fct].size(); ++dof)
-					m_vvValue[fct][dof] -= rhs.m_vvValue[fct][dof];
+			for(size_t i = 0; i < m_vValue.size(); ++i)
+				m_vValue[i] -= rhs.m_vValue[i];
 			return *this;
 		}
 
@@ -266,9 +330,8 @@ class LocalVector
 		this_type& scale_append(number s, const this_type& rhs)
 		{
 			UG_LOCALALGEBRA_ASSERT(m_pIndex==rhs.m_pIndex, "Not same indices.");
-			for(size_t fct = 0; fct < m_vvValue.size(); ++fct)
-				for(size_t dof = 0; dof < m_vvValue[fct].size(); ++dof)
-					m_vvValue[fct][dof] += s * rhs.m_vvValue[fct][dof];
+			for(size_t i = 0; i < m_vValue.size(); ++i)
+				m_vValue[i] += s * rhs.m_vValue[i];
 			return *this;
 		}
 
@@ -280,10 +343,11 @@ class LocalVector
 		void access_by_map(const FunctionIndexMapping& funcMap)
 		{
 			m_pFuncMap = &funcMap;
+			value_type* pValue = data();
 			for(size_t i = 0; i < funcMap.num_fct(); ++i)
 			{
 				const size_t mapFct = funcMap[i];
-				m_vvValueAcc[i] = &(m_vvValue[mapFct][0]);
+				m_vvValueAcc[i] = pValue + m_vOffset[mapFct];
 			}
 		}
 
@@ -294,14 +358,15 @@ class LocalVector
 
 			if(m_pIndex==NULL) {m_vvValueAcc.clear(); return;}
 
-			for(size_t i = 0; i < m_pIndex->num_fct(); ++i)
-				m_vvValueAcc[i] = &(m_vvValue[i][0]);
+			value_type* pValue = data();
+			for(size_t i = 0; i < m_vvValueAcc.size(); ++i)
+				m_vvValueAcc[i] = pValue + m_vOffset[i];
 		}
 
 	///	returns the number of currently accessible functions
 		size_t num_fct() const
 		{
-			if(m_pFuncMap == NULL) return m_vvValue.size();
+			if(m_pFuncMap == NULL) return num_all_fct();
 			return m_pFuncMap->num_fct();
 		}
 
@@ -318,8 +383,8 @@ class LocalVector
 		size_t num_dof(size_t fct) const
 		{
 			check_fct(fct);
-			if(m_pFuncMap == NULL) return m_vvValue[fct].size();
-			else return m_vvValue[ (*m_pFuncMap)[fct] ].size();
+			if(m_pFuncMap == NULL) return num_all_dof(fct);
+			else return num_all_dof((*m_pFuncMap)[fct]);
 		}
 
 	/// access to dof of currently accessible function fct
@@ -341,18 +406,25 @@ class LocalVector
 		///////////////////////////
 
 	///	returns the number of all functions
-		size_t num_all_fct() const {return m_vvValue.size();}
+		size_t num_all_fct() const {return m_vvValueAcc.size();}
 
 	///	returns the number of dofs for a function (unrestricted functions)
-		size_t num_all_dof(size_t fct) const {check_all_fct(fct); return m_vvValue[fct].size();}
+		size_t num_all_dof(size_t fct) const
+		{
+			check_all_fct(fct);
+			return m_vOffset[fct+1] - m_vOffset[fct];
+		}
 
 	/// access to dof of a fct (unrestricted functions)
-		number& value(size_t fct, size_t dof){check_all_dof(fct,dof);return m_vvValue[fct][dof];}
+		number& value(size_t fct, size_t dof){check_all_dof(fct,dof);return m_vValue[m_vOffset[fct] + dof];}
 
 	/// const access to dof of a fct (unrestricted functions)
-		const number& value(size_t fct, size_t dof) const{check_all_dof(fct,dof);return m_vvValue[fct][dof];}
+		const number& value(size_t fct, size_t dof) const{check_all_dof(fct,dof);return m_vValue[m_vOffset[fct] + dof];}
 
 	protected:
+	///	returns the begin of the value storage
+		value_type* data() {return m_vValue.empty() ? NULL : &m_vValue[0];}
+
 	///	checks correct fct index in debug mode
 		inline void check_fct(size_t fct) const
 		{
@@ -388,8 +460,11 @@ class LocalVector
 	/// Entries (fct, dof)
 		std::vector<value_type*> m_vvValueAcc;
 
-	/// Entries (fct, dof)
-		std::vector<std::vector<value_type> > m_vvValue;
+	///	Offset of the first dof of a function (fct) in the value array
+		std::vector<size_t> m_vOffset;
+
+	/// Entries (all fct, all dof) in one contiguous array
+		std::vector<value_type> m_vValue;
 };
 
 class LocalMatrix
@@ -405,12 +480,13 @@ class LocalMatrix
 	///	Constructor
 		LocalMatrix() :
 			m_pRowIndex(NULL), m_pColIndex(NULL) ,
-			m_pRowFuncMap(NULL), m_pColFuncMap(NULL)
+			m_pRowFuncMap(NULL), m_pColFuncMap(NULL),
+			m_numCols(0)
 		{}
 
 	///	Constructor
 		LocalMatrix(const LocalIndices& rowInd, const LocalIndices& colInd)
-			: m_pRowFuncMap(NULL), m_pColFuncMap(NULL)
+			: m_pRowFuncMap(NULL), m_pColFuncMap(NULL), m_numCols(0)
 		{
 			resize(rowInd, colInd);
 		}
@@ -419,21 +495,27 @@ class LocalMatrix
 		void resize(const LocalIndices& ind) {resize(ind, ind);}
 
 	///	resize for current local indices
+	/**
+	 * The entries of all function couplings are stored in one contiguous
+	 * row-major array, that is only grown (at least to the number of dofs
+	 * reserved in the indices). Thus, resizing for the elements of an element
+	 * loop does not allocate.
+	 */
 		void resize(const LocalIndices& rowInd, const LocalIndices& colInd)
 		{
 			m_pRowIndex = &rowInd;
 			m_pColIndex = &colInd;
 
-			m_CplMat.resize(rowInd.num_fct(), colInd.num_fct());
-			m_CplMatAcc.resize(rowInd.num_fct(), colInd.num_fct());
+			compute_offsets(m_vRowOffset, rowInd);
+			compute_offsets(m_vColOffset, colInd);
+			m_numCols = m_vColOffset.back();
 
-			for(size_t fct1 = 0; fct1 < m_CplMat.num_rows(); ++fct1)
-				for(size_t fct2 = 0; fct2 < m_CplMat.num_cols(); ++fct2)
-				{
-					m_CplMat(fct1, fct2).resize(colInd.num_dof(fct1),
-												rowInd.num_dof(fct2));
-				}
+			const size_t numRows = m_vRowOffset.back();
+			ResizeLocalAlgebraStorage(m_vValue, numRows * m_numCols,
+			                          rowInd.num_reserved_dof() * colInd.num_reserved_dof());
 
+			ResizeLocalAlgebraStorage(m_vRowAcc, rowInd.num_fct());
+			ResizeLocalAlgebraStorage(m_vColAcc, colInd.num_fct());
 			access_all();
 		}
 
@@ -450,9 +532,8 @@ class LocalMatrix
 	/// set all entries
 		this_type& operator=(number val)
 		{
-			for(size_t fct1=0; fct1 < m_CplMat.num_rows(); ++fct1)
-				for(size_t fct2=0; fct2 < m_CplMat.num_cols(); ++fct2)
-					m_CplMat(fct1,fct2) = val;
+			for(size_t i = 0; i < m_vValue.size(); ++i)
+				m_vValue[i] = val;
 			return *this;
 		}
 
@@ -465,9 +546,8 @@ class LocalMatrix
 	/// multiply matrix
 		this_type& operator*=(number val)
 		{
-			for(size_t fct1=0; fct1 < m_CplMat.num_rows(); ++fct1)
-				for(size_t fct2=0; fct2 < m_CplMat.num_cols(); ++fct2)
-					m_CplMat(fct1,fct2) *= val;
+			for(size_t i = 0; i < m_vValue.size(); ++i)
+				m_vValue[i] *= val;
 			return *this;
 		}
 
@@ -476,9 +556,8 @@ class LocalMatrix
 		{
 			UG_LOCALALGEBRA_ASSERT(m_pRowIndex==rhs.m_pRowIndex &&
 			          m_pColIndex==rhs.m_pColIndex, "Not same indices.");
-			for(size_t fct1=0; fct1 < m_CplMat.num_rows(); ++fct1)
-				for(size_t fct2=0; fct2 < m_CplMat.num_cols(); ++fct2)
-					m_CplMat(fct1,fct2) += rhs.m_CplMat(fct1,fct2);
+			for(size_t i = 0; i < m_vValue.size(); ++i)
+				m_vValue[i] += rhs.m_vValue[i];
 			return *this;
 		}
 
@@ -487,9 +566,8 @@ class LocalMatrix
 		{
 			UG_LOCALALGEBRA_ASSERT(m_pRowIndex==rhs.m_pRowIndex &&
 			          m_pColIndex==rhs.m_pColIndex, "Not same indices.");
-			for(size_t fct1=0; fct1 < m_CplMat.num_rows(); ++fct1)
-				for(size_t fct2=0; fct2 < m_CplMat.num_cols(); ++fct2)
-					m_CplMat(fct1,fct2) -= rhs.m_CplMat(fct1,fct2);
+			for(size_t i = 0; i < m_vValue.size(); ++i)
+				m_vValue[i] -= rhs.m_vValue[i];
 			return *this;
 		}
 
@@ -498,9 +576,8 @@ class LocalMatrix
 		{
 			UG_LOCALALGEBRA_ASSERT(m_pRowIndex==rhs.m_pRowIndex &&
 					  m_pColIndex==rhs.m_pColIndex, "Not same indices.");
-			for(size_t fct1=0; fct1 < m_CplMat.num_rows(); ++fct1)
-				for(size_t fct2=0; fct2 < m_CplMat.num_cols(); ++fct2)
-					MatScaleAppend(m_CplMat(fct1,fct2), s, rhs.m_CplMat(fct1,fct2));
+			for(size_t i = 0; i < m_vValue.size(); ++i)
+				m_vValue[i] += s * rhs.m_vValue[i];
 			return *this;
 		}
 
@@ -521,14 +598,10 @@ class LocalMatrix
 			m_pRowFuncMap = &rowFuncMap;
 			m_pColFuncMap = &colFuncMap;
 
-			for(size_t i = 0; i < m_pRowFuncMap->num_fct(); ++i)
-				for(size_t j = 0; j < m_pColFuncMap->num_fct(); ++j)
-				{
-					const size_t rowMapFct = rowFuncMap[i];
-					const size_t colMapFct = colFuncMap[j];
-
-					m_CplMatAcc(i,j) = &(m_CplMat(rowMapFct, colMapFct));
-				}
+			for(size_t i = 0; i < rowFuncMap.num_fct(); ++i)
+				m_vRowAcc[i] = m_vRowOffset[rowFuncMap[i]];
+			for(size_t j = 0; j < colFuncMap.num_fct(); ++j)
+				m_vColAcc[j] = m_vColOffset[colFuncMap[j]];
 		}
 
 	///	access all functions
@@ -537,41 +610,40 @@ class LocalMatrix
 			m_pRowFuncMap = NULL;
 			m_pColFuncMap = NULL;
 
-			if(m_pRowIndex==NULL) {m_CplMatAcc.resize(0,0); return;}
+			if(m_pRowIndex==NULL) {m_vRowAcc.clear(); m_vColAcc.clear(); return;}
 
-			for(size_t i = 0; i < m_pRowIndex->num_fct(); ++i)
-				for(size_t j = 0; j < m_pColIndex->num_fct(); ++j)
-					m_CplMatAcc(i,j) = &(m_CplMat(i,j));
+			for(size_t i = 0; i < m_vRowAcc.size(); ++i)
+				m_vRowAcc[i] = m_vRowOffset[i];
+			for(size_t j = 0; j < m_vColAcc.size(); ++j)
+				m_vColAcc[j] = m_vColOffset[j];
 		}
 
 	///	returns the number of currently accessible (restricted) functions
 		size_t num_row_fct() const
 		{
 			if(m_pRowFuncMap != NULL) return m_pRowFuncMap->num_fct();
-			return m_CplMatAcc.num_rows();
+			return m_vRowAcc.size();
 		}
 
 	///	returns the number of currently accessible (restricted) functions
 		size_t num_col_fct() const
 		{
 			if(m_pColFuncMap != NULL) return m_pColFuncMap->num_fct();
-			return m_CplMatAcc.num_cols();
+			return m_vColAcc.size();
 		}
 
 	///	returns the number of dofs for the currently accessible (restricted) function
 		size_t num_row_dof(size_t fct) const
 		{
-			if(m_CplMat.num_rows()==0) return 0;
-			if(m_pRowFuncMap == NULL) return m_CplMat(fct, 0).num_rows();
-			else return m_CplMat( (*m_pRowFuncMap)[fct], 0).num_rows();
+			if(m_pRowFuncMap == NULL) return num_all_row_dof(fct);
+			else return num_all_row_dof((*m_pRowFuncMap)[fct]);
 		}
 
 	///	returns the number of dofs for the currently accessible (restricted) function
 		size_t num_col_dof(size_t fct) const
 		{
-			if(m_CplMat.num_cols()==0) return 0;
-			if(m_pRowFuncMap == NULL) return m_CplMat(0, fct).num_cols();
-			else return m_CplMat( 0, (*m_pColFuncMap)[fct]).num_cols();
+			if(m_pColFuncMap == NULL) return num_all_col_dof(fct);
+			else return num_all_col_dof((*m_pColFuncMap)[fct]);
 		}
 
 	/// access to (restricted) coupling (rowFct, rowDoF) x (colFct, colDoF)
@@ -579,7 +651,8 @@ class LocalMatrix
 		                   size_t colFct, size_t colDoF)
 		{
 			check_dof(rowFct, rowDoF, colFct, colDoF);
-			return (*m_CplMatAcc(rowFct,colFct))(rowDoF, colDoF);
+			return m_vValue[(m_vRowAcc[rowFct] + rowDoF) * m_numCols
+			                + m_vColAcc[colFct] + colDoF];
 		}
 
 	/// const access to (restricted) coupling (rowFct, rowDoF) x (colFct, colDoF)
@@ -587,7 +660,8 @@ class LocalMatrix
 		                        size_t colFct, size_t colDoF) const
 		{
 			check_dof(rowFct, rowDoF, colFct, colDoF);
-			return (*m_CplMatAcc(rowFct,colFct))(rowDoF, colDoF);
+			return m_vValue[(m_vRowAcc[rowFct] + rowDoF) * m_numCols
+			                + m_vColAcc[colFct] + colDoF];
 		}
 
 		///////////////////////////
@@ -595,23 +669,24 @@ class LocalMatrix
 		///////////////////////////
 
 	///	returns the number of all functions
-		size_t num_all_row_fct() const{	return m_CplMat.num_rows();}
+		size_t num_all_row_fct() const{return m_vRowAcc.size();}
 
 	///	returns the number of all functions
-		size_t num_all_col_fct() const{return m_CplMat.num_cols();}
+		size_t num_all_col_fct() const{return m_vColAcc.size();}
 
 	///	returns the number of dofs for a function
-		size_t num_all_row_dof(size_t fct) const {return m_CplMat(fct, 0).num_rows();}
+		size_t num_all_row_dof(size_t fct) const {return m_vRowOffset[fct+1] - m_vRowOffset[fct];}
 
 	///	returns the number of dofs for a function
-		size_t num_all_col_dof(size_t fct) const {return m_CplMat(0, fct).num_cols();}
+		size_t num_all_col_dof(size_t fct) const {return m_vColOffset[fct+1] - m_vColOffset[fct];}
 
 	/// access to coupling (rowFct, rowDoF) x (colFct, colDoF)
 		number& value(size_t rowFct, size_t rowDoF,
 		              size_t colFct, size_t colDoF)
 		{
 			check_all_dof(rowFct, rowDoF, colFct, colDoF);
-			return (m_CplMat(rowFct,colFct))(rowDoF, colDoF);
+			return m_vValue[(m_vRowOffset[rowFct] + rowDoF) * m_numCols
+			                + m_vColOffset[colFct] + colDoF];
 		}
 
 	/// const access to coupling (rowFct, rowDoF) x (colFct, colDoF)
@@ -619,10 +694,21 @@ class LocalMatrix
 		                   size_t colFct, size_t colDoF) const
 		{
 			check_all_dof(rowFct, rowDoF, colFct, colDoF);
-			return (m_CplMat(rowFct,colFct))(rowDoF, colDoF);
+			return m_vValue[(m_vRowOffset[rowFct] + rowDoF) * m_numCols
+			                + m_vColOffset[colFct] + colDoF];
 		}
 
 	protected:
+	///	computes the offsets of the first dof of each function
+		static void compute_offsets(std::vector<size_t>& vOffset,
+		                            const LocalIndices& ind)
+		{
+			ResizeLocalAlgebraStorage(vOffset, ind.num_fct()+1);
+			vOffset[0] = 0;
+			for(size_t fct = 0; fct < ind.num_fct(); ++fct)
+				vOffset[fct+1] = vOffset[fct] + ind.num_dof(fct);
+		}
+
 	///	checks correct (fct1,fct2) index in debug mode
 		inline void check_fct(size_t rowFct, size_t colFct) const
 		{
@@ -665,22 +751,19 @@ class LocalMatrix
 	/// Column Access Mapping
 		const FunctionIndexMapping* m_pColFuncMap;
 
-	//	\todo: Think of a better (faster) storage (one plain array?)
-
-	//	type of cpl matrices between two functions
-		typedef DenseMatrix<VariableArray2<value_type> > LocalCplMatrix;
+	//	Offset of the first row (column) of a function in the entry array
+		std::vector<size_t> m_vRowOffset;
+		std::vector<size_t> m_vColOffset;
 
-	//	type of Func-Coupling matrices
-		typedef DenseMatrix<VariableArray2<LocalCplMatrix> > FctCplMatrix;
+	//	Offset of the first row (column) of a currently accessible function
+		std::vector<size_t> m_vRowAcc;
+		std::vector<size_t> m_vColAcc;
 
-	//	type of Func-Coupling pointer matrices
-		typedef DenseMatrix<VariableArray2<LocalCplMatrix*> > FctCplAccMatrix;
+	//	number of columns (all functions) of the entry array
+		size_t m_numCols;
 
-	// 	Entries (fct1, fct2, dof1, dof2)
-		FctCplMatrix m_CplMat;
-
-	// 	Entries (fct1, fct2, dof1, dof2)
-		FctCplAccMatrix m_CplMatAcc;
+	// 	Entries (fct1, dof1) x (fct2, dof2), row-major in one contiguous array
+		std::vector<value_type> m_vValue;
 };
 
 inline
@@ -737,6 +820,21 @@ void AddLocalVector(TVector& vec, const LocalVector& lvec)
 		}
 }
 
+///	adds the product of a local matrix and a local vector, f += J*x (all functions)
+inline void AddLocalMatVec(LocalVector& f, const LocalMatrix& J, const LocalVector& x)
+{
+	for(size_t fct1=0; fct1 < J.num_all_row_fct(); ++fct1)
+		for(size_t dof1=0; dof1 < J.num_all_row_dof(fct1); ++dof1)
+		{
+			number sum = 0.0;
+			for(size_t fct2=0; fct2 < J.num_all_col_fct(); ++fct2)
+				for(size_t dof2=0; dof2 < J.num_all_col_dof(fct2); ++dof2)
+					sum += J.value(fct1,dof1,fct2,dof2) * x.value(fct2,dof2);
+
+			f.value(fct1,dof1) += sum;
+		}
+}
+
 template <typename TMatrix>
 void AddLocalMatrixToGlobal(TMatrix& mat, const LocalMatrix& lmat)
 {
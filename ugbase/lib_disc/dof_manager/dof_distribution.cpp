@@ -38,6 +38,7 @@
 #include "lib_disc/local_finite_element/local_dof_set.h"
 #include "lib_disc/reference_element/reference_element.h"
 #include "lib_disc/reference_element/reference_element_traits.h"
+#include "lib_disc/reference_element/reference_element_util.h"
 #include "lib_disc/reference_element/reference_mapping.h"
 #include "lib_disc/reference_element/reference_mapping_provider.h"
 #include "lib_disc/common/groups_util.h"
@@ -48,6 +49,10 @@
 #include "lib_grid/file_io/file_io.h"
 #include "lib_grid/algorithms/debug_util.h"
 
+#ifdef UG_OPENMP
+#include <omp.h>
+#endif
+
 using namespace std;
 
 namespace ug{
@@ -71,6 +76,8 @@ DoFDistribution(SmartPtr<MultiGrid> spMG,
 	  m_spSurfView(spSurfView),
 	  m_gridLevel(level),
 	  m_spDoFIndexStorage(spDoFIndexStorage),
+	  m_bIndexCache(false),
+	  m_RevCnt(this),
 	  m_numIndex(0)
 {
 	if(m_spDoFIndexStorage.invalid())
@@ -88,7 +95,10 @@ DoFDistribution(SmartPtr<MultiGrid> spMG,
 
 
 DoFDistribution::
-~DoFDistribution() {}
+~DoFDistribution()
+{
+	clear_index_cache();
+}
 
 
 void DoFDistribution::check_subsets()
@@ -1120,6 +1130,32 @@ constrained_face_indices(TBaseElem* elem,LocalIndices& ind,
 template<typename TBaseElem>
 void DoFDistribution::_indices(TBaseElem* elem, LocalIndices& ind, bool bHang) const
 {
+//	read indices from the cached table, if the element is contained
+	const IndexCache* pCache = m_bIndexCache ? index_cache<TBaseElem>(bHang) : NULL;
+	if(pCache)
+	{
+		const size_t row = m_aaCacheRow[elem];
+		if(row != (size_t)-1)
+		{
+			const IndexCache& cache = *pCache;
+			const size_t numFct = num_fct();
+			const size_t* vOffset = &cache.vOffset[row * numFct];
+			const DoFIndex* pDoF = cache.vDoFIndex.empty() ? NULL : &cache.vDoFIndex[0];
+
+			ind.resize_fct(numFct);
+			for(size_t fct = 0; fct < numFct; ++fct)
+				ind.assign_dof(fct, pDoF + vOffset[fct],
+				               vOffset[fct+1] - vOffset[fct]);
+			return;
+		}
+	}
+
+	extract_indices<TBaseElem>(elem, ind, bHang);
+}
+
+template<typename TBaseElem>
+void DoFDistribution::extract_indices(TBaseElem* elem, LocalIndices& ind, bool bHang) const
+{
 //	reference dimension
 	static const int dim = TBaseElem::dim;
 
@@ -1181,6 +1217,140 @@ void DoFDistribution::_indices(TBaseElem* elem, LocalIndices& ind, bool bHang) c
 }
 
 
+template <typename TBaseElem>
+const DoFDistribution::IndexCache*
+DoFDistribution::index_cache(bool bHang) const
+{
+	IndexCache& cache = m_vIndexCache[TBaseElem::BASE_OBJECT_ID][bHang];
+	if(cache.revision == m_RevCnt) return &cache;
+
+//	the table (and the row attachment) is only built outside of parallel
+//	regions, such that threads only read tables completed before the region
+//	started. Thread-parallel loops build it in advance (update_index_cache).
+#ifdef UG_OPENMP
+	if(omp_in_parallel()) return NULL;
+#endif
+
+	build_index_cache<TBaseElem>(cache, bHang);
+	return &cache;
+}
+
+void DoFDistribution::update_index_cache(ReferenceObjectID roid, bool bHang) const
+{
+	if(!m_bIndexCache) return;
+
+#ifdef UG_OPENMP
+	UG_COND_THROW(omp_in_parallel(), "DoFDistribution::update_index_cache: "
+	              "Must not be called in a parallel region.");
+#endif
+
+	switch(ReferenceElementDimension(roid))
+	{
+		case VERTEX: index_cache<Vertex>(bHang); break;
+		case EDGE: index_cache<Edge>(bHang); break;
+		case FACE: index_cache<Face>(bHang); break;
+		case VOLUME: index_cache<Volume>(bHang); break;
+		default: UG_THROW("DoFDistribution::update_index_cache: Dimension "
+		                  "of reference object "<<roid<<" not supported.");
+	}
+}
+
+template <typename TBaseElem>
+void DoFDistribution::build_index_cache(IndexCache& cache, bool bHang) const
+{
+	PROFILE_FUNC_GROUP("discretization");
+	typedef typename traits<TBaseElem>::const_iterator const_iterator;
+
+	MultiGrid& mg = *m_pMG;
+
+//	attach the row numbers to the elements of this base type
+	if(!mg.has_attachment<TBaseElem>(m_aCacheRow))
+	{
+		mg.attach_to_dv<TBaseElem>(m_aCacheRow, (size_t)-1);
+		m_aaCacheRow.access(mg, m_aCacheRow,
+		                    mg.has_attachment<Vertex>(m_aCacheRow),
+		                    mg.has_attachment<Edge>(m_aCacheRow),
+		                    mg.has_attachment<Face>(m_aCacheRow),
+		                    mg.has_attachment<Volume>(m_aCacheRow));
+	}
+
+//	reset rows assigned for a previous revision
+	for(typename geometry_traits<TBaseElem>::iterator iter = mg.begin<TBaseElem>();
+		iter != mg.end<TBaseElem>(); ++iter)
+		m_aaCacheRow[*iter] = (size_t)-1;
+
+	const size_t numFct = num_fct();
+	cache.vOffset.clear();
+	cache.vDoFIndex.clear();
+	cache.vOffset.push_back(0);
+
+//	the rows are numbered in the order of iteration, thus the tables for
+//	bHang = true and bHang = false use the same row of an element
+	LocalIndices ind;
+	size_t row = 0;
+	const_iterator iterEnd = end<TBaseElem>();
+	for(const_iterator iter = begin<TBaseElem>(); iter != iterEnd; ++iter, ++row)
+	{
+		TBaseElem* elem = *iter;
+		extract_indices<TBaseElem>(elem, ind, bHang);
+
+		for(size_t fct = 0; fct < numFct; ++fct)
+		{
+			for(size_t dof = 0; dof < ind.num_dof(fct); ++dof)
+				cache.vDoFIndex.push_back(ind.multi_index(fct, dof));
+			cache.vOffset.push_back(cache.vDoFIndex.size());
+		}
+
+		m_aaCacheRow[elem] = row;
+	}
+
+	cache.revision = m_RevCnt;
+}
+
+void DoFDistribution::enable_index_cache(bool bEnable)
+{
+	if(!bEnable) clear_index_cache();
+	m_bIndexCache = bEnable;
+}
+
+DoFDistribution::ElemColoring&
+DoFDistribution::elem_coloring(ReferenceObjectID roid, int si, bool bHang) const
+{
+	return m_vmElemColoring[roid][bHang ? 1 : 0][si];
+}
+
+void DoFDistribution::clear_index_cache()
+{
+	for(int i = 0; i < NUM_GEOMETRIC_BASE_OBJECTS; ++i)
+		for(int h = 0; h < 2; ++h)
+			m_vIndexCache[i][h] = IndexCache();
+
+	if(m_aaCacheRow.is_valid_vertex_accessor()) m_pMG->detach_from<Vertex>(m_aCacheRow);
+	if(m_aaCacheRow.is_valid_edge_accessor()) m_pMG->detach_from<Edge>(m_aCacheRow);
+	if(m_aaCacheRow.is_valid_face_accessor()) m_pMG->detach_from<Face>(m_aCacheRow);
+	if(m_aaCacheRow.is_valid_volume_accessor()) m_pMG->detach_from<Volume>(m_aCacheRow);
+	m_aaCacheRow.invalidate();
+}
+
+void DoFDistribution::reserve_indices(ReferenceObjectID roid, LocalIndices& ind) const
+{
+	const ReferenceElement& rRef = ReferenceElementProvider::get(roid);
+
+	ind.resize_fct(num_fct());
+	for(size_t fct = 0; fct < num_fct(); ++fct)
+	{
+	//	sum up the dofs on all subelements (including the element itself)
+		size_t numDoF = 0;
+		for(int r = ROID_VERTEX; r < NUM_REFERENCE_OBJECTS; ++r)
+		{
+			const ReferenceObjectID subRoid = (ReferenceObjectID)r;
+			numDoF += rRef.num(subRoid) * max_fct_dofs(fct, subRoid);
+		}
+
+		ind.reserve_dof(fct, numDoF);
+	}
+}
+
 template <typename TBaseElem>
 void DoFDistribution::
 changable_indices(std::vector<size_t>& vIndex,
@@ -1444,6 +1614,9 @@ void DoFDistribution::reinit()
 #ifdef UG_PARALLEL
 	reinit_layouts_and_communicator();
 #endif
+
+//	invalidates cached index tables
+	++m_RevCnt;
 }
 
 
@@ -1481,6 +1654,9 @@ void DoFDistribution::reinit_layouts_and_communicator()
 	}else{
 		layouts()->vertical_master().clear();
 	}
+
+//	invalidate data cached for the former layouts
+	layouts()->layouts_changed();
 }
 
 void DoFDistribution::reinit_index_layout(IndexLayout& layout, int keyType)
@@ -1765,6 +1941,9 @@ void DoFDistribution::permute_indices(const std::vector<size_t>& vNewInd)
 	reinit_layouts_and_communicator();
 #endif
 
+//	invalidates cached index tables
+	++m_RevCnt;
+
 //	permute indices in associated vectors
 	permute_values(vNewInd);
 }
@@ -33,9 +33,13 @@
 #ifndef __H__UG__LIB_DISC__DOF_MANAGER__DOF_DISTRIBUTION__
 #define __H__UG__LIB_DISC__DOF_MANAGER__DOF_DISTRIBUTION__
 
+#include <map>
+
 #include "lib_grid/tools/surface_view.h"
+#include "lib_grid/algorithms/attachment_util.h"
 #include "lib_disc/domain_traits.h"
 #include "lib_disc/common/local_algebra.h"
+#include "lib_disc/common/revision_counter.h"
 #include "dof_index_storage.h"
 #include "dof_count.h"
 
@@ -243,6 +247,74 @@ class DoFDistribution : public DoFDistributionInfoProvider
 		void indices(Volume* elem, LocalIndices& ind, bool bHang = false) const;
 		/// \}
 
+		/// enables a cached table of the element indices
+		/**
+		 * If enabled, the indices extracted by indices() are stored for all
+		 * elements of the dof distribution in a flattened (CSR) table per
+		 * element type. The table is built on the first request for an
+		 * element type and rebuilt after the revision of the dof
+		 * distribution has changed, i.e. after reinit() or permute_indices().
+		 * Afterwards the indices of an element are read by a single
+		 * contiguous access instead of collecting the subelements and their
+		 * attached indices again. Elements not contained in the table (e.g.
+		 * shadows) are extracted as usual.
+		 *
+		 * \param[in]		bEnable		flag if the cache is used
+		 */
+		void enable_index_cache(bool bEnable);
+
+		///	returns if the index cache is enabled
+		bool index_cache_enabled() const {return m_bIndexCache;}
+
+		///	builds the index table for elements of a reference type, if outdated
+		/**
+		 * The tables are not built inside of OpenMP parallel regions, there
+		 * indices() falls back to the extraction for outdated tables. Thus,
+		 * thread-parallel element loops call this function before the
+		 * parallel region (see ColorElementsByIndices), such that all
+		 * threads read the completed table without locking.
+		 *
+		 * \param[in]		roid		reference object id of the elements
+		 * \param[in]		bHang		flag if hanging dofs are used
+		 */
+		void update_index_cache(ReferenceObjectID roid, bool bHang) const;
+
+		///	returns the current revision
+		const RevisionCounter& revision() const {return m_RevCnt;}
+
+		///	elements of a subset sorted by colors
+		/**
+		 * The thread-parallel element loops color the elements of a subset
+		 * such that no two elements of a color share an algebra index (see
+		 * ColorElementsByIndices). The coloring only depends on the indices,
+		 * thus it is stored here and reused as long as the revision matches.
+		 */
+		struct ElemColoring
+		{
+			///	revision of the dof distribution the coloring is computed for
+			RevisionCounter revision;
+
+			///	elements sorted by color
+			std::vector<std::vector<GridObject*> > vvElem;
+		};
+
+		///	returns the stored coloring of the elements of a type in a subset
+		ElemColoring& elem_coloring(ReferenceObjectID roid, int si, bool bHang) const;
+
+		/// reserves memory in the local indices for the dofs of an element type
+		/**
+		 * For every function the maximal number of dofs located on an element
+		 * of the passed reference object type (including the subelements) is
+		 * reserved in the local indices. Local vectors and matrices resized for
+		 * these indices reuse their memory for all elements of that type, such
+		 * that an element loop runs without heap allocations (for regular
+		 * grids; constrained dofs may grow the storage once).
+		 *
+		 * \param[in]		roid		reference object id of the elements
+		 * \param[out]		ind			Local indices
+		 */
+		void reserve_indices(ReferenceObjectID roid, LocalIndices& ind) const;
+
 		/// extracts all multiindices for a function (sorted)
 		/**
 		 * All Multi-Indices of a function living on the element (including the
@@ -354,6 +426,10 @@ class DoFDistribution : public DoFDistributionInfoProvider
 		template <typename TBaseElem>
 		void _indices(TBaseElem* elem, LocalIndices& ind, bool bHang = false) const;
 
+		///	extracts the indices of an element from the subelements
+		template <typename TBaseElem>
+		void extract_indices(TBaseElem* elem, LocalIndices& ind, bool bHang) const;
+
 		template<typename TBaseElem>
 		size_t _dof_indices(TBaseElem* elem, size_t fct,
 		                     std::vector<DoFIndex>& ind,
@@ -478,6 +554,49 @@ class DoFDistribution : public DoFDistributionInfoProvider
 		/// DoF-Index Memory Storage
 		SmartPtr<DoFIndexStorage> m_spDoFIndexStorage;
 
+	protected:
+		///	flattened table of the indices of all elements of a base type
+		struct IndexCache
+		{
+			///	revision of the dof distribution the table is built for
+			RevisionCounter revision;
+
+			///	start of (row, fct) in vDoFIndex at row*num_fct()+fct, plus end entry
+			std::vector<size_t> vOffset;
+
+			///	indices of all rows
+			std::vector<DoFIndex> vDoFIndex;
+		};
+
+		///	returns the up to date index table for a base element type
+		///	(NULL if outdated inside of a parallel region)
+		template <typename TBaseElem>
+		const IndexCache* index_cache(bool bHang) const;
+
+		///	builds the index table for a base element type
+		template <typename TBaseElem>
+		void build_index_cache(IndexCache& cache, bool bHang) const;
+
+		///	removes all index tables
+		void clear_index_cache();
+
+		///	flag if the index cache is used
+		bool m_bIndexCache;
+
+		///	index tables [base object id][bHang]
+		mutable IndexCache m_vIndexCache[NUM_GEOMETRIC_BASE_OBJECTS][2];
+
+		///	attachment storing the row of an element in the index tables
+		typedef ug::Attachment<size_t> ACacheRow;
+		mutable ACacheRow m_aCacheRow;
+		mutable MultiElementAttachmentAccessor<ACacheRow> m_aaCacheRow;
+
+		///	element colorings [reference object id][bHang], per subset
+		mutable std::map<int, ElemColoring> m_vmElemColoring[NUM_REFERENCE_OBJECTS][2];
+
+		///	revision counter, increased whenever the indices change
+		RevisionCounter m_RevCnt;
+
 	protected:
 		/// number of distributed indices on whole domain
 		size_t m_numIndex;
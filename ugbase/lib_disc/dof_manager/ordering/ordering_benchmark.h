@@ -0,0 +1,204 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+
+#ifndef __H__UG__LIB_DISC__DOF_MANAGER__ORDERING_BENCHMARK__
+#define __H__UG__LIB_DISC__DOF_MANAGER__ORDERING_BENCHMARK__
+
+#include <string>
+#include <vector>
+
+#include "common/log.h"
+#include "common/error.h"
+#include "common/stopwatch.h"
+#include "common/util/string_util.h"
+#include "common/profiler/hardware_counter.h"
+#include "lib_disc/assemble_interface.h"
+#include "lib_disc/function_spaces/grid_function.h"
+#include "cuthill_mckee.h"
+#include "lexorder.h"
+#include "space_filling_curve_order.h"
+
+namespace ug{
+
+///	time and hardware events of a repeatedly measured section
+struct OrderingBenchmarkMeasurement
+{
+	OrderingBenchmarkMeasurement() : time(0.0)
+	{
+		for(int i = 0; i < HWC_NUM_COUNTERS; ++i) vEvents[i] = 0;
+	}
+
+	void start()
+	{
+		ReadHardwareCounters(vStart);
+		tStart = get_clock_s();
+	}
+
+	void stop(size_t numRuns)
+	{
+		time = (get_clock_s() - tStart) / numRuns;
+		uint64 vEnd[HWC_NUM_COUNTERS];
+		ReadHardwareCounters(vEnd);
+		for(int i = 0; i < HWC_NUM_COUNTERS; ++i)
+			vEvents[i] = (vEnd[i] - vStart[i]) / numRuns;
+	}
+
+	double time;
+	uint64 vEvents[HWC_NUM_COUNTERS];
+
+	private:
+		double tStart;
+		uint64 vStart[HWC_NUM_COUNTERS];
+};
+
+///	writes time and (if counted) hardware events per run to the log
+inline void LogOrderingBenchmarkMeasurement(const char* name,
+                                            const OrderingBenchmarkMeasurement& m)
+{
+	UG_LOG("    " << name << ": " << m.time*1e3 << " ms");
+	if(IsHardwareCounterEnabled())
+	{
+		const uint64* e = m.vEvents;
+		UG_LOG(", " << e[HWC_CYCLES] << " cycles, IPC "
+				<< (e[HWC_CYCLES] > 0 ? (double)e[HWC_INSTRUCTIONS] / e[HWC_CYCLES] : 0.0)
+				<< ", " << e[HWC_LLC_MISSES] << " LLC misses ("
+				<< e[HWC_LLC_MISSES] * HardwareCounterCacheLineSize() * 1e-6 << " MB)");
+	}
+	UG_LOG("\n");
+}
+
+/**
+ * Measures the assembling of the jacobian and the matrix-vector product for
+ * several orderings of the DoFs. For every entry of the comma-separated list
+ * of orderings, the approximation space of u is reordered, the jacobian at u
+ * is assembled once to set up the matrix pattern and then numRuns times
+ * measured, followed by numRuns measured products J*u. Supported orderings:
+ *
+ * - "none": keeps the current ordering
+ * - "lex": lexicographic in x direction (OrderLex)
+ * - "cuthill-mckee", "reverse-cuthill-mckee" (OrderCuthillMcKee)
+ * - "hilbert", "morton": DoFs along a space filling curve (OrderSpaceFillingCurve)
+ * - "grid-hilbert", "grid-morton": grid elements and DoFs along the curve
+ *   (OrderGridSpaceFillingCurve and OrderSpaceFillingCurve)
+ *
+ * The time per run is written to the log. If the hardware counters are
+ * enabled (EnableHardwareCounters(true)), also cycles, instructions per cycle
+ * and last level cache misses per run are printed. Note that the counters only
+ * count the calling thread.
+ *
+ * \note The orderings are not undone, i.e. the approximation space and all
+ * its grid functions keep the last ordering of the list. Reorderings of the
+ * grid are kept as well.
+ *
+ * \param[in]		spAss		assembling (e.g. a DomainDiscretization)
+ * \param[in,out]	spU			grid function the jacobian is assembled at
+ * \param[in]		orderings	comma-separated list of orderings
+ * \param[in]		numRuns		number of runs per measurement
+ */
+template <typename TDomain, typename TAlgebra>
+void OrderingBenchmark(SmartPtr<IAssemble<TAlgebra> > spAss,
+                       SmartPtr<GridFunction<TDomain, TAlgebra> > spU,
+                       const char* orderings, size_t numRuns)
+{
+	typedef typename TAlgebra::matrix_type matrix_type;
+	typedef typename TAlgebra::vector_type vector_type;
+
+	if(spAss.invalid() || spU.invalid())
+		UG_THROW("OrderingBenchmark: Assembling and grid function required.");
+	if(numRuns == 0) numRuns = 1;
+
+	ApproximationSpace<TDomain>& approxSpace = *spU->approx_space();
+	TDomain& domain = *approxSpace.domain();
+	const GridLevel gl = spU->grid_level();
+	vector_type& u = *spU;
+
+	const std::vector<std::string> vOrdering = TokenizeTrimString(orderings);
+
+	UG_LOG("OrderingBenchmark: " << spU->num_indices() << " indices, "
+			<< numRuns << " runs");
+	if(!IsHardwareCounterEnabled())
+		UG_LOG(" (call EnableHardwareCounters(true) for hardware events)");
+	UG_LOG("\n");
+
+	for(size_t o = 0; o < vOrdering.size(); ++o)
+	{
+		const std::string& name = vOrdering[o];
+
+	//	reorder
+		if(name == "none") {}
+		else if(name == "lex") OrderLex(approxSpace, "x");
+		else if(name == "cuthill-mckee") OrderCuthillMcKee(approxSpace, false);
+		else if(name == "reverse-cuthill-mckee") OrderCuthillMcKee(approxSpace, true);
+		else if(name == "hilbert" || name == "morton")
+			OrderSpaceFillingCurve(approxSpace, name.c_str());
+		else if(name == "grid-hilbert" || name == "grid-morton")
+		{
+			OrderGridSpaceFillingCurve(domain, name.c_str() + 5);
+			OrderSpaceFillingCurve(approxSpace, name.c_str() + 5);
+		}
+		else
+			UG_THROW("OrderingBenchmark: Unknown ordering '" << name << "'. Use"
+					" none, lex, cuthill-mckee, reverse-cuthill-mckee, hilbert,"
+					" morton, grid-hilbert or grid-morton.");
+
+	//	assembling, the first one sets up the pattern
+		matrix_type J;
+		spAss->assemble_jacobian(J, u, gl);
+
+		OrderingBenchmarkMeasurement mAss;
+		mAss.start();
+		for(size_t i = 0; i < numRuns; ++i)
+			spAss->assemble_jacobian(J, u, gl);
+		mAss.stop(numRuns);
+
+	//	matrix-vector product
+	#ifdef UG_PARALLEL
+		u.change_storage_type(PST_CONSISTENT);
+	#endif
+		SmartPtr<vector_type> spD = u.clone_without_values();
+		J.apply(*spD, u);
+
+		OrderingBenchmarkMeasurement mSpMV;
+		mSpMV.start();
+		for(size_t i = 0; i < numRuns; ++i)
+			J.apply(*spD, u);
+		mSpMV.stop(numRuns);
+
+		UG_LOG("  " << name << ":\n");
+		LogOrderingBenchmarkMeasurement("assemble", mAss);
+		LogOrderingBenchmarkMeasurement("SpMV    ", mSpMV);
+	}
+}
+
+} // end namespace ug
+
+#endif /* __H__UG__LIB_DISC__DOF_MANAGER__ORDERING_BENCHMARK__ */
@@ -0,0 +1,198 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+
+#include "space_filling_curve_order.h"
+#include "common/common.h"
+#include "lib_disc/function_spaces/dof_position_util.h"
+#include "lib_disc/local_finite_element/local_finite_element_provider.h"
+#include "lib_disc/domain.h"
+#include <vector>
+#include <utility>
+
+namespace ug{
+
+template<int dim>
+void ComputeSpaceFillingCurveOrder(std::vector<size_t>& vNewIndex,
+                                   std::vector<std::pair<MathVector<dim>, size_t> >& vPos,
+                                   SpaceFillingCurve sfc)
+{
+//	order the positions along the curve
+	std::vector<MathVector<dim> > vCoord(vPos.size());
+	for(size_t i = 0; i < vPos.size(); ++i)
+		vCoord[i] = vPos[i].first;
+
+	std::vector<size_t> vOrder;
+	ComputeSpaceFillingCurveOrder<dim>(vOrder, vCoord, sfc);
+
+//	a) order all indices
+	if(vNewIndex.size() == vPos.size()){
+		for(size_t i = 0; i < vOrder.size(); ++i)
+			vNewIndex[vPos[vOrder[i]].second] = i;
+	}
+//	b) only some indices to order: permute the indices among each other
+	else{
+		for(size_t i = 0; i < vNewIndex.size(); ++i)
+			vNewIndex[i] = i;
+		for(size_t i = 0; i < vOrder.size(); ++i)
+			vNewIndex[vPos[vOrder[i]].second] = vPos[i].second;
+	}
+}
+
+template <typename TDomain>
+void OrderSpaceFillingCurveForDofDist(SmartPtr<DoFDistribution> dd,
+                                      ConstSmartPtr<TDomain> domain,
+                                      SpaceFillingCurve sfc)
+{
+
+//	as for the lexicographic order, all dofs can only be ordered together
+//	if there is the same number of dofs on each geometric object. Else, the
+//	components are ordered separately if they do not share geometric objects.
+
+//	a) check for same number of DoFs on every geometric object
+	bool bEqualNumDoFOnEachGeomObj = true;
+	int numDoFOnGeomObj = -1;
+	for(int si = 0; si < dd->num_subsets(); ++si){
+		for(int roid = 0; roid < NUM_REFERENCE_OBJECTS; ++roid){
+			const int numDoF = dd->num_dofs((ReferenceObjectID)roid, si);
+
+			if(numDoF == 0) continue;
+
+			if(numDoFOnGeomObj == -1)
+				numDoFOnGeomObj = numDoF;
+			else if(numDoFOnGeomObj != numDoF)
+				bEqualNumDoFOnEachGeomObj = false;
+		}
+	}
+
+	typedef typename std::pair<MathVector<TDomain::dim>, size_t> pos_type;
+	std::vector<pos_type> vPositions;
+
+//	a) we can order globally
+	if(bEqualNumDoFOnEachGeomObj)
+	{
+		ExtractPositions(domain, dd, vPositions);
+
+	//	get mapping: old -> new index
+		std::vector<size_t> vNewIndex(dd->num_indices());
+		ComputeSpaceFillingCurveOrder<TDomain::dim>(vNewIndex, vPositions, sfc);
+
+	//	reorder indices
+		dd->permute_indices(vNewIndex);
+		return;
+	}
+
+//	b) check for non-mixed spaces
+	std::vector<int> vNumFctOnRoid(NUM_REFERENCE_OBJECTS, 0);
+	for(size_t fct = 0; fct < dd->num_fct(); ++fct){
+		const CommonLocalDoFSet& locDoF =
+			LocalFiniteElementProvider::get_dofs(dd->local_finite_element_id(fct));
+
+		for(int roid = 0; roid < NUM_REFERENCE_OBJECTS; ++roid)
+			if(locDoF.num_dof((ReferenceObjectID)roid) > 0)
+				++vNumFctOnRoid[roid];
+	}
+
+	UG_LOG("OrderSpaceFillingCurve: Cannot order globally, trying to order some components:\n");
+	for(size_t fct = 0; fct < dd->num_fct(); ++fct){
+		const CommonLocalDoFSet& locDoF =
+			LocalFiniteElementProvider::get_dofs(dd->local_finite_element_id(fct));
+
+		bool bSortable = true;
+		for(int roid = 0; roid < NUM_REFERENCE_OBJECTS; ++roid)
+			if(locDoF.num_dof((ReferenceObjectID)roid) != 0 && vNumFctOnRoid[roid] > 1)
+				bSortable = false;
+
+		if(!bSortable){
+			UG_LOG("OrderSpaceFillingCurve: '"<<dd->name(fct)<<" NOT SORTED.\n");
+			continue;
+		}
+
+		ExtractPositions(domain, dd, fct, vPositions);
+
+	//	get mapping: old -> new index
+		std::vector<size_t> vNewIndex(dd->num_indices());
+		ComputeSpaceFillingCurveOrder<TDomain::dim>(vNewIndex, vPositions, sfc);
+
+	//	reorder indices
+		dd->permute_indices(vNewIndex);
+
+		UG_LOG("OrderSpaceFillingCurve: '"<<dd->name(fct)<<" SORTED.\n");
+	}
+}
+
+template <typename TDomain>
+void OrderSpaceFillingCurve(ApproximationSpace<TDomain>& approxSpace, const char* curve)
+{
+	const SpaceFillingCurve sfc = SpaceFillingCurveByName(curve);
+
+	std::vector<SmartPtr<DoFDistribution> > vDD = approxSpace.dof_distributions();
+	for(size_t i = 0; i < vDD.size(); ++i)
+		OrderSpaceFillingCurveForDofDist<TDomain>(vDD[i], approxSpace.domain(), sfc);
+}
+
+template <typename TDomain>
+void OrderSpaceFillingCurve(ApproximationSpace<TDomain>& approxSpace)
+{
+	OrderSpaceFillingCurve<TDomain>(approxSpace, "hilbert");
+}
+
+template <typename TDomain>
+void OrderGridSpaceFillingCurve(TDomain& domain, const char* curve)
+{
+	OrderGridBySpaceFillingCurve(*domain.grid(), domain.position_accessor(),
+								 SpaceFillingCurveByName(curve),
+								 domain.subset_handler().get());
+}
+
+#ifdef UG_DIM_1
+template void ComputeSpaceFillingCurveOrder<1>(std::vector<size_t>&, std::vector<std::pair<MathVector<1>, size_t> >&, SpaceFillingCurve);
+template void OrderSpaceFillingCurveForDofDist<Domain1d>(SmartPtr<DoFDistribution>, ConstSmartPtr<Domain1d>, SpaceFillingCurve);
+template void OrderSpaceFillingCurve<Domain1d>(ApproximationSpace<Domain1d>&, const char*);
+template void OrderSpaceFillingCurve<Domain1d>(ApproximationSpace<Domain1d>&);
+template void OrderGridSpaceFillingCurve<Domain1d>(Domain1d&, const char*);
+#endif
+#ifdef UG_DIM_2
+template void ComputeSpaceFillingCurveOrder<2>(std::vector<size_t>&, std::vector<std::pair<MathVector<2>, size_t> >&, SpaceFillingCurve);
+template void OrderSpaceFillingCurveForDofDist<Domain2d>(SmartPtr<DoFDistribution>, ConstSmartPtr<Domain2d>, SpaceFillingCurve);
+template void OrderSpaceFillingCurve<Domain2d>(ApproximationSpace<Domain2d>&, const char*);
+template void OrderSpaceFillingCurve<Domain2d>(ApproximationSpace<Domain2d>&);
+template void OrderGridSpaceFillingCurve<Domain2d>(Domain2d&, const char*);
+#endif
+#ifdef UG_DIM_3
+template void ComputeSpaceFillingCurveOrder<3>(std::vector<size_t>&, std::vector<std::pair<MathVector<3>, size_t> >&, SpaceFillingCurve);
+template void OrderSpaceFillingCurveForDofDist<Domain3d>(SmartPtr<DoFDistribution>, ConstSmartPtr<Domain3d>, SpaceFillingCurve);
+template void OrderSpaceFillingCurve<Domain3d>(ApproximationSpace<Domain3d>&, const char*);
+template void OrderSpaceFillingCurve<Domain3d>(ApproximationSpace<Domain3d>&);
+template void OrderGridSpaceFillingCurve<Domain3d>(Domain3d&, const char*);
+#endif
+
+}
@@ -124,10 +124,17 @@ void LoadDomain(TDomain& domain, const char* filename, int procId)
 
 template <typename TDomain>
 void SaveDomain(TDomain& domain, const char* filename)
+{
+	SaveDomain(domain, filename, "ascii");
+}
+
+template <typename TDomain>
+void SaveDomain(TDomain& domain, const char* filename, const char* dataMode)
 {
 	PROFILE_FUNC_GROUP("grid");
 	if(GetFilenameExtension(string(filename)) == string("ugx")){
 		GridWriterUGX ugxWriter;
+		ugxWriter.set_data_mode(GridWriterUGX::data_mode_by_name(dataMode));
 		ugxWriter.add_grid(*domain.grid(), "defGrid", domain.position_attachment());
 		ugxWriter.add_subset_handler(*domain.subset_handler(), "defSH", 0);
 
@@ -168,6 +175,10 @@ template void SaveDomain<Domain1d>(Domain1d& domain, const char* filename);
 template void SaveDomain<Domain2d>(Domain2d& domain, const char* filename);
 template void SaveDomain<Domain3d>(Domain3d& domain, const char* filename);
 
+template void SaveDomain<Domain1d>(Domain1d& domain, const char* filename, const char* dataMode);
+template void SaveDomain<Domain2d>(Domain2d& domain, const char* filename, const char* dataMode);
+template void SaveDomain<Domain3d>(Domain3d& domain, const char* filename, const char* dataMode);
+
 template number MaxElementDiameter<Domain1d>(Domain1d& domain, int level);
 template number MaxElementDiameter<Domain2d>(Domain2d& domain, int level);
 template number MaxElementDiameter<Domain3d>(Domain3d& domain, int level);
@@ -58,6 +58,12 @@ void LoadDomain(TDomain& domain, const char* filename, int procId);
 template <typename TDomain>
 void SaveDomain(TDomain& domain, const char* filename);
 
+///	Saves the domain to a grid-file.
+/**	For ugx files, the vertices, elements and subsets are written in the
+ * given data mode ("ascii", "base64" or "raw", cf. GridWriterUGX::DataMode).*/
+template <typename TDomain>
+void SaveDomain(TDomain& domain, const char* filename, const char* dataMode);
+
 
 ////////////////////////////////////////////////////////////////////////
 ///	returns the corner coordinates of a geometric object
@@ -83,6 +83,7 @@ init(SmartPtr<subset_handler_type> spMGSH,
 	m_spDoFDistributionInfo = SmartPtr<DoFDistributionInfo>(new DoFDistributionInfo(spMGSH));
 	m_algebraType = algebraType;
 	m_bAdaptionIsActive = false;
+	m_bIndexCache = false;
 	m_RevCnt = RevisionCounter(this);
 
 	this->set_dof_distribution_info(m_spDoFDistributionInfo);
@@ -315,6 +316,13 @@ bool SortDD(SmartPtr<DoFDistribution> spDD1, SmartPtr<DoFDistribution> spDD2){
 	return spDD1->grid_level() < spDD2->grid_level();
 }
 
+void IApproximationSpace::set_index_cache(bool bEnable)
+{
+	m_bIndexCache = bEnable;
+	for(size_t i = 0; i < m_vDD.size(); ++i)
+		m_vDD[i]->enable_index_cache(bEnable);
+}
+
 void IApproximationSpace::create_dof_distribution(const GridLevel& gl)
 {
 
@@ -342,6 +350,7 @@ void IApproximationSpace::create_dof_distribution(const GridLevel& gl)
 	SmartPtr<DoFDistribution> spDD = SmartPtr<DoFDistribution>(new
 		DoFDistribution(m_spMG, m_spMGSH, m_spDoFDistributionInfo,
 						m_spSurfaceView, gl, m_bGrouped, spIndexStrg));
+	spDD->enable_index_cache(m_bIndexCache);
 
 //	add to list and sort
 	m_vDD.push_back(spDD);
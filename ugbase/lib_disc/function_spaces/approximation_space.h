@@ -210,6 +210,9 @@ class IApproximationSpace : public DoFDistributionInfoProvider
 	///	returns the current revision
 		const RevisionCounter& revision() const {return m_RevCnt;}
 
+	///	enables cached element index tables in all dof distributions
+		void set_index_cache(bool bEnable);
+
 	protected:
 	///	creates a dof distribution
 		void create_dof_distribution(const GridLevel& gl);
@@ -256,6 +259,9 @@ class IApproximationSpace : public DoFDistributionInfoProvider
 	///	flag if DoFs should be grouped
 		bool m_bGrouped;
 
+	///	flag if dof distributions cache element indices
+		bool m_bIndexCache;
+
 	///	DofDistributionInfo
 		SmartPtr<DoFDistributionInfo> m_spDoFDistributionInfo;
 
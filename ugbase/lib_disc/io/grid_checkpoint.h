@@ -0,0 +1,152 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+
+#ifndef __H__UG__LIB_DISC__IO__GRID_CHECKPOINT__
+#define __H__UG__LIB_DISC__IO__GRID_CHECKPOINT__
+
+// extern libraries
+#include <string>
+#include <vector>
+
+// other ug modules
+#include "common/util/binary_buffer.h"
+#include "lib_grid/algorithms/serialization.h"
+#include "lib_disc/domain.h"
+#include "lib_disc/function_spaces/grid_function.h"
+#include "lib_disc/function_spaces/adaption_surface_grid_function.h"
+
+#ifdef UG_PARALLEL
+	#include "lib_grid/parallelization/load_balancer.h"
+#endif
+
+namespace ug{
+
+///	Saves and restores a (distributed) domain together with grid functions
+/**
+ * A checkpoint contains the multigrid hierarchy of the domain, its vertex
+ * positions and subset handlers, the global ids and parallel layouts of all
+ * grid elements and the values of all added grid functions. The values are
+ * stored per grid element, so that they do not depend on the DoF ordering.
+ *
+ * Each process serializes its part of the grid into a buffer and all buffers
+ * are written collectively into one file (see pcl::WriteCombinedParallelFile),
+ * i.e. no data is gathered on a single process.
+ *
+ * A checkpoint written on N processes can be loaded on any number M of
+ * processes. The parts are read round-robin, i.e. process p restores the parts
+ * written by the processes p, p + M, p + 2M, ... . Elements contained in
+ * several of these parts are merged based on their global ids and interfaces
+ * between them are dropped. If M > N, the processes p >= N start with an empty
+ * grid. The DoF layouts are rebuilt by the approximation space from the
+ * restored grid layouts. If M != N and a load balancer was set, the domain and
+ * the grid functions are redistributed onto all processes afterwards.
+ *
+ * To restart, create the domain (without loading a grid), the approximation
+ * space and the grid functions as usual, add the grid functions in the order
+ * used when the checkpoint was written and call load. Grid functions which
+ * are not part of the checkpoint should be created after loading, since their
+ * values can not be restored.
+ */
+template <typename TDomain, typename TAlgebra>
+class GridCheckpoint
+{
+	public:
+	///	type of grid function
+		typedef GridFunction<TDomain, TAlgebra> function_type;
+
+	///	type of the element-wise storage of grid function values
+		typedef AdaptionSurfaceGridFunction<TDomain> element_values_type;
+
+	public:
+	///	constructor
+		GridCheckpoint(SmartPtr<TDomain> spDomain) : m_spDomain(spDomain) {}
+
+	///	adds a grid function, that is saved and loaded with the domain
+		void add(SmartPtr<function_type> spGridFct, const char* name);
+
+	#ifdef UG_PARALLEL
+	///	sets a load balancer, used to redistribute after a restart on a different number of processes
+		void set_load_balancer(SmartPtr<LoadBalancer> spBalancer)	{m_spBalancer = spBalancer;}
+	#endif
+
+	///	writes the domain and all grid functions to a checkpoint file
+		void save(const char* filename);
+
+	///	restores the domain and all grid functions from a checkpoint file
+		void load(const char* filename);
+
+	protected:
+	///	adds serializers for the positions and the subset handlers of the domain
+		void add_domain_serializers(GridDataSerializationHandler& serializer);
+
+	///	attaches the element values of a grid function and adds their serializers
+		void add_value_serializers(GridDataSerializationHandler& serializer,
+		                           element_values_type& values,
+		                           const function_type& gridFct);
+
+	///	writes the parallel layouts of the given element type using local element indices
+		template <typename TElem>
+		void write_layouts(BinaryBuffer& out, MultiElementAttachmentAccessor<AInt>& aaIndex);
+
+	///	reads the parallel layouts of the given element type
+		template <typename TElem>
+		void read_layouts(BinaryBuffer& in, const std::vector<TElem*>& vElem);
+
+	///	orders the interfaces of the given element type by global ids and removes duplicates
+		template <typename TElem>
+		void sort_layouts(MultiElementAttachmentAccessor<AGeomObjID>& aaID);
+
+	///	writes the buffer to a file (collectively in parallel)
+		void write_file(BinaryBuffer& out, const char* filename);
+
+	///	reads the local parts of a file and returns the number of parts in the file
+		int read_file(std::vector<BinaryBuffer>& vIn, const char* filename);
+
+	protected:
+	///	the domain
+		SmartPtr<TDomain> m_spDomain;
+
+	///	added grid functions and their names
+		std::vector<SmartPtr<function_type> > m_vGridFct;
+		std::vector<std::string> m_vName;
+
+	#ifdef UG_PARALLEL
+	///	load balancer used after a restart on a different number of processes
+		SmartPtr<LoadBalancer> m_spBalancer;
+	#endif
+};
+
+} // end namespace ug
+
+#include "grid_checkpoint_impl.h"
+
+#endif /* __H__UG__LIB_DISC__IO__GRID_CHECKPOINT__ */
@@ -0,0 +1,545 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+
+#ifndef __H__UG__LIB_DISC__IO__GRID_CHECKPOINT_IMPL__
+#define __H__UG__LIB_DISC__IO__GRID_CHECKPOINT_IMPL__
+
+#include <cstdio>
+#include <algorithm>
+#include "grid_checkpoint.h"
+#include "common/serialization.h"
+#include "common/profiler/profiler.h"
+#include "lib_grid/lib_grid_messages.h"
+
+#ifdef UG_PARALLEL
+	#include "pcl/parallel_file.h"
+	#include "lib_grid/parallelization/distributed_grid.h"
+	#include "lib_grid/parallelization/parallelization_util.h"
+#endif
+
+namespace ug{
+
+///	magic number identifying checkpoint files
+static const int CHECKPOINT_MAGIC = 0x55474350;
+
+///	version of the checkpoint format
+static const int CHECKPOINT_VERSION = 1;
+
+template <typename TDomain, typename TAlgebra>
+void GridCheckpoint<TDomain, TAlgebra>::
+add(SmartPtr<function_type> spGridFct, const char* name)
+{
+	if(spGridFct->domain() != m_spDomain)
+		UG_THROW("GridCheckpoint::add: Grid function '" << name
+				 << "' is not defined on the domain of the checkpoint.");
+	for(size_t i = 0; i < m_vName.size(); ++i)
+		if(m_vName[i] == name)
+			UG_THROW("GridCheckpoint::add: Name '" << name << "' used twice.");
+
+	m_vGridFct.push_back(spGridFct);
+	m_vName.push_back(name);
+}
+
+template <typename TDomain, typename TAlgebra>
+void GridCheckpoint<TDomain, TAlgebra>::
+add_domain_serializers(GridDataSerializationHandler& serializer)
+{
+	TDomain& dom = *m_spDomain;
+	serializer.add(GeomObjAttachmentSerializer<Vertex, typename TDomain::position_attachment_type>::
+						create(*dom.grid(), dom.position_attachment()));
+	serializer.add(SubsetHandlerSerializer::create(*dom.subset_handler()));
+
+	std::vector<std::string> vName = dom.additional_subset_handler_names();
+	for(size_t i = 0; i < vName.size(); ++i)
+		serializer.add(SubsetHandlerSerializer::create(*dom.additional_subset_handler(vName[i])));
+}
+
+template <typename TDomain, typename TAlgebra>
+void GridCheckpoint<TDomain, TAlgebra>::
+add_value_serializers(GridDataSerializationHandler& serializer,
+                      element_values_type& values, const function_type& gridFct)
+{
+	typedef typename element_values_type::AValues AValues;
+	MultiGrid& mg = *m_spDomain->grid();
+
+//	copying the surface values attaches the element-wise storage
+	values.copy_from_surface(gridFct);
+
+	if(gridFct.max_dofs(VERTEX))
+		serializer.add(GeomObjAttachmentSerializer<Vertex, AValues>::create(mg, values.value_attachment()));
+	if(gridFct.max_dofs(EDGE))
+		serializer.add(GeomObjAttachmentSerializer<Edge, AValues>::create(mg, values.value_attachment()));
+	if(gridFct.max_dofs(FACE))
+		serializer.add(GeomObjAttachmentSerializer<Face, AValues>::create(mg, values.value_attachment()));
+	if(gridFct.max_dofs(VOLUME))
+		serializer.add(GeomObjAttachmentSerializer<Volume, AValues>::create(mg, values.value_attachment()));
+}
+
+template <typename TDomain, typename TAlgebra>
+template <typename TElem>
+void GridCheckpoint<TDomain, TAlgebra>::
+write_layouts(BinaryBuffer& out, MultiElementAttachmentAccessor<AInt>& aaIndex)
+{
+//	each interface is stored as (type, proc, level, size, element indices)
+	std::vector<int> vData;
+
+#ifdef UG_PARALLEL
+	typedef typename GridLayoutMap::Types<TElem>::Layout Layout;
+	typedef typename GridLayoutMap::Types<TElem>::Interface Interface;
+	const int vType[] = {INT_H_MASTER, INT_H_SLAVE, INT_V_MASTER, INT_V_SLAVE};
+
+	GridLayoutMap& glm = m_spDomain->grid()->distributed_grid_manager()->grid_layout_map();
+	for(size_t t = 0; t < 4; ++t){
+		if(!glm.has_layout<TElem>(vType[t])) continue;
+
+		Layout& layout = glm.get_layout<TElem>(vType[t]);
+		for(size_t lvl = 0; lvl < layout.num_levels(); ++lvl){
+			for(typename Layout::iterator iter = layout.begin(lvl);
+				iter != layout.end(lvl); ++iter)
+			{
+				Interface& intfc = layout.interface(iter);
+				vData.push_back(vType[t]);
+				vData.push_back(layout.proc_id(iter));
+				vData.push_back((int)lvl);
+				vData.push_back((int)intfc.size());
+				for(typename Interface::iterator eiter = intfc.begin();
+					eiter != intfc.end(); ++eiter)
+					vData.push_back(aaIndex[intfc.get_element(eiter)]);
+			}
+		}
+	}
+#endif
+
+	Serialize(out, vData);
+}
+
+template <typename TDomain, typename TAlgebra>
+template <typename TElem>
+void GridCheckpoint<TDomain, TAlgebra>::
+read_layouts(BinaryBuffer& in, const std::vector<TElem*>& vElem)
+{
+	std::vector<int> vData;
+	Deserialize(in, vData);
+
+#ifdef UG_PARALLEL
+//	the parts of the file are read round-robin, i.e. the part written by
+//	process p is restored on process p % NumProcs. Interfaces between parts,
+//	which are restored on the same process, are dropped, since their elements
+//	are merged.
+	const int numProcs = pcl::NumProcs(), rank = pcl::ProcRank();
+	GridLayoutMap& glm = m_spDomain->grid()->distributed_grid_manager()->grid_layout_map();
+	for(size_t i = 0; i < vData.size();){
+		const int type = vData[i], proc = vData[i+1] % numProcs;
+		const size_t lvl = vData[i+2], size = vData[i+3];
+		i += 4;
+		UG_COND_THROW(i + size > vData.size(), "GridCheckpoint: Corrupt layout data.");
+
+		if(proc == rank){
+			i += size;
+			continue;
+		}
+
+		typename GridLayoutMap::Types<TElem>::Interface& intfc
+			= glm.get_layout<TElem>(type).interface(proc, lvl);
+		for(size_t j = 0; j < size; ++j, ++i){
+			UG_COND_THROW((size_t)vData[i] >= vElem.size(),
+						  "GridCheckpoint: Corrupt layout data.");
+			intfc.push_back(vElem[vData[i]]);
+		}
+	}
+#endif
+//	without parallel support all parts are merged on the single process, so
+//	that no interfaces remain
+}
+
+///	compares grid elements by their global ids
+template <typename TElem>
+struct CompareCheckpointIDs
+{
+	CompareCheckpointIDs(MultiElementAttachmentAccessor<AGeomObjID>& aaID) : m_aaID(aaID) {}
+	bool operator()(TElem* e1, TElem* e2) const	{return m_aaID[e1] < m_aaID[e2];}
+	MultiElementAttachmentAccessor<AGeomObjID>& m_aaID;
+};
+
+template <typename TDomain, typename TAlgebra>
+template <typename TElem>
+void GridCheckpoint<TDomain, TAlgebra>::
+sort_layouts(MultiElementAttachmentAccessor<AGeomObjID>& aaID)
+{
+#ifdef UG_PARALLEL
+	typedef typename GridLayoutMap::Types<TElem>::Layout Layout;
+	typedef typename GridLayoutMap::Types<TElem>::Interface Interface;
+	const int vType[] = {INT_H_MASTER, INT_H_SLAVE, INT_V_MASTER, INT_V_SLAVE};
+
+	GridLayoutMap& glm = m_spDomain->grid()->distributed_grid_manager()->grid_layout_map();
+	std::vector<TElem*> vElem;
+	for(size_t t = 0; t < 4; ++t){
+		if(!glm.has_layout<TElem>(vType[t])) continue;
+
+		Layout& layout = glm.get_layout<TElem>(vType[t]);
+		for(size_t lvl = 0; lvl < layout.num_levels(); ++lvl){
+			for(typename Layout::iterator iter = layout.begin(lvl);
+				iter != layout.end(lvl); ++iter)
+			{
+				Interface& intfc = layout.interface(iter);
+				vElem.clear();
+				for(typename Interface::iterator eiter = intfc.begin();
+					eiter != intfc.end();)
+				{
+					vElem.push_back(intfc.get_element(eiter));
+					eiter = intfc.erase(eiter);
+				}
+
+				std::sort(vElem.begin(), vElem.end(), CompareCheckpointIDs<TElem>(aaID));
+				vElem.erase(std::unique(vElem.begin(), vElem.end()), vElem.end());
+				for(size_t i = 0; i < vElem.size(); ++i)
+					intfc.push_back(vElem[i]);
+			}
+		}
+	}
+#endif
+}
+
+template <typename TDomain, typename TAlgebra>
+void GridCheckpoint<TDomain, TAlgebra>::
+write_file(BinaryBuffer& out, const char* filename)
+{
+#ifdef UG_PARALLEL
+	pcl::WriteCombinedParallelFile(out, filename);
+#else
+//	same format as a combined parallel file written by one process
+	FILE* f = fopen(filename, "wb");
+	UG_COND_THROW(!f, "GridCheckpoint: Could not open " << filename);
+
+	int numParts = 1;
+	long long size = out.write_pos();
+	long long nextOffset = sizeof(int) + sizeof(long long) + size;
+	bool ok = (fwrite(&numParts, sizeof(numParts), 1, f) == 1)
+			&& (fwrite(&nextOffset, sizeof(nextOffset), 1, f) == 1)
+			&& (fwrite(out.buffer(), 1, size, f) == (size_t)size);
+	fclose(f);
+	UG_COND_THROW(!ok, "GridCheckpoint: Could not write " << filename);
+#endif
+}
+
+template <typename TDomain, typename TAlgebra>
+int GridCheckpoint<TDomain, TAlgebra>::
+read_file(std::vector<BinaryBuffer>& vIn, const char* filename)
+{
+#ifdef UG_PARALLEL
+	return pcl::ReadCombinedParallelFileParts(vIn, filename);
+#else
+	FILE* f = fopen(filename, "rb");
+	UG_COND_THROW(!f, "GridCheckpoint: Could not open " << filename);
+
+	int numParts = 0;
+	bool ok = (fread(&numParts, sizeof(numParts), 1, f) == 1) && (numParts > 0);
+	std::vector<long long> vNextOffset(std::max(numParts, 1));
+	ok = ok && (fread(&vNextOffset[0], sizeof(long long), numParts, f) == (size_t)numParts);
+	if(!ok){
+		fclose(f);
+		UG_THROW("GridCheckpoint: Could not read " << filename);
+	}
+
+//	all parts are restored on the single process
+	vIn.clear();
+	vIn.resize(numParts);
+	long long offset = sizeof(int) + numParts * sizeof(long long);
+	for(int i = 0; i < numParts && ok; ++i){
+		long long size = vNextOffset[i] - offset;
+		std::vector<char> data(size + 1);
+		ok = (size >= 0) && (fread(&data[0], 1, size, f) == (size_t)size);
+		vIn[i].write(&data[0], size);
+		offset = vNextOffset[i];
+	}
+	fclose(f);
+	UG_COND_THROW(!ok, "GridCheckpoint: Could not read " << filename);
+
+	return numParts;
+#endif
+}
+
+template <typename TDomain, typename TAlgebra>
+void GridCheckpoint<TDomain, TAlgebra>::
+save(const char* filename)
+{
+	PROFILE_FUNC();
+	MultiGrid& mg = *m_spDomain->grid();
+	BinaryBuffer out;
+
+//	write header
+	Serialize(out, CHECKPOINT_MAGIC);
+	Serialize(out, CHECKPOINT_VERSION);
+	Serialize(out, (int)TDomain::dim);
+	Serialize(out, m_vName);
+	for(size_t i = 0; i < m_vGridFct.size(); ++i)
+		Serialize(out, m_vGridFct[i]->num_fct());
+
+//	the values of the grid functions are copied to the grid elements. In order
+//	to store valid values on all copies of an element, they are made consistent.
+	std::vector<SmartPtr<element_values_type> > vValues;
+	GridDataSerializationHandler valueSerializer;
+#ifdef UG_PARALLEL
+	std::vector<uint> vStorageMask;
+#endif
+	for(size_t i = 0; i < m_vGridFct.size(); ++i){
+		function_type& u = *m_vGridFct[i];
+	#ifdef UG_PARALLEL
+		vStorageMask.push_back(u.get_storage_mask());
+		if(!(u.has_storage_type(PST_CONSISTENT) || u.has_storage_type(PST_UNDEFINED)))
+			u.change_storage_type(PST_CONSISTENT);
+	#endif
+		vValues.push_back(make_sp(new element_values_type(m_spDomain, false)));
+		add_value_serializers(valueSerializer, *vValues.back(), u);
+	}
+
+//	global ids are used to identify copies of elements on different processes
+#ifdef UG_PARALLEL
+	GridLayoutMap& glm = mg.distributed_grid_manager()->grid_layout_map();
+	AGeomObjID& aID = aGeomObjID;
+	CreateAndDistributeGlobalIDs<Vertex>(mg, glm, aID);
+	CreateAndDistributeGlobalIDs<Edge>(mg, glm, aID);
+	CreateAndDistributeGlobalIDs<Face>(mg, glm, aID);
+	CreateAndDistributeGlobalIDs<Volume>(mg, glm, aID);
+#else
+	AGeomObjID aID("checkpoint-id");
+	mg.attach_to_all(aID);
+	{
+		MultiElementAttachmentAccessor<AGeomObjID> aaID(mg, aID);
+		size_t count = 0;
+		for(VertexIterator iter = mg.begin<Vertex>(); iter != mg.end<Vertex>(); ++iter)
+			aaID[*iter] = MakeGeomObjID(0, count++);
+		for(EdgeIterator iter = mg.begin<Edge>(); iter != mg.end<Edge>(); ++iter)
+			aaID[*iter] = MakeGeomObjID(0, count++);
+		for(FaceIterator iter = mg.begin<Face>(); iter != mg.end<Face>(); ++iter)
+			aaID[*iter] = MakeGeomObjID(0, count++);
+		for(VolumeIterator iter = mg.begin<Volume>(); iter != mg.end<Volume>(); ++iter)
+			aaID[*iter] = MakeGeomObjID(0, count++);
+	}
+#endif
+	MultiElementAttachmentAccessor<AGeomObjID> aaID(mg, aID);
+
+//	write grid, domain data, grid function values and layouts
+	AInt aIndex;
+	mg.attach_to_all(aIndex);
+	MultiElementAttachmentAccessor<AInt> aaIndex(mg, aIndex);
+
+	GridObjectCollection goc = mg.get_grid_objects();
+	SerializeMultiGridElements(mg, goc, aaIndex, out, &aaID);
+
+	GridDataSerializationHandler domainSerializer;
+	add_domain_serializers(domainSerializer);
+	domainSerializer.write_infos(out);
+	domainSerializer.serialize(out, goc);
+
+	valueSerializer.write_infos(out);
+	valueSerializer.serialize(out, goc);
+
+	write_layouts<Vertex>(out, aaIndex);
+	write_layouts<Edge>(out, aaIndex);
+	write_layouts<Face>(out, aaIndex);
+	write_layouts<Volume>(out, aaIndex);
+	Serialize(out, CHECKPOINT_MAGIC);
+
+	mg.detach_from_all(aIndex);
+#ifndef UG_PARALLEL
+	mg.detach_from_all(aID);
+#endif
+
+//	copying the values back releases the element-wise storage
+	for(size_t i = 0; i < m_vGridFct.size(); ++i){
+		function_type& u = *m_vGridFct[i];
+		vValues[i]->copy_to_surface(u);
+	#ifdef UG_PARALLEL
+		if(vStorageMask[i] != u.get_storage_mask()){
+			if((vStorageMask[i] & PST_ADDITIVE) == PST_ADDITIVE)
+				u.change_storage_type(PST_ADDITIVE);
+			else if((vStorageMask[i] & PST_UNIQUE) == PST_UNIQUE)
+				u.change_storage_type(PST_UNIQUE);
+		}
+	#endif
+	}
+
+	write_file(out, filename);
+}
+
+template <typename TDomain, typename TAlgebra>
+void GridCheckpoint<TDomain, TAlgebra>::
+load(const char* filename)
+{
+	PROFILE_FUNC();
+	MultiGrid& mg = *m_spDomain->grid();
+
+//	the parts are distributed round-robin, processes for which no part exists
+//	in the file receive none
+	std::vector<BinaryBuffer> vIn;
+#ifdef UG_PARALLEL
+	const int numParts = read_file(vIn, filename);
+#else
+	read_file(vIn, filename);
+#endif
+
+	for(size_t p = 0; p < vIn.size(); ++p){
+		BinaryBuffer& in = vIn[p];
+		int magic = 0, version = 0, dim = 0;
+		Deserialize(in, magic);
+		Deserialize(in, version);
+		Deserialize(in, dim);
+		UG_COND_THROW(magic != CHECKPOINT_MAGIC || version != CHECKPOINT_VERSION,
+					  "GridCheckpoint: " << filename << " is not a valid checkpoint.");
+		UG_COND_THROW(dim != TDomain::dim, "GridCheckpoint: " << filename
+					  << " contains a domain of dimension " << dim << ".");
+
+		std::vector<std::string> vName;
+		Deserialize(in, vName);
+		UG_COND_THROW(vName != m_vName, "GridCheckpoint: The grid functions "
+					  "stored in " << filename << " do not match the added ones.");
+		for(size_t i = 0; i < m_vGridFct.size(); ++i){
+			size_t numFct = 0;
+			Deserialize(in, numFct);
+			UG_COND_THROW(numFct != m_vGridFct[i]->num_fct(), "GridCheckpoint: "
+						  "Grid function '" << m_vName[i] << "' has " << numFct
+						  << " functions in " << filename << ".");
+		}
+	}
+
+//	the values are restored explicitly and must not be redistributed
+	std::vector<SmartPtr<element_values_type> > vValues;
+	std::vector<bool> vRedistribute;
+	GridDataSerializationHandler valueSerializer;
+	for(size_t i = 0; i < m_vGridFct.size(); ++i){
+		vRedistribute.push_back(m_vGridFct[i]->redistribution_enabled());
+		m_vGridFct[i]->enable_redistribution(false);
+		vValues.push_back(make_sp(new element_values_type(m_spDomain, false)));
+		add_value_serializers(valueSerializer, *vValues.back(), *m_vGridFct[i]);
+	}
+
+//	the grid is replaced as during a redistribution, so that the approximation
+//	space and the grid functions are updated
+	SPMessageHub msgHub = mg.message_hub();
+	GridDataSerializationHandler userDataSerializer;
+	msgHub->post_message(GridMessage_Creation(GMCT_CREATION_STARTS, 0));
+	msgHub->post_message(GridMessage_Distribution(GMDT_DISTRIBUTION_STARTS, userDataSerializer));
+
+#ifdef UG_PARALLEL
+	DistributedGridManager& distGridMgr = *mg.distributed_grid_manager();
+	GridLayoutMap& glm = distGridMgr.grid_layout_map();
+	distGridMgr.enable_interface_management(false);
+	mg.clear_geometry();
+	glm.clear();
+	AGeomObjID& aID = aGeomObjID;
+#else
+	mg.clear_geometry();
+	AGeomObjID aID("checkpoint-id");
+#endif
+	if(!mg.has_vertex_attachment(aID)) mg.attach_to_vertices(aID);
+	if(!mg.has_edge_attachment(aID)) mg.attach_to_edges(aID);
+	if(!mg.has_face_attachment(aID)) mg.attach_to_faces(aID);
+	if(!mg.has_volume_attachment(aID)) mg.attach_to_volumes(aID);
+	MultiElementAttachmentAccessor<AGeomObjID> aaID(mg, aID);
+
+//	elements contained in several parts are merged based on their global ids
+	for(size_t p = 0; p < vIn.size(); ++p){
+		BinaryBuffer& in = vIn[p];
+		std::vector<Vertex*> vrts;
+		std::vector<Edge*> edges;
+		std::vector<Face*> faces;
+		std::vector<Volume*> vols;
+
+		if(!DeserializeMultiGridElements(mg, in, &vrts, &edges, &faces, &vols, &aaID))
+			UG_THROW("GridCheckpoint: Could not read the grid from " << filename);
+
+		GridDataSerializationHandler domainSerializer;
+		add_domain_serializers(domainSerializer);
+
+		GridDataSerializationHandler* vSerializer[] = {&domainSerializer, &valueSerializer};
+		for(size_t i = 0; i < 2; ++i){
+			GridDataSerializationHandler& serializer = *vSerializer[i];
+			serializer.deserialization_starts();
+			serializer.read_infos(in);
+			serializer.deserialize(in, vrts.begin(), vrts.end());
+			serializer.deserialize(in, edges.begin(), edges.end());
+			serializer.deserialize(in, faces.begin(), faces.end());
+			serializer.deserialize(in, vols.begin(), vols.end());
+			serializer.deserialization_done();
+		}
+
+		read_layouts<Vertex>(in, vrts);
+		read_layouts<Edge>(in, edges);
+		read_layouts<Face>(in, faces);
+		read_layouts<Volume>(in, vols);
+
+		int magic = 0;
+		Deserialize(in, magic);
+		UG_COND_THROW(magic != CHECKPOINT_MAGIC,
+					  "GridCheckpoint: Magic number mismatch in " << filename);
+	}
+
+#ifdef UG_PARALLEL
+//	merged parts may contribute the same element to an interface and in a
+//	different order. Ordering by global ids restores matching interfaces.
+	if(numParts > pcl::NumProcs()){
+		sort_layouts<Vertex>(aaID);
+		sort_layouts<Edge>(aaID);
+		sort_layouts<Face>(aaID);
+		sort_layouts<Volume>(aaID);
+	}
+	glm.remove_empty_interfaces();
+	distGridMgr.enable_interface_management(true);
+	distGridMgr.grid_layouts_changed(false);
+#else
+	mg.detach_from_all(aID);
+#endif
+
+	msgHub->post_message(GridMessage_Distribution(GMDT_DISTRIBUTION_STOPS, userDataSerializer));
+	msgHub->post_message(GridMessage_Creation(GMCT_CREATION_STOPS, 0));
+
+//	copy the restored values to the grid functions, which are consistent
+	for(size_t i = 0; i < m_vGridFct.size(); ++i){
+		function_type& u = *m_vGridFct[i];
+		u.resize_values(u.num_indices());
+		vValues[i]->copy_to_surface(u);
+	#ifdef UG_PARALLEL
+		u.set_storage_type(PST_CONSISTENT);
+	#endif
+		u.enable_redistribution(vRedistribute[i]);
+	}
+
+#ifdef UG_PARALLEL
+	if((numParts != pcl::NumProcs()) && m_spBalancer.valid())
+		m_spBalancer->rebalance();
+#endif
+}
+
+} // end namespace ug
+
+#endif /* __H__UG__LIB_DISC__IO__GRID_CHECKPOINT_IMPL__ */
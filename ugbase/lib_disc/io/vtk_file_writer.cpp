@@ -0,0 +1,477 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+
+#include "vtk_file_writer.h"
+
+#include <cstdio>
+#include <algorithm>
+#include <iterator>
+
+#ifdef UG_ZLIB
+#include <zlib.h>
+#endif
+
+#ifdef UG_LZ4
+#include <lz4.h>
+#endif
+
+#include "common/error.h"
+#include "common/profiler/profiler.h"
+#include "common/util/base64_file_writer.h"
+#include "common/util/endian_detection.h"
+#include "common/util/vector_util.h"
+#include "common/util/async_output_queue.h"
+
+#ifdef UG_PARALLEL
+#include "pcl/pcl_base.h"
+#include "pcl/pcl_process_communicator.h"
+#endif
+
+namespace ug{
+
+///	uncompressed size of the compressed blocks (the default of vtk)
+static const size_t VTK_COMPRESSION_BLOCK_SIZE = 32768;
+
+///	tag used to send the pieces to the writing process of an aggregation group
+static const int VTK_AGGREGATION_TAG = 7349;
+
+///	replaces the offset attributes in the passed xml
+/**	The value v of each offset attribute is replaced by (*pvOffset)[v], if
+ * pvOffset is passed, and by v + shift otherwise.*/
+static void ReplaceAppendedOffsets(std::string& xml, size_t shift,
+                                   const std::vector<size_t>* pvOffset = NULL)
+{
+	if(shift == 0 && pvOffset == NULL) return;
+
+	static const std::string key = " offset=\"";
+	std::string res;
+	res.reserve(xml.size() + 64);
+
+	size_t pos = 0, found;
+	while((found = xml.find(key, pos)) != std::string::npos)
+	{
+		const size_t valBegin = found + key.size();
+		const size_t valEnd = xml.find('"', valBegin);
+		UG_COND_THROW(valEnd == std::string::npos,
+		              "VTKFileWriter: Invalid offset attribute.");
+
+		std::stringstream ss;
+		ss << xml.substr(valBegin, valEnd - valBegin);
+		size_t val = 0;
+		ss >> val;
+
+		std::stringstream newVal;
+		if(pvOffset) newVal << pvOffset->at(val);
+		else newVal << val + shift;
+
+		res.append(xml, pos, valBegin - pos);
+		res.append(newVal.str());
+		pos = valEnd;
+	}
+	res.append(xml, pos, std::string::npos);
+	xml.swap(res);
+}
+
+///	appends the compressed data including the header of vtk to out
+/**	The data of a block starts with its Int32 byte count, which is replaced
+ * by the header of the compressed data.*/
+static void CompressBlock(std::vector<char>& out, VTKFileWriter::DataMode mode,
+                          const char* data, size_t size)
+{
+	const size_t skip = std::min(size, sizeof(int));
+	data += skip; size -= skip;
+
+	const size_t blockSize = VTK_COMPRESSION_BLOCK_SIZE;
+	const size_t numBlocks = (size + blockSize - 1) / blockSize;
+
+//	header: number of blocks, block size, size of last partial block (0 if
+//	the last block is full) and the compressed size of each block
+	std::vector<unsigned int> vHeader(3 + numBlocks);
+	vHeader[0] = (unsigned int) numBlocks;
+	vHeader[1] = (unsigned int) blockSize;
+	vHeader[2] = (unsigned int) (size % blockSize);
+
+	const size_t headerPos = out.size();
+	out.resize(headerPos + vHeader.size() * sizeof(unsigned int));
+
+	std::vector<char> vComp;
+	for(size_t b = 0; b < numBlocks; ++b)
+	{
+		size_t compSize = 0;
+
+		switch(mode)
+		{
+#ifdef UG_ZLIB
+			case VTKFileWriter::ZLIB:
+			{
+				const char* src = data + b * blockSize;
+				const size_t srcSize = std::min(blockSize, size - b * blockSize);
+				uLongf destLen = compressBound((uLong) srcSize);
+				vComp.resize(destLen);
+			//	output speed is more important than the last percent of size
+				if(compress2((Bytef*) GetDataPtr(vComp), &destLen,
+				             (const Bytef*) src, (uLong) srcSize, Z_BEST_SPEED) != Z_OK)
+					UG_THROW("VTKFileWriter: zlib compression failed.");
+				compSize = destLen;
+				break;
+			}
+#endif
+#ifdef UG_LZ4
+			case VTKFileWriter::LZ4:
+			{
+				const char* src = data + b * blockSize;
+				const size_t srcSize = std::min(blockSize, size - b * blockSize);
+				const int bound = LZ4_compressBound((int) srcSize);
+				vComp.resize(bound);
+				const int res = LZ4_compress_default(src, GetDataPtr(vComp),
+				                                     (int) srcSize, bound);
+				if(res <= 0)
+					UG_THROW("VTKFileWriter: lz4 compression failed.");
+				compSize = res;
+				break;
+			}
+#endif
+			default: UG_THROW("VTKFileWriter: Compression not supported.");
+		}
+
+		vHeader[3 + b] = (unsigned int) compSize;
+		out.insert(out.end(), vComp.begin(), vComp.begin() + compSize);
+	}
+
+	std::copy(reinterpret_cast<const char*>(GetDataPtr(vHeader)),
+	          reinterpret_cast<const char*>(GetDataPtr(vHeader) + vHeader.size()),
+	          out.begin() + headerPos);
+}
+
+///	encodes the buffered content of a vtk file and writes it
+/**	Note: This job may be executed on the writer thread of the AsyncOutputQueue.
+ * Thus, it must neither communicate nor use the (not thread-safe) profiler.*/
+class VTKFileJob : public AsyncOutputJob
+{
+	public:
+		VTKFileJob(const std::string& filename, VTKFileWriter::DataMode mode,
+		           std::string& header, std::string& xml,
+		           std::vector<size_t>& vBlockPos, std::vector<size_t>& vBlockEnd,
+		           std::vector<char>& data)
+			: m_filename(filename), m_mode(mode)
+		{
+			m_header.swap(header);
+			m_xml.swap(xml);
+			m_vBlockPos.swap(vBlockPos);
+			m_vBlockEnd.swap(vBlockEnd);
+			m_data.swap(data);
+		}
+
+		virtual size_t memory() const
+		{
+			return m_header.size() + m_xml.size() + m_data.size()
+					+ (m_vBlockPos.size() + m_vBlockEnd.size()) * sizeof(size_t);
+		}
+
+		virtual void run()
+		{
+			FILE* file = fopen(m_filename.c_str(), "wb");
+			if(file == NULL)
+				UG_THROW("VTKFileWriter: Could not open output file: " << m_filename);
+
+			try{
+				write(file);
+			}
+			catch(...){
+				fclose(file);
+				throw;
+			}
+
+			const bool bFailed = ferror(file) != 0;
+			fclose(file);
+			if(bFailed)
+				UG_THROW("VTKFileWriter: Can not write to output file: " << m_filename);
+		}
+
+	protected:
+		void write(FILE* file)
+		{
+			const size_t numBlocks = m_vBlockEnd.size();
+			fwrite(m_header.c_str(), 1, m_header.size(), file);
+
+		//	inline data: the encoded blocks are inserted into the xml
+			if(m_mode == VTKFileWriter::BASE64)
+			{
+				std::string enc;
+				size_t xmlPos = 0, dataPos = 0;
+				for(size_t b = 0; b < numBlocks; ++b)
+				{
+					fwrite(m_xml.c_str() + xmlPos, 1, m_vBlockPos[b] - xmlPos, file);
+					enc.clear();
+					EncodeBase64(enc, GetDataPtr(m_data) + dataPos, m_vBlockEnd[b] - dataPos);
+					fwrite(enc.c_str(), 1, enc.size(), file);
+					xmlPos = m_vBlockPos[b];
+					dataPos = m_vBlockEnd[b];
+				}
+				fwrite(m_xml.c_str() + xmlPos, 1, m_xml.size() - xmlPos, file);
+				fputs("  </UnstructuredGrid>\n", file);
+				fputs("</VTKFile>\n", file);
+				return;
+			}
+
+		//	appended data: replace the block indices by the offsets of the blocks
+			std::vector<size_t> vOffset(numBlocks);
+			std::vector<char> vComp;
+			const std::vector<char>* pAppended = &m_data;
+			if(m_mode == VTKFileWriter::RAW)
+			{
+				for(size_t b = 0; b < numBlocks; ++b)
+					vOffset[b] = (b > 0) ? m_vBlockEnd[b-1] : 0;
+			}
+			else
+			{
+				size_t dataPos = 0;
+				for(size_t b = 0; b < numBlocks; ++b)
+				{
+					vOffset[b] = vComp.size();
+					CompressBlock(vComp, m_mode, GetDataPtr(m_data) + dataPos,
+					              m_vBlockEnd[b] - dataPos);
+					dataPos = m_vBlockEnd[b];
+				}
+				pAppended = &vComp;
+			}
+			ReplaceAppendedOffsets(m_xml, 0, &vOffset);
+
+			fwrite(m_xml.c_str(), 1, m_xml.size(), file);
+			fputs("  </UnstructuredGrid>\n", file);
+			if(numBlocks > 0)
+			{
+				fputs("  <AppendedData encoding=\"raw\">\n   _", file);
+				fwrite(GetDataPtr(*pAppended), 1, pAppended->size(), file);
+				fputs("\n  </AppendedData>\n", file);
+			}
+			fputs("</VTKFile>\n", file);
+		}
+
+	protected:
+		std::string m_filename;
+		VTKFileWriter::DataMode m_mode;
+		std::string m_header;
+		std::string m_xml;
+		std::vector<size_t> m_vBlockPos;
+		std::vector<size_t> m_vBlockEnd;
+		std::vector<char> m_data;
+};
+
+VTKFileWriter::
+VTKFileWriter(const std::string& filename, DataMode mode, int groupSize,
+              bool bAsync)
+	: m_filename(filename), m_mode(mode), m_groupSize(std::max(groupSize, 1)),
+	  m_bAsync(bAsync), m_currFormat(normal), m_bClosed(false)
+{
+	if(!data_mode_supported(mode))
+		UG_THROW("VTKFileWriter: Compression of binary data not supported "
+				"by this build. Enable the cmake option ZLIB or LZ4.");
+}
+
+bool VTKFileWriter::
+data_mode_supported(DataMode mode)
+{
+	switch(mode)
+	{
+		case BASE64:
+		case RAW: return true;
+#ifdef UG_ZLIB
+		case ZLIB: return true;
+#endif
+#ifdef UG_LZ4
+		case LZ4: return true;
+#endif
+		default: return false;
+	}
+}
+
+VTKFileWriter::DataMode VTKFileWriter::
+data_mode_by_name(const std::string& name)
+{
+	if(name == "base64") return BASE64;
+	if(name == "raw") return RAW;
+	if(name == "zlib") return ZLIB;
+	if(name == "lz4") return LZ4;
+	UG_THROW("VTKFileWriter: Unknown binary format '"<<name<<"'. Valid "
+			"formats are 'base64', 'raw', 'zlib' and 'lz4'.");
+}
+
+void VTKFileWriter::
+begin_grid(bool bTimeDep, number time)
+{
+	std::ostringstream ss;
+	ss << "<?xml version=\"1.0\"?>\n";
+	ss << "<VTKFile type=\"UnstructuredGrid\" version=\"0.1\" byte_order=\"";
+	if(IsLittleEndian()) ss << "LittleEndian";
+	else ss << "BigEndian";
+	ss << "\"";
+	if(m_mode == ZLIB) ss << " compressor=\"vtkZLibDataCompressor\"";
+	if(m_mode == LZ4) ss << " compressor=\"vtkLZ4DataCompressor\"";
+	ss << ">\n";
+
+//	writing time point
+	if(bTimeDep)
+		ss << "  <Time timestep=\""<<time<<"\"/>\n";
+
+//	opening the grid
+	ss << "  <UnstructuredGrid>\n";
+	m_header = ss.str();
+}
+
+std::string VTKFileWriter::
+binary_format() const
+{
+	UG_COND_THROW(m_currFormat != normal,
+	              "VTKFileWriter: Format requested inside of a binary block.");
+
+	if(m_mode == BASE64) return "\"binary\"";
+
+	std::ostringstream ss;
+	ss << "\"appended\" offset=\"" << m_vBlockEnd.size() << "\"";
+	return ss.str();
+}
+
+VTKFileWriter& VTKFileWriter::
+operator<<(const fmtflag format)
+{
+//	complete the current block
+	if(m_currFormat == binary && format == normal)
+	{
+		m_vBlockPos.push_back((size_t) m_xml.tellp());
+		m_vBlockEnd.push_back(m_data.size());
+	}
+	m_currFormat = format;
+	return *this;
+}
+
+VTKFileWriter& VTKFileWriter::
+operator<<(const char* cstr)
+{
+	UG_COND_THROW(m_currFormat != normal,
+	              "VTKFileWriter: Strings can only be written as text.");
+	m_xml << cstr;
+	return *this;
+}
+
+VTKFileWriter& VTKFileWriter::
+operator<<(const std::string& str)
+{
+	UG_COND_THROW(m_currFormat != normal,
+	              "VTKFileWriter: Strings can only be written as text.");
+	m_xml << str;
+	return *this;
+}
+
+void VTKFileWriter::
+close()
+{
+	PROFILE_FUNC();
+
+	if(m_bClosed) return;
+	*this << normal;
+	m_bClosed = true;
+
+	std::string xml = m_xml.str();
+	m_xml.str("");
+
+#ifdef UG_PARALLEL
+//	aggregate the pieces of the group on its first process
+	if(m_groupSize > 1 && pcl::NumProcs() > 1)
+	{
+		pcl::ProcessCommunicator procComm;
+		const int rank = pcl::ProcRank();
+		const int root = rank - rank % m_groupSize;
+
+		if(rank != root)
+		{
+			int sizes[3] = {(int) xml.size(), (int) m_vBlockEnd.size(),
+							(int) m_data.size()};
+			procComm.send_data(sizes, sizeof(sizes), root, VTK_AGGREGATION_TAG);
+			procComm.send_data(&xml[0], sizes[0], root, VTK_AGGREGATION_TAG);
+			procComm.send_data(GetDataPtr(m_vBlockPos), sizes[1] * sizeof(size_t),
+			                   root, VTK_AGGREGATION_TAG);
+			procComm.send_data(GetDataPtr(m_vBlockEnd), sizes[1] * sizeof(size_t),
+			                   root, VTK_AGGREGATION_TAG);
+			procComm.send_data(GetDataPtr(m_data), sizes[2], root, VTK_AGGREGATION_TAG);
+			return;
+		}
+
+		const int end = std::min(root + m_groupSize, pcl::NumProcs());
+		std::string recXml;
+		std::vector<size_t> vPos, vEnd;
+		std::vector<char> vData;
+		for(int src = root + 1; src < end; ++src)
+		{
+			int sizes[3];
+			procComm.receive_data(sizes, sizeof(sizes), src, VTK_AGGREGATION_TAG);
+			recXml.resize(sizes[0]);
+			vPos.resize(sizes[1]);
+			vEnd.resize(sizes[1]);
+			vData.resize(sizes[2]);
+			procComm.receive_data(&recXml[0], sizes[0], src, VTK_AGGREGATION_TAG);
+			procComm.receive_data(GetDataPtr(vPos), sizes[1] * sizeof(size_t),
+			                      src, VTK_AGGREGATION_TAG);
+			procComm.receive_data(GetDataPtr(vEnd), sizes[1] * sizeof(size_t),
+			                      src, VTK_AGGREGATION_TAG);
+			procComm.receive_data(GetDataPtr(vData), sizes[2], src, VTK_AGGREGATION_TAG);
+
+		//	the positions and block indices of the received pieces are
+		//	relative to their own data
+			for(size_t b = 0; b < vPos.size(); ++b)
+			{
+				m_vBlockPos.push_back(vPos[b] + xml.size());
+				m_vBlockEnd.push_back(vEnd[b] + m_data.size());
+			}
+			if(m_mode != BASE64)
+				ReplaceAppendedOffsets(recXml, m_vBlockEnd.size() - vEnd.size());
+			xml.append(recXml);
+			m_data.insert(m_data.end(), vData.begin(), vData.end());
+		}
+	}
+#endif
+
+//	encode and write the file
+	if(m_bAsync)
+	{
+		AsyncOutputQueue::inst().push(new VTKFileJob(m_filename, m_mode, m_header,
+		                              xml, m_vBlockPos, m_vBlockEnd, m_data));
+	}
+	else
+	{
+		VTKFileJob job(m_filename, m_mode, m_header, xml, m_vBlockPos,
+		               m_vBlockEnd, m_data);
+		job.run();
+	}
+}
+
+} // end namespace ug
@@ -0,0 +1,175 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+
+#ifndef __H__UG__LIB_DISC__IO__VTK_FILE_WRITER__
+#define __H__UG__LIB_DISC__IO__VTK_FILE_WRITER__
+
+#include <string>
+#include <sstream>
+#include <vector>
+
+#include "common/types.h"
+
+namespace ug{
+
+///	writer for *.vtu files with inline or appended binary data
+/**
+ * The writer buffers the xml structure and the binary data of an unstructured
+ * grid file in memory and writes the file when close() is called. Text is
+ * written in the 'normal' format, binary data in the 'binary' format using the
+ * <<-operator. Every switch from 'binary' back to 'normal' completes a binary
+ * block, i.e. the data of a DataArray including its leading Int32 byte count.
+ *
+ * Depending on the data mode the blocks are stored
+ * - BASE64:	base64 encoded inside of the DataArray (format="binary"),
+ * - RAW:		unencoded in the appended data section (format="appended"),
+ * - ZLIB, LZ4:	as RAW, but compressed in blocks of 32 KiB (only if compiled
+ * 				with the corresponding cmake option).
+ *
+ * The attribute for the format of a DataArray is obtained by binary_format().
+ * The blocks are buffered unencoded and are encoded when the file is written.
+ * If asynchronous output is enabled, the encoding and writing is performed by
+ * the AsyncOutputQueue, such that the computation proceeds meanwhile.
+ *
+ * In parallel, the files of several processes can be aggregated: The processes
+ * are grouped into consecutive ranks of the given group size and all processes
+ * of a group send their pieces to the first process of the group, which writes
+ * them as pieces of a single file. Thus, only the file name passed on the first
+ * process of a group is used.
+ */
+class VTKFileWriter
+{
+	public:
+	///	format flags
+		enum fmtflag
+		{
+			normal,	///< text, written as is
+			binary	///< binary data, stored according to the data mode
+		};
+
+	///	storage of binary data
+		enum DataMode {BASE64, RAW, ZLIB, LZ4};
+
+	public:
+	///	constructor
+	/**
+	 * \param[in]	filename	name of the output file
+	 * \param[in]	mode		storage of binary data
+	 * \param[in]	groupSize	number of processes aggregated into one file
+	 * \param[in]	bAsync		write the file asynchronously
+	 */
+		VTKFileWriter(const std::string& filename, DataMode mode = BASE64,
+		              int groupSize = 1, bool bAsync = false);
+
+	///	destructor (the file is only written by close())
+		~VTKFileWriter() {}
+
+	///	writes the opening tags of the file up to the UnstructuredGrid tag
+		void begin_grid(bool bTimeDep = false, number time = 0.0);
+
+	///	writes the closing tags and the appended data to the file
+	/**	If processes are aggregated, this method communicates within the group
+	 * and must be called on all processes.*/
+		void close();
+
+	///	returns the value of the format attribute for the next DataArray
+	/**	For appended data, the offset is a placeholder (the index of the block),
+	 * which is replaced by the actual offset when the file is written.*/
+		std::string binary_format() const;
+
+	///	returns if the data mode is supported by this build
+		static bool data_mode_supported(DataMode mode);
+
+	///	returns the data mode for the name "base64", "raw", "zlib" or "lz4"
+		static DataMode data_mode_by_name(const std::string& name);
+
+	public:
+	///	switches between text and binary output
+		VTKFileWriter& operator<<(const fmtflag format);
+
+		VTKFileWriter& operator<<(int i)			{dispatch(i); return *this;}
+		VTKFileWriter& operator<<(char c)			{dispatch(c); return *this;}
+		VTKFileWriter& operator<<(float f)			{dispatch(f); return *this;}
+		VTKFileWriter& operator<<(double d)			{dispatch(d); return *this;}
+		VTKFileWriter& operator<<(long l)			{dispatch(l); return *this;}
+		VTKFileWriter& operator<<(size_t s)			{dispatch(s); return *this;}
+		VTKFileWriter& operator<<(const char* cstr);
+		VTKFileWriter& operator<<(const std::string& str);
+
+	protected:
+	///	writes a value as text or appends its bytes to the current block
+		template <typename T>
+		inline void dispatch(const T& value)
+		{
+			if(m_currFormat == normal) m_xml << value;
+			else m_data.insert(m_data.end(), reinterpret_cast<const char*>(&value),
+			                   reinterpret_cast<const char*>(&value) + sizeof(T));
+		}
+
+	protected:
+	///	name of the output file
+		std::string m_filename;
+
+	///	storage of binary data
+		DataMode m_mode;
+
+	///	number of processes aggregated into one file
+		int m_groupSize;
+
+	///	flag if written asynchronously
+		bool m_bAsync;
+
+	///	current format
+		fmtflag m_currFormat;
+
+	///	opening tags of the file
+		std::string m_header;
+
+	///	xml of the pieces
+		std::ostringstream m_xml;
+
+	///	position of each binary block in the xml (used for inline data)
+		std::vector<size_t> m_vBlockPos;
+
+	///	end of each binary block in the data
+		std::vector<size_t> m_vBlockEnd;
+
+	///	unencoded binary data of all blocks
+		std::vector<char> m_data;
+
+	///	flag if closed
+		bool m_bClosed;
+};
+
+} // end namespace ug
+
+#endif /* __H__UG__LIB_DISC__IO__VTK_FILE_WRITER__ */
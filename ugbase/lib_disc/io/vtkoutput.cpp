@@ -31,6 +31,7 @@
  */
 
 #include "vtkoutput.h"
+#include "common/util/async_output_queue.h"
 
 #include "common/util/os_info.h"  // for GetPathSeparator
 
@@ -56,10 +57,12 @@ print(const char* filename, Domain<TDim>& domain)
 	grid.attach_to_vertices(aVrtIndex);
 	aaVrtIndex.access(grid, aVrtIndex);
 
-//	get rank of process
+//	get rank of process (aggregated processes write to the file of the
+//	first process of their group)
 	int rank = 0;
 #ifdef UG_PARALLEL
 	rank = pcl::ProcRank();
+	rank -= rank % m_numProcsPerFile;
 #endif
 
 	const int si = -1;
@@ -75,18 +78,10 @@ print(const char* filename, Domain<TDim>& domain)
 //	open the file
 	try
 	{
-	VTKFileWriter File(name.c_str());
+	VTKFileWriter File(name, m_dataMode, m_numProcsPerFile, m_bAsync);
 
-//	header
-	File << VTKFileWriter::normal;
-	File << "<?xml version=\"1.0\"?>\n";
-	File << "<VTKFile type=\"UnstructuredGrid\" version=\"0.1\" byte_order=\"";
-	if(IsLittleEndian()) File << "LittleEndian";
-	else File << "BigEndian";
-	File << "\">\n";
-
-//	opening the grid
-	File << "  <UnstructuredGrid>\n";
+//	header and opening the grid
+	File.begin_grid();
 
 // 	get dimension of grid-piece
 	int dim = DimensionOfSubsets(sh);
@@ -114,9 +109,8 @@ print(const char* filename, Domain<TDim>& domain)
 		write_empty_grid_piece(File);
 	}
 
-//	write closing xml tags
-	File << "  </UnstructuredGrid>\n";
-	File << "</VTKFile>\n";
+//	write closing xml tags and the file
+	File.close();
 
 // 	detach help indices
 	grid.detach_from_vertices(aVrtIndex);
@@ -138,29 +132,32 @@ write_empty_grid_piece(VTKFileWriter& File, bool binary)
 	File << "    <Piece NumberOfPoints=\"0\" NumberOfCells=\"0\">\n";
 	File << "      <Points>\n";
 	File << "        <DataArray type=\"Float32\" NumberOfComponents=\"3\" format="
-		 <<	(binary ? "\"binary\"" : "\"ascii\"") << ">\n";
+		 <<	(binary ? File.binary_format() : "\"ascii\"") << ">\n";
 	if(binary)
-		File << VTKFileWriter::base64_binary << n << VTKFileWriter::normal;
+		File << VTKFileWriter::binary << n << VTKFileWriter::normal;
 	else
 		File << n;
 	File << "\n        </DataArray>\n";
 	File << "      </Points>\n";
 	File << "      <Cells>\n";
 	File << "        <DataArray type=\"Int32\" Name=\"connectivity\" format="
-		 <<	(binary ? "\"binary\"" : "\"ascii\"") << ">\n";
+		 <<	(binary ? File.binary_format() : "\"ascii\"") << ">\n";
 	if(binary)
-		File << VTKFileWriter::base64_binary << n << VTKFileWriter::normal;
+		File << VTKFileWriter::binary << n << VTKFileWriter::normal;
 	else
 		File << n;
 	File << "\n        </DataArray>\n";
 	File << "        <DataArray type=\"Int32\" Name=\"offsets\" format="
-		 <<	(binary ? "\"binary\"" : "\"ascii\"") << ">\n";
-	File << VTKFileWriter::base64_binary << n << VTKFileWriter::normal;
+		 <<	(binary ? File.binary_format() : "\"ascii\"") << ">\n";
+	if(binary)
+		File << VTKFileWriter::binary << n << VTKFileWriter::normal;
+	else
+		File << n;
 	File << "\n        </DataArray>\n";
 	File << "        <DataArray type=\"Int8\" Name=\"types\" format="
-		 <<	(binary ? "\"binary\"" : "\"ascii\"") << ">\n";
+		 <<	(binary ? File.binary_format() : "\"ascii\"") << ">\n";
 	if(binary)
-		File << VTKFileWriter::base64_binary << n << VTKFileWriter::normal;
+		File << VTKFileWriter::binary << n << VTKFileWriter::normal;
 	else
 		File << n;
 	File << "\n        </DataArray>\n";
@@ -593,6 +590,41 @@ set_binary(bool b) {
 	m_bBinary = b;
 }
 
+template <int TDim>
+void VTKOutput<TDim>::
+set_binary_format(const std::string& format)
+{
+	VTKFileWriter::DataMode mode = VTKFileWriter::data_mode_by_name(format);
+	if(!VTKFileWriter::data_mode_supported(mode))
+		UG_THROW("VTK::set_binary_format: Format '"<<format<<"' not supported"
+				" by this build. Enable the cmake option ZLIB resp. LZ4.");
+	m_dataMode = mode;
+}
+
+template <int TDim>
+void VTKOutput<TDim>::
+set_num_procs_per_file(int numProcs)
+{
+	if(numProcs < 1)
+		UG_THROW("VTK::set_num_procs_per_file: Number of processes per file"
+				" must be positive, but is "<<numProcs<<".");
+	m_numProcsPerFile = numProcs;
+}
+
+template <int TDim>
+void VTKOutput<TDim>::
+set_async(bool bAsync)
+{
+	m_bAsync = bAsync;
+}
+
+template <int TDim>
+void VTKOutput<TDim>::
+flush()
+{
+	WaitForAsyncOutput();
+}
+
 template <int TDim>
 bool VTKOutput<TDim>::
 vtk_name_used(const char* name) const
@@ -39,14 +39,12 @@
 
 // other ug modules
 #include "common/util/string_util.h"
-#include "common/util/base64_file_writer.h"
 #include "lib_disc/common/function_group.h"
 #include "lib_disc/domain.h"
 #include "lib_disc/spatial_disc/user_data/user_data.h"
+#include "vtk_file_writer.h"
 
 namespace ug{
-// todo this should avoid refactoring all the signatures of VTKOutput, remove it later
-typedef Base64FileWriter VTKFileWriter;
 
 template <typename T>
 struct IteratorProvider
@@ -922,11 +920,43 @@ protected:
 
 	public:
 	///	default constructor
-		VTKOutput()	: m_bSelectAll(true), m_bBinary(true) {}
+		VTKOutput()	: m_bSelectAll(true), m_bBinary(true),
+					  m_dataMode(VTKFileWriter::BASE64), m_numProcsPerFile(1),
+					  m_bAsync(false) {}
 
 	/// should values be printed in binary (base64 encoded way ) or plain ascii
 		void set_binary(bool b);
 
+	///	sets the storage of binary values
+	/**
+	 * "base64" writes the values base64 encoded inside of the xml (default),
+	 * "raw" writes them unencoded to an appended data section, which avoids the
+	 * 33% overhead and the cost of the encoding. "zlib" and "lz4" additionally
+	 * compress the appended data (if ug4 is compiled with ZLIB resp. LZ4).
+	 */
+		void set_binary_format(const std::string& format);
+
+	///	sets the number of processes whose pieces are written to one file
+	/**
+	 * In parallel, each process writes its own *.vtu file by default. If set
+	 * to n > 1, the processes are grouped into blocks of n consecutive ranks
+	 * and the first process of a block writes the pieces of the whole block
+	 * (e.g. n = processes per node reduces the number of files to one per node).
+	 */
+		void set_num_procs_per_file(int numProcs);
+
+	///	enables asynchronous output
+	/**
+	 * If enabled, the print methods only copy the data into a buffer and the
+	 * encoding and writing of the *.vtu files is performed by a background
+	 * thread (see AsyncOutputQueue), while the computation proceeds. Call
+	 * flush() to ensure that all files have been written.
+	 */
+		void set_async(bool bAsync);
+
+	///	waits until all asynchronously written files are on disk
+		void flush();
+
 	protected:
 	///	returns true if name for vtk-component is already used
 		bool vtk_name_used(const char* name) const;
@@ -957,6 +987,12 @@ protected:
 		bool m_bSelectAll;
 	/// print values in binary (base64 encoded way) or plain ascii
 		bool m_bBinary;
+	///	storage of binary values
+		VTKFileWriter::DataMode m_dataMode;
+	///	number of processes aggregated into one file
+		int m_numProcsPerFile;
+	///	flag if output is written asynchronously
+		bool m_bAsync;
 		std::map<std::string, std::vector<std::string> > m_vSymbFct;
 		std::map<std::string, std::vector<std::string> > m_vSymbFctNodal;
 		std::map<std::string, std::vector<std::string> > m_vSymbFctElem;
@@ -207,10 +207,12 @@ print_subset(const char* filename, TFunction& u, int si, int step, number time,
 	grid.attach_to_vertices(aVrtIndex);
 	aaVrtIndex.access(grid, aVrtIndex);
 
-//	get rank of process
+//	get rank of process (aggregated processes write to the file of the
+//	first process of their group)
 	int rank = 0;
 #ifdef UG_PARALLEL
 	rank = pcl::ProcRank();
+	rank -= rank % m_numProcsPerFile;
 #endif
 
 //	get name for *.vtu file
@@ -224,7 +226,7 @@ print_subset(const char* filename, TFunction& u, int si, int step, number time,
 //	open the file
 	try
 	{
-	VTKFileWriter File(name.c_str());
+	VTKFileWriter File(name, m_dataMode, m_numProcsPerFile, m_bAsync);
 
 //	bool if time point should be written to *.vtu file
 //	in parallel we must not (!) write it to the *.vtu file, but to the *.pvtu
@@ -233,22 +235,8 @@ print_subset(const char* filename, TFunction& u, int si, int step, number time,
 	if(pcl::NumProcs() > 1) bTimeDep = false;
 #endif
 
-//	header
-	File << VTKFileWriter::normal;
-	File << "<?xml version=\"1.0\"?>\n";
-	File << "<VTKFile type=\"UnstructuredGrid\" version=\"0.1\" byte_order=\"";
-	if(IsLittleEndian()) File << "LittleEndian";
-	else File << "BigEndian";
-	File << "\">\n";
-
-//	writing time point
-	if(bTimeDep)
-	{
-		File << "  <Time timestep=\""<<time<<"\"/>\n";
-	}
-
-//	opening the grid
-	File << "  <UnstructuredGrid>\n";
+//	header, time point and opening the grid
+	File.begin_grid(bTimeDep, time);
 
 // 	get dimension of grid-piece
 	int dim = -1;
@@ -276,10 +264,8 @@ print_subset(const char* filename, TFunction& u, int si, int step, number time,
 		write_empty_grid_piece(File);
 	}
 
-//	write closing xml tags
-	File << VTKFileWriter::normal;
-	File << "  </UnstructuredGrid>\n";
-	File << "</VTKFile>\n";
+//	write closing xml tags and the file
+	File.close();
 
 // 	detach help indices
 	grid.detach_from_vertices(aVrtIndex);
@@ -336,10 +322,12 @@ print_subsets(const char* filename, TFunction& u, SubsetGroup& ssGrp, int step,
 	grid.attach_to_vertices(aVrtIndex);
 	aaVrtIndex.access(grid, aVrtIndex);
 
-//	get rank of process
+//	get rank of process (aggregated processes write to the file of the
+//	first process of their group)
 	int rank = 0;
 #ifdef UG_PARALLEL
 	rank = pcl::ProcRank();
+	rank -= rank % m_numProcsPerFile;
 #endif
 
 //	get name for *.vtu file
@@ -353,7 +341,7 @@ print_subsets(const char* filename, TFunction& u, SubsetGroup& ssGrp, int step,
 //	open the file
 	try
 	{
-	VTKFileWriter File(name.c_str());
+	VTKFileWriter File(name, m_dataMode, m_numProcsPerFile, m_bAsync);
 
 //	bool if time point should be written to *.vtu file
 //	in parallel we must not (!) write it to the *.vtu file, but to the *.pvtu
@@ -362,22 +350,8 @@ print_subsets(const char* filename, TFunction& u, SubsetGroup& ssGrp, int step,
 	if(pcl::NumProcs() > 1) bTimeDep = false;
 #endif
 
-//	header
-	File << VTKFileWriter::normal;
-	File << "<?xml version=\"1.0\"?>\n";
-	File << "<VTKFile type=\"UnstructuredGrid\" version=\"0.1\" byte_order=\"";
-	if(IsLittleEndian()) File << "LittleEndian";
-	else File << "BigEndian";
-	File << "\">\n";
-
-//	writing time point
-	if(bTimeDep)
-	{
-		File << "  <Time timestep=\""<<time<<"\"/>\n";
-	}
-
-//	opening the grid
-	File << "  <UnstructuredGrid>\n";
+//	header, time point and opening the grid
+	File.begin_grid(bTimeDep, time);
 
 // 	get dimension of grid-piece: the highest dimension of the specified subsets
 	int dim = -1;
@@ -402,10 +376,8 @@ print_subsets(const char* filename, TFunction& u, SubsetGroup& ssGrp, int step,
 				" detected correctly although grid objects present.");
 	}
 
-//	write closing xml tags
-	File << VTKFileWriter::normal;
-	File << "  </UnstructuredGrid>\n";
-	File << "</VTKFile>\n";
+//	write closing xml tags and the file
+	File.close();
 
 // 	detach help indices
 	grid.detach_from_vertices(aVrtIndex);
@@ -745,7 +717,7 @@ write_points_elementwise(VTKFileWriter& File,
 	const_iterator iterBegin = IteratorProvider<T>::template begin<TElem>(iterContainer, si);
 	const_iterator iterEnd = IteratorProvider<T>::template end<TElem>(iterContainer, si);
 	if(m_bBinary)
-		File << VTKFileWriter::base64_binary;
+		File << VTKFileWriter::binary;
 	else
 		File << VTKFileWriter::normal;
 
@@ -790,10 +762,10 @@ write_points(VTKFileWriter& File,
 	File << VTKFileWriter::normal;
 	File << "      <Points>\n";
 	File << "        <DataArray type=\"Float32\" NumberOfComponents=\"3\" format="
-		 <<	(m_bBinary ? "\"binary\"" : "\"ascii\"") << ">\n";
+		 <<	(m_bBinary ? File.binary_format() : "\"ascii\"") << ">\n";
 	int n = 3*sizeof(float) * numVert;
 	if(m_bBinary)
-		File << VTKFileWriter::base64_binary << n;
+		File << VTKFileWriter::binary << n;
 
 //	reset counter for vertices
 	n = 0;
@@ -840,10 +812,10 @@ write_points(VTKFileWriter& File,
 	File << VTKFileWriter::normal;
 	File << "      <Points>\n";
 	File << "        <DataArray type=\"Float32\" NumberOfComponents=\"3\" format="
-		 <<	(m_bBinary ? "\"binary\"" : "\"ascii\"") << ">\n";
+		 <<	(m_bBinary ? File.binary_format() : "\"ascii\"") << ">\n";
 	int n = 3*sizeof(float) * numVert;
 	if(m_bBinary)
-		File << VTKFileWriter::base64_binary << n;
+		File << VTKFileWriter::binary << n;
 
 //	reset counter for vertices
 	n = 0;
@@ -962,7 +934,7 @@ write_cell_connectivity(VTKFileWriter& File,
 	const_iterator iterEnd = IteratorProvider<T>::template end<TElem>(iterContainer, si);
 
 	if(m_bBinary)
-		File << VTKFileWriter::base64_binary;
+		File << VTKFileWriter::binary;
 	else
 		File << VTKFileWriter::normal;
 
@@ -1041,11 +1013,11 @@ write_cell_connectivity(VTKFileWriter& File,
 	File << VTKFileWriter::normal;
 //	write opening tag to indicate that connections will be written
 	File << "        <DataArray type=\"Int32\" Name=\"connectivity\" format="
-		 <<	(m_bBinary ? "\"binary\"": "\"ascii\"") << ">\n";
+		 <<	(m_bBinary ? File.binary_format() : "\"ascii\"") << ">\n";
 	int n = sizeof(int) * numConn;
 
 	if(m_bBinary)
-		File << VTKFileWriter::base64_binary << n;
+		File << VTKFileWriter::binary << n;
 //	switch dimension
 	if(numConn > 0){
 		switch(dim)
@@ -1080,11 +1052,11 @@ write_cell_connectivity(VTKFileWriter& File,
 	File << VTKFileWriter::normal;
 //	write opening tag to indicate that connections will be written
 	File << "        <DataArray type=\"Int32\" Name=\"connectivity\" format="
-		 <<	(m_bBinary ? "\"binary\"": "\"ascii\"") << ">\n";
+		 <<	(m_bBinary ? File.binary_format() : "\"ascii\"") << ">\n";
 	int n = sizeof(int) * numConn;
 
 	if(m_bBinary)
-		File << VTKFileWriter::base64_binary << n;
+		File << VTKFileWriter::binary << n;
 //	switch dimension
 	if(numConn > 0)
 	for(size_t i = 0; i < ssGrp.size(); i++){
@@ -1129,7 +1101,7 @@ write_cell_offsets(VTKFileWriter& File, const T& iterContainer, int si, int& n)
 	const_iterator iterEnd = IteratorProvider<T>::template end<TElem>(iterContainer, si);
 
 	if(m_bBinary)
-		File << VTKFileWriter::base64_binary;
+		File << VTKFileWriter::binary;
 	else
 		File << VTKFileWriter::normal;
 
@@ -1178,10 +1150,10 @@ write_cell_offsets(VTKFileWriter& File, const T& iterContainer, int si, int dim,
 	File << VTKFileWriter::normal;
 //	write opening tag indicating that offsets are going to be written
 	File << "        <DataArray type=\"Int32\" Name=\"offsets\" format="
-		 <<	(m_bBinary ? "\"binary\"": "\"ascii\"") << ">\n";
+		 <<	(m_bBinary ? File.binary_format() : "\"ascii\"") << ">\n";
 	int n = sizeof(int) * numElem;
 	if(m_bBinary)
-		File << VTKFileWriter::base64_binary << n;
+		File << VTKFileWriter::binary << n;
 
 	n = 0;
 //	switch dimension
@@ -1216,10 +1188,10 @@ write_cell_offsets(VTKFileWriter& File, const T& iterContainer, SubsetGroup& ssG
 	File << VTKFileWriter::normal;
 //	write opening tag indicating that offsets are going to be written
 	File << "        <DataArray type=\"Int32\" Name=\"offsets\" format="
-		 <<	(m_bBinary ? "\"binary\"": "\"ascii\"") << ">\n";
+		 <<	(m_bBinary ? File.binary_format() : "\"ascii\"") << ">\n";
 	int n = sizeof(int) * numElem;
 	if(m_bBinary)
-		File << VTKFileWriter::base64_binary << n;
+		File << VTKFileWriter::binary << n;
 
 	n = 0;
 //	switch dimension
@@ -1285,7 +1257,7 @@ write_cell_types(VTKFileWriter& File, const T& iterContainer, int si)
 	const_iterator iterEnd = IteratorProvider<T>::template end<TElem>(iterContainer, si);
 
 	if(m_bBinary)
-		File << VTKFileWriter::base64_binary;
+		File << VTKFileWriter::binary;
 	else
 		File << VTKFileWriter::normal;
 //	loop all elements, write type for each element to stream
@@ -1325,9 +1297,9 @@ write_cell_types(VTKFileWriter& File, const T& iterContainer, int si, int dim,
 	File << VTKFileWriter::normal;
 //	write opening tag to indicate that types will be written
 	File << "        <DataArray type=\"Int8\" Name=\"types\" format="
-		 <<	(m_bBinary ? "\"binary\"": "\"ascii\"") << ">\n";
+		 <<	(m_bBinary ? File.binary_format() : "\"ascii\"") << ">\n";
 	if(m_bBinary)
-		File << VTKFileWriter::base64_binary << numElem;
+		File << VTKFileWriter::binary << numElem;
 
 //	switch dimension
 	if(numElem > 0)
@@ -1362,9 +1334,9 @@ write_cell_types(VTKFileWriter& File, const T& iterContainer, SubsetGroup& ssGrp
 	File << VTKFileWriter::normal;
 //	write opening tag to indicate that types will be written
 	File << "        <DataArray type=\"Int8\" Name=\"types\" format="
-		 <<	(m_bBinary ? "\"binary\"": "\"ascii\"") << ">\n";
+		 <<	(m_bBinary ? File.binary_format() : "\"ascii\"") << ">\n";
 	if(m_bBinary)
-		File << VTKFileWriter::base64_binary << numElem;
+		File << VTKFileWriter::binary << numElem;
 
 //	switch dimension
 	if(numElem > 0)
@@ -1410,7 +1382,7 @@ write_nodal_data_elementwise(VTKFileWriter& File, TFunction& u, number time,
 	static const size_t numCo = ref_elem_type::numCorners;
 
 	if(m_bBinary)
-		File << VTKFileWriter::base64_binary;
+		File << VTKFileWriter::binary;
 	else
 		File << VTKFileWriter::normal;
 
@@ -1509,11 +1481,11 @@ write_nodal_data(VTKFileWriter& File, TFunction& u, number time,
 	File << VTKFileWriter::normal;
 	File << "        <DataArray type=\"Float32\" Name=\""<<name<<"\" "
 	"NumberOfComponents=\""<<numCmp<<"\" format="
-		 <<	(m_bBinary ? "\"binary\"": "\"ascii\"") << ">\n";
+		 <<	(m_bBinary ? File.binary_format() : "\"ascii\"") << ">\n";
 
 	int n = sizeof(float) * numVert * numCmp;
 	if(m_bBinary)
-		File << VTKFileWriter::base64_binary << n;
+		File << VTKFileWriter::binary << n;
 
 //	start marking of grid
 	grid.begin_marking();
@@ -1561,11 +1533,11 @@ write_nodal_data(VTKFileWriter& File, TFunction& u, number time,
 	File << VTKFileWriter::normal;
 	File << "        <DataArray type=\"Float32\" Name=\""<<name<<"\" "
 	"NumberOfComponents=\""<<numCmp<<"\" format="
-		 <<	(m_bBinary ? "\"binary\"": "\"ascii\"") << ">\n";
+		 <<	(m_bBinary ? File.binary_format() : "\"ascii\"") << ">\n";
 
 	int n = sizeof(float) * numVert * numCmp;
 	if(m_bBinary)
-		File << VTKFileWriter::base64_binary << n;
+		File << VTKFileWriter::binary << n;
 
 //	start marking of grid
 	grid.begin_marking();
@@ -1608,7 +1580,7 @@ write_nodal_values_elementwise(VTKFileWriter& File, TFunction& u,
 	typedef typename reference_element_traits<TElem>::reference_element_type
 																ref_elem_type;
 	if(m_bBinary)
-		File << VTKFileWriter::base64_binary;
+		File << VTKFileWriter::binary;
 	else
 		File << VTKFileWriter::normal;
 
@@ -1678,11 +1650,11 @@ write_nodal_values(VTKFileWriter& File, TFunction& u,
 //	write opening tag
 	File << "        <DataArray type=\"Float32\" Name=\""<<name<<"\" "
 	"NumberOfComponents=\""<<(vFct.size() == 1 ? 1 : 3)<<"\" format="
-		 <<	(m_bBinary ? "\"binary\"": "\"ascii\"") << ">\n";
+		 <<	(m_bBinary ? File.binary_format() : "\"ascii\"") << ">\n";
 
 	int n = sizeof(float) * numVert * (vFct.size() == 1 ? 1 : 3);
 	if(m_bBinary)
-		File << VTKFileWriter::base64_binary << n;
+		File << VTKFileWriter::binary << n;
 
 //	start marking of grid
 	grid.begin_marking();
@@ -1722,11 +1694,11 @@ write_nodal_values(VTKFileWriter& File, TFunction& u,
 //	write opening tag
 	File << "        <DataArray type=\"Float32\" Name=\""<<name<<"\" "
 	"NumberOfComponents=\""<<(vFct.size() == 1 ? 1 : 3)<<"\" format="
-		 <<	(m_bBinary ? "\"binary\"": "\"ascii\"") << ">\n";
+		 <<	(m_bBinary ? File.binary_format() : "\"ascii\"") << ">\n";
 
 	int n = sizeof(float) * numVert * (vFct.size() == 1 ? 1 : 3);
 	if(m_bBinary)
-		File << VTKFileWriter::base64_binary << n;
+		File << VTKFileWriter::binary << n;
 
 //	start marking of grid
 	grid.begin_marking();
@@ -1975,7 +1947,7 @@ write_cell_data_elementwise(VTKFileWriter& File, TFunction& u, number time,
 	static const size_t numCo = ref_elem_type::numCorners;
 
 	if(m_bBinary)
-		File << VTKFileWriter::base64_binary;
+		File << VTKFileWriter::binary;
 	else
 		File << VTKFileWriter::normal;
 
@@ -2071,11 +2043,11 @@ write_cell_data(VTKFileWriter& File, TFunction& u, number time,
 	File << VTKFileWriter::normal;
 	File << "        <DataArray type=\"Float32\" Name=\""<<name<<"\" "
 	"NumberOfComponents=\""<<numCmp<<"\" format="
-		 <<	(m_bBinary ? "\"binary\"": "\"ascii\"") << ">\n";
+		 <<	(m_bBinary ? File.binary_format() : "\"ascii\"") << ">\n";
 
 	int n = sizeof(float) * numElem * numCmp;
 	if(m_bBinary)
-		File << VTKFileWriter::base64_binary << n;
+		File << VTKFileWriter::binary << n;
 
 //	switch dimension
 	switch(dim)
@@ -2112,11 +2084,11 @@ write_cell_data(VTKFileWriter& File, TFunction& u, number time,
 	File << VTKFileWriter::normal;
 	File << "        <DataArray type=\"Float32\" Name=\""<<name<<"\" "
 	"NumberOfComponents=\""<<numCmp<<"\" format="
-		 <<	(m_bBinary ? "\"binary\"": "\"ascii\"") << ">\n";
+		 <<	(m_bBinary ? File.binary_format() : "\"ascii\"") << ">\n";
 
 	int n = sizeof(float) * numElem * numCmp;
 	if(m_bBinary)
-		File << VTKFileWriter::base64_binary << n;
+		File << VTKFileWriter::binary << n;
 
 //	switch dimension
 	for(size_t i = 0; i < ssGrp.size(); i++)
@@ -2165,7 +2137,7 @@ write_cell_values_elementwise(VTKFileWriter& File, TFunction& u,
 	const_iterator iterEnd = IteratorProvider<TFunction>::template end<TElem>(u, si);
 
 	if(m_bBinary)
-		File << VTKFileWriter::base64_binary;
+		File << VTKFileWriter::binary;
 	else
 		File << VTKFileWriter::normal;
 
@@ -2248,11 +2220,11 @@ write_cell_values(VTKFileWriter& File, TFunction& u,
 	File << VTKFileWriter::normal;
 	File << "        <DataArray type=\"Float32\" Name=\""<<name<<"\" "
 	"NumberOfComponents=\""<<(vFct.size() == 1 ? 1 : 3)<<"\" format="
-		 <<	(m_bBinary ? "\"binary\"": "\"ascii\"") << ">\n";
+		 <<	(m_bBinary ? File.binary_format() : "\"ascii\"") << ">\n";
 
 	int n = sizeof(float) * numElem * (vFct.size() == 1 ? 1 : 3);
 	if(m_bBinary)
-		File << VTKFileWriter::base64_binary << n;
+		File << VTKFileWriter::binary << n;
 
 //	switch dimension
 	switch(dim)
@@ -2285,11 +2257,11 @@ write_cell_values(VTKFileWriter& File, TFunction& u,
 	File << VTKFileWriter::normal;
 	File << "        <DataArray type=\"Float32\" Name=\""<<name<<"\" "
 	"NumberOfComponents=\""<<(vFct.size() == 1 ? 1 : 3)<<"\" format="
-		 <<	(m_bBinary ? "\"binary\"": "\"ascii\"") << ">\n";
+		 <<	(m_bBinary ? File.binary_format() : "\"ascii\"") << ">\n";
 
 	int n = sizeof(float) * numElem * (vFct.size() == 1 ? 1 : 3);
 	if(m_bBinary)
-		File << VTKFileWriter::base64_binary << n;
+		File << VTKFileWriter::binary << n;
 
 //	switch dimension
 	for(size_t i = 0; i < ssGrp.size(); i++)
@@ -2672,8 +2644,8 @@ write_pvtu(TFunction& u, const std::string& filename,
 			fprintf(file, "    </PCellData>\n");
 		}
 
-	// 	include files from all procs
-		for (int i = 0; i < numProcs; i++) {
+	// 	include files from all procs (resp. from the first proc of each group)
+		for (int i = 0; i < numProcs; i += m_numProcsPerFile) {
 			vtu_filename(name, filename, i, si, maxSi, step);
 			name = FilenameWithoutPath(name);
 			fprintf(file, "    <Piece Source=\"%s\"/>\n", name.c_str());
@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+
+#ifndef __H__UG__LIB_DISC__OPERATOR__LINEAR_OPERATOR__MATRIX_FREE_OPERATOR__
+#define __H__UG__LIB_DISC__OPERATOR__LINEAR_OPERATOR__MATRIX_FREE_OPERATOR__
+
+#include "lib_algebra/operator/interface/matrix_free_operator.h"
+#include "lib_disc/assemble_interface.h"
+
+namespace ug{
+
+///	linearized operator applied without assembling the Jacobian matrix
+/**
+ * This operator implements the IMatrixFreeOperator interface. Invoking the
+ * init method only stores the linearization point u. Every application
+ * d = J(u)*c is computed by the IAssemble object element-wise from the local
+ * Jacobians (or, if not supported by the IAssemble, by a directional
+ * derivative of the defect), so that no global matrix is ever stored.
+ *
+ * The diagonal of J(u), as needed by Jacobi-like smoothers, is assembled on
+ * first request and kept until the next init.
+ *
+ * \tparam	TAlgebra			algebra type
+ */
+template <typename TAlgebra>
+class MatrixFreeOperator :
+	public virtual IMatrixFreeOperator<typename TAlgebra::vector_type>
+{
+	public:
+	///	Type of Algebra
+		typedef TAlgebra algebra_type;
+
+	///	Type of Vector
+		typedef typename TAlgebra::vector_type vector_type;
+
+	public:
+	///	Default Constructor
+		MatrixFreeOperator() :	m_spAss(NULL), m_bDiagValid(false) {};
+
+	///	Constructor
+		MatrixFreeOperator(SmartPtr<IAssemble<TAlgebra> > ass)
+			: m_spAss(ass), m_bDiagValid(false) {};
+
+	///	Constructor
+		MatrixFreeOperator(SmartPtr<IAssemble<TAlgebra> > ass, const GridLevel& gl)
+			: m_spAss(ass), m_gridLevel(gl), m_bDiagValid(false) {};
+
+	///	sets the discretization to be used
+		void set_discretization(SmartPtr<IAssemble<TAlgebra> > ass) {m_spAss = ass; m_bDiagValid = false;}
+
+	///	returns the discretization to be used
+		SmartPtr<IAssemble<TAlgebra> > discretization() {return m_spAss;}
+
+	///	sets the level used for assembling
+		void set_level(const GridLevel& gl) {m_gridLevel = gl; m_bDiagValid = false;}
+
+	///	returns the level
+		const GridLevel& level() const {return m_gridLevel;}
+
+	///	sets the linearization point
+		virtual void init(const vector_type& u);
+
+	///	not available, since a linearization point is needed
+		virtual void init();
+
+	///	compute d = J(u)*c
+		virtual void apply(vector_type& d, const vector_type& c);
+
+	///	Compute d := d - J(u)*c
+		virtual void apply_sub(vector_type& d, const vector_type& c);
+
+	///	returns the diagonal of J(u) (consistent)
+		virtual const vector_type& diagonal();
+
+	///	Destructor
+		virtual ~MatrixFreeOperator() {};
+
+	protected:
+	// 	assembling procedure
+		SmartPtr<IAssemble<TAlgebra> > m_spAss;
+
+	// 	DoF Distribution used
+		GridLevel m_gridLevel;
+
+	//	linearization point
+		SmartPtr<vector_type> m_spU;
+
+	//	diagonal of the operator and flag if up to date
+		SmartPtr<vector_type> m_spDiag;
+		bool m_bDiagValid;
+
+	//	temporary vector used in apply_sub
+		SmartPtr<vector_type> m_spTmp;
+};
+
+} // namespace ug
+
+// include implementation
+#include "matrix_free_operator_impl.h"
+
+#endif /* __H__UG__LIB_DISC__OPERATOR__LINEAR_OPERATOR__MATRIX_FREE_OPERATOR__ */
@@ -0,0 +1,134 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+
+#ifndef __H__UG__LIB_DISC__OPERATOR__LINEAR_OPERATOR__MATRIX_FREE_OPERATOR_IMPL__
+#define __H__UG__LIB_DISC__OPERATOR__LINEAR_OPERATOR__MATRIX_FREE_OPERATOR_IMPL__
+
+#include "matrix_free_operator.h"
+#include "common/profiler/profiler.h"
+
+namespace ug{
+
+template <typename TAlgebra>
+void
+MatrixFreeOperator<TAlgebra>::init(const vector_type& u)
+{
+	if(m_spAss.invalid())
+		UG_THROW("MatrixFreeOperator: Assembling routine not set.");
+
+//	remember linearization point
+	m_spU = u.clone();
+	m_bDiagValid = false;
+}
+
+template <typename TAlgebra>
+void
+MatrixFreeOperator<TAlgebra>::init()
+{
+	UG_THROW("MatrixFreeOperator::init: Operator needs a linearization point,"
+			" use init(u) instead.");
+}
+
+template <typename TAlgebra>
+void
+MatrixFreeOperator<TAlgebra>::apply(vector_type& d, const vector_type& c)
+{
+	PROFILE_FUNC_GROUP("algebra");
+#ifdef UG_PARALLEL
+	if(!c.has_storage_type(PST_CONSISTENT))
+		UG_THROW("Inadequate storage format of Vector c.");
+#endif
+
+	if(m_spU.invalid())
+		UG_THROW("MatrixFreeOperator::apply: Operator not initialized.");
+
+//	check sizes
+	if(c.size() != m_spU->size())
+		UG_THROW("MatrixFreeOperator::apply: Size of linearization point ["
+				<<m_spU->size()<<"] must match the size of vector x ["
+				<<c.size()<<"] for the operation b = A*x.");
+
+//	compute action of the Jacobian
+	try{
+		m_spAss->apply_jacobian(d, c, *m_spU, m_gridLevel);
+	}
+	UG_CATCH_THROW("MatrixFreeOperator::apply: Cannot apply Jacobian.");
+}
+
+template <typename TAlgebra>
+void
+MatrixFreeOperator<TAlgebra>::apply_sub(vector_type& d, const vector_type& c)
+{
+#ifdef UG_PARALLEL
+	if(!d.has_storage_type(PST_ADDITIVE))
+		UG_THROW("Inadequate storage format of Vector d.");
+#endif
+
+//	compute J(u)*c into temporary
+	if(m_spTmp.invalid() || m_spTmp->size() != d.size())
+		m_spTmp = d.clone_without_values();
+	apply(*m_spTmp, c);
+
+//	subtract
+	d -= *m_spTmp;
+}
+
+template <typename TAlgebra>
+const typename MatrixFreeOperator<TAlgebra>::vector_type&
+MatrixFreeOperator<TAlgebra>::diagonal()
+{
+	if(m_bDiagValid) return *m_spDiag;
+
+	if(m_spU.invalid())
+		UG_THROW("MatrixFreeOperator::diagonal: Operator not initialized.");
+
+//	assemble diagonal
+	if(m_spDiag.invalid() || m_spDiag->size() != m_spU->size())
+		m_spDiag = m_spU->clone_without_values();
+
+	try{
+		m_spAss->assemble_jacobian_diagonal(*m_spDiag, *m_spU, m_gridLevel);
+	}
+	UG_CATCH_THROW("MatrixFreeOperator::diagonal: Cannot assemble diagonal.");
+
+//	make diagonal consistent
+#ifdef UG_PARALLEL
+	m_spDiag->change_storage_type(PST_CONSISTENT);
+#endif
+
+	m_bDiagValid = true;
+	return *m_spDiag;
+}
+
+} // end namespace ug
+
+#endif /* __H__UG__LIB_DISC__OPERATOR__LINEAR_OPERATOR__MATRIX_FREE_OPERATOR_IMPL__ */
@@ -47,6 +47,7 @@
 #include "lib_algebra/operator/interface/operator_inverse.h"
 #include "lib_algebra/operator/interface/operator.h"
 #include "lib_algebra/operator/preconditioner/jacobi.h"
+#include "lib_algebra/operator/preconditioner/chebyshev.h"
 #include "lib_algebra/operator/linear_solver/lu.h"
 #include "lib_disc/dof_manager/dof_distribution.h"
 #include "lib_disc/operator/linear_operator/transfer_interface.h"
@@ -165,6 +166,19 @@ class AssembledMultiGridCycle :
 	///	sets if communication and computation should be overlaped
 		void set_comm_comp_overlap(bool bOverlap) {m_bCommCompOverlap = bOverlap;}
 
+	///	sets if eigenvalue estimates of (Chebyshev) smoothers are cached per level
+	/**
+	 * If enabled (default), the largest eigenvalue estimated by a Chebyshev
+	 * smoother on a level is reused for further inits of the smoothers on that
+	 * level. It is estimated again if the grid hierarchy changes, if the norm
+	 * of the diagonal of the level matrix changes by more than 1 percent (e.g.
+	 * for a new time step size) or after the given number of reuses.
+	 */
+		void set_cache_smoother_eigenvalues(bool bCache) {m_bCacheSmootherEigenvalues = bCache;}
+
+	///	sets the number of inits a cached smoother eigenvalue estimate is reused
+		void set_smoother_eigenvalue_reuse(int maxReuse) {m_maxSmootherEigenvalueReuse = maxReuse;}
+
 	///	sets the number of pre-smoothing steps to be performed
 		void set_num_presmooth(int num) {m_numPreSmooth = num;}
 
@@ -289,6 +303,9 @@ class AssembledMultiGridCycle :
 	///	initializes the smoother and base solver
 		void init_smoother();
 
+	///	initializes a smoother on a level, reusing cached eigenvalue estimates
+		bool init_level_smoother(int lev, ILinearIterator<vector_type>& smoother);
+
 	///	initializes the coarse grid matrices
 		void assemble_level_operator();
 		void init_rap_operator();
@@ -356,6 +373,12 @@ class AssembledMultiGridCycle :
 	///	flag if overlapping communication and computation
 		bool m_bCommCompOverlap;
 
+	///	flag if eigenvalue estimates of smoothers are cached per level
+		bool m_bCacheSmootherEigenvalues;
+
+	///	maximal number of inits a cached eigenvalue estimate is reused
+		int m_maxSmootherEigenvalueReuse;
+
 	///	approximation space revision of cached values
 		RevisionCounter m_ApproxSpaceRevision;
 
@@ -446,6 +469,13 @@ class AssembledMultiGridCycle :
 		///	missing coarse grid correction
 			matrix_type RimCpl_Coarse_Fine;
 			
+		///	cached estimate of the largest eigenvalue of the level smoothers (0 if none)
+			number lambdaMaxEst;
+
+		///	norm of the matrix diagonal and number of reuses of the cached estimate
+			number lambdaMaxDiagNorm;
+			int lambdaMaxNumReuse;
+
 		/// debugging output information (number of calls of the pre-, postsmoothers, base solver etc)
 			int n_pre_calls, n_post_calls, n_base_calls, n_restr_calls, n_prolong_calls;
 		};
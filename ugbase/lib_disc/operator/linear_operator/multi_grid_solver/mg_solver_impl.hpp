@@ -84,6 +84,7 @@ AssembledMultiGridCycle() :
 	m_LocalFullRefLevel(0), m_GridLevelType(GridLevel::LEVEL),
 	m_bUseRAP(false), m_bSmoothOnSurfaceRim(false),
 	m_bCommCompOverlap(false),
+	m_bCacheSmootherEigenvalues(true), m_maxSmootherEigenvalueReuse(10),
 	m_spPreSmootherPrototype(new Jacobi<TAlgebra>()),
 	m_spPostSmootherPrototype(m_spPreSmootherPrototype),
 	m_spProjectionPrototype(SPNULL),
@@ -106,6 +107,7 @@ AssembledMultiGridCycle(SmartPtr<ApproximationSpace<TDomain> > approxSpace) :
 	m_LocalFullRefLevel(0), m_GridLevelType(GridLevel::LEVEL),
 	m_bUseRAP(false), m_bSmoothOnSurfaceRim(false),
 	m_bCommCompOverlap(false),
+	m_bCacheSmootherEigenvalues(true), m_maxSmootherEigenvalueReuse(10),
 	m_spPreSmootherPrototype(new Jacobi<TAlgebra>()),
 	m_spPostSmootherPrototype(m_spPreSmootherPrototype),
 	m_spProjectionPrototype(new StdInjection<TDomain,TAlgebra>(m_spApproxSpace)),
@@ -146,6 +148,8 @@ clone()
 	clone->set_presmoother(m_spPreSmootherPrototype);
 	clone->set_postsmoother(m_spPostSmootherPrototype);
 	clone->set_surface_level(m_surfaceLev);
+	clone->set_cache_smoother_eigenvalues(m_bCacheSmootherEigenvalues);
+	clone->set_smoother_eigenvalue_reuse(m_maxSmootherEigenvalueReuse);
 
 	for(size_t i = 0; i < m_vspProlongationPostProcess.size(); ++i)
 		clone->add_prolongation_post_process(m_vspProlongationPostProcess[i]);
@@ -1130,7 +1134,7 @@ init_smoother()
 		UG_DLOG(LIB_DISC_MULTIGRID, 4, "  init_smoother: initializing pre-smoother on lev "<<lev<<"\n");
 		bool success;
 		GridLevel gw_gl; enter_debug_writer_section(gw_gl, "PreSmootherInit", lev);
-		try {success = ld.PreSmoother->init(ld.A, *ld.sc);}
+		try {success = init_level_smoother(lev, *ld.PreSmoother);}
 		UG_CATCH_THROW("GMG::init: Cannot init pre-smoother for level "<<lev);
 		leave_debug_writer_section(gw_gl);
 		if (!success)
@@ -1140,7 +1144,7 @@ init_smoother()
 		if(ld.PreSmoother != ld.PostSmoother)
 		{
 			GridLevel gw_gl; enter_debug_writer_section(gw_gl, "PostSmootherInit", lev);
-			try {success = ld.PostSmoother->init(ld.A, *ld.sc);}
+			try {success = init_level_smoother(lev, *ld.PostSmoother);}
 			UG_CATCH_THROW("GMG::init: Cannot init post-smoother for level "<<lev);
 			leave_debug_writer_section(gw_gl);
 			if (!success)
@@ -1151,6 +1155,51 @@ init_smoother()
 	UG_DLOG(LIB_DISC_MULTIGRID, 3, "gmg-stop init_smoother\n");
 }
 
+template <typename TDomain, typename TAlgebra>
+bool AssembledMultiGridCycle<TDomain, TAlgebra>::
+init_level_smoother(int lev, ILinearIterator<vector_type>& smoother)
+{
+	LevData& ld = *m_vLevData[lev];
+
+//	Chebyshev smoothers may reuse the estimate of the largest eigenvalue
+	Chebyshev<TAlgebra>* pCheby = dynamic_cast<Chebyshev<TAlgebra>*>(&smoother);
+	const bool bCache = m_bCacheSmootherEigenvalues && pCheby
+						&& pCheby->estimates_max_eigenvalue();
+
+//	the estimate is only reused as long as the level matrix is unchanged,
+//	which is checked cheaply by the (global) norm of its diagonal
+	number diagNorm = 0.0;
+	if(bCache){
+		const matrix_type& A = *ld.A;
+		for(size_t i = 0; i < A.num_rows(); ++i)
+			diagNorm += BlockNorm2(A(i, i));
+		#ifdef UG_PARALLEL
+		diagNorm = A.layouts()->proc_comm().allreduce(diagNorm, PCL_RO_SUM);
+		#endif
+
+		if(ld.lambdaMaxEst > 0.0
+			&& ld.lambdaMaxNumReuse < m_maxSmootherEigenvalueReuse
+			&& fabs(diagNorm - ld.lambdaMaxDiagNorm) <= 1e-2 * ld.lambdaMaxDiagNorm)
+		{
+			pCheby->set_max_eigenvalue_estimate(ld.lambdaMaxEst);
+			++ld.lambdaMaxNumReuse;
+		}
+		else
+			ld.lambdaMaxNumReuse = 0;
+	}
+
+	if(!smoother.init(ld.A, *ld.sc)) return false;
+
+	if(bCache && ld.lambdaMaxNumReuse == 0){
+		ld.lambdaMaxEst = pCheby->max_eigenvalue_estimate();
+		ld.lambdaMaxDiagNorm = diagNorm;
+		UG_DLOG(LIB_DISC_MULTIGRID, 4, "  init_smoother: eigenvalue estimate on lev "
+				<<lev<<": "<<ld.lambdaMaxEst<<"\n");
+	}
+
+	return true;
+}
+
 template <typename TDomain, typename TAlgebra>
 void AssembledMultiGridCycle<TDomain, TAlgebra>::
 init_base_solver()
@@ -1542,6 +1591,9 @@ init_level_memory(int baseLev, int topLev)
 				new MatrixOperator<matrix_type, vector_type>);
 
 		ld.PreSmoother = m_spPreSmootherPrototype->clone();
+		ld.lambdaMaxEst = 0.0;
+		ld.lambdaMaxDiagNorm = 0.0;
+		ld.lambdaMaxNumReuse = 0;
 		if(m_spPreSmootherPrototype == m_spPostSmootherPrototype)
 			ld.PostSmoother = ld.PreSmoother;
 		else
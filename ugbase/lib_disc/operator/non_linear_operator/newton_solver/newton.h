@@ -81,7 +81,7 @@ class NewtonSolver
 		             SmartPtr<ILineSearch<vector_type> > spLineSearch);
 
 	///	sets the linear solver
-		void set_linear_solver(SmartPtr<ILinearOperatorInverse<vector_type> > LinearSolver) {m_spLinearSolver = LinearSolver;}
+		void set_linear_solver(SmartPtr<ILinearOperatorInverse<vector_type> > LinearSolver) {m_spLinearSolver = LinearSolver; m_bJacobianValid = false;}
 
 	/// sets the convergence check
 		void set_convergence_check(SmartPtr<IConvergenceCheck<vector_type> > spConvCheck);
@@ -91,6 +91,33 @@ class NewtonSolver
 		void disable_line_search() {m_spLineSearch = SPNULL;}
 		SmartPtr<ILineSearch<vector_type> > line_search()	{return m_spLineSearch;}
 
+	///	sets the number of Newton steps the Jacobian may be reused (modified Newton)
+	/**	If set to a value > 0, the Jacobian and the linear solver (including its
+	 * preconditioner) are only reinitialized if the Jacobian has already been
+	 * reused maxReuse times or if the contraction rate of the last Newton step
+	 * exceeds the reuse rate. The Jacobian is also kept across calls of apply,
+	 * e.g. in subsequent time steps. Default is 0 (reassemble in every step).*/
+		void set_max_jacobian_reuse(int maxReuse) {m_maxJacobianReuse = maxReuse;}
+
+	///	sets the contraction rate that triggers reassembling of a reused Jacobian
+		void set_jacobian_reuse_rate(number rate) {m_jacobianReuseRate = rate;}
+
+	///	forces reassembling of the Jacobian in the next Newton step
+		void reset_jacobian() {m_bJacobianValid = false;}
+
+	///	enables Eisenstat-Walker forcing terms for the linear solver
+	/**	If enabled, the relative reduction of the linear solver is chosen in
+	 * every Newton step as
+	 * 	eta_k = gamma * (|F(u_k)| / |F(u_{k-1})|)^alpha,
+	 * safeguarded by gamma * eta_{k-1}^alpha and bounded by etaMax (choice 2
+	 * of Eisenstat and Walker, 1996). The convergence check of the linear
+	 * solver has to be a StdConvCheck. Its reduction is restored after apply.*/
+		void set_adaptive_forcing(bool bForcing) {m_bForcing = bForcing;}
+
+	///	sets the parameters of the Eisenstat-Walker forcing terms
+		void set_forcing_parameters(number etaMax, number gamma, number alpha)
+			{m_etaMax = etaMax; m_gamma = gamma; m_alpha = alpha;}
+
 	/// This operator inverts the Operator N: Y -> X
 		virtual bool init(SmartPtr<IOperator<vector_type> > N);
 
@@ -123,6 +150,7 @@ class NewtonSolver
 		int total_linsolver_steps() const;
 		double total_average_linear_steps() const;
 		int last_num_newton_steps() const	{return m_lastNumSteps;}
+		int num_jacobian_assemblies() const	{return m_numJacobianAssemblies;}
 	/// \}
 
 	/// resets average linear solver convergence
@@ -145,6 +173,9 @@ class NewtonSolver
 			{m_stepUpdate.clear();}
 
 	private:
+	///	returns the forcing term for the next linear solve
+		number forcing_term(number defect, number lastDefect, int step);
+
 	///	help functions for debug output
 	///	\{
 		void write_debug(const vector_type& vec, std::string filename);
@@ -179,6 +210,25 @@ class NewtonSolver
 		number m_lambda_reduce;
 	/// \}
 
+	/// Jacobian reuse (modified Newton)
+	/// \{
+		int m_maxJacobianReuse;
+		number m_jacobianReuseRate;
+		bool m_bJacobianValid;
+		int m_numJacobianReuse;
+		number m_lastRate;
+		int m_numJacobianAssemblies;
+	/// \}
+
+	/// Eisenstat-Walker forcing terms
+	/// \{
+		bool m_bForcing;
+		number m_etaMax;
+		number m_gamma;
+		number m_alpha;
+		number m_eta;
+	/// \}
+
 	///	call counter
 		int m_dgbCall;
 		int m_lastNumSteps;
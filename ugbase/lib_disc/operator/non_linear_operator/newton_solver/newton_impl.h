@@ -64,6 +64,17 @@ NewtonSolver(SmartPtr<ILinearOperatorInverse<vector_type> > LinearSolver,
 			m_N(NULL),
 			m_J(NULL),
 			m_spAss(NULL),
+			m_maxJacobianReuse(0),
+			m_jacobianReuseRate(0.5),
+			m_bJacobianValid(false),
+			m_numJacobianReuse(0),
+			m_lastRate(0.0),
+			m_numJacobianAssemblies(0),
+			m_bForcing(false),
+			m_etaMax(0.9),
+			m_gamma(0.9),
+			m_alpha(2.0),
+			m_eta(0.9),
 			m_dgbCall(0),
 			m_lastNumSteps(0)
 {};
@@ -77,6 +88,17 @@ NewtonSolver() :
 	m_N(NULL),
 	m_J(NULL),
 	m_spAss(NULL),
+	m_maxJacobianReuse(0),
+	m_jacobianReuseRate(0.5),
+	m_bJacobianValid(false),
+	m_numJacobianReuse(0),
+	m_lastRate(0.0),
+	m_numJacobianAssemblies(0),
+	m_bForcing(false),
+	m_etaMax(0.9),
+	m_gamma(0.9),
+	m_alpha(2.0),
+	m_eta(0.9),
 	m_dgbCall(0),
 	m_lastNumSteps(0)
 {};
@@ -90,6 +112,17 @@ NewtonSolver(SmartPtr<IOperator<vector_type> > N) :
 	m_N(NULL),
 	m_J(NULL),
 	m_spAss(NULL),
+	m_maxJacobianReuse(0),
+	m_jacobianReuseRate(0.5),
+	m_bJacobianValid(false),
+	m_numJacobianReuse(0),
+	m_lastRate(0.0),
+	m_numJacobianAssemblies(0),
+	m_bForcing(false),
+	m_etaMax(0.9),
+	m_gamma(0.9),
+	m_alpha(2.0),
+	m_eta(0.9),
 	m_dgbCall(0),
 	m_lastNumSteps(0)
 {
@@ -105,6 +138,17 @@ NewtonSolver(SmartPtr<IAssemble<TAlgebra> > spAss) :
 	m_N(NULL),
 	m_J(NULL),
 	m_spAss(NULL),
+	m_maxJacobianReuse(0),
+	m_jacobianReuseRate(0.5),
+	m_bJacobianValid(false),
+	m_numJacobianReuse(0),
+	m_lastRate(0.0),
+	m_numJacobianAssemblies(0),
+	m_bForcing(false),
+	m_etaMax(0.9),
+	m_gamma(0.9),
+	m_alpha(2.0),
+	m_eta(0.9),
 	m_dgbCall(0),
 	m_lastNumSteps(0)
 {
@@ -131,6 +175,7 @@ bool NewtonSolver<TAlgebra>::init(SmartPtr<IOperator<vector_type> > N)
 		UG_THROW("NewtonSolver: currently only works for AssembledDiscreteOperator.");
 
 	m_spAss = m_N->discretization();
+	m_bJacobianValid = false;
 	return true;
 }
 
@@ -155,9 +200,33 @@ bool NewtonSolver<TAlgebra>::apply(vector_type& u)
 //	Jacobian
 	if(m_J.invalid() || m_J->discretization() != m_spAss) {
 		m_J = make_sp(new AssembledLinearOperator<TAlgebra>(m_spAss));
+		m_bJacobianValid = false;
 	}
+	if(m_J->level() != m_N->level() || m_J->get_matrix().num_rows() != u.size())
+		m_bJacobianValid = false;
 	m_J->set_level(m_N->level());
 
+//	linear convergence check controlled by the forcing terms
+	SmartPtr<StdConvCheck<vector_type> > spLinConvCheck;
+	number linReduction = 0.0;
+	if(m_bForcing){
+		spLinConvCheck = m_spLinearSolver->convergence_check().template cast_dynamic<StdConvCheck<vector_type> >();
+		if(spLinConvCheck.invalid())
+			UG_THROW("NewtonSolver::apply: Adaptive forcing requires a StdConvCheck for the linear solver.");
+		linReduction = spLinConvCheck->get_reduction();
+	}
+
+//	the forcing terms overwrite the reduction of the linear solver, which is
+//	restored on every exit (including errors) of this method
+	struct ReductionGuard
+	{
+		ReductionGuard(SmartPtr<StdConvCheck<vector_type> > spCheck, number reduction)
+			: m_spCheck(spCheck), m_reduction(reduction) {}
+		~ReductionGuard() {if(m_spCheck.valid()) m_spCheck->set_reduction(m_reduction);}
+		SmartPtr<StdConvCheck<vector_type> > m_spCheck;
+		number m_reduction;
+	} reductionGuard(spLinConvCheck, linReduction);
+
 //	create tmp vectors
 	SmartPtr<vector_type> spD = u.clone_without_values();
 	SmartPtr<vector_type> spC = u.clone_without_values();
@@ -198,6 +267,7 @@ bool NewtonSolver<TAlgebra>::apply(vector_type& u)
 
 // 	start convergence check
 	m_spConvCheck->start(*spD);
+	number lastDefect = m_spConvCheck->defect();
 
 	for(size_t i = 0; i < m_stepUpdate.size(); ++i)
 		m_stepUpdate[i]->update();
@@ -215,31 +285,52 @@ bool NewtonSolver<TAlgebra>::apply(vector_type& u)
 		for(size_t i = 0; i < m_innerStepUpdate.size(); ++i)
 			m_innerStepUpdate[i]->update();
 
-	// 	Compute Jacobian
-		try{
-		NEWTON_PROFILE_BEGIN(NewtonComputeJacobian);
-		m_J->init(u);
-		NEWTON_PROFILE_END();
-		}UG_CATCH_THROW("NewtonSolver::apply: Initialization of Jacobian failed.");
-
-	//	Write Jacobian for debug and prepare the section for the lin. solver
-		if (this->debug_writer_valid())
+	//	in modified Newton, the Jacobian and the initialized linear solver of
+	//	a previous step are reused as long as the iteration contracts well
+		if(m_bJacobianValid && m_numJacobianReuse < m_maxJacobianReuse
+			&& m_lastRate <= m_jacobianReuseRate)
 		{
-			write_debug(m_J->get_matrix(), std::string("NEWTON_Jacobian") + debug_name_ext);
-			this->enter_debug_writer_section(std::string("NEWTON_LinSolver") + debug_name_ext);
-		}
+			++m_numJacobianReuse;
 
-	// 	Init Jacobi Inverse
-		try{
-		NEWTON_PROFILE_BEGIN(NewtonPrepareLinSolver);
-		if(!m_spLinearSolver->init(m_J, u))
+			if (this->debug_writer_valid())
+				this->enter_debug_writer_section(std::string("NEWTON_LinSolver") + debug_name_ext);
+		}
+		else
 		{
-			UG_LOG("ERROR in 'NewtonSolver::apply': Cannot init Inverse Linear "
-					"Operator for Jacobi-Operator.\n");
-			return false;
+		// 	Compute Jacobian
+			try{
+			NEWTON_PROFILE_BEGIN(NewtonComputeJacobian);
+			m_J->init(u);
+			NEWTON_PROFILE_END();
+			}UG_CATCH_THROW("NewtonSolver::apply: Initialization of Jacobian failed.");
+
+		//	Write Jacobian for debug and prepare the section for the lin. solver
+			if (this->debug_writer_valid())
+			{
+				write_debug(m_J->get_matrix(), std::string("NEWTON_Jacobian") + debug_name_ext);
+				this->enter_debug_writer_section(std::string("NEWTON_LinSolver") + debug_name_ext);
+			}
+
+		// 	Init Jacobi Inverse
+			try{
+			NEWTON_PROFILE_BEGIN(NewtonPrepareLinSolver);
+			if(!m_spLinearSolver->init(m_J, u))
+			{
+				UG_LOG("ERROR in 'NewtonSolver::apply': Cannot init Inverse Linear "
+						"Operator for Jacobi-Operator.\n");
+				return false;
+			}
+			NEWTON_PROFILE_END();
+			}UG_CATCH_THROW("NewtonSolver::apply: Initialization of Linear Solver failed.");
+
+			m_bJacobianValid = (m_maxJacobianReuse > 0);
+			m_numJacobianReuse = 0;
+			++m_numJacobianAssemblies;
 		}
-		NEWTON_PROFILE_END();
-		}UG_CATCH_THROW("NewtonSolver::apply: Initialization of Linear Solver failed.");
+
+	//	set the relative reduction of the linear solver
+		if(m_bForcing)
+			spLinConvCheck->set_reduction(forcing_term(m_spConvCheck->defect(), lastDefect, loopCnt));
 
 	// 	Solve Linearized System
 		try{
@@ -297,7 +388,9 @@ bool NewtonSolver<TAlgebra>::apply(vector_type& u)
 		loopCnt++;
 
 	// 	check convergence
+		lastDefect = m_spConvCheck->defect();
 		m_spConvCheck->update(*spD);
+		m_lastRate = m_spConvCheck->rate();
 		if(loopCnt-1 >= (int)m_vNonLinSolverRates.size()) m_vNonLinSolverRates.resize(loopCnt, 0);
 		m_vNonLinSolverRates[loopCnt-1] += m_spConvCheck->rate();
 
@@ -317,6 +410,24 @@ bool NewtonSolver<TAlgebra>::apply(vector_type& u)
 	return m_spConvCheck->post();
 }
 
+template <typename TAlgebra>
+number NewtonSolver<TAlgebra>::forcing_term(number defect, number lastDefect, int step)
+{
+	if(step == 0 || lastDefect == 0.0){
+		m_eta = m_etaMax;
+		return m_eta;
+	}
+
+//	choice 2 of Eisenstat and Walker with safeguard against too small terms
+	number eta = m_gamma * std::pow(defect / lastDefect, m_alpha);
+	const number etaSafe = m_gamma * std::pow(m_eta, m_alpha);
+	if(etaSafe > 0.1)
+		eta = std::max(eta, etaSafe);
+
+	m_eta = std::min(eta, m_etaMax);
+	return m_eta;
+}
+
 template <typename TAlgebra>
 void NewtonSolver<TAlgebra>::print_average_convergence() const
 {
@@ -403,6 +514,7 @@ void NewtonSolver<TAlgebra>::clear_average_convergence()
 	m_vNonLinSolverRates.clear();
 	m_vLinSolverCalls.clear();
 	m_vTotalLinSolverSteps.clear();
+	m_numJacobianAssemblies = 0;
 }
 
 template <typename TAlgebra>
@@ -441,6 +553,10 @@ std::string NewtonSolver<TAlgebra>::config_string() const
 	ss << " LineSearch: ";
 	if(m_spLineSearch.valid())		ss << ConfigShift(m_spLineSearch->config_string()) << "\n";
 	else							ss << " not set.\n";
+	if(m_maxJacobianReuse > 0)
+		ss << " Jacobian reuse: max " << m_maxJacobianReuse << " steps, reassemble at rate > " << m_jacobianReuseRate << "\n";
+	if(m_bForcing)
+		ss << " Adaptive forcing: eta_max = " << m_etaMax << ", gamma = " << m_gamma << ", alpha = " << m_alpha << "\n";
 	return ss.str();
 }
 
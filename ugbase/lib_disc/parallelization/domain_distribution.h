@@ -86,6 +86,23 @@ static bool DistributeDomain(TDomain& domainOut,
 							 PartitionMap& partitionMap,
 							 bool createVerticalInterfaces);
 
+///	writes the parts of a domain into one pre-partitioned grid file
+/**	The file can be loaded with LoadPartitionedDomain, where each process reads
+ * its own part. Partitions are mapped to parts through the target processes
+ * of the partition map, if specified. See SavePartitionedGrid.
+ *
+ * In a parallel run, the method has to be called by all processes. The domain
+ * has to be held by a single process, which writes the file.*/
+template <typename TDomain>
+static void SavePartitionedDomain(TDomain& domain, PartitionMap& partitionMap,
+								  const char* filename);
+
+///	loads the part of a pre-partitioned grid file, which belongs to the local process
+/**	The horizontal interfaces are reconstructed from global ids, so that no
+ * process has to hold the whole grid. See LoadPartitionedGrid.*/
+template <typename TDomain>
+static void LoadPartitionedDomain(TDomain& domain, const char* filename);
+
 }//	end of namespace
 
 ////////////////////////////////
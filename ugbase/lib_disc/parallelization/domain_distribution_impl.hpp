@@ -37,6 +37,8 @@
 #include "lib_grid/algorithms/attachment_util.h"
 #include "lib_grid/parallelization/deprecated/load_balancing.h"
 #include "common/serialization.h"
+#include "common/util/file_util.h"
+#include "lib_grid/file_io/file_io_partitioned.h"
 
 #ifdef UG_PARALLEL
 	#include "pcl/pcl.h"
@@ -359,6 +361,34 @@ PartitionDistributedDomain_LevelBased(TDomain& domain, PartitionMap& partitionMa
 }
 
 
+///	adds serializers for the vertex positions and the subset handlers of a domain
+template <typename TDomain>
+static void AddDomainSerializers(GridDataSerializationHandler& serializer,
+								 TDomain& domain)
+{
+	typedef typename TDomain::position_attachment_type	position_attachment_type;
+
+	SPVertexDataSerializer posSerializer =
+			GeomObjAttachmentSerializer<Vertex, position_attachment_type>::
+								create(*domain.grid(), domain.position_attachment());
+
+	SPGridDataSerializer shSerializer = SubsetHandlerSerializer::
+											create(*domain.subset_handler());
+
+	serializer.add(posSerializer);
+	serializer.add(shSerializer);
+
+	std::vector<std::string> additionalSHNames = domain.additional_subset_handler_names();
+	for(size_t i = 0; i < additionalSHNames.size(); ++i){
+		SmartPtr<ISubsetHandler> sh = domain.additional_subset_handler(additionalSHNames[i]);
+		if(sh.valid()){
+			SPGridDataSerializer shSerializer = SubsetHandlerSerializer::create(*sh);
+			serializer.add(shSerializer);
+		}
+	}
+}
+
+
 template <typename TDomain>
 static bool DistributeDomain(TDomain& domainOut,
 							 PartitionMap& partitionMap,
@@ -378,8 +408,6 @@ static bool DistributeDomain(TDomain& domainOut,
 
 #ifdef UG_PARALLEL
 
-	typedef typename TDomain::position_attachment_type	position_attachment_type;
-	
 //	used to check whether all processes are correctly prepared for redistribution
 	//bool performDistribution = true;
 
@@ -409,25 +437,8 @@ static bool DistributeDomain(TDomain& domainOut,
 */
 
 //	data serialization
-	SPVertexDataSerializer posSerializer =
-			GeomObjAttachmentSerializer<Vertex, position_attachment_type>::
-								create(*pGrid, domainOut.position_attachment());
-
-	SPGridDataSerializer shSerializer = SubsetHandlerSerializer::
-											create(*domainOut.subset_handler());
-
 	GridDataSerializationHandler serializer;
-	serializer.add(posSerializer);
-	serializer.add(shSerializer);
-
-	std::vector<std::string> additionalSHNames = domainOut.additional_subset_handler_names();
-	for(size_t i = 0; i < additionalSHNames.size(); ++i){
-		SmartPtr<ISubsetHandler> sh = domainOut.additional_subset_handler(additionalSHNames[i]);
-		if(sh.valid()){
-			SPGridDataSerializer shSerializer = SubsetHandlerSerializer::create(*sh);
-			serializer.add(shSerializer);
-		}
-	}
+	AddDomainSerializers(serializer, domainOut);
 
 //	now call redistribution
 	DistributeGrid(*pGrid, partitionHandler, serializer, createVerticalInterfaces,
@@ -440,6 +451,57 @@ static bool DistributeDomain(TDomain& domainOut,
 	return true;
 }
 
+
+template <typename TDomain>
+static void SavePartitionedDomain(TDomain& domain, PartitionMap& partitionMap,
+								  const char* filename)
+{
+	PROFILE_FUNC_GROUP("parallelization");
+	SmartPtr<MultiGrid> pMG = domain.grid();
+
+#ifdef UG_PARALLEL
+//	only the process which holds the grid writes the file
+	if(pcl::NumProcs() > 1){
+		pcl::ProcessCommunicator procComm;
+		const int hasGrid = (pMG->num<Vertex>() > 0) ? 1 : 0;
+		const int numGridProcs = procComm.allreduce(hasGrid, PCL_RO_SUM);
+		UG_COND_THROW(numGridProcs == 0, "SavePartitionedDomain: The grid is empty.");
+		UG_COND_THROW(numGridProcs > 1, "SavePartitionedDomain: The domain is "
+					  "distributed onto " << numGridProcs << " processes. Only a "
+					  "domain held by a single process can be saved.");
+		if(!hasGrid)
+			return;
+	}
+#endif
+
+	if(partitionMap.get_partition_handler()->grid() != pMG.get())
+		partitionMap.assign_grid(*pMG);
+
+	GridDataSerializationHandler serializer;
+	AddDomainSerializers(serializer, domain);
+
+	std::vector<int>* processMap = NULL;
+	if(partitionMap.num_target_procs() > 0)
+		processMap = &partitionMap.get_target_proc_vec();
+
+	SavePartitionedGrid(*pMG, *partitionMap.get_partition_handler(), serializer,
+						filename, processMap);
+}
+
+
+template <typename TDomain>
+static void LoadPartitionedDomain(TDomain& domain, const char* filename)
+{
+	PROFILE_FUNC_GROUP("parallelization");
+	std::string tfile = FindFileInStandardPaths(filename);
+	UG_COND_THROW(tfile.empty(), "LoadPartitionedDomain: Could not find " << filename);
+
+	GridDataSerializationHandler serializer;
+	AddDomainSerializers(serializer, domain);
+
+	LoadPartitionedGrid(*domain.grid(), serializer, tfile.c_str());
+}
+
 }//	end of namespace
 
 #endif
@@ -36,6 +36,7 @@
 #include "lib_grid/tools/bool_marker.h"
 #include "lib_grid/tools/selector_grid.h"
 #include "lib_disc/spatial_disc/local_to_global/local_to_global_mapper.h"
+#include "lib_disc/spatial_disc/local_to_global/fixed_pattern_mapper.h"
 #include "lib_disc/spatial_disc/elem_disc/elem_disc_interface.h"
 
 namespace ug{
@@ -115,7 +116,8 @@ class AssemblingTuner
 		m_bSingleAssIndex(false), m_SingleAssIndex(0),
 		m_bForceRegGrid(false), m_bModifySolutionImplemented(false),
 		m_ConstraintTypesEnabled(CT_ALL), m_ElemTypesEnabled(EDT_ALL),
-		m_bMatrixIsConst(false), m_bClearOnResize(true)
+		m_bMatrixIsConst(false), m_bClearOnResize(true),
+		m_numThreads(1)
 		{
 			m_pMapper = &m_pMapperCommon;
 		}
@@ -144,6 +146,10 @@ class AssemblingTuner
 		void modify_LocalSol(LocalVector& vecMod, const LocalVector& lvec,
 		                         ConstSmartPtr<DoFDistribution> dd) const
 		{ m_pMapper->modify_LocalSol(vecMod, lvec, dd);}
+
+	///	returns if the default local to global mapping is used
+		bool default_mapping_used() const {return m_pMapper == &m_pMapperCommon;}
+
 	///	sets a marker to exclude elements from assembling
 	/**
 	 * This methods sets a marker. Only elements that are marked will be
@@ -229,6 +235,9 @@ class AssemblingTuner
 	///	returns if only selected elements used for assembling
 		bool selected_elements_used() const {return (m_pSelector != NULL);}
 
+	///	returns if elements are skipped via a bool marker
+		bool marked_elements_used() const {return (m_pBoolMarker != NULL);}
+
 	///	returns if element is to be used in assembling
 		template <typename TElem>
 		bool element_used(TElem* elem) const;
@@ -258,10 +267,60 @@ class AssemblingTuner
 	 */
 		bool matrix_is_const() const {return m_bMatrixIsConst;}
 
+	///	sets the number of threads used in the element loops
+	/**
+	 * If ug4 is compiled with OPENMP, the element loops of the matrix and
+	 * defect assembling routines (stationary and instationary) are executed
+	 * by the given number of threads. To this end, the elements are colored
+	 * such that no two elements of the same color share an algebra index and
+	 * all elements of one color are assembled concurrently. This is only done
+	 * if all element discretizations of a subset declare that their
+	 * element-wise assembling is thread-safe and all imported user data can
+	 * be evaluated concurrently; otherwise, the usual serial loop is used.
+	 *
+	 * \param[in]	numThreads	number of threads (1 disables threading)
+	 */
+		void set_num_threads(int numThreads);
+
+	///	returns the number of threads used in the element loops
+		int num_threads() const {return m_numThreads;}
+
+	///	returns if thread-parallel element loops may be used
+		bool thread_parallel_assembling_enabled() const
+		{
+			return m_numThreads > 1 && default_mapping_used()
+					&& !single_index_assembling_enabled();
+		}
+
+	///	enables the reuse of the matrix pattern in repeated assemblings
+	/**
+	 * If enabled, the sparsity pattern of an assembled matrix is finalized
+	 * when the same matrix is assembled again. The positions of all local
+	 * entries in the matrix are computed once and the following assemblings
+	 * add the local matrices directly to these positions. If the pattern
+	 * changes (e.g. after grid refinement), it is recorded again.
+	 *
+	 * \param[in]	bReuse	flag if pattern is reused
+	 */
+		void set_reuse_matrix_pattern(bool bReuse)
+		{
+			m_fixedPatternMapper.clear();
+			if(bReuse)
+				m_pMapper = &m_fixedPatternMapper;
+			else
+				m_pMapper = &m_pMapperCommon;
+		}
+
+	///	returns if the matrix pattern is reused
+		bool reuse_matrix_pattern() const {return m_pMapper == &m_fixedPatternMapper;}
+
 	protected:
 	///	default LocalToGlobalMapper
 		LocalToGlobalMapper<TAlgebra> m_pMapperCommon;
 
+	///	LocalToGlobalMapper reusing the matrix pattern
+		mutable FixedPatternLocalToGlobalMapper<TAlgebra> m_fixedPatternMapper;
+
 	///	LocalToGlobalMapper
 		ILocalToGlobalMapper<TAlgebra>* m_pMapper;
 
@@ -293,6 +352,9 @@ class AssemblingTuner
 
 	/// disables clearing of vector/matrix on resize
 		bool m_bClearOnResize;
+
+	///	number of threads used in element loops
+		int m_numThreads;
 };
 
 } // end namespace ug
@@ -34,6 +34,7 @@
 #define __H__UG__LIB_DISC__SPATIAL_DISC__ASS_TUNER_IMPL__
 
 #include "ass_tuner.h"
+#include "common/util/per_thread.h"
 
 namespace ug{
 
@@ -62,11 +63,39 @@ void AssemblingTuner<TAlgebra>::resize(ConstSmartPtr<DoFDistribution> dd,
 	}
 	else{
 		const size_t numIndex = dd->num_indices();
+		if (reuse_matrix_pattern()
+			&& m_fixedPatternMapper.prepare_matrix(mat, numIndex))
+		{
+		//	keep the finalized pattern
+			if (m_bClearOnResize) mat.clear_values();
+			return;
+		}
 		if (m_bClearOnResize) mat.resize_and_clear(numIndex, numIndex);
 		else mat.resize_and_keep_values(numIndex, numIndex);
 	}
 }
 
+template <typename TAlgebra>
+void AssemblingTuner<TAlgebra>::set_num_threads(int numThreads)
+{
+	if(numThreads < 1)
+		UG_THROW("AssemblingTuner::set_num_threads: Number of threads must be"
+				" positive, but "<<numThreads<<" passed.");
+
+#ifndef UG_OPENMP
+	if(numThreads > 1)
+		UG_THROW("AssemblingTuner::set_num_threads: Thread-parallel assembling"
+				" requires ug4 to be compiled with OPENMP=ON.");
+#endif
+
+	if(numThreads > PER_THREAD_MAX_THREADS)
+		UG_THROW("AssemblingTuner::set_num_threads: At most "
+				<<PER_THREAD_MAX_THREADS<<" threads supported, but "
+				<<numThreads<<" passed.");
+
+	m_numThreads = numThreads;
+}
+
 template <typename TAlgebra>
 template <typename TElem>
 bool AssemblingTuner<TAlgebra>::element_used(TElem* elem) const
@@ -46,6 +46,10 @@ namespace ug{
  *
  * In addition, the object can be shared between unrelated code parts, if the
  * same object is intended to be used, but no passing is possible or wanted.
+ *
+ * If compiled with OpenMP, each thread is provided its own instances, such
+ * that concurrent element loops do not share the geometry of the current
+ * element. (The instances of the other than the master thread are not freed.)
  */
 template <typename TGeom>
 class GeomProvider
@@ -93,13 +97,25 @@ class GeomProvider
 		typedef std::map<LFEIDandQuadOrder, TGeom*> MapType;
 		static MapType m_mLFEIDandOrder;
 
+		/// returns the instances (of the calling thread)
+		static MapType& geoms() {
+#ifdef UG_OPENMP
+			static MapType* s_pMap = NULL;
+			#pragma omp threadprivate(s_pMap)
+			if(s_pMap == NULL) s_pMap = new MapType;
+			return *s_pMap;
+#else
+			return m_mLFEIDandOrder;
+#endif
+		}
+
 		/// returns class based on identifier
 		static TGeom& get_class(const LFEID lfeID, const int quadOrder) {
 
 			LFEIDandQuadOrder key(lfeID, quadOrder);
 
 			typedef std::pair<typename MapType::iterator,bool> ret_type;
-			ret_type ret = m_mLFEIDandOrder.insert(std::pair<LFEIDandQuadOrder,TGeom*>(key,NULL));
+			ret_type ret = geoms().insert(std::pair<LFEIDandQuadOrder,TGeom*>(key,NULL));
 
 			// newly inserted, need construction of data
 			if(ret.second == true){
@@ -117,11 +133,12 @@ class GeomProvider
 		/// clears all instances
 		static void clear_geoms(){
 			typedef typename std::map<LFEIDandQuadOrder, TGeom*>::iterator MapIter;
-			for(MapIter iter = m_mLFEIDandOrder.begin(); iter != m_mLFEIDandOrder.end(); ++iter)
+			MapType& mGeoms = geoms();
+			for(MapIter iter = mGeoms.begin(); iter != mGeoms.end(); ++iter)
 				if(iter->second)
 					delete iter->second;
 
-			m_mLFEIDandOrder.clear();
+			mGeoms.clear();
 		}
 
 	public:
@@ -139,7 +156,14 @@ class GeomProvider
 
 		///	returns a singleton based on the identifier
 		static inline TGeom& get(){
+#ifdef UG_OPENMP
+			static TGeom* s_pInst = NULL;
+			#pragma omp threadprivate(s_pInst)
+			if(s_pInst == NULL) s_pInst = new TGeom;
+			TGeom& inst = *s_pInst;
+#else
 			static TGeom inst;
+#endif
 			if(!staticLocalData)
 				UG_THROW("GeomProvider: accessing geometry without keys, but"
 						 " geometry may change local data. Use access by keys instead.");
@@ -104,7 +104,8 @@ class DomainDiscretizationBase
 	///	default Constructor
 		DomainDiscretizationBase(SmartPtr<approx_space_type> pApproxSpace) :
 			m_bErrorCalculated(false),
-			m_spApproxSpace(pApproxSpace), m_spAssTuner(new AssemblingTuner<TAlgebra>)
+			m_spApproxSpace(pApproxSpace), m_spAssTuner(new AssemblingTuner<TAlgebra>),
+			m_dirichletMaskConstraintTypes(0), m_bDirichletDoFs(false)
 		{};
 
 	/// virtual destructor
@@ -124,6 +125,37 @@ class DomainDiscretizationBase
 		virtual void assemble_defect(vector_type& d, const vector_type& u, const GridLevel& gl)
 		{assemble_defect(d, u, dd(gl));}
 
+	///	applies the Jacobian matrix-free using the local Jacobians (stationary)
+	/**
+	 * Computes f = J(u)*x element by element, i.e. the local Jacobians are
+	 * applied on the fly and no global matrix is assembled. Rows of Dirichlet
+	 * dofs are identity rows as in assemble_jacobian. Other constraints (e.g.
+	 * hanging nodes) are not supported.
+	 */
+		virtual void apply_jacobian(vector_type& f, const vector_type& x,
+		                            const vector_type& u, ConstSmartPtr<DoFDistribution> dd);
+		virtual void apply_jacobian(vector_type& f, const vector_type& x,
+		                            const vector_type& u, const GridLevel& gl)
+		{apply_jacobian(f, x, u, dd(gl));}
+
+	///	assembles the diagonal of the Jacobian without assembling a matrix (stationary)
+		virtual void assemble_jacobian_diagonal(vector_type& diag, const vector_type& u,
+		                                        ConstSmartPtr<DoFDistribution> dd);
+		virtual void assemble_jacobian_diagonal(vector_type& diag, const vector_type& u,
+		                                        const GridLevel& gl)
+		{assemble_jacobian_diagonal(diag, u, dd(gl));}
+
+	///	returns a mask that is zero for dirichlet dofs and one for all others
+	/**
+	 * The mask is cached and only recomputed if the dof distribution (or its
+	 * revision), the enabled constraint types or the registered constraints
+	 * change. Note, that subsets added to a constraint after its registration
+	 * are not detected. SPNULL is returned if there are no dirichlet dofs.
+	 */
+		virtual ConstSmartPtr<vector_type> dirichlet_mask(ConstSmartPtr<DoFDistribution> dd);
+		virtual ConstSmartPtr<vector_type> dirichlet_mask(const GridLevel& gl)
+		{return dirichlet_mask(dd(gl));}
+
 	/// \copydoc IAssemble::assemble_linear()
 		virtual void assemble_linear(matrix_type& A, vector_type& b, ConstSmartPtr<DoFDistribution> dd);
 		virtual void assemble_linear(matrix_type& mat, vector_type& rhs, const GridLevel& gl)
@@ -433,6 +465,7 @@ public:
 
 		//	add constraint
 			m_vConstraint.push_back(pp);
+			m_dirichletMaskRevision.invalidate();
 		}
 
 	/// removes a constraint from the assembling process
@@ -451,6 +484,7 @@ public:
 				{
 					// remove constraint
 					m_vConstraint.erase(m_vConstraint.begin()+i);
+					m_dirichletMaskRevision.invalidate();
 					return;
 				}
 			}
@@ -520,6 +554,19 @@ public:
 	///	this object provides tools to adapt the assemble routine
 		SmartPtr<AssemblingTuner<TAlgebra> > m_spAssTuner;
 	
+	///	throws if constraints other than dirichlet ones are enabled (matrix-free)
+		void check_matrix_free_constraints() const;
+
+	///	cached dirichlet mask
+		SmartPtr<vector_type> m_spDirichletMask;
+
+	///	dof distribution revision and constraint types the mask is computed for
+		RevisionCounter m_dirichletMaskRevision;
+		int m_dirichletMaskConstraintTypes;
+
+	///	flag if the cached mask contains dirichlet dofs
+		bool m_bDirichletDoFs;
+
 	private:
 	//---- Auxiliary function templates for the assembling ----//
 	//	These functions call the corresponding functions from the global assembler for a composed list of elements:
@@ -549,6 +596,19 @@ public:
 									vector_type& d,
 									const vector_type& u);
 	template <typename TElem>
+	void AssembleJacobianAction(	const std::vector<IElemDisc<domain_type>*>& vElemDisc,
+									ConstSmartPtr<DoFDistribution> dd,
+									int si, bool bNonRegularGrid,
+									vector_type& f,
+									const vector_type& x,
+									const vector_type& u);
+	template <typename TElem>
+	void AssembleJacobianDiagonal(	const std::vector<IElemDisc<domain_type>*>& vElemDisc,
+									ConstSmartPtr<DoFDistribution> dd,
+									int si, bool bNonRegularGrid,
+									vector_type& diag,
+									const vector_type& u);
+	template <typename TElem>
 	void AssembleLinear( 			const std::vector<IElemDisc<domain_type>*>& vElemDisc,
 									ConstSmartPtr<DoFDistribution> dd,
 									int si, bool bNonRegularGrid,
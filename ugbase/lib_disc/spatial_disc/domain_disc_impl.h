@@ -627,6 +627,356 @@ AssembleJacobian(	const std::vector<IElemDisc<domain_type>*>& vElemDisc,
 	}
 }
 
+///////////////////////////////////////////////////////////////////////////////
+// Matrix-free Jacobian (stationary)
+///////////////////////////////////////////////////////////////////////////////
+template <typename TDomain, typename TAlgebra, typename TGlobAssembler>
+ConstSmartPtr<typename TAlgebra::vector_type>
+DomainDiscretizationBase<TDomain, TAlgebra, TGlobAssembler>::
+dirichlet_mask(ConstSmartPtr<DoFDistribution> dd)
+{
+//	reuse the mask as long as dofs and constraints are unchanged
+	if(m_dirichletMaskRevision != dd->revision()
+		|| m_dirichletMaskConstraintTypes != m_spAssTuner->enabled_constraints())
+	{
+		PROFILE_FUNC_GROUP("discretization");
+		update_constraints();
+
+		m_spDirichletMask = make_sp(new vector_type);
+		m_spAssTuner->resize(dd, *m_spDirichletMask);
+		m_spDirichletMask->set(1.0);
+		m_bDirichletDoFs = false;
+
+	//	dirichlet dofs are set to zero in the mask
+		if(m_spAssTuner->constraint_type_enabled(CT_DIRICHLET))
+			for(size_t i = 0; i < m_vConstraint.size(); ++i)
+				if(m_vConstraint[i]->type() & CT_DIRICHLET)
+				{
+					m_vConstraint[i]->adjust_correction(*m_spDirichletMask, dd, CT_DIRICHLET);
+					m_bDirichletDoFs = true;
+				}
+
+		m_dirichletMaskRevision = dd->revision();
+		m_dirichletMaskConstraintTypes = m_spAssTuner->enabled_constraints();
+	}
+
+	if(!m_bDirichletDoFs) return SPNULL;
+	return m_spDirichletMask;
+}
+
+template <typename TDomain, typename TAlgebra, typename TGlobAssembler>
+void DomainDiscretizationBase<TDomain, TAlgebra, TGlobAssembler>::
+check_matrix_free_constraints() const
+{
+	for(size_t i = 0; i < m_vConstraint.size(); ++i)
+		if(m_spAssTuner->constraint_type_enabled(m_vConstraint[i]->type())
+			&& m_vConstraint[i]->type() != CT_DIRICHLET)
+			UG_THROW("DomainDiscretization: Matrix-free application of "
+					"the Jacobian only supports Dirichlet constraints.");
+}
+
+template <typename TDomain, typename TAlgebra, typename TGlobAssembler>
+void DomainDiscretizationBase<TDomain, TAlgebra, TGlobAssembler>::
+apply_jacobian(vector_type& f,
+               const vector_type& x,
+               const vector_type& u,
+               ConstSmartPtr<DoFDistribution> dd)
+{
+	PROFILE_FUNC_GROUP("discretization");
+//	update the elem discs
+	update_disc_items();
+	check_matrix_free_constraints();
+	prep_assemble_loop(m_vElemDisc);
+
+//	reset vector to zero and resize
+	m_spAssTuner->resize(dd, f);
+	f.set(0.0);
+
+//	Union of Subsets
+	SubsetGroup unionSubsets;
+	std::vector<SubsetGroup> vSSGrp;
+
+//	pre process -  modifies the solution, used for computing the defect
+	const vector_type* pModifyU = &u;
+	SmartPtr<vector_type> pModifyMemory;
+	if( m_spAssTuner->modify_solution_enabled() ){
+		pModifyMemory = u.clone();
+		pModifyU = pModifyMemory.get();
+		try{
+		for(int type = 1; type < CT_ALL; type = type << 1){
+			if(!(m_spAssTuner->constraint_type_enabled(type))) continue;
+			for(size_t i = 0; i < m_vConstraint.size(); ++i)
+				if(m_vConstraint[i]->type() & type)
+					m_vConstraint[i]->modify_solution(*pModifyMemory, u, dd, type);
+		}
+		} UG_CATCH_THROW("Cannot modify solution.");
+	}
+
+//	create list of all subsets
+	try{
+		CreateSubsetGroups(vSSGrp, unionSubsets, m_vElemDisc, dd->subset_handler());
+	}UG_CATCH_THROW("'DomainDiscretization': Can not create Subset Groups and Union.");
+
+//	loop subsets
+	for(size_t i = 0; i < unionSubsets.size(); ++i)
+	{
+	//	get subset
+		const int si = unionSubsets[i];
+
+	//	get dimension of the subset
+		const int dim = DimensionOfSubset(*dd->subset_handler(), si);
+
+	//	request if subset is regular grid
+		bool bNonRegularGrid = !unionSubsets.regular_grid(i);
+
+	//	overrule by regular grid if required
+		if(m_spAssTuner->regular_grid_forced()) bNonRegularGrid = false;
+
+	//	Elem Disc on the subset
+		std::vector<IElemDisc<TDomain>*> vSubsetElemDisc;
+
+	//	get all element discretizations that work on the subset
+		GetElemDiscOnSubset(vSubsetElemDisc, m_vElemDisc, vSSGrp, si);
+
+	//	assemble on suitable elements
+		try
+		{
+		switch(dim)
+		{
+		case 1:
+			this->template AssembleJacobianAction<RegularEdge>
+				(vSubsetElemDisc, dd, si, bNonRegularGrid, f, x, *pModifyU);
+			break;
+		case 2:
+			this->template AssembleJacobianAction<Triangle>
+				(vSubsetElemDisc, dd, si, bNonRegularGrid, f, x, *pModifyU);
+			this->template AssembleJacobianAction<Quadrilateral>
+				(vSubsetElemDisc, dd, si, bNonRegularGrid, f, x, *pModifyU);
+			break;
+		case 3:
+			this->template AssembleJacobianAction<Tetrahedron>
+				(vSubsetElemDisc, dd, si, bNonRegularGrid, f, x, *pModifyU);
+			this->template AssembleJacobianAction<Pyramid>
+				(vSubsetElemDisc, dd, si, bNonRegularGrid, f, x, *pModifyU);
+			this->template AssembleJacobianAction<Prism>
+				(vSubsetElemDisc, dd, si, bNonRegularGrid, f, x, *pModifyU);
+			this->template AssembleJacobianAction<Hexahedron>
+				(vSubsetElemDisc, dd, si, bNonRegularGrid, f, x, *pModifyU);
+			this->template AssembleJacobianAction<Octahedron>
+				(vSubsetElemDisc, dd, si, bNonRegularGrid, f, x, *pModifyU);
+			break;
+		default:
+			UG_THROW("DomainDiscretization::apply_jacobian (stationary):"
+							"Dimension "<<dim<<"(subset="<<si<<") not supported");
+		}
+		}
+		UG_CATCH_THROW("DomainDiscretization::apply_jacobian (stationary):"
+						" Assembling of elements of Dimension " << dim << " in "
+						" subset "<<si<< " failed.");
+	}
+
+//	post process: rows of dirichlet dofs are identity rows
+	try{
+		ConstSmartPtr<vector_type> spMask = dirichlet_mask(dd);
+		if(spMask.valid())
+		{
+			for(size_t i = 0; i < f.size(); ++i)
+				for(size_t k = 0; k < (size_t)GetSize(f[i]); ++k)
+					if(BlockRef((*spMask)[i], k) == 0.0)
+						BlockRef(f[i], k) = BlockRef(x[i], k);
+		}
+		post_assemble_loop(m_vElemDisc);
+	}UG_CATCH_THROW("DomainDiscretization::apply_jacobian:"
+					" Cannot execute post process.");
+
+//	Remember parallel storage type
+#ifdef UG_PARALLEL
+	f.set_storage_type(PST_ADDITIVE);
+#endif
+}
+
+template <typename TDomain, typename TAlgebra, typename TGlobAssembler>
+template <typename TElem>
+void DomainDiscretizationBase<TDomain, TAlgebra, TGlobAssembler>::
+AssembleJacobianAction(	const std::vector<IElemDisc<domain_type>*>& vElemDisc,
+						ConstSmartPtr<DoFDistribution> dd,
+						int si, bool bNonRegularGrid,
+						vector_type& f,
+						const vector_type& x,
+						const vector_type& u)
+{
+	//	check if only some elements are selected
+	if(m_spAssTuner->selected_elements_used())
+	{
+		std::vector<TElem*> vElem;
+		m_spAssTuner->collect_selected_elements(vElem, dd, si);
+
+		//	assembling is carried out only over those elements
+		//	which are selected and in subset si
+		gass_type::template AssembleJacobianAction<TElem>
+			(vElemDisc, m_spApproxSpace->domain(), dd, vElem.begin(), vElem.end(), si,
+			 bNonRegularGrid, f, x, u, m_spAssTuner);
+	}
+	else
+	{
+		//	general case: assembling over all elements in subset si
+		gass_type::template AssembleJacobianAction<TElem>
+			(vElemDisc, m_spApproxSpace->domain(), dd,
+				dd->template begin<TElem>(si), dd->template end<TElem>(si), si,
+					bNonRegularGrid, f, x, u, m_spAssTuner);
+	}
+}
+
+template <typename TDomain, typename TAlgebra, typename TGlobAssembler>
+void DomainDiscretizationBase<TDomain, TAlgebra, TGlobAssembler>::
+assemble_jacobian_diagonal(vector_type& diag,
+                           const vector_type& u,
+                           ConstSmartPtr<DoFDistribution> dd)
+{
+	PROFILE_FUNC_GROUP("discretization");
+//	update the elem discs
+	update_disc_items();
+	check_matrix_free_constraints();
+	prep_assemble_loop(m_vElemDisc);
+
+//	reset vector to zero and resize
+	m_spAssTuner->resize(dd, diag);
+	diag.set(0.0);
+
+//	Union of Subsets
+	SubsetGroup unionSubsets;
+	std::vector<SubsetGroup> vSSGrp;
+
+//	pre process -  modifies the solution, used for computing the defect
+	const vector_type* pModifyU = &u;
+	SmartPtr<vector_type> pModifyMemory;
+	if( m_spAssTuner->modify_solution_enabled() ){
+		pModifyMemory = u.clone();
+		pModifyU = pModifyMemory.get();
+		try{
+		for(int type = 1; type < CT_ALL; type = type << 1){
+			if(!(m_spAssTuner->constraint_type_enabled(type))) continue;
+			for(size_t i = 0; i < m_vConstraint.size(); ++i)
+				if(m_vConstraint[i]->type() & type)
+					m_vConstraint[i]->modify_solution(*pModifyMemory, u, dd, type);
+		}
+		} UG_CATCH_THROW("Cannot modify solution.");
+	}
+
+//	create list of all subsets
+	try{
+		CreateSubsetGroups(vSSGrp, unionSubsets, m_vElemDisc, dd->subset_handler());
+	}UG_CATCH_THROW("'DomainDiscretization': Can not create Subset Groups and Union.");
+
+//	loop subsets
+	for(size_t i = 0; i < unionSubsets.size(); ++i)
+	{
+	//	get subset
+		const int si = unionSubsets[i];
+
+	//	get dimension of the subset
+		const int dim = DimensionOfSubset(*dd->subset_handler(), si);
+
+	//	request if subset is regular grid
+		bool bNonRegularGrid = !unionSubsets.regular_grid(i);
+
+	//	overrule by regular grid if required
+		if(m_spAssTuner->regular_grid_forced()) bNonRegularGrid = false;
+
+	//	Elem Disc on the subset
+		std::vector<IElemDisc<TDomain>*> vSubsetElemDisc;
+
+	//	get all element discretizations that work on the subset
+		GetElemDiscOnSubset(vSubsetElemDisc, m_vElemDisc, vSSGrp, si);
+
+	//	assemble on suitable elements
+		try
+		{
+		switch(dim)
+		{
+		case 1:
+			this->template AssembleJacobianDiagonal<RegularEdge>
+				(vSubsetElemDisc, dd, si, bNonRegularGrid, diag, *pModifyU);
+			break;
+		case 2:
+			this->template AssembleJacobianDiagonal<Triangle>
+				(vSubsetElemDisc, dd, si, bNonRegularGrid, diag, *pModifyU);
+			this->template AssembleJacobianDiagonal<Quadrilateral>
+				(vSubsetElemDisc, dd, si, bNonRegularGrid, diag, *pModifyU);
+			break;
+		case 3:
+			this->template AssembleJacobianDiagonal<Tetrahedron>
+				(vSubsetElemDisc, dd, si, bNonRegularGrid, diag, *pModifyU);
+			this->template AssembleJacobianDiagonal<Pyramid>
+				(vSubsetElemDisc, dd, si, bNonRegularGrid, diag, *pModifyU);
+			this->template AssembleJacobianDiagonal<Prism>
+				(vSubsetElemDisc, dd, si, bNonRegularGrid, diag, *pModifyU);
+			this->template AssembleJacobianDiagonal<Hexahedron>
+				(vSubsetElemDisc, dd, si, bNonRegularGrid, diag, *pModifyU);
+			this->template AssembleJacobianDiagonal<Octahedron>
+				(vSubsetElemDisc, dd, si, bNonRegularGrid, diag, *pModifyU);
+			break;
+		default:
+			UG_THROW("DomainDiscretization::assemble_jacobian_diagonal (stationary):"
+							"Dimension "<<dim<<"(subset="<<si<<") not supported");
+		}
+		}
+		UG_CATCH_THROW("DomainDiscretization::assemble_jacobian_diagonal (stationary):"
+						" Assembling of elements of Dimension " << dim << " in "
+						" subset "<<si<< " failed.");
+	}
+
+//	post process: rows of dirichlet dofs are identity rows
+	try{
+		ConstSmartPtr<vector_type> spMask = dirichlet_mask(dd);
+		if(spMask.valid())
+		{
+			for(size_t i = 0; i < diag.size(); ++i)
+				for(size_t k = 0; k < (size_t)GetSize(diag[i]); ++k)
+					if(BlockRef((*spMask)[i], k) == 0.0)
+						BlockRef(diag[i], k) = 1.0;
+		}
+		post_assemble_loop(m_vElemDisc);
+	}UG_CATCH_THROW("DomainDiscretization::assemble_jacobian_diagonal:"
+					" Cannot execute post process.");
+
+//	Remember parallel storage type
+#ifdef UG_PARALLEL
+	diag.set_storage_type(PST_ADDITIVE);
+#endif
+}
+
+template <typename TDomain, typename TAlgebra, typename TGlobAssembler>
+template <typename TElem>
+void DomainDiscretizationBase<TDomain, TAlgebra, TGlobAssembler>::
+AssembleJacobianDiagonal(	const std::vector<IElemDisc<domain_type>*>& vElemDisc,
+							ConstSmartPtr<DoFDistribution> dd,
+							int si, bool bNonRegularGrid,
+							vector_type& diag,
+							const vector_type& u)
+{
+	//	check if only some elements are selected
+	if(m_spAssTuner->selected_elements_used())
+	{
+		std::vector<TElem*> vElem;
+		m_spAssTuner->collect_selected_elements(vElem, dd, si);
+
+		//	assembling is carried out only over those elements
+		//	which are selected and in subset si
+		gass_type::template AssembleJacobianDiagonal<TElem>
+			(vElemDisc, m_spApproxSpace->domain(), dd, vElem.begin(), vElem.end(), si,
+			 bNonRegularGrid, diag, u, m_spAssTuner);
+	}
+	else
+	{
+		//	general case: assembling over all elements in subset si
+		gass_type::template AssembleJacobianDiagonal<TElem>
+			(vElemDisc, m_spApproxSpace->domain(), dd,
+				dd->template begin<TElem>(si), dd->template end<TElem>(si), si,
+					bNonRegularGrid, diag, u, m_spAssTuner);
+	}
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Defect (stationary)
 ///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,229 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+
+#ifndef __H__UG__LIB_DISC__SPATIAL_DISC__ELEM_DISC__ELEM_COLORING__
+#define __H__UG__LIB_DISC__SPATIAL_DISC__ELEM_DISC__ELEM_COLORING__
+
+// extern includes
+#include <vector>
+#include <boost/type_traits/is_same.hpp>
+#include <boost/type_traits/integral_constant.hpp>
+
+// other ug4 modules
+#include "common/common.h"
+
+// intern headers
+#include "lib_disc/common/local_algebra.h"
+#include "lib_disc/dof_manager/dof_distribution.h"
+#include "lib_disc/spatial_disc/ass_tuner.h"
+
+namespace ug {
+
+/// returns if an iterator range is the full range of a subset
+template <typename TElem, typename TIterator>
+inline bool IsSubsetRange(ConstSmartPtr<DoFDistribution> dd, int si,
+                          TIterator iterBegin, TIterator iterEnd,
+                          boost::true_type)
+{
+	return iterBegin == dd->template begin<TElem>(si)
+		&& iterEnd == dd->template end<TElem>(si);
+}
+
+/// returns if an iterator range is the full range of a subset
+/**
+ * Ranges of other iterator types (e.g. of selected elements) are never
+ * considered to be a full subset range.
+ */
+template <typename TElem, typename TIterator>
+inline bool IsSubsetRange(ConstSmartPtr<DoFDistribution> dd, int si,
+                          TIterator iterBegin, TIterator iterEnd,
+                          boost::false_type)
+{
+	return false;
+}
+
+/// colors elements such that no two elements of a color share an algebra index
+/**
+ * This function distributes the elements of an iterator range into colors,
+ * such that no two elements of the same color couple to the same algebra
+ * index. Thus, the local contributions of all elements of one color can be
+ * added to the global vector or matrix concurrently without data races.
+ * A greedy first-fit coloring is used. Elements skipped by the assembling
+ * tuner are not colored.
+ *
+ * If the range contains all elements of the subset and no elements are
+ * skipped by the assembling tuner, the coloring is stored in the DoF
+ * Distribution and reused until the revision of the DoF Distribution
+ * changes.
+ *
+ * If a matrix is passed, the sparsity pattern of the element couplings is
+ * created in the matrix in the same pass (by adding zero entries), such
+ * that the concurrent adding of local matrices does not need to change the
+ * matrix structure.
+ *
+ * \param[out]		vvElem			elements sorted by color
+ * \param[in]		dd				DoF Distribution
+ * \param[in]		si				subset index
+ * \param[in]		iterBegin		element iterator
+ * \param[in]		iterEnd			element iterator
+ * \param[in]		bUseHanging		flag if hanging dofs are used
+ * \param[in]		assTuner		assemble adapter
+ * \param[in,out]	pMat			matrix to create the pattern in (or NULL)
+ */
+template <typename TElem, typename TIterator, typename TAlgebra>
+void ColorElementsByIndices(std::vector<std::vector<TElem*> >& vvElem,
+                            ConstSmartPtr<DoFDistribution> dd, int si,
+                            TIterator iterBegin, TIterator iterEnd,
+                            bool bUseHanging,
+                            const AssemblingTuner<TAlgebra>& assTuner,
+                            typename TAlgebra::matrix_type* pMat = NULL)
+{
+	PROFILE_FUNC_GROUP("discretization");
+
+	vvElem.clear();
+
+//	the index table must be up to date, before threads read it concurrently
+	dd->update_index_cache(geometry_traits<TElem>::REFERENCE_OBJECT_ID, bUseHanging);
+
+//	local indices and algebra
+	LocalIndices ind; LocalMatrix locZero;
+	std::vector<size_t> vIndex;
+
+//	check if a stored coloring can be used
+	typedef typename DoFDistribution::traits<TElem>::const_iterator subset_iterator;
+	const bool bCache = !assTuner.selected_elements_used()
+		&& !assTuner.marked_elements_used()
+		&& IsSubsetRange<TElem>(dd, si, iterBegin, iterEnd,
+		                        boost::is_same<TIterator, subset_iterator>());
+
+	if(bCache)
+	{
+		DoFDistribution::ElemColoring& coloring =
+			dd->elem_coloring(geometry_traits<TElem>::REFERENCE_OBJECT_ID,
+			                  si, bUseHanging);
+
+		if(coloring.revision == dd->revision())
+		{
+		//	copy stored coloring
+			vvElem.resize(coloring.vvElem.size());
+			for(size_t c = 0; c < coloring.vvElem.size(); ++c)
+			{
+				const std::vector<GridObject*>& vElem = coloring.vvElem[c];
+				vvElem[c].resize(vElem.size());
+				for(size_t i = 0; i < vElem.size(); ++i)
+					vvElem[c][i] = static_cast<TElem*>(vElem[i]);
+			}
+
+		//	create couplings in matrix pattern
+			if(pMat != NULL)
+			{
+				for(TIterator iter = iterBegin; iter != iterEnd; ++iter)
+				{
+					dd->indices(*iter, ind, bUseHanging);
+					locZero.resize(ind);
+					locZero = 0.0;
+					AddLocalMatrixToGlobal(*pMat, locZero);
+				}
+			}
+			return;
+		}
+	}
+
+//	flags for all algebra indices, which color already uses them
+	const size_t numIndex = dd->num_indices();
+	std::vector<std::vector<bool> > vvIndexUsed;
+
+	for(TIterator iter = iterBegin; iter != iterEnd; ++iter)
+	{
+	//	get Element
+		TElem* elem = *iter;
+
+	//	check if elem is skipped from assembling
+		if(!assTuner.element_used(elem)) continue;
+
+	//	get global indices
+		dd->indices(elem, ind, bUseHanging);
+
+		vIndex.clear();
+		for(size_t fct = 0; fct < ind.num_fct(); ++fct)
+			for(size_t dof = 0; dof < ind.num_dof(fct); ++dof)
+				vIndex.push_back(ind.index(fct, dof));
+
+	//	find first color not using any of the indices
+		size_t c = 0;
+		for(; c < vvIndexUsed.size(); ++c)
+		{
+			const std::vector<bool>& vUsed = vvIndexUsed[c];
+			size_t i = 0;
+			for(; i < vIndex.size(); ++i)
+				if(vUsed[vIndex[i]]) break;
+			if(i == vIndex.size()) break;
+		}
+
+	//	open a new color if needed
+		if(c == vvIndexUsed.size())
+		{
+			vvIndexUsed.push_back(std::vector<bool>(numIndex, false));
+			vvElem.push_back(std::vector<TElem*>());
+		}
+
+	//	add element to color
+		for(size_t i = 0; i < vIndex.size(); ++i)
+			vvIndexUsed[c][vIndex[i]] = true;
+		vvElem[c].push_back(elem);
+
+	//	create couplings in matrix pattern
+		if(pMat != NULL)
+		{
+			locZero.resize(ind);
+			locZero = 0.0;
+			AddLocalMatrixToGlobal(*pMat, locZero);
+		}
+	}
+
+//	store coloring
+	if(bCache)
+	{
+		DoFDistribution::ElemColoring& coloring =
+			dd->elem_coloring(geometry_traits<TElem>::REFERENCE_OBJECT_ID,
+			                  si, bUseHanging);
+
+		coloring.vvElem.resize(vvElem.size());
+		for(size_t c = 0; c < vvElem.size(); ++c)
+			coloring.vvElem[c].assign(vvElem[c].begin(), vvElem[c].end());
+		coloring.revision = dd->revision();
+	}
+}
+
+} // end namespace ug
+
+#endif /* __H__UG__LIB_DISC__SPATIAL_DISC__ELEM_DISC__ELEM_COLORING__ */
@@ -46,6 +46,7 @@
 #include "lib_disc/common/function_group.h"
 #include "lib_disc/common/local_algebra.h"
 #include "lib_disc/spatial_disc/user_data/data_evaluator.h"
+#include "lib_disc/spatial_disc/elem_disc/elem_coloring.h"
 #include "bridge/util_algebra_dependent.h"
 
 #define PROFILE_ELEM_LOOP
@@ -140,7 +141,21 @@ public:
 
 	//	local indices and local algebra
 		LocalIndices ind; LocalVector locU; LocalMatrix locA;
+		dd->reserve_indices(id, ind);
 
+#ifdef UG_OPENMP
+	//	thread-parallel loop over colored elements, if possible
+		if(ThreadParallelLoopPossible(spAssTuner, Eval))
+		{
+			std::vector<std::vector<TElem*> > vvElem;
+			ColorElementsByIndices<TElem>(vvElem, dd, si, iterBegin, iterEnd,
+			                              Eval.use_hanging(), *spAssTuner, &A);
+			ThreadedAssembleMatrix<TElem>(vElemDisc, STIFF, spDomain, dd, si,
+			                              bNonRegularGrid, vvElem, A, u,
+			                              spAssTuner->num_threads());
+		}
+		else
+#endif
 	//	Loop over all elements
 		for(TIterator iter = iterBegin; iter != iterEnd; ++iter)
 		{
@@ -248,7 +263,21 @@ public:
 
 	//	local indices and local algebra
 		LocalIndices ind; LocalVector locU; LocalMatrix locM;
+		dd->reserve_indices(id, ind);
 
+#ifdef UG_OPENMP
+	//	thread-parallel loop over colored elements, if possible
+		if(ThreadParallelLoopPossible(spAssTuner, Eval))
+		{
+			std::vector<std::vector<TElem*> > vvElem;
+			ColorElementsByIndices<TElem>(vvElem, dd, si, iterBegin, iterEnd,
+			                              Eval.use_hanging(), *spAssTuner, &M);
+			ThreadedAssembleMatrix<TElem>(vElemDisc, MASS, spDomain, dd, si,
+			                              bNonRegularGrid, vvElem, M, u,
+			                              spAssTuner->num_threads());
+		}
+		else
+#endif
 	//	Loop over all elements
 		for(TIterator iter = iterBegin; iter != iterEnd; ++iter)
 		{
@@ -355,7 +384,21 @@ public:
 
 	//	local indices and local algebra
 		LocalIndices ind; LocalVector locU; LocalMatrix locJ;
+		dd->reserve_indices(id, ind);
 
+#ifdef UG_OPENMP
+	//	thread-parallel loop over colored elements, if possible
+		if(ThreadParallelLoopPossible(spAssTuner, Eval))
+		{
+			std::vector<std::vector<TElem*> > vvElem;
+			ColorElementsByIndices<TElem>(vvElem, dd, si, iterBegin, iterEnd,
+			                              Eval.use_hanging(), *spAssTuner, &J);
+			ThreadedAssembleMatrix<TElem>(vElemDisc, STIFF | RHS, spDomain, dd, si,
+			                              bNonRegularGrid, vvElem, J, u,
+			                              spAssTuner->num_threads());
+		}
+		else
+#endif
 	//	Loop over all elements
 		for(TIterator iter = iterBegin; iter != iterEnd; ++iter)
 		{
@@ -412,6 +455,227 @@ public:
 		UG_CATCH_THROW("(stationary) AssembleJacobian: Cannot create Data Evaluator.");
 	}
 
+////////////////////////////////////////////////////////////////////////////////
+// Apply (stationary) Jacobian matrix-free
+////////////////////////////////////////////////////////////////////////////////
+
+public:
+	/**
+	 * This function adds the action of the local Jacobians of all passed
+	 * element discretizations on one given subset to a global vector, i.e.
+	 * f += J(u)*x, in the stationary case. The local Jacobians are computed
+	 * element by element and are not stored, i.e. no global matrix is
+	 * needed. (This version processes elements in a given interval.)
+	 *
+	 * \param[in]		vElemDisc		element discretizations
+	 * \param[in]		spDomain		domain
+	 * \param[in]		dd				DoF Distribution
+	 * \param[in]		iterBegin		element iterator
+	 * \param[in]		iterEnd			element iterator
+	 * \param[in]		si				subset index
+	 * \param[in]		bNonRegularGrid flag to indicate if non regular grid is used
+	 * \param[in,out]	f				result vector
+	 * \param[in]		x				vector the jacobian is applied to
+	 * \param[in]		u				solution (linearization point)
+	 * \param[in]		spAssTuner		assemble adapter
+	 */
+	template <typename TElem, typename TIterator>
+	static void
+	AssembleJacobianAction(	const std::vector<IElemDisc<domain_type>*>& vElemDisc,
+							ConstSmartPtr<domain_type> spDomain,
+							ConstSmartPtr<DoFDistribution> dd,
+							TIterator iterBegin,
+							TIterator iterEnd,
+							int si, bool bNonRegularGrid,
+							vector_type& f,
+							const vector_type& x,
+							const vector_type& u,
+							ConstSmartPtr<AssemblingTuner<TAlgebra> > spAssTuner)
+	{
+	//	check if there are any elements at all, otherwise return immediately
+		if(iterBegin == iterEnd) return;
+
+	//	reference object id
+		static const ReferenceObjectID id = geometry_traits<TElem>::REFERENCE_OBJECT_ID;
+
+	//	storage for corner coordinates
+		MathVector<domain_type::dim> vCornerCoords[TElem::NUM_VERTICES];
+
+	//	prepare for given elem discs
+		try
+		{
+		DataEvaluator<domain_type> Eval(STIFF | RHS,
+						   vElemDisc, dd->function_pattern(), bNonRegularGrid);
+
+	//	prepare element loop
+		Eval.prepare_elem_loop(id, si);
+
+	//	local indices and local algebra
+		LocalIndices ind; LocalVector locU, locX, locF; LocalMatrix locJ;
+		dd->reserve_indices(id, ind);
+
+	//	Loop over all elements
+		for(TIterator iter = iterBegin; iter != iterEnd; ++iter)
+		{
+		//	get Element
+			TElem* elem = *iter;
+
+		//	get corner coordinates
+			FillCornerCoordinates(vCornerCoords, *elem, *spDomain);
+
+		//	check if elem is skipped from assembling
+			if(!spAssTuner->element_used(elem)) continue;
+
+		//	get global indices
+			dd->indices(elem, ind, Eval.use_hanging());
+
+		//	adapt local algebra
+			locU.resize(ind); locX.resize(ind); locF.resize(ind); locJ.resize(ind);
+
+		//	read local values of u and x
+			GetLocalVector(locU, u);
+			GetLocalVector(locX, x);
+
+		//	prepare element
+			try
+			{
+				Eval.prepare_elem(locU, elem, id, vCornerCoords, ind, true);
+			}
+			UG_CATCH_THROW("(stationary) AssembleJacobianAction: Cannot prepare element.");
+
+		//	reset local algebra
+			locJ = 0.0;
+
+		//	Assemble JA
+			try
+			{
+				Eval.add_jac_A_elem(locJ, locU, elem, vCornerCoords);
+			}
+			UG_CATCH_THROW("(stationary) AssembleJacobianAction: Cannot compute Jacobian (A).");
+
+		//	apply local jacobian and send to global vector
+			locF = 0.0;
+			AddLocalMatVec(locF, locJ, locX);
+			AddLocalVector(f, locF);
+		}
+
+	//	finish element loop
+		try
+		{
+			Eval.finish_elem_loop();
+		}
+		UG_CATCH_THROW("(stationary) AssembleJacobianAction: Cannot finish element loop.");
+
+		}
+		UG_CATCH_THROW("(stationary) AssembleJacobianAction: Cannot create Data Evaluator.");
+	}
+
+	/**
+	 * This function adds the diagonal of the local Jacobians of all passed
+	 * element discretizations on one given subset to a global vector in the
+	 * stationary case. (This version processes elements in a given interval.)
+	 *
+	 * \param[in]		vElemDisc		element discretizations
+	 * \param[in]		spDomain		domain
+	 * \param[in]		dd				DoF Distribution
+	 * \param[in]		iterBegin		element iterator
+	 * \param[in]		iterEnd			element iterator
+	 * \param[in]		si				subset index
+	 * \param[in]		bNonRegularGrid flag to indicate if non regular grid is used
+	 * \param[in,out]	diag			diagonal of the jacobian
+	 * \param[in]		u				solution (linearization point)
+	 * \param[in]		spAssTuner		assemble adapter
+	 */
+	template <typename TElem, typename TIterator>
+	static void
+	AssembleJacobianDiagonal(	const std::vector<IElemDisc<domain_type>*>& vElemDisc,
+								ConstSmartPtr<domain_type> spDomain,
+								ConstSmartPtr<DoFDistribution> dd,
+								TIterator iterBegin,
+								TIterator iterEnd,
+								int si, bool bNonRegularGrid,
+								vector_type& diag,
+								const vector_type& u,
+								ConstSmartPtr<AssemblingTuner<TAlgebra> > spAssTuner)
+	{
+	//	check if there are any elements at all, otherwise return immediately
+		if(iterBegin == iterEnd) return;
+
+	//	reference object id
+		static const ReferenceObjectID id = geometry_traits<TElem>::REFERENCE_OBJECT_ID;
+
+	//	storage for corner coordinates
+		MathVector<domain_type::dim> vCornerCoords[TElem::NUM_VERTICES];
+
+	//	prepare for given elem discs
+		try
+		{
+		DataEvaluator<domain_type> Eval(STIFF | RHS,
+						   vElemDisc, dd->function_pattern(), bNonRegularGrid);
+
+	//	prepare element loop
+		Eval.prepare_elem_loop(id, si);
+
+	//	local indices and local algebra
+		LocalIndices ind; LocalVector locU, locDiag; LocalMatrix locJ;
+		dd->reserve_indices(id, ind);
+
+	//	Loop over all elements
+		for(TIterator iter = iterBegin; iter != iterEnd; ++iter)
+		{
+		//	get Element
+			TElem* elem = *iter;
+
+		//	get corner coordinates
+			FillCornerCoordinates(vCornerCoords, *elem, *spDomain);
+
+		//	check if elem is skipped from assembling
+			if(!spAssTuner->element_used(elem)) continue;
+
+		//	get global indices
+			dd->indices(elem, ind, Eval.use_hanging());
+
+		//	adapt local algebra
+			locU.resize(ind); locDiag.resize(ind); locJ.resize(ind);
+
+		//	read local values of u
+			GetLocalVector(locU, u);
+
+		//	prepare element
+			try
+			{
+				Eval.prepare_elem(locU, elem, id, vCornerCoords, ind, true);
+			}
+			UG_CATCH_THROW("(stationary) AssembleJacobianDiagonal: Cannot prepare element.");
+
+		//	reset local algebra
+			locJ = 0.0;
+
+		//	Assemble JA
+			try
+			{
+				Eval.add_jac_A_elem(locJ, locU, elem, vCornerCoords);
+			}
+			UG_CATCH_THROW("(stationary) AssembleJacobianDiagonal: Cannot compute Jacobian (A).");
+
+		//	extract local diagonal and send to global vector
+			for(size_t fct = 0; fct < locDiag.num_all_fct(); ++fct)
+				for(size_t dof = 0; dof < locDiag.num_all_dof(fct); ++dof)
+					locDiag.value(fct, dof) = locJ.value(fct, dof, fct, dof);
+			AddLocalVector(diag, locDiag);
+		}
+
+	//	finish element loop
+		try
+		{
+			Eval.finish_elem_loop();
+		}
+		UG_CATCH_THROW("(stationary) AssembleJacobianDiagonal: Cannot finish element loop.");
+
+		}
+		UG_CATCH_THROW("(stationary) AssembleJacobianDiagonal: Cannot create Data Evaluator.");
+	}
+
 ////////////////////////////////////////////////////////////////////////////////
 // Assemble (instationary) Jacobian
 ////////////////////////////////////////////////////////////////////////////////
@@ -477,8 +741,22 @@ public:
 
 	//	local algebra
 		LocalIndices ind; LocalVector locU; LocalMatrix locJ;
+		dd->reserve_indices(id, ind);
 
 		EL_PROFILE_BEGIN(Elem_AssembleJacobian);
+#ifdef UG_OPENMP
+	//	thread-parallel loop over colored elements, if possible
+		if(ThreadParallelLoopPossible(spAssTuner, Eval))
+		{
+			std::vector<std::vector<TElem*> > vvElem;
+			ColorElementsByIndices<TElem>(vvElem, dd, si, iterBegin, iterEnd,
+			                              Eval.use_hanging(), *spAssTuner, &J);
+			ThreadedAssembleJacobian<TElem>(vElemDisc, spDomain, dd, si,
+			                                bNonRegularGrid, vvElem, J, vSol, s_a0,
+			                                spAssTuner->num_threads());
+		}
+		else
+#endif
 	//	Loop over all elements
 		for(TIterator iter = iterBegin; iter != iterEnd; ++iter)
 		{
@@ -606,7 +884,21 @@ public:
 
 	//	local indices and local algebra
 		LocalIndices ind; LocalVector locU, locD, tmpLocD;
+		dd->reserve_indices(id, ind);
 
+#ifdef UG_OPENMP
+	//	thread-parallel loop over colored elements, if possible
+		if(ThreadParallelLoopPossible(spAssTuner, Eval))
+		{
+			std::vector<std::vector<TElem*> > vvElem;
+			ColorElementsByIndices<TElem>(vvElem, dd, si, iterBegin, iterEnd,
+			                              Eval.use_hanging(), *spAssTuner, (matrix_type*)NULL);
+			ThreadedAssembleDefect<TElem>(vElemDisc, spDomain, dd, si,
+			                              bNonRegularGrid, vvElem, d, u,
+			                              spAssTuner->num_threads());
+		}
+		else
+#endif
 	//	Loop over all elements
 		for(TIterator iter = iterBegin; iter != iterEnd; ++iter)
 		{
@@ -757,7 +1049,22 @@ public:
 
 	//	local indices and local algebra
 		LocalIndices ind; LocalVector locD, tmpLocD;
+		dd->reserve_indices(id, ind);
 
+#ifdef UG_OPENMP
+	//	thread-parallel loop over colored elements, if possible
+		if(ThreadParallelLoopPossible(spAssTuner, Eval))
+		{
+			std::vector<std::vector<TElem*> > vvElem;
+			ColorElementsByIndices<TElem>(vvElem, dd, si, iterBegin, iterEnd,
+			                              Eval.use_hanging(), *spAssTuner, (matrix_type*)NULL);
+			ThreadedAssembleDefect<TElem>(vElemDisc, spDomain, dd, si,
+			                              bNonRegularGrid, vvElem, d, vSol,
+			                              vScaleMass, vScaleStiff,
+			                              spAssTuner->num_threads());
+		}
+		else
+#endif
 	//	Loop over all elements
 		for(TIterator iter = iterBegin; iter != iterEnd; ++iter)
 		{
@@ -935,6 +1242,7 @@ public:
 
 	//	local indices and local algebra
 		LocalIndices ind; LocalVector locRhs; LocalMatrix locA;
+		dd->reserve_indices(id, ind);
 
 	//	Loop over all elements
 		for(TIterator iter = iterBegin; iter != iterEnd; ++iter)
@@ -1076,6 +1384,7 @@ public:
 
 	//	local algebra
 		LocalIndices ind; LocalVector locRhs, tmpLocRhs; LocalMatrix locA, tmpLocA;
+		dd->reserve_indices(id, ind);
 
 	//	Loop over all elements
 		for(TIterator iter = iterBegin; iter != iterEnd; ++iter)
@@ -1278,6 +1587,7 @@ public:
 
 	//	local indices and local algebra
 		LocalIndices ind; LocalVector locU, locRhs;
+		dd->reserve_indices(id, ind);
 
 	//	Loop over all elements
 		for(TIterator iter = iterBegin; iter != iterEnd; ++iter)
@@ -1406,6 +1716,7 @@ public:
 
 	//	local algebra
 		LocalIndices ind; LocalVector locRhs, tmpLocRhs;
+		dd->reserve_indices(id, ind);
 
 	//	Loop over all elements
 		for(TIterator iter = iterBegin; iter != iterEnd; ++iter)
@@ -1631,6 +1942,7 @@ public:
 
 	//	local algebra
 		LocalIndices ind; LocalVector locU;
+		dd->reserve_indices(id, ind);
 
 	//	Loop over all elements
 		for(TIterator iter = iterBegin; iter != iterEnd; ++iter)
@@ -1781,6 +2093,7 @@ public:
 
 	//	local algebra
 		LocalIndices ind; LocalVector locU;
+		dd->reserve_indices(id, ind);
 
 	//	Loop over all elements
 		for(TIterator iter = iterBegin; iter != iterEnd; ++iter)
@@ -1872,6 +2185,7 @@ public:
 
 	//	local indices and local algebra
 		LocalIndices ind; LocalVector locU;
+		dd->reserve_indices(id, ind);
 
 	//	Loop over all elements
 		for(TIterator iter = iterBegin; iter != iterEnd; ++iter)
@@ -1996,6 +2310,7 @@ public:
 
 		//	local indices and local algebra
 			LocalIndices ind;
+			dd->reserve_indices(id, ind);
 
 		//	loop over all elements
 			for (TIterator iter = iterBegin; iter != iterEnd; ++iter)
@@ -2060,6 +2375,541 @@ public:
 		UG_CATCH_THROW("AssembleErrorEstimator: Cannot create Data Evaluator.");
 	}
 
+#ifdef UG_OPENMP
+////////////////////////////////////////////////////////////////////////////////
+// Thread-parallel element loops
+////////////////////////////////////////////////////////////////////////////////
+
+protected:
+	///	returns if the element loop can be executed by several threads
+	static bool
+	ThreadParallelLoopPossible(ConstSmartPtr<AssemblingTuner<TAlgebra> > spAssTuner,
+	                              const DataEvaluator<domain_type>& Eval)
+	{
+		return spAssTuner->thread_parallel_assembling_enabled() && Eval.thread_safe();
+	}
+
+	///	creates and prepares a data evaluator for the calling thread
+	/**
+	 * The construction and the preparation of the element loop modify the
+	 * (shared) element discretizations, thus they are serialized. On errors,
+	 * the error is stored and an invalid pointer is returned. In the
+	 * time-dependent case, the passed local time series must be owned by the
+	 * calling thread and outlive the data evaluator.
+	 */
+	static SmartPtr<DataEvaluator<domain_type> >
+	CreateThreadEvaluator(int discPart,
+	                      const std::vector<IElemDisc<domain_type>*>& vElemDisc,
+	                      ConstSmartPtr<DoFDistribution> dd, ReferenceObjectID id,
+	                      int si, bool bNonRegularGrid, std::vector<UGError>& vErr,
+	                      LocalVectorTimeSeries* locTimeSeries = NULL,
+	                      const std::vector<number>* vScaleMass = NULL,
+	                      const std::vector<number>* vScaleStiff = NULL)
+	{
+		SmartPtr<DataEvaluator<domain_type> > spEval;
+		#pragma omp critical (ThreadedAssemblePrepare)
+		{
+			try
+			{
+				spEval = make_sp(new DataEvaluator<domain_type>(discPart,
+				                   vElemDisc, dd->function_pattern(), bNonRegularGrid,
+				                   locTimeSeries, vScaleMass, vScaleStiff));
+				spEval->prepare_elem_loop(id, si);
+			}
+			catch(UGError& err)
+			{
+				spEval = SPNULL;
+				vErr.push_back(err);
+			}
+			catch(const std::exception& ex)
+			{
+				spEval = SPNULL;
+				vErr.push_back(UGError("Exception in preparation", ex, __FILE__, __LINE__));
+			}
+		}
+		return spEval;
+	}
+
+	///	finishes the element loop of the data evaluator of the calling thread
+	static void
+	FinishThreadEvaluator(SmartPtr<DataEvaluator<domain_type> > spEval,
+	                      std::vector<UGError>& vErr)
+	{
+		if(spEval.invalid()) return;
+		#pragma omp critical (ThreadedAssemblePrepare)
+		{
+			try
+			{
+				spEval->finish_elem_loop();
+			}
+			catch(UGError& err)
+			{
+				vErr.push_back(err);
+			}
+		}
+	}
+
+	/**
+	 * This function adds the local stiffness or mass (if discPart is MASS)
+	 * matrices of colored elements to a global matrix. The elements of one
+	 * color are processed concurrently, the colors one after another. Each
+	 * thread uses its own data evaluator and local algebra. The sparsity
+	 * pattern of the matrix must already contain all couplings.
+	 *
+	 * \param[in]		vElemDisc		element discretizations
+	 * \param[in]		discPart		disc part of the data evaluators
+	 * \param[in]		spDomain		domain
+	 * \param[in]		dd				DoF Distribution
+	 * \param[in]		si				subset index
+	 * \param[in]		bNonRegularGrid flag to indicate if non regular grid is used
+	 * \param[in]		vvElem			elements sorted by color
+	 * \param[in,out]	A				matrix
+	 * \param[in]		u				solution
+	 * \param[in]		numThreads		number of threads
+	 */
+	template <typename TElem>
+	static void
+	ThreadedAssembleMatrix(const std::vector<IElemDisc<domain_type>*>& vElemDisc,
+	                       int discPart,
+	                       ConstSmartPtr<domain_type> spDomain,
+	                       ConstSmartPtr<DoFDistribution> dd,
+	                       int si, bool bNonRegularGrid,
+	                       const std::vector<std::vector<TElem*> >& vvElem,
+	                       matrix_type& A, const vector_type& u, int numThreads)
+	{
+		static const ReferenceObjectID id = geometry_traits<TElem>::REFERENCE_OBJECT_ID;
+		std::vector<UGError> vErr;
+		bool bPrepared = true;
+
+		#pragma omp parallel num_threads(numThreads)
+		{
+		//	thread-local data evaluator
+			SmartPtr<DataEvaluator<domain_type> > spEval
+				= CreateThreadEvaluator(discPart, vElemDisc, dd, id, si,
+				                        bNonRegularGrid, vErr);
+			if(spEval.invalid())
+			{
+				#pragma omp critical (ThreadedAssemblePrepare)
+				bPrepared = false;
+			}
+
+		//	all threads must be prepared before the elements are assembled
+			#pragma omp barrier
+
+		//	thread-local storage
+			MathVector<domain_type::dim> vCornerCoords[TElem::NUM_VERTICES];
+			LocalIndices ind; LocalVector locU; LocalMatrix locA;
+			dd->reserve_indices(id, ind);
+
+			for(size_t c = 0; bPrepared && c < vvElem.size(); ++c)
+			{
+				const std::vector<TElem*>& vElem = vvElem[c];
+				const int numElem = (int)vElem.size();
+
+			//	the implicit barrier separates the colors
+				#pragma omp for schedule(static)
+				for(int e = 0; e < numElem; ++e)
+				{
+					try
+					{
+						TElem* elem = vElem[e];
+
+						FillCornerCoordinates(vCornerCoords, *elem, *spDomain);
+						dd->indices(elem, ind, spEval->use_hanging());
+
+						locU.resize(ind); locA.resize(ind);
+						GetLocalVector(locU, u);
+
+						spEval->prepare_elem(locU, elem, id, vCornerCoords, ind, true);
+
+						locA = 0.0;
+						if(discPart == MASS)
+							spEval->add_jac_M_elem(locA, locU, elem, vCornerCoords);
+						else
+							spEval->add_jac_A_elem(locA, locU, elem, vCornerCoords);
+
+						AddLocalMatrixToGlobal(A, locA);
+					}
+					catch(UGError& err)
+					{
+						#pragma omp critical (ThreadedAssembleError)
+						vErr.push_back(err);
+					}
+					catch(const std::exception& ex)
+					{
+						#pragma omp critical (ThreadedAssembleError)
+						vErr.push_back(UGError("Exception in element loop", ex, __FILE__, __LINE__));
+					}
+				}
+			}
+
+			FinishThreadEvaluator(spEval, vErr);
+		}
+
+		if(!vErr.empty()){
+			vErr[0].push_msg("ThreadedAssembleMatrix: Cannot assemble element.", __FILE__, __LINE__);
+			throw vErr[0];
+		}
+	}
+
+	/**
+	 * This function adds the local stationary defects of colored elements to
+	 * a global vector. The elements of one color are processed concurrently,
+	 * the colors one after another. Each thread uses its own data evaluator
+	 * and local algebra.
+	 *
+	 * \param[in]		vElemDisc		element discretizations
+	 * \param[in]		spDomain		domain
+	 * \param[in]		dd				DoF Distribution
+	 * \param[in]		si				subset index
+	 * \param[in]		bNonRegularGrid flag to indicate if non regular grid is used
+	 * \param[in]		vvElem			elements sorted by color
+	 * \param[in,out]	d				defect
+	 * \param[in]		u				solution
+	 * \param[in]		numThreads		number of threads
+	 */
+	template <typename TElem>
+	static void
+	ThreadedAssembleDefect(const std::vector<IElemDisc<domain_type>*>& vElemDisc,
+	                       ConstSmartPtr<domain_type> spDomain,
+	                       ConstSmartPtr<DoFDistribution> dd,
+	                       int si, bool bNonRegularGrid,
+	                       const std::vector<std::vector<TElem*> >& vvElem,
+	                       vector_type& d, const vector_type& u, int numThreads)
+	{
+		static const ReferenceObjectID id = geometry_traits<TElem>::REFERENCE_OBJECT_ID;
+		std::vector<UGError> vErr;
+		bool bPrepared = true;
+
+		#pragma omp parallel num_threads(numThreads)
+		{
+		//	thread-local data evaluator
+			SmartPtr<DataEvaluator<domain_type> > spEval
+				= CreateThreadEvaluator(STIFF | RHS, vElemDisc, dd, id, si,
+				                        bNonRegularGrid, vErr);
+			if(spEval.invalid())
+			{
+				#pragma omp critical (ThreadedAssemblePrepare)
+				bPrepared = false;
+			}
+
+		//	all threads must be prepared before the elements are assembled
+			#pragma omp barrier
+
+		//	thread-local storage
+			MathVector<domain_type::dim> vCornerCoords[TElem::NUM_VERTICES];
+			LocalIndices ind; LocalVector locU, locD, tmpLocD;
+			dd->reserve_indices(id, ind);
+
+			for(size_t c = 0; bPrepared && c < vvElem.size(); ++c)
+			{
+				const std::vector<TElem*>& vElem = vvElem[c];
+				const int numElem = (int)vElem.size();
+
+			//	the implicit barrier separates the colors
+				#pragma omp for schedule(static)
+				for(int e = 0; e < numElem; ++e)
+				{
+					try
+					{
+						TElem* elem = vElem[e];
+
+						FillCornerCoordinates(vCornerCoords, *elem, *spDomain);
+						dd->indices(elem, ind, spEval->use_hanging());
+
+						locU.resize(ind); locD.resize(ind); tmpLocD.resize(ind);
+						GetLocalVector(locU, u);
+
+						spEval->prepare_elem(locU, elem, id, vCornerCoords, ind);
+
+						locD = 0.0;
+						spEval->add_def_A_elem(locD, locU, elem, vCornerCoords);
+
+						tmpLocD = 0.0;
+						spEval->add_rhs_elem(tmpLocD, elem, vCornerCoords);
+						locD.scale_append(-1, tmpLocD);
+
+						AddLocalVector(d, locD);
+					}
+					catch(UGError& err)
+					{
+						#pragma omp critical (ThreadedAssembleError)
+						vErr.push_back(err);
+					}
+					catch(const std::exception& ex)
+					{
+						#pragma omp critical (ThreadedAssembleError)
+						vErr.push_back(UGError("Exception in element loop", ex, __FILE__, __LINE__));
+					}
+				}
+			}
+
+			FinishThreadEvaluator(spEval, vErr);
+		}
+
+		if(!vErr.empty()){
+			vErr[0].push_msg("ThreadedAssembleDefect: Cannot assemble element.", __FILE__, __LINE__);
+			throw vErr[0];
+		}
+	}
+	/**
+	 * This function adds the local instationary jacobians of colored elements
+	 * to a global matrix, as AssembleJacobian does in the time-dependent case.
+	 * The elements of one color are processed concurrently, the colors one
+	 * after another. Each thread uses its own local time series, data
+	 * evaluator and local algebra. The sparsity pattern of the matrix must
+	 * already contain all couplings.
+	 *
+	 * \param[in]		vElemDisc		element discretizations
+	 * \param[in]		spDomain		domain
+	 * \param[in]		dd				DoF Distribution
+	 * \param[in]		si				subset index
+	 * \param[in]		bNonRegularGrid flag to indicate if non regular grid is used
+	 * \param[in]		vvElem			elements sorted by color
+	 * \param[in,out]	J				jacobian
+	 * \param[in]		vSol			current and previous solutions
+	 * \param[in]		s_a0			scaling factor for stiffness part
+	 * \param[in]		numThreads		number of threads
+	 */
+	template <typename TElem>
+	static void
+	ThreadedAssembleJacobian(const std::vector<IElemDisc<domain_type>*>& vElemDisc,
+	                         ConstSmartPtr<domain_type> spDomain,
+	                         ConstSmartPtr<DoFDistribution> dd,
+	                         int si, bool bNonRegularGrid,
+	                         const std::vector<std::vector<TElem*> >& vvElem,
+	                         matrix_type& J,
+	                         ConstSmartPtr<VectorTimeSeries<vector_type> > vSol,
+	                         number s_a0, int numThreads)
+	{
+		static const ReferenceObjectID id = geometry_traits<TElem>::REFERENCE_OBJECT_ID;
+		const vector_type& u = *vSol->solution(0);
+		std::vector<UGError> vErr;
+		bool bPrepared = true;
+
+		#pragma omp parallel num_threads(numThreads)
+		{
+		//	thread-local time series and data evaluator
+			LocalVectorTimeSeries locTimeSeries;
+			locTimeSeries.read_times(vSol);
+			SmartPtr<DataEvaluator<domain_type> > spEval
+				= CreateThreadEvaluator(MASS | STIFF | RHS, vElemDisc, dd, id, si,
+				                        bNonRegularGrid, vErr, &locTimeSeries);
+			if(spEval.invalid())
+			{
+				#pragma omp critical (ThreadedAssemblePrepare)
+				bPrepared = false;
+			}
+			else spEval->set_time_point(0);
+
+		//	all threads must be prepared before the elements are assembled
+			#pragma omp barrier
+
+		//	thread-local storage
+			MathVector<domain_type::dim> vCornerCoords[TElem::NUM_VERTICES];
+			LocalIndices ind; LocalVector locU; LocalMatrix locJ;
+			dd->reserve_indices(id, ind);
+
+			for(size_t c = 0; bPrepared && c < vvElem.size(); ++c)
+			{
+				const std::vector<TElem*>& vElem = vvElem[c];
+				const int numElem = (int)vElem.size();
+
+			//	the implicit barrier separates the colors
+				#pragma omp for schedule(static)
+				for(int e = 0; e < numElem; ++e)
+				{
+					try
+					{
+						TElem* elem = vElem[e];
+
+						FillCornerCoordinates(vCornerCoords, *elem, *spDomain);
+						dd->indices(elem, ind, spEval->use_hanging());
+
+						locU.resize(ind); locJ.resize(ind);
+						GetLocalVector(locU, u);
+						if(spEval->time_series_needed())
+							locTimeSeries.read_values(vSol, ind);
+
+						spEval->prepare_elem(locU, elem, id, vCornerCoords, ind, true);
+
+						locJ = 0.0;
+						spEval->add_jac_A_elem(locJ, locU, elem, vCornerCoords, PT_INSTATIONARY);
+						locJ *= s_a0;
+						spEval->add_jac_A_elem(locJ, locU, elem, vCornerCoords, PT_STATIONARY);
+						spEval->add_jac_M_elem(locJ, locU, elem, vCornerCoords, PT_INSTATIONARY);
+
+						AddLocalMatrixToGlobal(J, locJ);
+					}
+					catch(UGError& err)
+					{
+						#pragma omp critical (ThreadedAssembleError)
+						vErr.push_back(err);
+					}
+					catch(const std::exception& ex)
+					{
+						#pragma omp critical (ThreadedAssembleError)
+						vErr.push_back(UGError("Exception in element loop", ex, __FILE__, __LINE__));
+					}
+				}
+			}
+
+			FinishThreadEvaluator(spEval, vErr);
+		}
+
+		if(!vErr.empty()){
+			vErr[0].push_msg("ThreadedAssembleJacobian: Cannot assemble element.", __FILE__, __LINE__);
+			throw vErr[0];
+		}
+	}
+
+	/**
+	 * This function adds the local instationary defects of colored elements
+	 * to a global vector, as AssembleDefect does in the time-dependent case.
+	 * The elements of one color are processed concurrently, the colors one
+	 * after another. Each thread uses its own local time series, data
+	 * evaluator and local algebra.
+	 *
+	 * \param[in]		vElemDisc		element discretizations
+	 * \param[in]		spDomain		domain
+	 * \param[in]		dd				DoF Distribution
+	 * \param[in]		si				subset index
+	 * \param[in]		bNonRegularGrid flag to indicate if non regular grid is used
+	 * \param[in]		vvElem			elements sorted by color
+	 * \param[in,out]	d				defect
+	 * \param[in]		vSol			current and previous solutions
+	 * \param[in]		vScaleMass		scaling factors for mass part
+	 * \param[in]		vScaleStiff		scaling factors for stiffness part
+	 * \param[in]		numThreads		number of threads
+	 */
+	template <typename TElem>
+	static void
+	ThreadedAssembleDefect(const std::vector<IElemDisc<domain_type>*>& vElemDisc,
+	                       ConstSmartPtr<domain_type> spDomain,
+	                       ConstSmartPtr<DoFDistribution> dd,
+	                       int si, bool bNonRegularGrid,
+	                       const std::vector<std::vector<TElem*> >& vvElem,
+	                       vector_type& d,
+	                       ConstSmartPtr<VectorTimeSeries<vector_type> > vSol,
+	                       const std::vector<number>& vScaleMass,
+	                       const std::vector<number>& vScaleStiff, int numThreads)
+	{
+		static const ReferenceObjectID id = geometry_traits<TElem>::REFERENCE_OBJECT_ID;
+		std::vector<UGError> vErr;
+		bool bPrepared = true;
+
+		#pragma omp parallel num_threads(numThreads)
+		{
+		//	thread-local time series and data evaluator
+			LocalVectorTimeSeries locTimeSeries;
+			locTimeSeries.read_times(vSol);
+			SmartPtr<DataEvaluator<domain_type> > spEval
+				= CreateThreadEvaluator(MASS | STIFF | RHS | EXPL, vElemDisc, dd,
+				                        id, si, bNonRegularGrid, vErr,
+				                        &locTimeSeries, &vScaleMass, &vScaleStiff);
+			if(spEval.invalid())
+			{
+				#pragma omp critical (ThreadedAssemblePrepare)
+				bPrepared = false;
+			}
+
+		//	all threads must be prepared before the elements are assembled
+			#pragma omp barrier
+
+		//	thread-local storage
+			MathVector<domain_type::dim> vCornerCoords[TElem::NUM_VERTICES];
+			LocalIndices ind; LocalVector locD, tmpLocD;
+			dd->reserve_indices(id, ind);
+
+			for(size_t c = 0; bPrepared && c < vvElem.size(); ++c)
+			{
+				const std::vector<TElem*>& vElem = vvElem[c];
+				const int numElem = (int)vElem.size();
+
+			//	the implicit barrier separates the colors
+				#pragma omp for schedule(static)
+				for(int e = 0; e < numElem; ++e)
+				{
+					try
+					{
+						TElem* elem = vElem[e];
+
+						FillCornerCoordinates(vCornerCoords, *elem, *spDomain);
+						dd->indices(elem, ind, spEval->use_hanging());
+
+						locD.resize(ind); tmpLocD.resize(ind);
+						locTimeSeries.read_values(vSol, ind);
+
+						locD = 0.0;
+						for(size_t t = 0; t < vScaleStiff.size(); ++t)
+						{
+							const number scale_stiff = vScaleStiff[t];
+							LocalVector& locU = locTimeSeries.solution(t);
+							spEval->set_time_point(t);
+
+							spEval->prepare_elem(locU, elem, id, vCornerCoords, ind, false);
+
+							tmpLocD = 0.0;
+							spEval->add_def_M_elem(tmpLocD, locU, elem, vCornerCoords, PT_INSTATIONARY);
+							locD.scale_append(vScaleMass[t], tmpLocD);
+
+							if(scale_stiff != 0.0)
+							{
+								tmpLocD = 0.0;
+								spEval->add_def_A_elem(tmpLocD, locU, elem, vCornerCoords, PT_INSTATIONARY);
+								locD.scale_append(scale_stiff, tmpLocD);
+							}
+							if(t == 0)
+								spEval->add_def_A_elem(locD, locU, elem, vCornerCoords, PT_STATIONARY);
+
+						//	explicit parts, only valid at lowest time discretization order
+							if(t == 1)
+							{
+								tmpLocD = 0.0;
+								spEval->add_def_A_expl_elem(tmpLocD, locU, elem, vCornerCoords, PT_INSTATIONARY);
+								const number dt = vSol->time(0)-vSol->time(1);
+								locD.scale_append(dt, tmpLocD);
+							}
+
+							if(scale_stiff != 0.0)
+							{
+								tmpLocD = 0.0;
+								spEval->add_rhs_elem(tmpLocD, elem, vCornerCoords, PT_INSTATIONARY);
+								locD.scale_append( - scale_stiff, tmpLocD);
+							}
+							if(t == 0)
+							{
+								tmpLocD = 0.0;
+								spEval->add_rhs_elem(tmpLocD, elem, vCornerCoords, PT_STATIONARY);
+								locD.scale_append( -1.0, tmpLocD);
+							}
+						}
+
+						AddLocalVector(d, locD);
+					}
+					catch(UGError& err)
+					{
+						#pragma omp critical (ThreadedAssembleError)
+						vErr.push_back(err);
+					}
+					catch(const std::exception& ex)
+					{
+						#pragma omp critical (ThreadedAssembleError)
+						vErr.push_back(UGError("Exception in element loop", ex, __FILE__, __LINE__));
+					}
+				}
+			}
+
+			FinishThreadEvaluator(spEval, vErr);
+		}
+
+		if(!vErr.empty()){
+			vErr[0].push_msg("ThreadedAssembleDefect: Cannot assemble element.", __FILE__, __LINE__);
+			throw vErr[0];
+		}
+	}
+#endif // UG_OPENMP
+
 }; // class StdGlobAssembler
 
 } // end namespace ug
@@ -38,7 +38,7 @@ namespace ug{
 template <typename TDomain>
 IElemDiscBase<TDomain>::IElemDiscBase(const char* functions, const char* subsets)
 	:	m_spApproxSpace(NULL), m_spFctPattern(0),
-	  	m_timePoint(0), m_pLocalVectorTimeSeries(NULL), m_bStationaryForced(false)
+	  	m_bStationaryForced(false)
 		//,m_id(ROID_UNKNOWN)
 {
 	if(functions == NULL) functions = "";
@@ -54,7 +54,7 @@ IElemDiscBase<TDomain>::
 IElemDiscBase(const std::vector<std::string>& vFct,
                               const std::vector<std::string>& vSubset)
 	: 	m_spApproxSpace(NULL), m_spFctPattern(0),
-		m_timePoint(0), m_pLocalVectorTimeSeries(NULL), m_bStationaryForced(false)
+		m_bStationaryForced(false)
 		//,m_id(ROID_UNKNOWN)
 {
 	set_functions(vFct);
@@ -438,17 +438,19 @@ set_time_dependent(LocalVectorTimeSeries& locTimeSeries,
                    const std::vector<number>& vScaleMass,
                    const std::vector<number>& vScaleStiff)
 {
-	m_pLocalVectorTimeSeries = &locTimeSeries;
-	m_vScaleMass = vScaleMass;
-	m_vScaleStiff = vScaleStiff;
+	TimeState& st = time_state();
+	st.pLocalVectorTimeSeries = &locTimeSeries;
+	st.vScaleMass = vScaleMass;
+	st.vScaleStiff = vScaleStiff;
 }
 
 template <typename TDomain>
 void IElemDiscBase<TDomain>::set_time_independent()
 {
-	m_pLocalVectorTimeSeries = NULL;
-	m_vScaleMass.clear();
-	m_vScaleStiff.clear();
+	TimeState& st = time_state();
+	st.pLocalVectorTimeSeries = NULL;
+	st.vScaleMass.clear();
+	st.vScaleStiff.clear();
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -484,7 +486,7 @@ do_prep_timestep_elem(const number time, LocalVector& u, GridObject* elem, const
 	//	access by map
 	u.access_by_map(asLeaf().map());
 	if(asLeaf().local_time_series_needed())
-		asLeaf().m_pLocalVectorTimeSeries->access_by_map(asLeaf().map());
+		asLeaf().time_state().pLocalVectorTimeSeries->access_by_map(asLeaf().map());
 
 	//	call assembling routine
 	if (this->m_vPrepareTimestepElemFct[m_roid] != NULL)
@@ -498,7 +500,7 @@ do_prep_elem(LocalVector& u, GridObject* elem, const ReferenceObjectID roid, con
 	//	access by map
 	u.access_by_map(asLeaf().map());
 	if(asLeaf().local_time_series_needed())
-		asLeaf().m_pLocalVectorTimeSeries->access_by_map(asLeaf().map());
+		asLeaf().time_state().pLocalVectorTimeSeries->access_by_map(asLeaf().map());
 
 	//	call assembling routine
 	UG_ASSERT(m_vPrepareElemFct[m_roid]!=NULL, "ElemDisc method prepare_elem missing.");
@@ -521,7 +523,7 @@ do_fsh_timestep_elem(const number time, LocalVector& u, GridObject* elem, const
 	//	access by map
 	u.access_by_map(asLeaf().map());
 	if(asLeaf().local_time_series_needed())
-		asLeaf().m_pLocalVectorTimeSeries->access_by_map(asLeaf().map());
+		asLeaf().time_state().pLocalVectorTimeSeries->access_by_map(asLeaf().map());
 
 	//	call assembling routine
 	if (this->m_vFinishTimestepElemFct[m_roid] != NULL)
@@ -570,7 +572,7 @@ do_add_jac_A_elem(LocalMatrix& J, LocalVector& u, GridObject* elem, const MathVe
 	u.access_by_map(asLeaf().map());
 	J.access_by_map(asLeaf().map());
 	if(asLeaf().local_time_series_needed())
-		asLeaf().m_pLocalVectorTimeSeries->access_by_map(asLeaf().map());
+		asLeaf().time_state().pLocalVectorTimeSeries->access_by_map(asLeaf().map());
 
 	//	call assembling routine
 	UG_ASSERT(m_vElemJAFct[m_roid]!=NULL, "ElemDisc method add_jac_A missing.");
@@ -588,7 +590,7 @@ do_add_jac_M_elem(LocalMatrix& J, LocalVector& u, GridObject* elem, const MathVe
 	u.access_by_map(asLeaf().map());
 	J.access_by_map(asLeaf().map());
 	if(asLeaf().local_time_series_needed())
-		asLeaf().m_pLocalVectorTimeSeries->access_by_map(asLeaf().map());
+		asLeaf().time_state().pLocalVectorTimeSeries->access_by_map(asLeaf().map());
 
 	//	call assembling routine
 	UG_ASSERT(m_vElemJMFct[m_roid]!=NULL, "ElemDisc method add_jac_M missing.");
@@ -603,7 +605,7 @@ do_add_def_A_elem(LocalVector& d, LocalVector& u, GridObject* elem, const MathVe
 	u.access_by_map(asLeaf().map());
 	d.access_by_map(asLeaf().map());
 	if(asLeaf().local_time_series_needed())
-		asLeaf().m_pLocalVectorTimeSeries->access_by_map(asLeaf().map());
+		asLeaf().time_state().pLocalVectorTimeSeries->access_by_map(asLeaf().map());
 
 	//	call assembling routine
 	UG_ASSERT(m_vElemdAFct[m_roid]!=NULL, "ElemDisc method add_def_A missing.");
@@ -618,7 +620,7 @@ do_add_def_A_expl_elem(LocalVector& d, LocalVector& u, GridObject* elem, const M
 	u.access_by_map(asLeaf().map());
 	d.access_by_map(asLeaf().map());
 	if(asLeaf().local_time_series_needed())
-		asLeaf().m_pLocalVectorTimeSeries->access_by_map(asLeaf().map());
+		asLeaf().time_state().pLocalVectorTimeSeries->access_by_map(asLeaf().map());
 
 	//	call assembling routine
 	if(this->m_vElemdAExplFct[m_roid] != NULL)
@@ -636,7 +638,7 @@ do_add_def_M_elem(LocalVector& d, LocalVector& u, GridObject* elem, const MathVe
 	u.access_by_map(asLeaf().map());
 	d.access_by_map(asLeaf().map());
 	if(asLeaf().local_time_series_needed())
-		asLeaf().m_pLocalVectorTimeSeries->access_by_map(asLeaf().map());
+		asLeaf().time_state().pLocalVectorTimeSeries->access_by_map(asLeaf().map());
 
 	//	call assembling routine
 	UG_ASSERT(m_vElemdMFct[m_roid]!=NULL, "ElemDisc method add_def_M missing.");
@@ -650,7 +652,7 @@ do_add_rhs_elem(LocalVector& rhs, GridObject* elem, const MathVector<dim> vCorne
 	//	access by map
 	rhs.access_by_map(asLeaf().map());
 	if(asLeaf().local_time_series_needed())
-		asLeaf().m_pLocalVectorTimeSeries->access_by_map(asLeaf().map());
+		asLeaf().time_state().pLocalVectorTimeSeries->access_by_map(asLeaf().map());
 
 	//	call assembling routine
 	UG_ASSERT(m_vElemRHSFct[m_roid]!=NULL, "ElemDisc method add_rhs missing.");
@@ -684,7 +686,7 @@ do_prep_err_est_elem(LocalVector& u, GridObject* elem, const MathVector<dim> vCo
 	//	access by map
 	u.access_by_map(asLeaf().map());
 	if (asLeaf().local_time_series_needed())
-		asLeaf().m_pLocalVectorTimeSeries->access_by_map(asLeaf().map());
+		asLeaf().time_state().pLocalVectorTimeSeries->access_by_map(asLeaf().map());
 
 	//	call assembling routine
 	UG_ASSERT(m_vPrepareErrEstElemFct[m_roid]!=NULL, "ElemDisc method prepare_err_est_elem missing.");
@@ -698,7 +700,7 @@ do_compute_err_est_A_elem(LocalVector& u, GridObject* elem, const MathVector<dim
 	//	access by map
 	u.access_by_map(asLeaf().map());
 	if (asLeaf().local_time_series_needed())
-		asLeaf().m_pLocalVectorTimeSeries->access_by_map(asLeaf().map());
+		asLeaf().time_state().pLocalVectorTimeSeries->access_by_map(asLeaf().map());
 
 	//	call assembling routine
 	if (this->m_vElemComputeErrEstAFct[m_roid] != NULL)
@@ -712,7 +714,7 @@ do_compute_err_est_M_elem(LocalVector& u, GridObject* elem, const MathVector<dim
 	//	access by map
 	u.access_by_map(asLeaf().map());
 	if(asLeaf().local_time_series_needed())
-		asLeaf().m_pLocalVectorTimeSeries->access_by_map(asLeaf().map());
+		asLeaf().time_state().pLocalVectorTimeSeries->access_by_map(asLeaf().map());
 
 	//	call assembling routine
 	if(this->m_vElemComputeErrEstMFct[m_roid] != NULL)
@@ -724,7 +726,7 @@ void IElemEstimatorFuncs<TLeaf, TDomain>::
 do_compute_err_est_rhs_elem(GridObject* elem, const MathVector<dim> vCornerCoords[], const number& scale)
 {
 	if(asLeaf().local_time_series_needed())
-		asLeaf().m_pLocalVectorTimeSeries->access_by_map(asLeaf().map());
+		asLeaf().time_state().pLocalVectorTimeSeries->access_by_map(asLeaf().map());
 
 	//	call assembling routine
 	if(this->m_vElemComputeErrEstRhsFct[m_roid] != NULL)
@@ -648,7 +648,7 @@ class IElemDiscBase
 		void set_time_independent();
 
 	///	returns if assembling is time-dependent
-		bool is_time_dependent() const {return (m_pLocalVectorTimeSeries != NULL) && !m_bStationaryForced;}
+		bool is_time_dependent() const {return (time_state().pLocalVectorTimeSeries != NULL) && !m_bStationaryForced;}
 
 	///	sets that the assembling is always stationary (even in instationary case)
 		void set_stationary(bool bStationaryForced = true) {m_bStationaryForced = bStationaryForced;}
@@ -668,15 +668,16 @@ class IElemDiscBase
 		bool local_time_series_needed() {return is_time_dependent() && requests_local_time_series();}
 
 	///	sets the current time point
-		void set_time_point(const size_t timePoint) {m_timePoint = timePoint;}
+		void set_time_point(const size_t timePoint) {time_state().timePoint = timePoint;}
 
 	///	returns the currently considered time point of the time-disc scheme
-		size_t time_point() const {return m_timePoint;}
+		size_t time_point() const {return time_state().timePoint;}
 
 	///	returns currently set timepoint
 		number time() const
 		{
-			if(m_pLocalVectorTimeSeries) return m_pLocalVectorTimeSeries->time(m_timePoint);
+			const TimeState& st = time_state();
+			if(st.pLocalVectorTimeSeries) return st.pLocalVectorTimeSeries->time(st.timePoint);
 			else return 0.0;
 		}
 
@@ -691,33 +692,53 @@ class IElemDiscBase
 	 * \returns vLocalTimeSol		vector of local time Solutions
 	 */
 		const LocalVectorTimeSeries* local_time_solutions() const
-		{return m_pLocalVectorTimeSeries;}
+		{return time_state().pLocalVectorTimeSeries;}
 
 	///	returns the weight factors of the time-disc scheme
 	///	\{
-		const std::vector<number>& mass_scales() const {return m_vScaleMass;}
-		const std::vector<number>& stiff_scales() const {return m_vScaleStiff;}
+		const std::vector<number>& mass_scales() const {return time_state().vScaleMass;}
+		const std::vector<number>& stiff_scales() const {return time_state().vScaleStiff;}
 
-		number mass_scale(const size_t timePoint) const {return m_vScaleMass[timePoint];}
-		number stiff_scale(const size_t timePoint) const {return m_vScaleStiff[timePoint];}
+		number mass_scale(const size_t timePoint) const {return time_state().vScaleMass[timePoint];}
+		number stiff_scale(const size_t timePoint) const {return time_state().vScaleStiff[timePoint];}
 
-		number mass_scale() const {return m_vScaleMass[m_timePoint];}
-		number stiff_scale() const {return m_vScaleStiff[m_timePoint];}
+		number mass_scale() const {const TimeState& st = time_state(); return st.vScaleMass[st.timePoint];}
+		number stiff_scale() const {const TimeState& st = time_state(); return st.vScaleStiff[st.timePoint];}
 	///	\}
 
 	protected:
-	///	time point
-		size_t m_timePoint;
+	///	time dependency of the element loop
+	/**
+	 * The time series is set by the DataEvaluator of the element loop. It is
+	 * held per thread, such that each thread of a thread-parallel element
+	 * loop uses its own local time series.
+	 */
+		struct TimeState
+		{
+			TimeState() : timePoint(0), pLocalVectorTimeSeries(NULL) {}
+
+		///	time point
+			size_t timePoint;
+
+		///	list of local vectors for all solutions of the time series
+			LocalVectorTimeSeries* pLocalVectorTimeSeries;
 
-	///	list of local vectors for all solutions of the time series
-		LocalVectorTimeSeries* m_pLocalVectorTimeSeries;
+		///	weight factors for time dependent assembling
+		/// \{
+			std::vector<number> vScaleMass;
+			std::vector<number> vScaleStiff;
+		/// \}
+		};
 
-	///	weight factors for time dependent assembling
+	///	returns the time state of the calling thread
 	/// \{
-		std::vector<number> m_vScaleMass;
-		std::vector<number> m_vScaleStiff;
+		TimeState& time_state() {return m_timeState.get();}
+		const TimeState& time_state() const {return m_timeState.get();}
 	/// \}
 
+	///	time state (per thread)
+		PerThread<TimeState> m_timeState;
+
 	///	flag if stationary assembling is to be used even in instationary assembling
 		bool m_bStationaryForced;
 
@@ -750,6 +771,16 @@ class IElemDiscBase
 	 * element assemblings but is needed for finite volumes
 	 */
 		virtual bool use_hanging() const {return false;}
+
+	///	returns if the element-wise assembling may be executed concurrently
+	/**
+	 * This function returns if the element-wise assembling functions of the
+	 * discretization may be called from several threads at the same time
+	 * (for different elements). This is only the case if no element-dependent
+	 * data is stored in the discretization itself, e.g. no geometry is
+	 * cached during prep_elem. The default is false.
+	 */
+		virtual bool thread_safe_elem_assembling() const {return false;}
 };
 
 
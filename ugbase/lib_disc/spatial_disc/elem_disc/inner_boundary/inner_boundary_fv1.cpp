@@ -101,7 +101,7 @@ prep_elem_loop(const ReferenceObjectID roid, const int si)
 	if (!TFVGeom::usesHangingNodes)
 	{
 		static const int refDim = TElem::dim;
-		static const TFVGeom& geo = GeomProvider<TFVGeom>::get();
+		const TFVGeom& geo = GeomProvider<TFVGeom>::get();
 		const MathVector<refDim>* vBFip = geo.bf_local_ips();
 		const size_t numBFip = geo.num_bf_local_ips();
 
@@ -131,7 +131,7 @@ prep_elem(const LocalVector& u, GridObject* elem, const ReferenceObjectID roid,
 	if (m_bCurrElemIsHSlave) return;
 
 	// update Geometry for this element
-	static TFVGeom& geo = GeomProvider<TFVGeom>::get();
+	TFVGeom& geo = GeomProvider<TFVGeom>::get();
 	try {geo.update(elem, vCornerCoords, &(this->subset_handler()));}
 	UG_CATCH_THROW("FV1InnerBoundaryElemDisc::prep_elem: "
 						"Cannot update Finite Volume Geometry.");
@@ -163,7 +163,7 @@ add_jac_A_elem(LocalMatrix& J, const LocalVector& u, GridObject* elem, const Mat
 	if (m_bCurrElemIsHSlave) return;
 
 	// get finite volume geometry
-	const static TFVGeom& fvgeom = GeomProvider<TFVGeom>::get();
+	const TFVGeom& fvgeom = GeomProvider<TFVGeom>::get();
 
 	for (size_t i = 0; i < fvgeom.num_bf(); ++i)
 	{
@@ -227,7 +227,7 @@ add_def_A_elem(LocalVector& d, const LocalVector& u, GridObject* elem, const Mat
 	if (m_bCurrElemIsHSlave) return;
 
 	// get finite volume geometry
-	static TFVGeom& fvgeom = GeomProvider<TFVGeom>::get();
+	TFVGeom& fvgeom = GeomProvider<TFVGeom>::get();
 
 	// loop Boundary Faces
 	for (size_t i = 0; i < fvgeom.num_bf(); ++i)
@@ -68,6 +68,16 @@ prepare_setting(const std::vector<LFEID>& vLfeID, bool bNonRegularGrid)
 	register_all_funcs(m_order);
 }
 
+template<typename TDomain>
+bool NeumannBoundaryFE<TDomain>::thread_safe_elem_assembling() const
+{
+	for(size_t i = 0; i < m_vBNDNumberData.size(); ++i)
+		if(!m_vBNDNumberData[i].functor->thread_safe_evaluation()) return false;
+	for(size_t i = 0; i < m_vVectorData.size(); ++i)
+		if(!m_vVectorData[i].functor->thread_safe_evaluation()) return false;
+	return true;
+}
+
 template<typename TDomain>
 void NeumannBoundaryFE<TDomain>::
 add(SmartPtr<CplUserData<number, dim> > data, const char* BndSubsets, const char* InnerSubsets)
@@ -159,6 +169,14 @@ prep_elem_loop(const ReferenceObjectID roid, const int si)
 	for(size_t data = 0; data < m_vNumberData.size(); ++data)
 	{
 		if(!m_vNumberData[data].InnerSSGrp.contains(m_si)) continue;
+
+	//	constant data is evaluated once and needs no import
+		if(m_vNumberData[data].import.constant()){
+			(*m_vNumberData[data].import.user_data())
+				(m_vNumberData[data].constVal, MathVector<dim>(0.0), this->time(), m_si);
+			continue;
+		}
+
 		m_vNumberData[data].import.set_fct(id,
 		                                   &m_vNumberData[data],
 		                                   &NumberData::template lin_def<TElem, TFEGeom>);
@@ -184,7 +202,8 @@ prep_elem(const LocalVector& u, GridObject* elem, const ReferenceObjectID roid,
 						"Cannot update Finite Element Geometry.");
 
 	for(size_t i = 0; i < m_vNumberData.size(); ++i)
-		if(m_vNumberData[i].InnerSSGrp.contains(m_si))
+		if(m_vNumberData[i].InnerSSGrp.contains(m_si)
+			&& !m_vNumberData[i].import.constant())
 			m_vNumberData[i].template extract_bip<TElem, TFEGeom>(geo);
 }
 
@@ -199,15 +218,17 @@ add_rhs_elem(LocalVector& d, GridObject* elem, const MathVector<dim> vCornerCoor
 //	Number Data
 	for(size_t data = 0; data < m_vNumberData.size(); ++data){
 		if(!m_vNumberData[data].InnerSSGrp.contains(m_si)) continue;
+		const bool bConst = m_vNumberData[data].import.constant();
 		for(size_t s = 0; s < m_vNumberData[data].BndSSGrp.size(); ++s){
 			const int si = m_vNumberData[data].BndSSGrp[s];
 			const std::vector<BF>& vBF = geo.bf(si);
 
 			for(size_t b = 0; b < vBF.size(); ++b){
 				for(size_t ip = 0; ip < vBF[b].num_ip(); ++ip){
+					const number val = bConst ? m_vNumberData[data].constVal
+											  : m_vNumberData[data].import[ip];
 					for(size_t sh = 0; sh < vBF[b].num_sh(); ++sh){
-						d(_C_, sh) -= m_vNumberData[data].import[ip]
-									 * vBF[b].shape(ip, sh) * vBF[b].weight(ip);
+						d(_C_, sh) -= val * vBF[b].shape(ip, sh) * vBF[b].weight(ip);
 					}
 				}
 			}
@@ -324,6 +345,8 @@ void NeumannBoundaryFE<TDomain>::NumberData::
 extract_bip(const TFEGeom& geo)
 {
 	typedef typename TFEGeom::BF BF;
+	std::vector<MathVector<dim> >& vLocIP = elemIPs->vLocIP;
+	std::vector<MathVector<dim> >& vGloIP = elemIPs->vGloIP;
 	vLocIP.clear();
 	vGloIP.clear();
 	for(size_t s = 0; s < this->BndSSGrp.size(); s++)
@@ -76,7 +76,7 @@ class NeumannBoundaryFE
 			NumberData(SmartPtr<CplUserData<number, dim> > data,
 					   std::string BndSubsets, std::string InnerSubsets,
 					   NeumannBoundaryFE* this_)
-				: base_type::Data(BndSubsets, InnerSubsets), This(this_)
+				: base_type::Data(BndSubsets, InnerSubsets), constVal(0.0), This(this_)
 			{
 				import.set_data(data);
 			}
@@ -90,8 +90,13 @@ class NeumannBoundaryFE
 						 const size_t nip);
 
 			DataImport<number, dim> import;
-			std::vector<MathVector<dim> > vLocIP;
-			std::vector<MathVector<dim> > vGloIP;
+			number constVal;	// value of constant data (assembled without import)
+			struct ElemIPs
+			{
+				std::vector<MathVector<dim> > vLocIP;
+				std::vector<MathVector<dim> > vGloIP;
+			};
+			PerThread<ElemIPs> elemIPs;	// ips of the current element (per thread)
 			NeumannBoundaryFE* This;
 		};
 		friend struct NumberData;
@@ -126,6 +131,15 @@ class NeumannBoundaryFE
 	///	type of trial space for each function used
 		virtual void prepare_setting(const std::vector<LFEID>& vLfeID, bool bNonRegularGrid);
 
+	///	returns if the element-wise assembling may be executed concurrently
+	/**
+	 * The integration points of the imports are held per thread. Thus, this
+	 * is the case if the conditional and vector data, that is evaluated
+	 * directly, may be evaluated concurrently. The imported data is checked
+	 * by the DataEvaluator.
+	 */
+		virtual bool thread_safe_elem_assembling() const;
+
 	protected:
 	///	current order of disc scheme
 		int m_order;
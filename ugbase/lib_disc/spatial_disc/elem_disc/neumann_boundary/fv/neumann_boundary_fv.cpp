@@ -73,6 +73,16 @@ prepare_setting(const std::vector<LFEID>& vLfeID, bool bNonRegularGrid)
 	register_all_funcs(m_order);
 }
 
+template<typename TDomain>
+bool NeumannBoundaryFV<TDomain>::thread_safe_elem_assembling() const
+{
+	for(size_t i = 0; i < m_vBNDNumberData.size(); ++i)
+		if(!m_vBNDNumberData[i].functor->thread_safe_evaluation()) return false;
+	for(size_t i = 0; i < m_vVectorData.size(); ++i)
+		if(!m_vVectorData[i].functor->thread_safe_evaluation()) return false;
+	return true;
+}
+
 template<typename TDomain>
 void NeumannBoundaryFV<TDomain>::
 add(SmartPtr<CplUserData<number, dim> > data, const char* BndSubsets, const char* InnerSubsets)
@@ -164,6 +174,14 @@ prep_elem_loop(const ReferenceObjectID roid, const int si)
 	for(size_t data = 0; data < m_vNumberData.size(); ++data)
 	{
 		if(!m_vNumberData[data].InnerSSGrp.contains(m_si)) continue;
+
+	//	constant data is evaluated once and needs no import
+		if(m_vNumberData[data].import.constant()){
+			(*m_vNumberData[data].import.user_data())
+				(m_vNumberData[data].constVal, MathVector<dim>(0.0), this->time(), m_si);
+			continue;
+		}
+
 		m_vNumberData[data].import.set_fct(id,
 		                                   &m_vNumberData[data],
 		                                   &NumberData::template lin_def<TElem, TFVGeom>);
@@ -187,7 +205,8 @@ prep_elem(const LocalVector& u, GridObject* elem, const ReferenceObjectID roid,
 						"Cannot update Finite Volume Geometry.");
 
 	for(size_t i = 0; i < m_vNumberData.size(); ++i)
-		if(m_vNumberData[i].InnerSSGrp.contains(m_si))
+		if(m_vNumberData[i].InnerSSGrp.contains(m_si)
+			&& !m_vNumberData[i].import.constant())
 			m_vNumberData[i].template extract_bip<TElem, TFVGeom>(geo);
 }
 
@@ -202,6 +221,7 @@ add_rhs_elem(LocalVector& d, GridObject* elem, const MathVector<dim> vCornerCoor
 //	Number Data
 	for(size_t data = 0; data < m_vNumberData.size(); ++data){
 		if(!m_vNumberData[data].InnerSSGrp.contains(m_si)) continue;
+		const bool bConst = m_vNumberData[data].import.constant();
 		size_t ip = 0;
 		for(size_t s = 0; s < m_vNumberData[data].BndSSGrp.size(); ++s){
 			const int si = m_vNumberData[data].BndSSGrp[s];
@@ -211,8 +231,9 @@ add_rhs_elem(LocalVector& d, GridObject* elem, const MathVector<dim> vCornerCoor
 				const int co = vBF[b].node_id();
 
 				for(size_t i = 0; i < vBF[b].num_ip(); ++i, ++ip){
-					d(_C_, co) -= m_vNumberData[data].import[ip]
-					             * vBF[b].volume() * vBF[b].weight(i);
+					const number val = bConst ? m_vNumberData[data].constVal
+											  : m_vNumberData[data].import[ip];
+					d(_C_, co) -= val * vBF[b].volume() * vBF[b].weight(i);
 				}
 			}
 		}
@@ -335,6 +356,7 @@ extract_bip(const TFVGeom& geo)
 	static const int locDim = TElem::dim;
 
 	std::vector<MathVector<locDim> >* vLocIP = local_ips<locDim>();
+	std::vector<MathVector<dim> >& vGloIP = elemIPs->vGloIP;
 
 	vLocIP->clear();
 	vGloIP.clear();
@@ -362,9 +384,9 @@ std::vector<MathVector<refDim> >* NeumannBoundaryFV<TDomain>::NumberData::local_
 {
 	switch (refDim)
 	{
-		case 1: return (std::vector<MathVector<refDim> >*)(&vLocIP_dim1);
-		case 2: return (std::vector<MathVector<refDim> >*)(&vLocIP_dim2);
-		case 3: return (std::vector<MathVector<refDim> >*)(&vLocIP_dim3);
+		case 1: return (std::vector<MathVector<refDim> >*)(&elemIPs->vLocIP_dim1);
+		case 2: return (std::vector<MathVector<refDim> >*)(&elemIPs->vLocIP_dim2);
+		case 3: return (std::vector<MathVector<refDim> >*)(&elemIPs->vLocIP_dim3);
 	}
 }
 
@@ -62,6 +62,16 @@ prepare_setting(const std::vector<LFEID>& vLfeID, bool bNonRegularGrid)
 		UG_THROW("NeumannBoundary: FV Scheme only implemented for 1st order Lagrange.");
 }
 
+template<typename TDomain>
+bool NeumannBoundaryFV1<TDomain>::thread_safe_elem_assembling() const
+{
+	for(size_t i = 0; i < m_vBNDNumberData.size(); ++i)
+		if(!m_vBNDNumberData[i].functor->thread_safe_evaluation()) return false;
+	for(size_t i = 0; i < m_vVectorData.size(); ++i)
+		if(!m_vVectorData[i].functor->thread_safe_evaluation()) return false;
+	return true;
+}
+
 template<typename TDomain>
 void NeumannBoundaryFV1<TDomain>::
 add(SmartPtr<CplUserData<number, dim> > data, const char* BndSubsets, const char* InnerSubsets)
@@ -110,7 +120,7 @@ prep_elem_loop(const ReferenceObjectID roid, const int si)
 	m_si = si;
 
 //	register subsetIndex at Geometry
-	static TFVGeom& geo = GeomProvider<TFVGeom >::get();
+	TFVGeom& geo = GeomProvider<TFVGeom >::get();
 
 //	request subset indices as boundary subset. This will force the
 //	creation of boundary subsets when calling geo.update
@@ -146,6 +156,14 @@ prep_elem_loop(const ReferenceObjectID roid, const int si)
 	for(size_t data = 0; data < m_vNumberData.size(); ++data)
 	{
 		if(!m_vNumberData[data].InnerSSGrp.contains(m_si)) continue;
+
+	//	constant data is evaluated once and needs no import
+		if(m_vNumberData[data].import.constant()){
+			(*m_vNumberData[data].import.user_data())
+				(m_vNumberData[data].constVal, MathVector<dim>(0.0), this->time(), m_si);
+			continue;
+		}
+
 		m_vNumberData[data].import.set_fct(id,
 		                                   &m_vNumberData[data],
 		                                   &NumberData::template lin_def<TElem, TFVGeom>);
@@ -161,7 +179,7 @@ void NeumannBoundaryFV1<TDomain>::
 prep_elem(const LocalVector& u, GridObject* elem, const ReferenceObjectID roid, const MathVector<dim> vCornerCoords[])
 {
 //  update Geometry for this element
-	static TFVGeom& geo = GeomProvider<TFVGeom >::get();
+	TFVGeom& geo = GeomProvider<TFVGeom >::get();
 	try{
 		geo.update(elem, vCornerCoords, &(this->subset_handler()));
 	}
@@ -169,7 +187,8 @@ prep_elem(const LocalVector& u, GridObject* elem, const ReferenceObjectID roid,
 						"Cannot update Finite Volume Geometry.");
 
 	for(size_t i = 0; i < m_vNumberData.size(); ++i)
-		if(m_vNumberData[i].InnerSSGrp.contains(m_si))
+		if(m_vNumberData[i].InnerSSGrp.contains(m_si)
+			&& !m_vNumberData[i].import.constant())
 			m_vNumberData[i].template extract_bip<TElem, TFVGeom>(geo);
 }
 
@@ -178,12 +197,13 @@ template<typename TElem, typename TFVGeom>
 void NeumannBoundaryFV1<TDomain>::
 add_rhs_elem(LocalVector& d, GridObject* elem, const MathVector<dim> vCornerCoords[])
 {
-	const static TFVGeom& geo = GeomProvider<TFVGeom >::get();
+	const TFVGeom& geo = GeomProvider<TFVGeom >::get();
 	typedef typename TFVGeom::BF BF;
 
 //	Number Data
 	for(size_t data = 0; data < m_vNumberData.size(); ++data){
 		if(!m_vNumberData[data].InnerSSGrp.contains(m_si)) continue;
+		const bool bConst = m_vNumberData[data].import.constant();
 		size_t ip = 0;
 		for(size_t s = 0; s < m_vNumberData[data].BndSSGrp.size(); ++s){
 			const int si = m_vNumberData[data].BndSSGrp[s];
@@ -191,8 +211,9 @@ add_rhs_elem(LocalVector& d, GridObject* elem, const MathVector<dim> vCornerCoor
 
 			for(size_t i = 0; i < vBF.size(); ++i, ++ip){
 				const int co = vBF[i].node_id();
-				d(_C_, co) -= m_vNumberData[data].import[ip]
-				                                    * vBF[i].volume();
+				const number val = bConst ? m_vNumberData[data].constVal
+										  : m_vNumberData[data].import[ip];
+				d(_C_, co) -= val * vBF[i].volume();
 			}
 		}
 	}
@@ -239,7 +260,7 @@ void NeumannBoundaryFV1<TDomain>::
 fsh_elem_loop()
 {
 //	remove subsetIndex from Geometry
-	static TGeom& geo = GeomProvider<TGeom >::get();
+	TGeom& geo = GeomProvider<TGeom >::get();
 
 
 //	unrequest subset indices as boundary subset. This will force the
@@ -510,7 +531,7 @@ lin_def(const LocalVector& u,
             const size_t nip)
 {
 //  get finite volume geometry
-	const static TFVGeom& geo = GeomProvider<TFVGeom>::get();
+	const TFVGeom& geo = GeomProvider<TFVGeom>::get();
 	typedef typename TFVGeom::BF BF;
 
 	for(size_t s = 0; s < this->BndSSGrp.size(); ++s)
@@ -533,6 +554,7 @@ extract_bip(const TFVGeom& geo)
 	static const int locDim = TElem::dim;
 
 	std::vector<MathVector<locDim> >* vLocIP = local_ips<locDim>();
+	std::vector<MathVector<dim> >& vGloIP = elemIPs->vGloIP;
 
 	vLocIP->clear();
 	vGloIP.clear();
@@ -568,9 +590,9 @@ std::vector<MathVector<refDim> >* NeumannBoundaryFV1<TDomain>::NumberData::local
 {
 	switch (refDim)
 	{
-		case 1: return (std::vector<MathVector<refDim> >*)(&vLocIP_dim1);
-		case 2: return (std::vector<MathVector<refDim> >*)(&vLocIP_dim2);
-		case 3: return (std::vector<MathVector<refDim> >*)(&vLocIP_dim3);
+		case 1: return (std::vector<MathVector<refDim> >*)(&elemIPs->vLocIP_dim1);
+		case 2: return (std::vector<MathVector<refDim> >*)(&elemIPs->vLocIP_dim2);
+		case 3: return (std::vector<MathVector<refDim> >*)(&elemIPs->vLocIP_dim3);
 	}
 }
 
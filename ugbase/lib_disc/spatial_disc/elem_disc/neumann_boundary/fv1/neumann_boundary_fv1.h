@@ -78,7 +78,7 @@ class NeumannBoundaryFV1
 		{
 			NumberData(SmartPtr<CplUserData<number, dim> > data,
 			           std::string BndSubsets, std::string InnerSubsets)
-				: base_type::Data(BndSubsets, InnerSubsets)
+				: base_type::Data(BndSubsets, InnerSubsets), constVal(0.0)
 			{
 				import.set_data(data);
 			}
@@ -102,10 +102,15 @@ class NeumannBoundaryFV1
 			std::vector<MathVector<refDim> >* local_ips();
 
 			DataImport<number, dim> import;
-			std::vector<MathVector<3> > vLocIP_dim3;
-			std::vector<MathVector<2> > vLocIP_dim2;	// might have Neumann bnd for lower-dim elements!
-			std::vector<MathVector<1> > vLocIP_dim1;
-			std::vector<MathVector<dim> > vGloIP;
+			number constVal;	// value of constant data (assembled without import)
+			struct ElemIPs
+			{
+				std::vector<MathVector<3> > vLocIP_dim3;
+				std::vector<MathVector<2> > vLocIP_dim2;	// might have Neumann bnd for lower-dim elements!
+				std::vector<MathVector<1> > vLocIP_dim1;
+				std::vector<MathVector<dim> > vGloIP;
+			};
+			PerThread<ElemIPs> elemIPs;	// ips of the current element (per thread)
 		};
 
 	///	Conditional scalar user data
@@ -142,6 +147,15 @@ class NeumannBoundaryFV1
 	///	type of trial space for each function used
 		virtual void prepare_setting(const std::vector<LFEID>& vLfeID, bool bNonRegularGrid);
 
+	///	returns if the element-wise assembling may be executed concurrently
+	/**
+	 * The integration points of the imports are held per thread. Thus, this
+	 * is the case if the conditional and vector data, that is evaluated
+	 * directly, may be evaluated concurrently. The imported data is checked
+	 * by the DataEvaluator.
+	 */
+		virtual bool thread_safe_elem_assembling() const;
+
 	protected:
 	///	assembling functions for fv1
 	///	\{
@@ -0,0 +1,362 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+
+#ifndef __H__UG__LIB_DISC__SPATIAL_DISC__FIXED_PATTERN_MAPPER__
+#define __H__UG__LIB_DISC__SPATIAL_DISC__FIXED_PATTERN_MAPPER__
+
+// extern headers
+#include <map>
+#include <vector>
+
+// intern headers
+#include "lib_disc/common/local_algebra.h"
+#include "local_to_global_mapper.h"
+
+namespace ug{
+
+/// LocalToGlobal mapping reusing the sparsity pattern of previous assemblings
+/**
+ * This mapper is intended for the repeated assembling of matrices with an
+ * unchanged sparsity pattern (e.g. Jacobians in a Newton iteration or in
+ * time stepping). The first assembling is carried out as usual, but the
+ * global indices of all added local matrices are recorded. At the beginning
+ * of the next assembling (see prepare_matrix), the pattern of the matrix is
+ * finalized into a contiguous CRS layout and the positions of all local
+ * entries in the value array of the matrix are computed once. All further
+ * assemblings add the local matrices directly to these positions, i.e.
+ * without searching the connections and without reallocation.
+ *
+ * The indices of each local matrix are compared to the recorded ones. If
+ * they differ (e.g. since the grid or the element order changed) or the
+ * pattern of the matrix has been released, the usual adding is used and the
+ * pattern is recorded again in the next assembling.
+ *
+ * The recorded data is stored per matrix, so that one mapper can be used
+ * for several matrices assembled alternately (e.g. the matrices of the
+ * levels of a multigrid hierarchy or a Jacobian and a mass matrix). A record
+ * is only used for the matrix with the recorded pattern revision (see
+ * SparseMatrix::pattern_revision), i.e. it is never applied to a resized
+ * matrix or a new matrix at the address of a destroyed one. Records that
+ * have not been used for MAX_UNUSED_PREPARE preparations are removed.
+ *
+ * \tparam	TAlgebra			type of Algebra
+ */
+template <typename TAlgebra>
+class FixedPatternLocalToGlobalMapper : public ILocalToGlobalMapper<TAlgebra>
+{
+	public:
+	///	Algebra type
+		typedef TAlgebra algebra_type;
+
+	///	Type of algebra matrix
+		typedef typename algebra_type::matrix_type matrix_type;
+
+	///	Type of algebra vector
+		typedef typename algebra_type::vector_type vector_type;
+
+	public:
+	///	default constructor
+		FixedPatternLocalToGlobalMapper()
+			: m_numPrepare(0), m_pCurrMat(NULL), m_pCurr(NULL) {}
+
+	///	prepares a new assembling of the matrix
+	/**
+	 * This method must be called before the matrix is resized for a new
+	 * assembling. If the previous assembling of the same matrix has been
+	 * recorded completely, the pattern of the matrix is finalized here and
+	 * the positions of the local entries are computed. In this case, the
+	 * matrix must not be resized (which would drop the pattern), but only
+	 * its values must be cleared (see SparseMatrix::clear_values).
+	 *
+	 * \param[in]	mat			matrix to be assembled
+	 * \param[in]	numIndex	number of rows and columns
+	 * \returns		true if the matrix is assembled in its finalized pattern
+	 */
+		bool prepare_matrix(matrix_type& mat, size_t numIndex)
+		{
+			++m_numPrepare;
+			remove_unused_records();
+
+			PatternRecord& rec = m_mRecord[&mat];
+			rec.lastPrepare = m_numPrepare;
+			m_pCurrMat = &mat;
+			m_pCurr = &rec;
+
+			const bool bSame = rec.bValid
+								&& (rec.revision == mat.pattern_revision())
+								&& (numIndex == rec.numIndex)
+								&& (mat.num_rows() == numIndex)
+								&& (mat.num_cols() == numIndex);
+
+			if(bSame)
+			{
+			//	previous assembling has been recorded: finalize pattern
+				if(!rec.bReplay)
+				{
+					mat.finalize_pattern();
+					rec.bReplay = compute_slots(rec, mat);
+				}
+
+			//	replay as long as the pattern is unchanged
+				if(rec.bReplay && mat.pattern_finalized())
+				{
+					rec.currElem = 0;
+					return true;
+				}
+			}
+
+		//	record the coming assembling
+			rec.clear();
+			rec.numIndex = numIndex;
+			rec.bValid = true;
+			return false;
+		}
+
+	///	forgets about all recorded data
+		void clear()
+		{
+			m_mRecord.clear();
+			m_numPrepare = 0;
+			m_pCurrMat = NULL;
+			m_pCurr = NULL;
+		}
+
+	///	adds a local vector to the global one
+		void add_local_vec_to_global(vector_type& vec, const LocalVector& lvec,
+		                             ConstSmartPtr<DoFDistribution> dd)
+			{AddLocalVector(vec, lvec);}
+
+	///	adds a local matrix to the global one
+		void add_local_mat_to_global(matrix_type& mat, const LocalMatrix& lmat,
+		                             ConstSmartPtr<DoFDistribution> dd)
+		{
+		//	find the record of the matrix
+			if(&mat != m_pCurrMat)
+			{
+				typename std::map<const matrix_type*, PatternRecord>::iterator
+					iter = m_mRecord.find(&mat);
+				m_pCurrMat = &mat;
+				m_pCurr = (iter != m_mRecord.end()) ? &iter->second : NULL;
+			}
+
+			if(m_pCurr && m_pCurr->bValid)
+			{
+				if(m_pCurr->bReplay)
+				{
+					if(replay(*m_pCurr, mat, lmat)) return;
+
+				//	pattern differs: use usual adding and record again next time
+					m_pCurr->bValid = false;
+				}
+				else
+					record(*m_pCurr, mat, lmat);
+			}
+
+			AddLocalMatrixToGlobal(mat, lmat);
+		}
+
+	///	modifies local solution vector for adapted defect computation
+		void modify_LocalSol(LocalVector& vecMod, const LocalVector& lvec,
+		                     ConstSmartPtr<DoFDistribution> dd) {}
+
+	///	destructor
+		~FixedPatternLocalToGlobalMapper() {}
+
+	protected:
+	///	recorded data of one matrix
+		struct PatternRecord
+		{
+			PatternRecord() : lastPrepare(0) {clear();}
+
+			void clear()
+			{
+				vRowInd.clear(); vColInd.clear();
+				vRowOffset.assign(1, 0); vColOffset.assign(1, 0);
+				vSlot.clear(); vSlotOffset.clear();
+				numIndex = 0;
+				revision = 0;
+				bValid = false; bReplay = false;
+				currElem = 0;
+			}
+
+		///	recorded size
+			size_t numIndex;
+
+		///	pattern revision of the recorded matrix
+			size_t revision;
+
+		///	number of the last preparation using this record
+			size_t lastPrepare;
+
+		///	flag if recorded data can be used
+			bool bValid;
+
+		///	flag if positions have been computed and are used
+			bool bReplay;
+
+		///	current element in replay
+			size_t currElem;
+
+		///	recorded row and column indices of all elements
+		/// \{
+			std::vector<DoFIndex> vRowInd, vColInd;
+			std::vector<size_t> vRowOffset, vColOffset;
+		/// \}
+
+		///	positions of all local entries in the value array
+		/// \{
+			std::vector<int> vSlot;
+			std::vector<size_t> vSlotOffset;
+		/// \}
+		};
+
+	///	appends the indices of a local matrix to the recorded ones
+		void record(PatternRecord& rec, const matrix_type& mat, const LocalMatrix& lmat)
+		{
+			rec.revision = mat.pattern_revision();
+
+			const LocalIndices& rowInd = lmat.get_row_indices();
+			const LocalIndices& colInd = lmat.get_col_indices();
+
+			for(size_t fct1=0; fct1 < lmat.num_all_row_fct(); ++fct1)
+				for(size_t dof1=0; dof1 < lmat.num_all_row_dof(fct1); ++dof1)
+					rec.vRowInd.push_back(rowInd.multi_index(fct1,dof1));
+			rec.vRowOffset.push_back(rec.vRowInd.size());
+
+			for(size_t fct2=0; fct2 < lmat.num_all_col_fct(); ++fct2)
+				for(size_t dof2=0; dof2 < lmat.num_all_col_dof(fct2); ++dof2)
+					rec.vColInd.push_back(colInd.multi_index(fct2,dof2));
+			rec.vColOffset.push_back(rec.vColInd.size());
+		}
+
+	///	computes the positions of all recorded entries in the value array
+	/**	returns false if a recorded connection is not in the matrix pattern */
+		bool compute_slots(PatternRecord& rec, const matrix_type& mat)
+		{
+			const size_t numElem = rec.vRowOffset.size() - 1;
+			rec.vSlotOffset.resize(numElem + 1);
+			rec.vSlot.clear();
+
+			for(size_t e = 0; e < numElem; ++e)
+			{
+				rec.vSlotOffset[e] = rec.vSlot.size();
+				for(size_t i = rec.vRowOffset[e]; i < rec.vRowOffset[e+1]; ++i)
+					for(size_t j = rec.vColOffset[e]; j < rec.vColOffset[e+1]; ++j)
+					{
+						const int slot = mat.value_index(rec.vRowInd[i][0], rec.vColInd[j][0]);
+						if(slot < 0) return false;
+						rec.vSlot.push_back(slot);
+					}
+			}
+			rec.vSlotOffset[numElem] = rec.vSlot.size();
+			return true;
+		}
+
+	///	removes the records not used in the last MAX_UNUSED_PREPARE preparations
+		void remove_unused_records()
+		{
+			typename std::map<const matrix_type*, PatternRecord>::iterator
+				iter = m_mRecord.begin();
+			while(iter != m_mRecord.end())
+			{
+				if(iter->second.lastPrepare + MAX_UNUSED_PREPARE < m_numPrepare)
+					m_mRecord.erase(iter++);
+				else
+					++iter;
+			}
+		}
+
+	///	adds a local matrix using the computed positions (false if indices differ)
+		bool replay(PatternRecord& rec, matrix_type& mat, const LocalMatrix& lmat)
+		{
+			const size_t e = rec.currElem;
+			if(e + 1 >= rec.vRowOffset.size()) return false;
+
+			const LocalIndices& rowInd = lmat.get_row_indices();
+			const LocalIndices& colInd = lmat.get_col_indices();
+
+		//	check that the indices coincide with the recorded ones
+			size_t i = rec.vRowOffset[e];
+			for(size_t fct1=0; fct1 < lmat.num_all_row_fct(); ++fct1)
+				for(size_t dof1=0; dof1 < lmat.num_all_row_dof(fct1); ++dof1, ++i)
+					if(i >= rec.vRowOffset[e+1] || rec.vRowInd[i] != rowInd.multi_index(fct1,dof1))
+						return false;
+			if(i != rec.vRowOffset[e+1]) return false;
+
+			size_t j = rec.vColOffset[e];
+			for(size_t fct2=0; fct2 < lmat.num_all_col_fct(); ++fct2)
+				for(size_t dof2=0; dof2 < lmat.num_all_col_dof(fct2); ++dof2, ++j)
+					if(j >= rec.vColOffset[e+1] || rec.vColInd[j] != colInd.multi_index(fct2,dof2))
+						return false;
+			if(j != rec.vColOffset[e+1]) return false;
+
+		//	add entries
+			const int* pSlot = &rec.vSlot[rec.vSlotOffset[e]];
+			for(size_t fct1=0; fct1 < lmat.num_all_row_fct(); ++fct1)
+				for(size_t dof1=0; dof1 < lmat.num_all_row_dof(fct1); ++dof1)
+				{
+					const size_t rowComp = rowInd.comp(fct1,dof1);
+
+					for(size_t fct2=0; fct2 < lmat.num_all_col_fct(); ++fct2)
+						for(size_t dof2=0; dof2 < lmat.num_all_col_dof(fct2); ++dof2)
+						{
+							const size_t colComp = colInd.comp(fct2,dof2);
+
+							BlockRef(mat.value_by_index(*pSlot++), rowComp, colComp)
+										+= lmat.value(fct1,dof1,fct2,dof2);
+						}
+				}
+
+			++rec.currElem;
+			return true;
+		}
+
+	protected:
+	///	number of preparations after which an unused record is removed
+		static const size_t MAX_UNUSED_PREPARE = 64;
+
+	///	recorded data for each assembled matrix
+		std::map<const matrix_type*, PatternRecord> m_mRecord;
+
+	///	number of preparations so far
+		size_t m_numPrepare;
+
+	///	matrix of the last access and its record (NULL if not recorded)
+	/// \{
+		const matrix_type* m_pCurrMat;
+		PatternRecord* m_pCurr;
+	/// \}
+};
+
+} // end namespace ug
+
+#endif /* __H__UG__LIB_DISC__SPATIAL_DISC__FIXED_PATTERN_MAPPER__*/
@@ -116,6 +116,9 @@ class StdConstData
 	///	returns if data is constant
 		virtual bool constant() const {return true;}
 
+	///	returns that the data may be evaluated concurrently
+		virtual bool thread_safe_evaluation() const {return true;}
+
 	///	returns if grid function is needed for evaluation
 		virtual bool requires_grid_fct() const {return false;}
 
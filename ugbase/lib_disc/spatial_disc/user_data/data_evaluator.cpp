@@ -99,6 +99,10 @@ void DataEvaluator<TDomain>::finish_elem_loop()
 
 //	clear positions at user data
 	clear_positions_in_user_data();
+
+//	add the elements of this loop to the profiler statistics
+	PROFILE_COUNTER_ADD(AssembledElements(), m_numPreparedElem);
+	m_numPreparedElem = 0;
 }
 
 
@@ -135,6 +139,11 @@ prepare_elem(LocalVector& u, GridObject* elem, const ReferenceObjectID roid, con
              const LocalIndices& ind,
              bool bDeriv)
 {
+//	count elements for the allocation statistics of the profiler output
+#ifdef UG_PROFILER
+	++m_numPreparedElem;
+#endif
+
 // 	prepare element
 	try{
 		for(size_t i = 0; i < m_vElemDisc[PT_ALL].size(); ++i){
@@ -76,6 +76,17 @@ class DataEvaluatorBase
 	///	returns if one of the element discs needs hanging dofs
 		bool use_hanging() const {return m_bUseHanging;}
 
+	///	returns if the element-wise evaluation may be called concurrently
+	/**
+	 * The element-wise evaluation is thread-safe, if all element discs
+	 * declare so and all user data to be evaluated may be evaluated
+	 * concurrently. Imports and user data hold the values of the current
+	 * element per thread, thus each thread must prepare the element loop with
+	 * its own DataEvaluator. Only valid after the element loop has been
+	 * prepared.
+	 */
+		bool thread_safe() const;
+
 		
 
 	///	prepares the element loop for all IElemDiscs for the computation of the error estimator
@@ -180,7 +191,8 @@ public:
 		              LocalVectorTimeSeries* locTimeSeries = NULL,
 		              const std::vector<number>* vScaleMass = NULL,
 		              const std::vector<number>* vScaleStiff = NULL)
-	: DataEvaluatorBase<TDomain, IElemDisc<TDomain> > (discPart, vElemDisc, fctPat, bNonRegularGrid, locTimeSeries, vScaleMass, vScaleStiff) {}
+	: DataEvaluatorBase<TDomain, IElemDisc<TDomain> > (discPart, vElemDisc, fctPat, bNonRegularGrid, locTimeSeries, vScaleMass, vScaleStiff),
+	  m_numPreparedElem(0) {}
 
 
 	////////////////////////////////////////////
@@ -241,6 +253,8 @@ protected:
 	using base_type::clear_positions_in_user_data;
 	using base_type::extract_imports_and_userdata;
 
+	///	number of elements prepared in the current loop (profiler builds only)
+	size_t m_numPreparedElem;
 };
 
 
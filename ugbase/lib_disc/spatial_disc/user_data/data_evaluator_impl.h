@@ -90,6 +90,25 @@ DataEvaluatorBase(int discPart,
 }
 
 
+template <typename TDomain, typename TElemDisc>
+bool DataEvaluatorBase<TDomain, TElemDisc>::thread_safe() const
+{
+	for(size_t i = 0; i < m_vElemDisc[PT_ALL].size(); ++i)
+		if(!m_vElemDisc[PT_ALL][i]->thread_safe_elem_assembling())
+			return false;
+
+//	imports and user data hold their element state per thread, but the
+//	evaluation itself must not modify shared state
+	for(size_t i = 0; i < m_vConstData.size(); ++i)
+		if(!m_vConstData[i]->thread_safe_evaluation()) return false;
+	for(size_t i = 0; i < m_vPosData.size(); ++i)
+		if(!m_vPosData[i]->thread_safe_evaluation()) return false;
+	for(size_t i = 0; i < m_vDependentData.size(); ++i)
+		if(!m_vDependentData[i]->thread_safe_evaluation()) return false;
+
+	return true;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // DataEvaluatorBase Setup
 ///////////////////////////////////////////////////////////////////////////////
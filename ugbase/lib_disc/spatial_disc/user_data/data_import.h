@@ -181,9 +181,7 @@ class DataImport : public IDataImport<dim>
 	public:
 	/// Constructor
 		DataImport(bool bLinDefect = true) : IDataImport<dim>(bLinDefect),
-			m_id(ROID_UNKNOWN),
-			m_seriesID(-1),	m_spUserData(NULL), m_vValue(NULL),
-			m_numIP(0), m_spDependentUserData(NULL)
+			m_spUserData(NULL), m_spDependentUserData(NULL)
 		{clear_fct();
 		}
 
@@ -215,25 +213,27 @@ class DataImport : public IDataImport<dim>
 		}
 
 	///	returns the data value at ip
-		const TData& operator[](size_t ip) const{check_ip(ip); return m_vValue[ip];}
+		const TData& operator[](size_t ip) const{check_ip(ip); return import_state().vValue[ip];}
 
 	///	returns the data value at ip
-		const TData* values() const {check_values(); return m_vValue;}
+		const TData* values() const {check_values(); return import_state().vValue;}
 
 	///	return the derivative w.r.t to local function at ip
 		const TData* deriv(size_t ip, size_t fct) const
 		{
 			UG_ASSERT(m_spDependentUserData.valid(), "No Dependent Data set");
-			UG_ASSERT(m_seriesID >= 0, "No series ticket set");
-			return m_spDependentUserData->deriv(m_seriesID, ip, fct);
+			const int seriesID = import_state().seriesID;
+			UG_ASSERT(seriesID >= 0, "No series ticket set");
+			return m_spDependentUserData->deriv(seriesID, ip, fct);
 		}
 
 	///	return the derivative w.r.t to local function and dof at ip
 		const TData& deriv(size_t ip, size_t fct, size_t dof) const
 		{
 			UG_ASSERT(m_spDependentUserData.valid(), "No Dependent Data set");
-			UG_ASSERT(m_seriesID >= 0, "No series ticket set");
-			return m_spDependentUserData->deriv(m_seriesID, ip, fct, dof);
+			const int seriesID = import_state().seriesID;
+			UG_ASSERT(seriesID >= 0, "No series ticket set");
+			return m_spDependentUserData->deriv(seriesID, ip, fct, dof);
 		}
 
 	/////////////////////////////////////////
@@ -241,7 +241,7 @@ class DataImport : public IDataImport<dim>
 	/////////////////////////////////////////
 
 	/// number of integration points
-		size_t num_ip() const {return m_numIP;}
+		size_t num_ip() const {return import_state().numIP;}
 
 	///	set the local integration points
 		template <int ldim>
@@ -270,7 +270,7 @@ class DataImport : public IDataImport<dim>
 	///	position of ip
 		const MathVector<dim>& position(size_t i) const
 		{
-			if(data_given()) return m_spUserData->ip(m_seriesID, i);
+			if(data_given()) return m_spUserData->ip(import_state().seriesID, i);
 			 UG_THROW("DataImport::position: "
 					 	 	 "No Data set, but positions requested.");
 		}
@@ -285,25 +285,26 @@ class DataImport : public IDataImport<dim>
 	/// number of shapes for local function
 		size_t num_sh(size_t fct) const
 		{
-			UG_ASSERT(fct <  m_vvNumDoFPerFct[fct], "Invalid index");
-			return m_vvNumDoFPerFct[fct];
+			const std::vector<size_t>& vNumDoFPerFct = import_state().vvNumDoFPerFct;
+			UG_ASSERT(fct <  vNumDoFPerFct.size(), "Invalid index");
+			return vNumDoFPerFct[fct];
 		}
 
 	///	returns the pointer to all  linearized defects at one ip
 		TData* lin_defect(size_t ip, size_t fct)
-			{check_ip_fct(ip,fct);return &(m_vvvLinDefect[ip][fct][0]);}
+			{check_ip_fct(ip,fct);return &(import_state().vvvLinDefect[ip][fct][0]);}
 
 	///	returns the pointer to all  linearized defects at one ip
 		const TData* lin_defect(size_t ip, size_t fct) const
-			{check_ip_fct(ip,fct);return &(m_vvvLinDefect[ip][fct][0]);}
+			{check_ip_fct(ip,fct);return &(import_state().vvvLinDefect[ip][fct][0]);}
 
 	///	returns the linearized defect
 		TData& lin_defect(size_t ip, size_t fct, size_t sh)
-			{check_ip_fct_sh(ip,fct,sh);return m_vvvLinDefect[ip][fct][sh];}
+			{check_ip_fct_sh(ip,fct,sh);return import_state().vvvLinDefect[ip][fct][sh];}
 
 	/// const access to lin defect
 		const TData& lin_defect(size_t ip, size_t fct, size_t sh) const
-			{check_ip_fct_sh(ip,fct,sh);return m_vvvLinDefect[ip][fct][sh];}
+			{check_ip_fct_sh(ip,fct,sh);return import_state().vvvLinDefect[ip][fct][sh];}
 
 	/// compute jacobian for derivative w.r.t. non-system owned unknowns
 		void add_jacobian(LocalMatrix& J, const number scale);
@@ -344,15 +345,16 @@ class DataImport : public IDataImport<dim>
 	///	compute lin defect
 		virtual void compute_lin_defect(LocalVector& u)
 		{
+			ImportState& st = import_state();
 		///	compute the linearization only if the export parameter is 'at current time'
-			if (! m_spUserData->at_current_time (m_seriesID))
+			if (! m_spUserData->at_current_time (st.seriesID))
 				return;
 		///	compute the linearization
-			UG_ASSERT(m_vLinDefectFunc[m_id] != NULL, "No evaluation function.");
-			UG_ASSERT(num_ip() == 0 || m_vvvLinDefect.size() >= num_ip(),
-			          "DataImport: Num ip "<<num_ip()<<", but memory: "<<m_vvvLinDefect.size());
+			UG_ASSERT(m_vLinDefectFunc[st.id] != NULL, "No evaluation function.");
+			UG_ASSERT(num_ip() == 0 || st.vvvLinDefect.size() >= num_ip(),
+			          "DataImport: Num ip "<<num_ip()<<", but memory: "<<st.vvvLinDefect.size());
 			u.access_by_map(this->map());
-			(m_vLinDefectFunc[m_id])(u, &m_vvvLinDefect[0], m_numIP);
+			(m_vLinDefectFunc[st.id])(u, &st.vvvLinDefect[0], st.numIP);
 		}
 
 	protected:
@@ -374,32 +376,47 @@ class DataImport : public IDataImport<dim>
 	///	resizes the lin defect arrays for current number of ips.
 		void resize_defect_array();
 
-	/// current Geom Object
-		ReferenceObjectID m_id;
+	///	element loop state of the import (per thread)
+		struct ImportState
+		{
+			ImportState() : id(ROID_UNKNOWN), seriesID(-1), vValue(NULL), numIP(0) {}
+
+		/// current Geom Object
+			ReferenceObjectID id;
+
+		///	series number provided by export
+			int seriesID;
+
+		///	cached access to the UserData field
+			const TData* vValue;
+
+		///	number of ips
+			size_t numIP;
+
+		///	number of functions and their dofs
+			std::vector<size_t> vvNumDoFPerFct;
+
+		/// linearized defect (num_ip) x (num_fct) x (num_dofs(i))
+			std::vector<std::vector<std::vector<TData> > > vvvLinDefect;
+		};
+
+	///	returns the state of the calling thread
+	/// \{
+		ImportState& import_state() {return m_importState.get();}
+		const ImportState& import_state() const {return m_importState.get();}
+	/// \}
+
+	///	element loop state (per thread)
+		PerThread<ImportState> m_importState;
 
 	///	function pointers for all elem types
 		LinDefectFunc m_vLinDefectFunc[NUM_REFERENCE_OBJECTS];
 
-	///	series number provided by export
-		int m_seriesID;
-
 	/// connected UserData
 		SmartPtr<CplUserData<TData, dim> > m_spUserData;
 
-	///	cached access to the UserData field
-		const TData* m_vValue;
-
-	///	number of ips
-		size_t m_numIP;
-
 	/// connected export (if depended data)
 		SmartPtr<DependentUserData<TData, dim> > m_spDependentUserData;
-
-	///	number of functions and their dofs
-		std::vector<size_t> m_vvNumDoFPerFct;
-
-	/// linearized defect (num_ip) x (num_fct) x (num_dofs(i))
-		std::vector<std::vector<std::vector<TData> > > m_vvvLinDefect;
 };
 
 } // end namespace ug
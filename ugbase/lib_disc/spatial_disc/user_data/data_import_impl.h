@@ -53,7 +53,7 @@ void DataImport<TData,dim>::set_roid(ReferenceObjectID id)
 	if(id == ROID_UNKNOWN)
 		UG_THROW("DataImport::set_roid: Setting unknown ReferenceObjectId.");
 
-	m_id = id;
+	import_state().id = id;
 }
 
 template <typename TData, int dim>
@@ -62,17 +62,18 @@ void DataImport<TData,dim>::check_setup()
 //	if lin defect is not supposed to be computed, we're done
 	if(!this->m_bCompLinDefect) return;
 
-	if(m_id == ROID_UNKNOWN)
+	const ReferenceObjectID id = import_state().id;
+	if(id == ROID_UNKNOWN)
 		UG_THROW("DataImport::check_setup: The reference element "
 				"type has not been set for evaluation.");
 
 //	Check for evaluation function and choose it if present
-	if(m_vLinDefectFunc[m_id] != NULL)
+	if(m_vLinDefectFunc[id] != NULL)
 		return;
 
 //	fails
 	UG_THROW("DataImport::check_setup: No evaluation function for computation of "
-			"linearized defect registered for "<<m_id<<", but required. "
+			"linearized defect registered for "<<id<<", but required. "
 			"(world dim: "<<dim<<", part: "<<this->part()<<")");
 }
 
@@ -129,11 +130,17 @@ void DataImport<TData,dim>::set_data(SmartPtr<CplUserData<TData, dim> > spData)
 template <typename TData, int dim>
 void DataImport<TData,dim>::cache_data_access()
 {
+		ImportState& st = import_state();
+
+	//	the callback is shared by all threads, but the calling thread may not
+	//	have requested its series yet
+		if(st.seriesID < 0) return;
+
 	//	cache the pointer to the data field.
-		m_vValue = m_spUserData->values(m_seriesID);
+		st.vValue = m_spUserData->values(st.seriesID);
 
 	//	in addition we cache the number of ips
-		m_numIP = m_spUserData->num_ip(m_seriesID);
+		st.numIP = m_spUserData->num_ip(st.seriesID);
 }
 
 template <typename TData, int dim>
@@ -144,10 +151,12 @@ void DataImport<TData,dim>::set_local_ips(const MathVector<ldim>* vPos, size_t n
 //	if no data set, skip
 	if(!data_given()) return;
 
+	ImportState& st = import_state();
+
 //	request series if first time requested
-	if(m_seriesID == -1)
+	if(st.seriesID == -1)
 	{
-		m_seriesID = m_spUserData->template
+		st.seriesID = m_spUserData->template
 					register_local_ip_series<ldim>(vPos,numIP,timePointSpec,bMayChange);
 
 	//	register callback, invoked when data field is changed
@@ -160,7 +169,7 @@ void DataImport<TData,dim>::set_local_ips(const MathVector<ldim>* vPos, size_t n
 		resize_defect_array();
 
 	//	check that num ip is correct
-		UG_ASSERT(m_numIP == numIP, "Different number of ips than requested.");
+		UG_ASSERT(st.numIP == numIP, "Different number of ips than requested.");
 	}
 	else
 	{
@@ -168,10 +177,10 @@ void DataImport<TData,dim>::set_local_ips(const MathVector<ldim>* vPos, size_t n
 			UG_THROW("DataImport: Setting different local ips to non-changable ip series.");
 
 	//	set new local ips
-		m_spUserData->template set_local_ips<ldim>(m_seriesID,vPos,numIP);
-		m_spUserData->set_time_point(m_seriesID,timePointSpec);
+		m_spUserData->template set_local_ips<ldim>(st.seriesID,vPos,numIP);
+		m_spUserData->set_time_point(st.seriesID,timePointSpec);
 
-		if(numIP != m_numIP)
+		if(numIP != st.numIP)
 		{
 		//	cache access to the data
 			cache_data_access();
@@ -181,7 +190,7 @@ void DataImport<TData,dim>::set_local_ips(const MathVector<ldim>* vPos, size_t n
 		}
 
 	//	check that num ip is correct
-		UG_ASSERT(m_numIP == numIP, "Different number of ips than requested.");
+		UG_ASSERT(st.numIP == numIP, "Different number of ips than requested.");
 	}
 }
 
@@ -210,7 +219,7 @@ void DataImport<TData,dim>::set_local_ips(const MathVector<dim>* vPos, size_t nu
 template <typename TData, int dim>
 void DataImport<TData,dim>::set_time_point(int timePointSpec)
 {
-	m_spUserData->set_time_point(m_seriesID,timePointSpec);
+	m_spUserData->set_time_point(import_state().seriesID,timePointSpec);
 }
 
 template <typename TData, int dim>
@@ -220,18 +229,20 @@ void DataImport<TData,dim>::set_global_ips(const MathVector<dim>* vPos, size_t n
 	if(!data_given()) return;
 
 //	set global ips for series ID
-	UG_ASSERT(m_seriesID >= 0, "Wrong series id.");
-	m_spUserData->set_global_ips(m_seriesID,vPos,numIP);
+	const int seriesID = import_state().seriesID;
+	UG_ASSERT(seriesID >= 0, "Wrong series id.");
+	m_spUserData->set_global_ips(seriesID,vPos,numIP);
 }
 
 template <typename TData, int dim>
 void DataImport<TData,dim>::clear_ips()
 {
 	if(data_given()) m_spUserData->unregister_storage_callback(this);
-	m_seriesID = -1;
-	m_vValue = 0;
-	m_numIP = 0;
-	m_vvvLinDefect.resize(num_ip());
+	ImportState& st = import_state();
+	st.seriesID = -1;
+	st.vValue = 0;
+	st.numIP = 0;
+	st.vvvLinDefect.resize(num_ip());
 }
 
 template <typename TData, int dim>
@@ -239,8 +250,10 @@ void DataImport<TData,dim>::add_jacobian(LocalMatrix& J, const number scale)
 {
 	UG_ASSERT(m_spDependentUserData.valid(), "No Export set.");
 
+	const int seriesID = import_state().seriesID;
+
 ///	compute the linearization only if the export parameter is 'at current time'
-	if (! m_spUserData->at_current_time (m_seriesID))
+	if (! m_spUserData->at_current_time (seriesID))
 		return;
 	
 //	access jacobian by maps
@@ -255,7 +268,7 @@ void DataImport<TData,dim>::add_jacobian(LocalMatrix& J, const number scale)
 			{
 			//	get array of linearized defect and derivative
 				const TData* LinDef = lin_defect(ip, fct1);
-				const TData* Deriv = m_spDependentUserData->deriv(m_seriesID, ip, fct2);
+				const TData* Deriv = m_spDependentUserData->deriv(seriesID, ip, fct2);
 
 			//	loop shapes of functions
 				for(size_t sh1 = 0; sh1 < num_sh(fct1); ++sh1)
@@ -274,13 +287,22 @@ void DataImport<TData,dim>::update_dof_sizes(const LocalIndices& ind)
 	const FunctionIndexMapping& map = this->map();
 	UG_ASSERT(map.num_fct() == this->num_fct(), "Number function mismatch.");
 
-//	cache numFct and their numDoFs
-	m_vvNumDoFPerFct.resize(map.num_fct());
-	for(size_t fct = 0; fct < m_vvNumDoFPerFct.size(); ++fct)
-		m_vvNumDoFPerFct[fct] = ind.num_dof(map[fct]);
+	ImportState& st = import_state();
 
-	m_vvvLinDefect.clear();
-	resize_defect_array();
+//	cache numFct and their numDoFs
+	st.vvNumDoFPerFct.resize(map.num_fct());
+	for(size_t fct = 0; fct < st.vvNumDoFPerFct.size(); ++fct)
+		st.vvNumDoFPerFct[fct] = ind.num_dof(map[fct]);
+
+//	resize the arrays in place, such that the memory is reused from element
+//	to element (the number of ips is only grown)
+	if(st.vvvLinDefect.size() < st.numIP) st.vvvLinDefect.resize(st.numIP);
+	for(size_t ip = 0; ip < st.vvvLinDefect.size(); ++ip)
+	{
+		st.vvvLinDefect[ip].resize(st.vvNumDoFPerFct.size());
+		for(size_t fct = 0; fct < st.vvNumDoFPerFct.size(); ++fct)
+			st.vvvLinDefect[ip][fct].resize(st.vvNumDoFPerFct[fct]);
+	}
 }
 
 template <typename TData, int dim>
@@ -288,20 +310,21 @@ void DataImport<TData,dim>::resize_defect_array()
 {
 //	get old size
 //	NOTE: for all ips up to oldSize the arrays are already resized
-	const size_t oldSize = m_vvvLinDefect.size();
+	ImportState& st = import_state();
+	const size_t oldSize = st.vvvLinDefect.size();
 
 //	resize ips
-	m_vvvLinDefect.resize(num_ip());
+	st.vvvLinDefect.resize(st.numIP);
 
 //	resize num fct
-	for(size_t ip = oldSize; ip < num_ip(); ++ip)
+	for(size_t ip = oldSize; ip < st.numIP; ++ip)
 	{
 	//	resize num fct
-		m_vvvLinDefect[ip].resize(m_vvNumDoFPerFct.size());
+		st.vvvLinDefect[ip].resize(st.vvNumDoFPerFct.size());
 
 	//	resize dofs
-		for(size_t fct = 0; fct < m_vvNumDoFPerFct.size(); ++fct)
-			m_vvvLinDefect[ip][fct].resize(m_vvNumDoFPerFct[fct]);
+		for(size_t fct = 0; fct < st.vvNumDoFPerFct.size(); ++fct)
+			st.vvvLinDefect[ip][fct].resize(st.vvNumDoFPerFct[fct]);
 	}
 }
 
@@ -309,27 +332,27 @@ template <typename TData, int dim>
 inline void DataImport<TData,dim>::check_ip_fct(size_t ip, size_t fct) const
 {
 	check_ip(ip);
-	UG_ASSERT(ip  < m_vvvLinDefect.size(), "Invalid index.");
-	UG_ASSERT(fct < m_vvvLinDefect[ip].size(), "Invalid index.");
+	UG_ASSERT(ip  < import_state().vvvLinDefect.size(), "Invalid index.");
+	UG_ASSERT(fct < import_state().vvvLinDefect[ip].size(), "Invalid index.");
 }
 
 template <typename TData, int dim>
 inline void DataImport<TData,dim>::check_ip_fct_sh(size_t ip, size_t fct, size_t sh) const
 {
 	check_ip_fct(ip, fct);
-	UG_ASSERT(sh < m_vvvLinDefect[ip][fct].size(), "Invalid index.");
+	UG_ASSERT(sh < import_state().vvvLinDefect[ip][fct].size(), "Invalid index.");
 }
 
 template <typename TData, int dim>
 inline void DataImport<TData,dim>::check_ip(size_t ip) const
 {
-	UG_ASSERT(ip < m_numIP, "Invalid index.");
+	UG_ASSERT(ip < import_state().numIP, "Invalid index.");
 }
 
 template <typename TData, int dim>
 inline void DataImport<TData,dim>::check_values() const
 {
-	UG_ASSERT(m_vValue != NULL, "Data Value field not set.");
+	UG_ASSERT(import_state().vValue != NULL, "Data Value field not set.");
 }
 
 } // end namespace ug
@@ -95,6 +95,9 @@ class StdDataLinker
 	///	returns if derivative is zero
 		virtual bool zero_derivative() const;
 
+	///	returns if all inputs may be evaluated concurrently
+		virtual bool thread_safe_evaluation() const;
+
 	public:
 	///	returns if the derivative of the i'th input is zero
 		bool zero_derivative(size_t i) const
@@ -160,9 +163,10 @@ class StdDataLinker
 	///	returns the series id set for the i'th input
 		size_t series_id(size_t i, size_t s) const
 		{
-			UG_ASSERT(i < m_vvSeriesID.size(), "invalid index");
-			UG_ASSERT(s < m_vvSeriesID[i].size(), "invalid index");
-			return m_vvSeriesID[i][s];
+			const std::vector<std::vector<size_t> >& vvSeriesID = *m_vvSeriesID;
+			UG_ASSERT(i < vvSeriesID.size(), "invalid index");
+			UG_ASSERT(s < vvSeriesID[i].size(), "invalid index");
+			return vvSeriesID[i][s];
 		}
 
 	///	requests series id's from input data
@@ -184,8 +188,8 @@ class StdDataLinker
 	///	Function mapping for each input relative to common FunctionGroup
 		std::vector<FunctionIndexMapping> m_vMap;
 
-	///	series id the linker uses to get data from input
-		std::vector<std::vector<size_t> > m_vvSeriesID;
+	///	series id the linker uses to get data from input (per thread)
+		PerThread<std::vector<std::vector<size_t> > > m_vvSeriesID;
 
 	protected:
 	///	access to implementation
@@ -88,8 +88,8 @@ void StdDataLinker<TImpl,TData,dim>::eval_deriv(LocalVector* u, GridObject* elem
 
 	for(size_t s = 0; s < this->num_series(); ++s){
 
-		if(bDeriv && this->m_vvvvDeriv[s].size() > 0)
-			vvvDeriv = &this->m_vvvvDeriv[s][0];
+		if(bDeriv && this->deriv_state().vvvvDeriv[s].size() > 0)
+			vvvDeriv = &this->deriv_state().vvvvDeriv[s][0];
 		else
 			vvvDeriv = NULL;
 
@@ -113,8 +113,8 @@ void StdDataLinker<TImpl,TData,dim>::eval_deriv(LocalVectorTimeSeries* u, GridOb
 
 		bool bDoDeriv = bDeriv && this->at_current_time (s); // derivatives only for the 'current' time point!
 
-		if(bDoDeriv && this->m_vvvvDeriv[s].size() > 0)
-			vvvDeriv = &this->m_vvvvDeriv[s][0];
+		if(bDoDeriv && this->deriv_state().vvvvDeriv[s].size() > 0)
+			vvvDeriv = &this->deriv_state().vvvvDeriv[s][0];
 		else
 			vvvDeriv = NULL;
 
@@ -184,6 +184,16 @@ bool StdDataLinker<TImpl,TData,dim>::zero_derivative() const
 	return bRet;
 }
 
+template <typename TImpl, typename TData, int dim>
+bool StdDataLinker<TImpl,TData,dim>::thread_safe_evaluation() const
+{
+	for(size_t i = 0; i < m_vspICplUserData.size(); ++i)
+		if(m_vspICplUserData[i].invalid()
+			|| !m_vspICplUserData[i]->thread_safe_evaluation())
+			return false;
+	return true;
+}
+
 template <typename TImpl, typename TData, int dim>
 void StdDataLinker<TImpl,TData,dim>::check_setup() const
 {
@@ -242,9 +252,10 @@ void StdDataLinker<TImpl,TData,dim>::
 local_ip_series_added(const size_t seriesID)
 {
 	const size_t s = seriesID;
+	std::vector<std::vector<size_t> >& vvSeriesID = *m_vvSeriesID;
 
 //	 we need a series id for all inputs
-	m_vvSeriesID.resize(m_vspICplUserData.size());
+	vvSeriesID.resize(m_vspICplUserData.size());
 
 //	loop inputs
 	for(size_t i = 0; i < m_vspICplUserData.size(); ++i)
@@ -253,28 +264,28 @@ local_ip_series_added(const size_t seriesID)
 		UG_ASSERT(m_vspICplUserData[i].valid(), "No Input set, but requested.");
 
 	//	resize series ids
-		m_vvSeriesID[i].resize(s+1);
+		vvSeriesID[i].resize(s+1);
 
 	//	request local ips for series at input data
 		switch(this->dim_local_ips())
 		{
 			case 1:
-				m_vvSeriesID[i][s] =
+				vvSeriesID[i][s] =
 						m_vspICplUserData[i]->template register_local_ip_series<1>
 								(this->template local_ips<1>(s), this->num_ip(s),
-								 this->m_vTimePoint[s], this->m_vMayChange[s]);
+								 this->ip_state().vTimePoint[s], this->ip_state().vMayChange[s]);
 				break;
 			case 2:
-				m_vvSeriesID[i][s] =
+				vvSeriesID[i][s] =
 						m_vspICplUserData[i]->template register_local_ip_series<2>
 								(this->template local_ips<2>(s), this->num_ip(s),
-								 this->m_vTimePoint[s], this->m_vMayChange[s]);
+								 this->ip_state().vTimePoint[s], this->ip_state().vMayChange[s]);
 				break;
 			case 3:
-				m_vvSeriesID[i][s] =
+				vvSeriesID[i][s] =
 						m_vspICplUserData[i]->template register_local_ip_series<3>
 								(this->template local_ips<3>(s), this->num_ip(s),
-								 this->m_vTimePoint[s], this->m_vMayChange[s]);
+								 this->ip_state().vTimePoint[s], this->ip_state().vMayChange[s]);
 				break;
 			default: UG_THROW("Dimension not supported."); break;
 		}
@@ -290,6 +301,7 @@ void StdDataLinker<TImpl,TData,dim>::
 local_ips_changed(const size_t seriesID, const size_t newNumIP)
 {
 	const size_t s = seriesID;
+	const std::vector<std::vector<size_t> >& vvSeriesID = *m_vvSeriesID;
 
 //	loop inputs
 	for(size_t i = 0; i < m_vspICplUserData.size(); ++i)
@@ -300,13 +312,13 @@ local_ips_changed(const size_t seriesID, const size_t newNumIP)
 		switch(this->dim_local_ips())
 		{
 			case 1: m_vspICplUserData[i]->template set_local_ips<1>
-					(m_vvSeriesID[i][s], this->template local_ips<1>(s), this->num_ip(s));
+					(vvSeriesID[i][s], this->template local_ips<1>(s), this->num_ip(s));
 				break;
 			case 2: m_vspICplUserData[i]->template set_local_ips<2>
-					(m_vvSeriesID[i][s], this->template local_ips<2>(s), this->num_ip(s));
+					(vvSeriesID[i][s], this->template local_ips<2>(s), this->num_ip(s));
 				break;
 			case 3: m_vspICplUserData[i]->template set_local_ips<3>
-					(m_vvSeriesID[i][s], this->template local_ips<3>(s), this->num_ip(s));
+					(vvSeriesID[i][s], this->template local_ips<3>(s), this->num_ip(s));
 				break;
 			default: UG_THROW("Dimension not supported."); break;
 		}
@@ -320,6 +332,8 @@ template <typename TImpl, typename TData, int dim>
 void StdDataLinker<TImpl,TData,dim>::
 global_ips_changed(const size_t seriesID, const MathVector<dim>* vPos, const size_t numIP)
 {
+	const std::vector<std::vector<size_t> >& vvSeriesID = *m_vvSeriesID;
+
 //	loop inputs
 	for(size_t i = 0; i < m_vspICplUserData.size(); ++i)
 	{
@@ -327,7 +341,7 @@ global_ips_changed(const size_t seriesID, const MathVector<dim>* vPos, const siz
 		UG_ASSERT(m_vspICplUserData[i].valid(), "No Input set, but requested.");
 
 	//	adjust global ids of imported data
-		m_vspICplUserData[i]->set_global_ips(m_vvSeriesID[i][seriesID], vPos, numIP);
+		m_vspICplUserData[i]->set_global_ips(vvSeriesID[i][seriesID], vPos, numIP);
 	}
 }
 
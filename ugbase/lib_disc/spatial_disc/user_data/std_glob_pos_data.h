@@ -110,6 +110,14 @@ class StdGlobPosData
 	///	returns if data is constant
 		virtual bool constant() const {return false;}
 
+	///	returns if the data may be evaluated concurrently
+	/**
+	 * The evaluation of a function of the position is assumed to be
+	 * thread-safe. Implementations calling into non-reentrant code (e.g. an
+	 * interpreter) must override this.
+	 */
+		virtual bool thread_safe_evaluation() const {return true;}
+
 	///	returns if grid function is needed for evaluation
 		virtual bool requires_grid_fct() const {return false;}
 
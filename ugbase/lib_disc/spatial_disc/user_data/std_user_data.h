@@ -182,8 +182,8 @@ class StdDependentUserData
 
 			for(size_t s = 0; s < this->num_series(); ++s){
 				
-				if(bDeriv && this->m_vvvvDeriv[s].size() > 0)
-					vvvDeriv = &this->m_vvvvDeriv[s][0];
+				if(bDeriv && this->deriv_state().vvvvDeriv[s].size() > 0)
+					vvvDeriv = &this->deriv_state().vvvvDeriv[s][0];
 				else
 					vvvDeriv = NULL;
 
@@ -206,8 +206,8 @@ class StdDependentUserData
 				
 				bool bDoDeriv = bDeriv && this->at_current_time (s); // derivatives only for the 'current' time point!
 
-				if(bDoDeriv && this->m_vvvvDeriv[s].size() > 0)
-					vvvDeriv = &this->m_vvvvDeriv[s][0];
+				if(bDoDeriv && this->deriv_state().vvvvDeriv[s].size() > 0)
+					vvvDeriv = &this->deriv_state().vvvvDeriv[s][0];
 				else
 					vvvDeriv = NULL;
 
@@ -38,6 +38,7 @@
 #include "lib_disc/common/local_algebra.h"
 #include "lib_disc/time_disc/solution_time_series.h"
 #include "lib_disc/common/function_group.h"
+#include "common/util/per_thread.h"
 
 namespace ug{
 
@@ -241,27 +242,36 @@ class ICplUserData : virtual public UserDataInfo
 
 	public:
 	///	set the subset of evaluation
-		void set_subset(int si) {m_si = si;}
+		void set_subset(int si) {ip_state().si = si;}
 
 	///	returns the subset of evaluation
-		int subset() const {return m_si;}
+		int subset() const {return ip_state().si;}
 
 	///	set evaluation time
-		void set_times(const std::vector<number>& vTime) {m_vTime = vTime;}
+		void set_times(const std::vector<number>& vTime) {ip_state().vTime = vTime;}
 
 	/// sets the current time point
-		void set_time_point(size_t timePoint) {m_timePoint = timePoint;}
+		void set_time_point(size_t timePoint) {ip_state().timePoint = timePoint;}
 		
 	///	returns the current time point
-		size_t time_point() {return m_timePoint;}
+		size_t time_point() {return ip_state().timePoint;}
 
 	///	get the current evaluation time
-		number time() const {return m_vTime[m_timePoint];}
+		number time() const {const IPState& st = ip_state(); return st.vTime[st.timePoint];}
 
 	public:
 	///	returns if data is constant
 		virtual bool constant() const {return false;}
 
+	///	returns if the data may be evaluated by several threads concurrently
+	/**
+	 * The ip series, values and derivatives are held per thread. Thus, this is
+	 * the case if the evaluation does not modify any other state of the data
+	 * or of shared objects (e.g. an interpreter). The default is false, i.e.
+	 * data must opt in.
+	 */
+		virtual bool thread_safe_evaluation() const {return false;}
+
 	///	number of other Data this data depends on
 		virtual size_t num_needed_data() const {return 0;}
 
@@ -295,10 +305,10 @@ class ICplUserData : virtual public UserDataInfo
 
 	public:
 	///	returns the number of ip series
-		size_t num_series() const {return m_vNumIP.size();}
+		size_t num_series() const {return ip_state().vNumIP.size();}
 
 	/// returns the number of integration points
-		size_t num_ip(size_t s) const {UG_ASSERT(s < num_series(), "Invalid series"); return m_vNumIP[s];}
+		size_t num_ip(size_t s) const {UG_ASSERT(s < num_series(), "Invalid series"); return ip_state().vNumIP[s];}
 
 	///	set local positions, returns series id
 	/**
@@ -343,7 +353,7 @@ class ICplUserData : virtual public UserDataInfo
 		void set_time_point(const size_t seriesId, const int timePointSpec);
 
 	///	returns current local ip dimension
-		int dim_local_ips() const {return m_locPosDim;}
+		int dim_local_ips() const {return ip_state().locPosDim;}
 
 	///	returns local ips
 		template <int ldim>
@@ -360,7 +370,7 @@ class ICplUserData : virtual public UserDataInfo
 		inline size_t time_point(size_t s) const;
 		
 	///	get the specified evaluation time
-		number time(size_t s) const {return m_vTime[time_point(s)];}
+		number time(size_t s) const {return ip_state().vTime[time_point(s)];}
 
 	///	returns true iff the time point specification is equal to the current one, or not specified
 		inline bool at_current_time(size_t s) const;
@@ -369,10 +379,10 @@ class ICplUserData : virtual public UserDataInfo
 		void set_global_ips(size_t s, const MathVector<dim>* vPos, size_t numIP);
 
 	///	returns global ips
-		const MathVector<dim>* ips(size_t s) const {check_s(s); return m_vvGlobPos[s];}
+		const MathVector<dim>* ips(size_t s) const {check_s(s); return ip_state().vvGlobPos[s];}
 
 	/// returns global ip
-		const MathVector<dim>& ip(size_t s, size_t ip) const{check_s_ip(s,ip); return m_vvGlobPos[s][ip];}
+		const MathVector<dim>& ip(size_t s, size_t ip) const{check_s_ip(s,ip); return ip_state().vvGlobPos[s][ip];}
 
 	protected:
 	///	callback invoked after local ips have been added to the series
@@ -388,13 +398,13 @@ class ICplUserData : virtual public UserDataInfo
 	 * 		 invoke the local_ip_series_to_be_cleared() callback, and adding all local
 	 * 		 series again.
 	 */
-		virtual void local_ip_series_added(const size_t seriesID){m_vvGlobPos.resize(seriesID+1);}
+		virtual void local_ip_series_added(const size_t seriesID){ip_state().vvGlobPos.resize(seriesID+1);}
 
 	///	callback invoked, if a local ip series has been changed
 		virtual void local_ips_changed(const size_t seriesID, const size_t newNumIP) = 0;
 
 	///	callback invoked, when local ips are cleared
-		virtual void local_ip_series_to_be_cleared() {m_vvGlobPos.clear();}
+		virtual void local_ip_series_to_be_cleared() {ip_state().vvGlobPos.clear();}
 
 	///	callback invoked after global ips have been changed
 	/**
@@ -412,45 +422,66 @@ class ICplUserData : virtual public UserDataInfo
 
 	protected:
 	///	help function to get local ips
-		std::vector<const MathVector<1>*>& get_local_ips(Int2Type<1>) {return m_pvLocIP1d;}
-		std::vector<const MathVector<2>*>& get_local_ips(Int2Type<2>) {return m_pvLocIP2d;}
-		std::vector<const MathVector<3>*>& get_local_ips(Int2Type<3>) {return m_pvLocIP3d;}
-		const std::vector<const MathVector<1>*>& get_local_ips(Int2Type<1>) const {return m_pvLocIP1d;}
-		const std::vector<const MathVector<2>*>& get_local_ips(Int2Type<2>) const {return m_pvLocIP2d;}
-		const std::vector<const MathVector<3>*>& get_local_ips(Int2Type<3>) const {return m_pvLocIP3d;}
+		std::vector<const MathVector<1>*>& get_local_ips(Int2Type<1>) {return ip_state().pvLocIP1d;}
+		std::vector<const MathVector<2>*>& get_local_ips(Int2Type<2>) {return ip_state().pvLocIP2d;}
+		std::vector<const MathVector<3>*>& get_local_ips(Int2Type<3>) {return ip_state().pvLocIP3d;}
+		const std::vector<const MathVector<1>*>& get_local_ips(Int2Type<1>) const {return ip_state().pvLocIP1d;}
+		const std::vector<const MathVector<2>*>& get_local_ips(Int2Type<2>) const {return ip_state().pvLocIP2d;}
+		const std::vector<const MathVector<3>*>& get_local_ips(Int2Type<3>) const {return ip_state().pvLocIP3d;}
 
 	protected:
-	///	flags if local ips may change
-		std::vector<bool> m_vMayChange;
+	///	ip series, positions and times of the evaluation
+	/**
+	 * This state is set up by the element loops and changes from element to
+	 * element. It is held per thread, such that several threads may evaluate
+	 * the same data concurrently (see thread_safe_evaluation()).
+	 */
+		struct IPState
+		{
+			IPState() : locPosDim(-1), vTime(1, 0.0), timePoint(0), si(-1) {}
 
-	/// number of evaluation points (-1 indicates no ips set)
-		std::vector<size_t> m_vNumIP;
+		///	flags if local ips may change
+			std::vector<bool> vMayChange;
 
-	/// dimension of local position (-1 indicates no dim set)
-		int m_locPosDim;
+		/// number of evaluation points (-1 indicates no ips set)
+			std::vector<size_t> vNumIP;
 
-	/// local ips of dimension 1d-3d
-		std::vector<const MathVector<1>*> m_pvLocIP1d;
-		std::vector<const MathVector<2>*> m_pvLocIP2d;
-		std::vector<const MathVector<3>*> m_pvLocIP3d;
-		
-	///	time points for the series
-		std::vector<int> m_vTimePoint;
+		/// dimension of local position (-1 indicates no dim set)
+			int locPosDim;
 
-	/// global ips
-		std::vector<const MathVector<dim>*> m_vvGlobPos;
+		/// local ips of dimension 1d-3d
+			std::vector<const MathVector<1>*> pvLocIP1d;
+			std::vector<const MathVector<2>*> pvLocIP2d;
+			std::vector<const MathVector<3>*> pvLocIP3d;
 
-	///	time for evaluation
-		std::vector<number> m_vTime;
+		///	time points for the series
+			std::vector<int> vTimePoint;
+
+		/// global ips
+			std::vector<const MathVector<dim>*> vvGlobPos;
+
+		///	time for evaluation
+			std::vector<number> vTime;
+
+		///	current time point (used if no explicit specification for series)
+			size_t timePoint;
+
+		///	subset for evaluation
+			int si;
+		};
+
+	///	returns the ip state of the calling thread
+	/// \{
+		IPState& ip_state() {return m_ipState.get();}
+		const IPState& ip_state() const {return m_ipState.get();}
+	/// \}
+
+	protected:
+	///	ip state (per thread)
+		PerThread<IPState> m_ipState;
 
-	///	current time point (used if no explicit specification for series)
-		size_t m_timePoint;
-		
 	///	default time point (or -1 if not specified)
 		int m_defaultTimePoint;
-
-	///	subset for evaluation
-		int m_si;
 };
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -484,33 +515,35 @@ class CplUserData : public ICplUserData<dim>, public UserData<TData,dim,TRet>
 	public:
 	///	returns the value at ip
 		const TData& value(size_t s, size_t ip) const
-			{check_series_ip(s,ip); return m_vvValue[s][ip];}
+			{check_series_ip(s,ip); return value_state().vvValue[s][ip];}
 
 	///	returns all values for a series
 		const TData* values(size_t s) const
 			{
 				check_series(s);
-				if(m_vvValue[s].empty())
+				const std::vector<TData>& vValue = value_state().vvValue[s];
+				if(vValue.empty())
 					return NULL;
-				return &(m_vvValue[s][0]);
+				return &(vValue[0]);
 			}
 
 	///	returns the value at ip
 		TData& value(size_t s, size_t ip)
-			{check_series_ip(s,ip);return m_vvValue[s][ip];}
+			{check_series_ip(s,ip); return value_state().vvValue[s][ip];}
 
 	///	returns all values for a series
 		TData* values(size_t s)
 			{
 				check_series(s);
-				if(m_vvValue[s].empty())
+				std::vector<TData>& vValue = value_state().vvValue[s];
+				if(vValue.empty())
 					return NULL;
-				return &(m_vvValue[s][0]);
+				return &(vValue[0]);
 			}
 
 	///	returns flag, if data is evaluated (for conditional data)
 		bool defined(size_t s, size_t ip) const
-			{check_series_ip(s,ip); return m_vvBoolFlag[s][ip];}
+			{check_series_ip(s,ip); return value_state().vvBoolFlag[s][ip];}
 
 	///	destructor
 		~CplUserData() {local_ip_series_to_be_cleared();}
@@ -544,11 +577,24 @@ class CplUserData : public ICplUserData<dim>, public UserData<TData,dim,TRet>
 		void call_storage_callback() const;
 
 	private:
-	/// data at ip (size: (0,...num_series-1) x (0,...,num_ip-1))
-		std::vector<std::vector<TData> > m_vvValue;
+	///	values of the evaluation (per thread)
+		struct ValueState
+		{
+		/// data at ip (size: (0,...num_series-1) x (0,...,num_ip-1))
+			std::vector<std::vector<TData> > vvValue;
 
-	/// bool flag at ip (size: (0,...num_series-1) x (0,...,num_ip-1))
-		std::vector<std::vector<bool> > m_vvBoolFlag;
+		/// bool flag at ip (size: (0,...num_series-1) x (0,...,num_ip-1))
+			std::vector<std::vector<bool> > vvBoolFlag;
+		};
+
+	///	returns the values of the calling thread
+	/// \{
+		ValueState& value_state() {return m_valueState.get();}
+		const ValueState& value_state() const {return m_valueState.get();}
+	/// \}
+
+	///	values (per thread)
+		PerThread<ValueState> m_valueState;
 
 	///	registered callbacks
 //		typedef void (DataImport<TData,dim>::*CallbackFct)();
@@ -593,25 +639,26 @@ class DependentUserData : public CplUserData<TData, dim>
 	/// number of shapes for local function
 		size_t num_sh(size_t fct) const
 		{
-			UG_ASSERT(fct < m_vvNumDoFPerFct.size(), "Wrong index");
-			return m_vvNumDoFPerFct[fct];
+			const std::vector<size_t>& vNumDoFPerFct = deriv_state().vvNumDoFPerFct;
+			UG_ASSERT(fct < vNumDoFPerFct.size(), "Wrong index");
+			return vNumDoFPerFct[fct];
 		}
 
 	///	returns the derivative of the local function, at ip and for a dof
 		const TData& deriv(size_t s, size_t ip, size_t fct, size_t dof) const
-			{check_s_ip_fct_dof(s,ip,fct,dof);return m_vvvvDeriv[s][ip][fct][dof];}
+			{check_s_ip_fct_dof(s,ip,fct,dof);return deriv_state().vvvvDeriv[s][ip][fct][dof];}
 
 	///	returns the derivative of the local function, at ip and for a dof
 		TData& deriv(size_t s, size_t ip, size_t fct, size_t dof)
-			{check_s_ip_fct_dof(s,ip,fct,dof);return m_vvvvDeriv[s][ip][fct][dof];}
+			{check_s_ip_fct_dof(s,ip,fct,dof);return deriv_state().vvvvDeriv[s][ip][fct][dof];}
 
 	///	returns the derivatives of the local function, at ip
 		TData* deriv(size_t s, size_t ip, size_t fct)
-			{check_s_ip_fct(s,ip,fct);return &(m_vvvvDeriv[s][ip][fct][0]);}
+			{check_s_ip_fct(s,ip,fct);return &(deriv_state().vvvvDeriv[s][ip][fct][0]);}
 
 	///	returns the derivatives of the local function, at ip
 		const TData* deriv(size_t s, size_t ip, size_t fct) const
-			{check_s_ip_fct(s,ip,fct);return &(m_vvvvDeriv[s][ip][fct][0]);}
+			{check_s_ip_fct(s,ip,fct);return &(deriv_state().vvvvDeriv[s][ip][fct][0]);}
 
 	///	sets all derivative values to zero
 		static void set_zero(std::vector<std::vector<TData> > vvvDeriv[], const size_t nip);
@@ -670,12 +717,25 @@ class DependentUserData : public CplUserData<TData, dim>
 		void resize_deriv_array(const size_t seriesID);
 
 	protected:
-	///	number of functions and their dofs
-		std::vector<size_t> m_vvNumDoFPerFct;
+	///	derivatives of the evaluation (per thread)
+		struct DerivState
+		{
+		///	number of functions and their dofs
+			std::vector<size_t> vvNumDoFPerFct;
+
+		// 	Data (size: (0,...,num_series-1) x (0,...,num_ip-1) x (0,...,num_fct-1) x (0,...,num_sh(fct) )
+		///	Derivatives
+			std::vector<std::vector<std::vector<std::vector<TData> > > > vvvvDeriv;
+		};
+
+	///	returns the derivatives of the calling thread
+	/// \{
+		DerivState& deriv_state() {return m_derivState.get();}
+		const DerivState& deriv_state() const {return m_derivState.get();}
+	/// \}
 
-	// 	Data (size: (0,...,num_series-1) x (0,...,num_ip-1) x (0,...,num_fct-1) x (0,...,num_sh(fct) )
-	///	Derivatives
-		std::vector<std::vector<std::vector<std::vector<TData> > > > m_vvvvDeriv;
+	///	derivatives (per thread)
+		PerThread<DerivState> m_derivState;
 };
 
 } // end namespace ug
@@ -44,26 +44,22 @@ namespace ug{
 
 template <int dim>
 ICplUserData<dim>::ICplUserData()
-:	m_locPosDim(-1), m_timePoint(0), m_defaultTimePoint(-1), m_si(-1)
-{
-	m_vNumIP.clear();
-	m_vMayChange.clear();
-	m_locPosDim = -1;
-	m_pvLocIP1d.clear(); m_pvLocIP2d.clear(); m_pvLocIP3d.clear();
-	m_vTime.clear(); m_vTime.push_back(0.0);
-}
+:	m_defaultTimePoint(-1)
+{}
 
 template <int dim>
 void ICplUserData<dim>::clear()
 {
 	local_ip_series_to_be_cleared();
-	m_vNumIP.clear();
-	m_vMayChange.clear();
-	m_locPosDim = -1;
-	m_pvLocIP1d.clear(); m_pvLocIP2d.clear(); m_pvLocIP3d.clear();
-	m_timePoint = 0;
-	m_vTime.clear(); m_vTime.push_back(0.0);
-	m_si = -1;
+	IPState& st = ip_state();
+	st.vNumIP.clear();
+	st.vMayChange.clear();
+	st.vTimePoint.clear();
+	st.locPosDim = -1;
+	st.pvLocIP1d.clear(); st.pvLocIP2d.clear(); st.pvLocIP3d.clear();
+	st.timePoint = 0;
+	st.vTime.clear(); st.vTime.push_back(0.0);
+	st.si = -1;
 }
 
 template <int dim>
@@ -73,9 +69,11 @@ size_t ICplUserData<dim>::register_local_ip_series(const MathVector<ldim>* vPos,
                                          const int timePointSpec,
                                          bool bMayChange)
 {
+	IPState& st = ip_state();
+
 //	check, that dimension is ok.
-	if(m_locPosDim == -1) m_locPosDim = ldim;
-	else if(m_locPosDim != ldim)
+	if(st.locPosDim == -1) st.locPosDim = ldim;
+	else if(st.locPosDim != ldim)
 		UG_THROW("Local IP dimension conflict");
 	
 //	get the "right" time point specification
@@ -90,16 +88,16 @@ size_t ICplUserData<dim>::register_local_ip_series(const MathVector<ldim>* vPos,
 		for(size_t s = 0; s < vvIP.size(); ++s)
 		{
 		//	return series number iff exists and local ips remain constant
-			if(!m_vMayChange[s])
-				if(vvIP[s] == vPos && m_vNumIP[s] == numIP && m_vTimePoint[s] == theTimePoint)
+			if(!st.vMayChange[s])
+				if(vvIP[s] == vPos && st.vNumIP[s] == numIP && st.vTimePoint[s] == theTimePoint)
 					return s;
 		}
 
 //	if series not yet registered, add it
 	vvIP.push_back(vPos);
-	m_vNumIP.push_back(numIP);
-	m_vTimePoint.push_back(theTimePoint);
-	m_vMayChange.push_back(bMayChange);
+	st.vNumIP.push_back(numIP);
+	st.vTimePoint.push_back(theTimePoint);
+	st.vMayChange.push_back(bMayChange);
 
 //	invoke callback:
 //	This callback is called, whenever the local_ip_series have changed. It
@@ -107,10 +105,10 @@ size_t ICplUserData<dim>::register_local_ip_series(const MathVector<ldim>* vPos,
 //	linker must himself request local_ip_series from the data inputs of
 //	the linker. In addition value fields and derivative fields must be adjusted
 //	in UserData<TData, dim> etc.
-	local_ip_series_added(m_vNumIP.size() - 1);
+	local_ip_series_added(st.vNumIP.size() - 1);
 
 //	return new series id
-	return m_vNumIP.size() - 1;
+	return st.vNumIP.size() - 1;
 }
 
 
@@ -120,17 +118,19 @@ void ICplUserData<dim>::set_local_ips(const size_t seriesID,
                             const MathVector<ldim>* vPos,
                             const size_t numIP)
 {
+	IPState& st = ip_state();
+
 //	check series id
 	if(seriesID >= num_series())
 		UG_THROW("Trying to set new ips for invalid seriesID "<<seriesID);
 
 //	check that series is changeable
-	if(!m_vMayChange[seriesID])
+	if(!st.vMayChange[seriesID])
 		UG_THROW("Local IP is not changable, but trying to set new ips.");
 
 //	check, that dimension is ok.
-	if(m_locPosDim == -1) m_locPosDim = ldim;
-	else if(m_locPosDim != ldim)
+	if(st.locPosDim == -1) st.locPosDim = ldim;
+	else if(st.locPosDim != ldim)
 		UG_THROW("Local IP dimension conflict");
 
 //	get local positions
@@ -138,11 +138,11 @@ void ICplUserData<dim>::set_local_ips(const size_t seriesID,
 
 //	check if still at same position and with same numIP. In that case the
 //	positions have not changed. We have nothing to do
-	if(vvIP[seriesID] == vPos && m_vNumIP[seriesID] == numIP) return;
+	if(vvIP[seriesID] == vPos && st.vNumIP[seriesID] == numIP) return;
 
 //	remember new positions and numIP
 	vvIP[seriesID] = vPos;
-	m_vNumIP[seriesID] = numIP;
+	st.vNumIP[seriesID] = numIP;
 
 //	invoke callback:
 //	This callback is called, whenever the local_ip_series have changed. It
@@ -157,16 +157,18 @@ template <int dim>
 void ICplUserData<dim>::set_time_point(const size_t seriesID,
                             		const int timePointSpec)
 {
+	IPState& st = ip_state();
+
 //	check series id
 	if(seriesID >= num_series())
 		UG_THROW("Trying to set new ips for invalid seriesID "<<seriesID);
 
 //	check that series is changeable
-	if(!m_vMayChange[seriesID])
+	if(!st.vMayChange[seriesID])
 		UG_THROW("Time point specification is not changable, but trying to set a new one.");
 	
 //	set the new time point specification (if it is not prescribed by the object)
-	m_vTimePoint[seriesID] = (m_defaultTimePoint >= 0)? m_defaultTimePoint : timePointSpec;
+	st.vTimePoint[seriesID] = (m_defaultTimePoint >= 0)? m_defaultTimePoint : timePointSpec;
 	
 //TODO: Should we call the callback here? (No data sizes are changed!)
 }
@@ -176,7 +178,7 @@ template <int ldim>
 const MathVector<ldim>* ICplUserData<dim>::local_ips(size_t s) const
 {
 //	check, that dimension is ok.
-	if(m_locPosDim != ldim) UG_THROW("Local IP dimension conflict");
+	if(ip_state().locPosDim != ldim) UG_THROW("Local IP dimension conflict");
 
 	UG_ASSERT(s < num_series(), "Wrong series id");
 
@@ -189,7 +191,7 @@ template <int ldim>
 const MathVector<ldim>& ICplUserData<dim>::local_ip(size_t s, size_t ip) const
 {
 //	check, that dimension is ok.
-	if(m_locPosDim != ldim) UG_THROW("Local IP dimension conflict");
+	if(ip_state().locPosDim != ldim) UG_THROW("Local IP dimension conflict");
 
 	UG_ASSERT(s < num_series(), "Wrong series id");
 	UG_ASSERT(ip < num_ip(s), "Invalid index.");
@@ -202,7 +204,7 @@ int ICplUserData<dim>::time_point_specification(size_t s) const
 {
 	UG_ASSERT(s < num_series(), "Wrong series id");
 
-	return m_vTimePoint[s];
+	return ip_state().vTimePoint[s];
 }
 
 template <int dim>
@@ -210,11 +212,10 @@ size_t ICplUserData<dim>::time_point(size_t s) const
 {
 	UG_ASSERT(s < num_series(), "Wrong series id:" << s << ">=" << num_series());
 
-//	size_t time_spec;
-//	if ((time_spec = m_vTimePoint[s]) >= 0)
-	if (m_vTimePoint[s] >= 0)
-		return m_vTimePoint[s];
-	return m_timePoint;
+	const IPState& st = ip_state();
+	if (st.vTimePoint[s] >= 0)
+		return st.vTimePoint[s];
+	return st.timePoint;
 }
 
 template <int dim>
@@ -222,9 +223,10 @@ bool ICplUserData<dim>::at_current_time(size_t s) const
 {
 	UG_ASSERT(s < num_series(), "Wrong series id:" << s << ">=" << num_series());
 	
+	const IPState& st = ip_state();
 	int time_spec;
-	if ((time_spec = m_vTimePoint[s]) >= 0)
-		return ((size_t) time_spec) == m_timePoint;
+	if ((time_spec = st.vTimePoint[s]) >= 0)
+		return ((size_t) time_spec) == st.timePoint;
 	return true;
 }
 
@@ -240,7 +242,7 @@ void ICplUserData<dim>::set_global_ips(size_t s, const MathVector<dim>* vPos, si
 		               " for series "<< s);
 
 //	remember global positions
-	m_vvGlobPos[s] = vPos;
+	ip_state().vvGlobPos[s] = vPos;
 
 //	invoke callback:
 //	this callback is called every time the global position changes. It gives
@@ -253,7 +255,7 @@ template <int dim>
 inline void ICplUserData<dim>::check_s(size_t s) const
 {
 	UG_ASSERT(s < num_series(), "Wrong series id");
-	UG_ASSERT(s < m_vvGlobPos.size(), "Invalid index.");
+	UG_ASSERT(s < ip_state().vvGlobPos.size(), "Invalid index.");
 }
 
 template <int dim>
@@ -261,7 +263,7 @@ inline void ICplUserData<dim>::check_s_ip(size_t s, size_t ip) const
 {
 	check_s(s);
 	UG_ASSERT(ip < num_ip(s), "Invalid index.");
-	UG_ASSERT(m_vvGlobPos[s] != NULL, "Global IP not set.");
+	UG_ASSERT(ip_state().vvGlobPos[s] != NULL, "Global IP not set.");
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -273,6 +275,11 @@ void CplUserData<TData,dim,TRet>::
 register_storage_callback(DataImport<TData,dim>* obj, void (DataImport<TData,dim>::*func)())
 {
 	typedef std::pair<DataImport<TData,dim>*, CallbackFct> Pair;
+
+//	an import requests its series in each thread, but is registered only once
+	for(size_t i = 0; i < m_vCallback.size(); ++i)
+		if(m_vCallback[i].first == obj) return;
+
 	//	m_vCallback.push_back(Pair(obj,func));
 	m_vCallback.push_back(Pair(obj, boost::bind(func, obj)));
 }
@@ -308,7 +315,7 @@ template <typename TData, int dim, typename TRet>
 inline void CplUserData<TData,dim,TRet>::check_series(size_t s) const
 {
 	UG_ASSERT(s < num_series(), "Wrong series id"<<s);
-	UG_ASSERT(s < m_vvValue.size(), "Invalid index "<<s);
+	UG_ASSERT(s < value_state().vvValue.size(), "Invalid index "<<s);
 }
 
 template <typename TData, int dim, typename TRet>
@@ -316,28 +323,29 @@ inline void CplUserData<TData,dim,TRet>::check_series_ip(size_t s, size_t ip) co
 {
 	check_series(s);
 	UG_ASSERT(ip < num_ip(s), "Invalid index "<<ip);
-	UG_ASSERT(ip < m_vvValue[s].size(), "Invalid index "<<ip);
+	UG_ASSERT(ip < value_state().vvValue[s].size(), "Invalid index "<<ip);
 }
 
 template <typename TData, int dim, typename TRet>
 void CplUserData<TData,dim,TRet>::local_ip_series_added(const size_t seriesID)
 {
 	const size_t s = seriesID;
+	ValueState& st = value_state();
 
 //	check, that only increasing the data, this is important to guarantee,
 //	that the allocated memory pointer remain valid. They are used outside of
 //	the class as well to allow fast access to the data.
-	if(s < m_vvValue.size())
+	if(s < st.vvValue.size())
 		UG_THROW("Decrease is not implemented. Series: "<<s<<
-		         	 	 ", currNumSeries: "<<m_vvValue.size());
+		         	 	 ", currNumSeries: "<<st.vvValue.size());
 
 //	increase number of series if needed
-	m_vvValue.resize(s+1);
-	m_vvBoolFlag.resize(s+1);
+	st.vvValue.resize(s+1);
+	st.vvBoolFlag.resize(s+1);
 
 //	allocate new storage
-	m_vvValue[s].resize(num_ip(s));
-	m_vvBoolFlag[s].resize(num_ip(s), true);
+	st.vvValue[s].resize(num_ip(s));
+	st.vvBoolFlag[s].resize(num_ip(s), true);
 	value_storage_changed(s);
 	call_storage_callback();
 
@@ -350,8 +358,9 @@ void CplUserData<TData,dim,TRet>::local_ip_series_to_be_cleared()
 {
 //	free the memory
 //	clear all series
-	m_vvValue.clear();
-	m_vvBoolFlag.clear();
+	ValueState& st = value_state();
+	st.vvValue.clear();
+	st.vvBoolFlag.clear();
 
 //	call base class callback (if implementation given)
 //	base_type::local_ip_series_to_be_cleared();
@@ -361,11 +370,12 @@ template <typename TData, int dim, typename TRet>
 void CplUserData<TData,dim,TRet>::local_ips_changed(const size_t seriesID, const size_t newNumIP)
 {
 //	resize only when more data is needed than actually allocated
-	if(newNumIP >= m_vvValue[seriesID].size())
+	ValueState& st = value_state();
+	if(newNumIP >= st.vvValue[seriesID].size())
 	{
 	//	resize
-		m_vvValue[seriesID].resize(newNumIP);
-		m_vvBoolFlag[seriesID].resize(newNumIP, true);
+		st.vvValue[seriesID].resize(newNumIP);
+		st.vvBoolFlag[seriesID].resize(newNumIP, true);
 
 	//	invoke callback
 		value_storage_changed(seriesID);
@@ -455,9 +465,10 @@ void DependentUserData<TData,dim>::update_dof_sizes(const LocalIndices& ind)
 	UG_ASSERT(map.num_fct() == this->num_fct(), "Number function mismatch.");
 
 //	cache numFct and their numDoFs
-	m_vvNumDoFPerFct.resize(map.num_fct());
-	for(size_t fct = 0; fct < m_vvNumDoFPerFct.size(); ++fct)
-		m_vvNumDoFPerFct[fct] = ind.num_dof(map[fct]);
+	std::vector<size_t>& vNumDoFPerFct = deriv_state().vvNumDoFPerFct;
+	vNumDoFPerFct.resize(map.num_fct());
+	for(size_t fct = 0; fct < vNumDoFPerFct.size(); ++fct)
+		vNumDoFPerFct[fct] = ind.num_dof(map[fct]);
 
 	resize_deriv_array();
 }
@@ -466,24 +477,28 @@ template <typename TData, int dim>
 void DependentUserData<TData,dim>::resize_deriv_array()
 {
 //	resize num fct
-	for(size_t s = 0; s < m_vvvvDeriv.size(); ++s)
+	const size_t numSeries = deriv_state().vvvvDeriv.size();
+	for(size_t s = 0; s < numSeries; ++s)
 		resize_deriv_array(s);
 }
 
 template <typename TData, int dim>
 void DependentUserData<TData,dim>::resize_deriv_array(const size_t s)
 {
-//	resize ips
-	m_vvvvDeriv[s].resize(num_ip(s));
+	DerivState& st = deriv_state();
+	std::vector<std::vector<std::vector<TData> > >& vvvDeriv = st.vvvvDeriv[s];
+
+//	resize ips (only grown, such that the memory is reused from element to element)
+	if(vvvDeriv.size() < num_ip(s)) vvvDeriv.resize(num_ip(s));
 
-	for(size_t ip = 0; ip < m_vvvvDeriv[s].size(); ++ip)
+	for(size_t ip = 0; ip < vvvDeriv.size(); ++ip)
 	{
 	//	resize num fct
-		m_vvvvDeriv[s][ip].resize(m_vvNumDoFPerFct.size());
+		vvvDeriv[ip].resize(st.vvNumDoFPerFct.size());
 
 	//	resize dofs
-		for(size_t fct = 0; fct < m_vvNumDoFPerFct.size(); ++fct)
-			m_vvvvDeriv[s][ip][fct].resize(m_vvNumDoFPerFct[fct]);
+		for(size_t fct = 0; fct < st.vvNumDoFPerFct.size(); ++fct)
+			vvvDeriv[ip][fct].resize(st.vvNumDoFPerFct[fct]);
 	}
 }
 
@@ -502,30 +517,30 @@ template <typename TData, int dim>
 inline void DependentUserData<TData,dim>::check_s_ip(size_t s, size_t ip) const
 {
 	UG_ASSERT(s < this->num_series(), "Wrong series id"<<s);
-	UG_ASSERT(s < m_vvvvDeriv.size(), "Invalid index "<<s);
+	UG_ASSERT(s < deriv_state().vvvvDeriv.size(), "Invalid index "<<s);
 	UG_ASSERT(ip < this->num_ip(s), "Invalid index "<<ip);
-	UG_ASSERT(ip < m_vvvvDeriv[s].size(), "Invalid index "<<ip);
+	UG_ASSERT(ip < deriv_state().vvvvDeriv[s].size(), "Invalid index "<<ip);
 }
 
 template <typename TData, int dim>
 inline void DependentUserData<TData,dim>::check_s_ip_fct(size_t s, size_t ip, size_t fct) const
 {
 	check_s_ip(s,ip);
-	UG_ASSERT(fct < m_vvvvDeriv[s][ip].size(), "Invalid index.");
+	UG_ASSERT(fct < deriv_state().vvvvDeriv[s][ip].size(), "Invalid index.");
 }
 
 template <typename TData, int dim>
 inline void DependentUserData<TData,dim>::check_s_ip_fct_dof(size_t s, size_t ip, size_t fct, size_t dof) const
 {
 	check_s_ip_fct(s,ip,fct);
-	UG_ASSERT(dof < m_vvvvDeriv[s][ip][fct].size(), "Invalid index.");
+	UG_ASSERT(dof < deriv_state().vvvvDeriv[s][ip][fct].size(), "Invalid index.");
 }
 
 template <typename TData, int dim>
 void DependentUserData<TData,dim>::local_ip_series_added(const size_t seriesID)
 {
 //	adjust data arrays
-	m_vvvvDeriv.resize(seriesID+1);
+	deriv_state().vvvvDeriv.resize(seriesID+1);
 
 //	forward change signal to base class
 	base_type::local_ip_series_added(seriesID);
@@ -535,7 +550,7 @@ template <typename TData, int dim>
 void DependentUserData<TData,dim>::local_ip_series_to_be_cleared()
 {
 //	adjust data arrays
-	m_vvvvDeriv.clear();
+	deriv_state().vvvvDeriv.clear();
 
 //	forward change signal to base class
 	base_type::local_ip_series_to_be_cleared();
@@ -544,10 +559,10 @@ void DependentUserData<TData,dim>::local_ip_series_to_be_cleared()
 template <typename TData, int dim>
 void DependentUserData<TData,dim>::local_ips_changed(const size_t seriesID, const size_t newNumIP)
 {
-	UG_ASSERT(seriesID < m_vvvvDeriv.size(), "wrong series id.");
+	UG_ASSERT(seriesID < deriv_state().vvvvDeriv.size(), "wrong series id.");
 
 //	resize only when more data is needed than actually allocated
-	if(newNumIP >= m_vvvvDeriv[seriesID].size())
+	if(newNumIP >= deriv_state().vvvvDeriv[seriesID].size())
 		resize_deriv_array(seriesID);
 
 //	call base class callback (if implementation given)
@@ -149,6 +149,9 @@ class CompositeTimeDiscretization
 		///	@copydoc IAssemble::constraint
 		virtual SmartPtr<IConstraint<TAlgebra> > constraint(size_t i);
 
+		///	@copydoc IAssemble::dirichlet_mask
+		virtual ConstSmartPtr<vector_type> dirichlet_mask(const GridLevel& gl);
+
 	protected:
 		std::vector<SmartPtr<ITimeDiscretization<TAlgebra> > > m_vTimeDisc;
 };
@@ -260,6 +260,28 @@ SmartPtr<IConstraint<TAlgebra> > CompositeTimeDiscretization<TAlgebra>::constrai
 	return m_vTimeDisc[k]->constraint(indInCurTD);
 }
 
+template <typename TAlgebra>
+ConstSmartPtr<typename TAlgebra::vector_type>
+CompositeTimeDiscretization<TAlgebra>::dirichlet_mask(const GridLevel& gl)
+{
+//	a dof is a dirichlet dof, if it is one for any of the time discs
+	SmartPtr<vector_type> spMask;
+	for(size_t t = 0; t < m_vTimeDisc.size(); ++t)
+	{
+		ConstSmartPtr<vector_type> spTDMask = m_vTimeDisc[t]->dirichlet_mask(gl);
+		if(spTDMask.invalid()) continue;
+
+		if(spMask.invalid()) {spMask = spTDMask->clone(); continue;}
+
+		for(size_t i = 0; i < spMask->size(); ++i)
+			for(size_t k = 0; k < (size_t)GetSize((*spMask)[i]); ++k)
+				if(BlockRef((*spTDMask)[i], k) == 0.0)
+					BlockRef((*spMask)[i], k) = 0.0;
+	}
+
+	return spMask;
+}
+
 } // end namespace ug
 
 
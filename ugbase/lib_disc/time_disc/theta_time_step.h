@@ -71,7 +71,9 @@ class MultiStepTimeDiscretization
 	/// constructor
 		MultiStepTimeDiscretization(SmartPtr<IDomainDiscretization<algebra_type> > spDD)
 			: ITimeDiscretization<TAlgebra>(spDD),
-			  m_pPrevSol(NULL)
+			  m_pPrevSol(NULL),
+			  m_bLinearTimeInvariant(false),
+			  m_bLinearCacheValid(false)
 		{}
 
 		virtual ~MultiStepTimeDiscretization(){};
@@ -96,6 +98,27 @@ class MultiStepTimeDiscretization
 
 		virtual number future_time() const {return m_futureTime;}
 
+	///	enables reusing mass and stiffness matrix for linear time-invariant problems
+	/**
+	 * If enabled, assemble_linear and assemble_rhs do not run the element
+	 * assembling in every time step. Instead, the mass matrix M, the stiffness
+	 * matrix A and the right-hand side f are assembled once, and in every time
+	 * step the system is formed as
+	 * \f[
+	 * 	(s_{m,0} M + s_{a,0} A) u_0 = \sum_i s_{a,i} f - \sum_{i>0} (s_{m,i} M + s_{a,i} A) u_i
+	 * \f]
+	 * with the scalings of the time stepping scheme. This is only valid if
+	 * the element discretizations are linear and neither their coefficients
+	 * nor their sources depend on time. Dirichlet values may depend on time.
+	 * The cached matrices are rebuilt if the grid level or the number of
+	 * unknowns changes, or after invalidate_linear_cache() has been called.
+	 */
+		void set_linear_time_invariant(bool bLTI)
+			{m_bLinearTimeInvariant = bLTI; m_bLinearCacheValid = false;}
+
+	///	forces reassembling of the cached mass and stiffness matrix
+		void invalidate_linear_cache() {m_bLinearCacheValid = false;}
+
 	public:
 		void assemble_jacobian(matrix_type& J, const vector_type& u, const GridLevel& gl);
 
@@ -141,6 +164,20 @@ class MultiStepTimeDiscretization
 		SmartPtr<VectorTimeSeries<vector_type> > m_pPrevSol;	///< Previous solutions
 		number m_dt; 								///< Time Step size
 		number m_futureTime;						///< Future Time
+
+	///	assembles the cached matrices and rhs if needed
+		void update_linear_cache(const vector_type& u, const GridLevel& gl);
+
+	///	forms system matrix (if pA != NULL) and rhs from the cached matrices
+		void assemble_linear_cached(matrix_type* pA, vector_type& b, const GridLevel& gl);
+
+		bool m_bLinearTimeInvariant;		///< flag if M, A and f are cached
+		bool m_bLinearCacheValid;			///< flag if cache is up to date
+		GridLevel m_linearCacheGL;			///< grid level of cached matrices
+		matrix_type m_M;					///< cached mass matrix
+		matrix_type m_A;					///< cached stiffness matrix
+		vector_type m_f;					///< cached right-hand side
+		std::vector<std::pair<size_t, size_t> > m_vDirichlet; ///< (index, component) of Dirichlet rows
 };
 
 /// theta time stepping scheme
@@ -34,6 +34,7 @@
 #define __H__UG__LIB_DISC__TIME_DISC__THETA_TIME_STEP_IMPL__
 
 #include "theta_time_step.h"
+#include "lib_algebra/algebra_common/sparsematrix_util.h"
 
 #ifndef M_PI
 #define M_PI    3.14159265358979323846264338327950288   /* pi */
@@ -191,6 +192,12 @@ assemble_linear(matrix_type& A, vector_type& b, const GridLevel& gl)
 				m_prevSteps <<", but only "<< m_pPrevSol->size() << " passed.");
 
 
+//	reuse mass and stiffness matrix
+	if(m_bLinearTimeInvariant){
+		assemble_linear_cached(&A, b, gl);
+		return;
+	}
+
 //	push unknown solution to solution time series (not used, but formally needed)
 	m_pPrevSol->push(m_pPrevSol->latest(), m_futureTime);
 
@@ -214,6 +221,12 @@ assemble_rhs(vector_type& b, const GridLevel& gl)
 				" Number of previous solutions must be at least "<<
 				m_prevSteps <<", but only "<< m_pPrevSol->size() << " passed.");
 
+//	reuse mass and stiffness matrix
+	if(m_bLinearTimeInvariant){
+		assemble_linear_cached(NULL, b, gl);
+		return;
+	}
+
 //	push unknown solution to solution time series (not used, but formally needed)
 	m_pPrevSol->push(m_pPrevSol->latest(), m_futureTime);
 
@@ -256,6 +269,96 @@ assemble_rhs(vector_type& b, const vector_type& u, const GridLevel& gl)
 	m_pPrevSol->remove_latest();
 }
 
+template <typename TAlgebra>
+void MultiStepTimeDiscretization<TAlgebra>::
+update_linear_cache(const vector_type& u, const GridLevel& gl)
+{
+	if(m_bLinearCacheValid && m_linearCacheGL == gl && m_M.num_rows() == u.size())
+		return;
+
+	PROFILE_BEGIN_GROUP(MultiStepTimeDiscretization_update_linear_cache, "discretization MultiStepTimeDiscretization");
+	try{
+		this->m_spDomDisc->assemble_mass_matrix(m_M, u, gl);
+		this->m_spDomDisc->assemble_stiffness_matrix(m_A, u, gl);
+		this->m_spDomDisc->assemble_rhs(m_f, gl);
+	}UG_CATCH_THROW("MultiStepTimeDiscretization: Cannot assemble mass and stiffness matrix.");
+
+//	remember the rows set by Dirichlet constraints. These are identity rows
+//	in both matrices and are reset to identity in the system matrix
+	m_vDirichlet.clear();
+	const matrix_type& M = m_M;
+	for(size_t i = 0; i < M.num_rows(); ++i)
+		for(size_t alpha = 0; alpha < (size_t)GetRows(M(i,i)); ++alpha)
+			if(IsDirichletRow(m_M, i, alpha) && IsDirichletRow(m_A, i, alpha))
+				m_vDirichlet.push_back(std::make_pair(i, alpha));
+
+	m_linearCacheGL = gl;
+	m_bLinearCacheValid = true;
+}
+
+template <typename TAlgebra>
+void MultiStepTimeDiscretization<TAlgebra>::
+assemble_linear_cached(matrix_type* pA, vector_type& b, const GridLevel& gl)
+{
+	PROFILE_BEGIN_GROUP(MultiStepTimeDiscretization_assemble_linear_cached, "discretization MultiStepTimeDiscretization");
+	if(m_pPrevSol->size() + 1 < m_vScaleMass.size())
+		UG_THROW("MultiStepTimeDiscretization::assemble_linear_cached:"
+				" Number of previous solutions must be at least "<<
+				m_vScaleMass.size() - 1 <<", but only "<< m_pPrevSol->size() << " passed.");
+
+	update_linear_cache(*m_pPrevSol->latest(), gl);
+
+//	system matrix s_m0 * M + s_a0 * A
+	if(pA != NULL){
+		matrix_type& A = *pA;
+		MatAdd(A, m_vScaleMass[0], m_M, m_vScaleStiff[0], m_A);
+		for(size_t k = 0; k < m_vDirichlet.size(); ++k)
+			SetDirichletRow(A, m_vDirichlet[k].first, m_vDirichlet[k].second);
+#ifdef UG_PARALLEL
+		A.set_storage_type(PST_ADDITIVE);
+		A.set_layouts(m_M.layouts());
+#endif
+	}
+
+//	rhs: sum_i s_ai * f - sum_{i>0} (s_mi * M + s_ai * A) u_i
+	number scaleRhs = 0.0;
+	for(size_t i = 0; i < m_vScaleStiff.size(); ++i)
+		scaleRhs += m_vScaleStiff[i];
+
+	b.resize(m_f.size());
+#ifdef UG_PARALLEL
+	b.set_layouts(m_f.layouts());
+#endif
+	VecScaleAssign(b, scaleRhs, m_f);
+
+	SmartPtr<vector_type> spTmp = m_pPrevSol->latest()->clone_without_values();
+	for(size_t i = 1; i < m_vScaleMass.size(); ++i)
+	{
+		const vector_type& u = *m_pPrevSol->solution(i-1);
+		if(m_vScaleMass[i] != 0.0){
+			VecScaleAssign(*spTmp, m_vScaleMass[i], u);
+			m_M.matmul_minus(b, *spTmp);
+		}
+		if(m_vScaleStiff[i] != 0.0){
+			VecScaleAssign(*spTmp, m_vScaleStiff[i], u);
+			m_A.matmul_minus(b, *spTmp);
+		}
+	}
+
+//	Dirichlet values at the future time
+	VecScaleAssign(*spTmp, 1.0, *m_pPrevSol->latest());
+	try{
+		this->m_spDomDisc->adjust_solution(*spTmp, m_futureTime, gl);
+	}UG_CATCH_THROW("MultiStepTimeDiscretization: Cannot adjust solution.");
+	for(size_t k = 0; k < m_vDirichlet.size(); ++k)
+		BlockRef(b[m_vDirichlet[k].first], m_vDirichlet[k].second)
+			= BlockRef((*spTmp)[m_vDirichlet[k].first], m_vDirichlet[k].second);
+
+#ifdef UG_PARALLEL
+	b.set_storage_type(PST_ADDITIVE);
+#endif
+}
+
 template<typename TAlgebra>
 void MultiStepTimeDiscretization<TAlgebra>::
 calc_error(const vector_type& u, vector_type* u_vtk)
@@ -169,6 +169,12 @@ class ITimeDiscretization : public IAssemble<TAlgebra>
 			return m_spDomDisc->constraint(i);
 		}
 
+	///	returns the dirichlet mask of the domain discretization
+		virtual ConstSmartPtr<vector_type> dirichlet_mask(const GridLevel& gl)
+		{
+			return m_spDomDisc->dirichlet_mask(gl);
+		}
+
 	protected:
 		SmartPtr<IDomainDiscretization<TAlgebra> > m_spDomDisc; ///< Domain Discretization
 
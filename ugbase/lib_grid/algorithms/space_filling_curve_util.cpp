@@ -0,0 +1,148 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+
+#include <algorithm>
+#include <limits>
+#include "space_filling_curve_util.h"
+#include "common/error.h"
+#include "common/util/string_util.h"
+
+using namespace std;
+
+namespace ug{
+
+SpaceFillingCurve SpaceFillingCurveByName(const std::string& name)
+{
+	const string lname = ToLower(name);
+	if(lname == "morton") return SFC_MORTON;
+	if(lname == "hilbert") return SFC_HILBERT;
+	UG_THROW("SpaceFillingCurveByName: Unknown curve '" << name << "'. "
+			 "Use 'morton' or 'hilbert'.");
+}
+
+///	interleaves the bits of the coordinates, the most significant bit first
+template <int dim>
+static uint64 InterleaveBits(const uint32 X[dim], int numBits)
+{
+	uint64 key = 0;
+	for(int b = numBits - 1; b >= 0; --b)
+		for(int d = 0; d < dim; ++d)
+			key = (key << 1) | ((X[d] >> b) & 1);
+	return key;
+}
+
+///	key of a cell on the Hilbert curve
+/**	Transforms the coordinates into the 'transposed' Hilbert index (see
+ * J. Skilling, Programming the Hilbert curve, AIP Conf. Proc. 707, 2004),
+ * whose interleaved bits form the key.*/
+template <int dim>
+static uint64 HilbertKey(uint32 X[dim], int numBits)
+{
+	const uint32 M = 1u << (numBits - 1);
+
+//	inverse undo
+	for(uint32 Q = M; Q > 1; Q >>= 1){
+		const uint32 P = Q - 1;
+		for(int d = 0; d < dim; ++d){
+			if(X[d] & Q)
+				X[0] ^= P;
+			else{
+				const uint32 t = (X[0] ^ X[d]) & P;
+				X[0] ^= t;
+				X[d] ^= t;
+			}
+		}
+	}
+
+//	gray encode
+	for(int d = 1; d < dim; ++d)
+		X[d] ^= X[d-1];
+	uint32 t = 0;
+	for(uint32 Q = M; Q > 1; Q >>= 1)
+		if(X[dim-1] & Q)
+			t ^= Q - 1;
+	for(int d = 0; d < dim; ++d)
+		X[d] ^= t;
+
+	return InterleaveBits<dim>(X, numBits);
+}
+
+template <int dim>
+void ComputeSpaceFillingCurveOrder(std::vector<size_t>& vOrder,
+								   const std::vector<MathVector<dim> >& vPos,
+								   SpaceFillingCurve sfc)
+{
+	const size_t numPos = vPos.size();
+	vOrder.resize(numPos);
+	if(numPos == 0) return;
+
+//	bounding box, the cells are cubes
+	MathVector<dim> minPos = vPos[0], maxPos = vPos[0];
+	for(size_t i = 1; i < numPos; ++i){
+		for(int d = 0; d < dim; ++d){
+			minPos[d] = std::min(minPos[d], vPos[i][d]);
+			maxPos[d] = std::max(maxPos[d], vPos[i][d]);
+		}
+	}
+	number extent = 0;
+	for(int d = 0; d < dim; ++d)
+		extent = std::max(extent, maxPos[d] - minPos[d]);
+
+	const int numBits = (dim == 3) ? 21 : 31;
+	const number maxCell = (number)((1u << numBits) - 1);
+	const number scale = (extent > 0) ? maxCell / extent : 0;
+
+//	keys of the points, the index resolves ties
+	std::vector<std::pair<uint64, size_t> > vKey(numPos);
+	uint32 X[dim];
+	for(size_t i = 0; i < numPos; ++i){
+		for(int d = 0; d < dim; ++d)
+			X[d] = (uint32)std::min(maxCell, (vPos[i][d] - minPos[d]) * scale);
+
+		if(sfc == SFC_HILBERT && dim > 1)
+			vKey[i].first = HilbertKey<dim>(X, numBits);
+		else
+			vKey[i].first = InterleaveBits<dim>(X, numBits);
+		vKey[i].second = i;
+	}
+
+	std::sort(vKey.begin(), vKey.end());
+
+	for(size_t i = 0; i < numPos; ++i)
+		vOrder[i] = vKey[i].second;
+}
+
+template void ComputeSpaceFillingCurveOrder<1>(std::vector<size_t>&, const std::vector<MathVector<1> >&, SpaceFillingCurve);
+template void ComputeSpaceFillingCurveOrder<2>(std::vector<size_t>&, const std::vector<MathVector<2> >&, SpaceFillingCurve);
+template void ComputeSpaceFillingCurveOrder<3>(std::vector<size_t>&, const std::vector<MathVector<3> >&, SpaceFillingCurve);
+
+}//	end of namespace
@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+
+#ifndef __H__UG_space_filling_curve_util
+#define __H__UG_space_filling_curve_util
+
+#include <string>
+#include <vector>
+#include "common/types.h"
+#include "common/math/ugmath_types.h"
+#include "lib_grid/grid/grid.h"
+#include "lib_grid/tools/subset_handler_interface.h"
+
+namespace ug{
+
+///	space filling curves available for orderings
+enum SpaceFillingCurve
+{
+	SFC_MORTON,		///< Morton (Z-) curve, bit interleaved coordinates
+	SFC_HILBERT		///< Hilbert curve, neighboured keys are neighboured cells
+};
+
+///	returns the curve for a name ("morton" or "hilbert")
+UG_API
+SpaceFillingCurve SpaceFillingCurveByName(const std::string& name);
+
+////////////////////////////////////////////////////////////////////////
+///	computes the order of points along a space filling curve
+/**	The bounding box of the points is divided into 2^b cells per direction
+ * (b = 31 in 1d and 2d, b = 21 in 3d) and each point is assigned the key
+ * of its cell along the curve. Points are ordered by their keys, points in
+ * the same cell by their index.
+ *
+ * \param[out]	vOrder	vOrder[i] is the index in vPos of the i-th point
+ *						along the curve
+ * \param[in]	vPos	positions of the points
+ * \param[in]	sfc		curve to order by
+ */
+template <int dim>
+void ComputeSpaceFillingCurveOrder(std::vector<size_t>& vOrder,
+								   const std::vector<MathVector<dim> >& vPos,
+								   SpaceFillingCurve sfc);
+
+////////////////////////////////////////////////////////////////////////
+///	reorders the elements of a base type along a space filling curve
+/**	The elements are ordered by the position of their centers. Afterwards the
+ * sections of the grid's element storage, the levels of a MultiGrid and the
+ * subsets of the optionally passed subset handler are iterated in this order,
+ * and the data attached to the elements is aligned with it. Element loops
+ * (e.g. assembling) then access neighboured elements and their data
+ * in succession.
+ *
+ * TElem has to be one of Vertex, Edge, Face or Volume.
+ */
+template <class TElem, class TAAPos>
+void OrderElementsBySpaceFillingCurve(Grid& grid, TAAPos aaPos,
+									  SpaceFillingCurve sfc,
+									  ISubsetHandler* psh = NULL);
+
+///	reorders all elements of a grid along a space filling curve
+/**	\sa OrderElementsBySpaceFillingCurve*/
+template <class TAAPos>
+void OrderGridBySpaceFillingCurve(Grid& grid, TAAPos aaPos,
+								  SpaceFillingCurve sfc,
+								  ISubsetHandler* psh = NULL);
+
+}//	end of namespace
+
+////////////////////////////////
+// include implementation
+#include "space_filling_curve_util_impl.hpp"
+
+#endif	//__H__UG_space_filling_curve_util
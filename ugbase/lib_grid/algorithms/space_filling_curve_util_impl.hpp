@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+
+#ifndef __H__UG_space_filling_curve_util_impl
+#define __H__UG_space_filling_curve_util_impl
+
+#include "lib_grid/multi_grid.h"
+#include "geom_obj_util/vertex_util.h"
+#include "geom_obj_util/edge_util.h"
+#include "geom_obj_util/face_util.h"
+#include "geom_obj_util/volume_util.h"
+
+namespace ug{
+
+template <class TElem, class TAAPos>
+void OrderElementsBySpaceFillingCurve(Grid& grid, TAAPos aaPos,
+									  SpaceFillingCurve sfc,
+									  ISubsetHandler* psh)
+{
+	typedef typename TAAPos::ValueType vector_t;
+	typedef typename geometry_traits<TElem>::iterator iterator;
+
+	std::vector<TElem*> vElem;
+	std::vector<vector_t> vCenter;
+	vElem.reserve(grid.num<TElem>());
+	vCenter.reserve(grid.num<TElem>());
+	for(iterator iter = grid.begin<TElem>(); iter != grid.end<TElem>(); ++iter){
+		vElem.push_back(*iter);
+		vCenter.push_back(CalculateCenter(*iter, aaPos));
+	}
+
+	std::vector<size_t> vOrder;
+	ComputeSpaceFillingCurveOrder<vector_t::Size>(vOrder, vCenter, sfc);
+
+	std::vector<TElem*> vOrderedElem(vElem.size());
+	for(size_t i = 0; i < vOrder.size(); ++i)
+		vOrderedElem[i] = vElem[vOrder[i]];
+
+	grid.reorder_elements(vOrderedElem);
+
+//	reassigning the current level or subset appends an element to its list
+	MultiGrid* pmg = dynamic_cast<MultiGrid*>(&grid);
+	if(pmg){
+		SubsetHandler& hierarchy = pmg->get_hierarchy_handler();
+		for(size_t i = 0; i < vOrderedElem.size(); ++i)
+			hierarchy.assign_subset(vOrderedElem[i], pmg->get_level(vOrderedElem[i]));
+	}
+
+	if(psh){
+		for(size_t i = 0; i < vOrderedElem.size(); ++i){
+			const int si = psh->get_subset_index(vOrderedElem[i]);
+			if(si != -1)
+				psh->assign_subset(vOrderedElem[i], si);
+		}
+	}
+}
+
+template <class TAAPos>
+void OrderGridBySpaceFillingCurve(Grid& grid, TAAPos aaPos,
+								  SpaceFillingCurve sfc,
+								  ISubsetHandler* psh)
+{
+	OrderElementsBySpaceFillingCurve<Vertex>(grid, aaPos, sfc, psh);
+	OrderElementsBySpaceFillingCurve<Edge>(grid, aaPos, sfc, psh);
+	OrderElementsBySpaceFillingCurve<Face>(grid, aaPos, sfc, psh);
+	OrderElementsBySpaceFillingCurve<Volume>(grid, aaPos, sfc, psh);
+}
+
+}//	end of namespace
+
+#endif	//__H__UG_space_filling_curve_util_impl
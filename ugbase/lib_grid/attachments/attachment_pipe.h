@@ -390,6 +390,11 @@ class UG_API AttachmentPipe
 	/**	Aligns data with elements and removes unused data-memory.*/
 		void defragment();
 
+	/**	Aligns data with the current order of the elements, even if the pipe
+	 * is not fragmented. Afterwards the i-th data-entry corresponds to the
+	 * i-th element. Call this method after the elements have been reordered.*/
+		void align_data();
+
 	/**\brief attaches a new data-array to the pipe.
 	 *
 	 * Attachs a new attachment and creates a container which holds the
@@ -292,6 +292,14 @@ defragment()
 	if(!is_fragmented())
 		return;
 
+	align_data();
+}
+
+template <class TElem, class TElemHandler>
+void
+AttachmentPipe<TElem, TElemHandler>::
+align_data()
+{
 //	if num_elements == 0, then simply resize all data-containers to 0.
 	if(num_elements() == 0)
 	{
@@ -307,19 +315,25 @@ defragment()
 	else
 	{
 	//	calculate the fragmentation array. It has to be of the same size as the fragmented data containers.
-		std::vector<uint> vNewIndices(num_data_entries(), INVALID_ATTACHMENT_INDEX);
+		std::vector<size_t> vNewIndices(num_data_entries(), INVALID_ATTACHMENT_INDEX);
 
-	//	iterate through the elements and calculate the new index of each
-		size_t counter = 0;
+	//	iterate through the elements and calculate the new index of each.
+	//	The element list itself may store its links in this pipe, so data-indices
+	//	may only be changed once the iteration is done.
+		std::vector<TElem> vElems;
+		vElems.reserve(num_elements());
 		typename atraits::element_iterator iter = atraits::elements_begin(m_pHandler);
 		typename atraits::element_iterator end = atraits::elements_end(m_pHandler);
 
 		for(; iter != end; ++iter){
-			vNewIndices[atraits::get_data_index(m_pHandler, (*iter))] = counter;
-			atraits::set_data_index(m_pHandler, (*iter), counter);
-			++counter;
+			vNewIndices[atraits::get_data_index(m_pHandler, (*iter))] = vElems.size();
+			vElems.push_back(*iter);
 		}
 
+		size_t counter = vElems.size();
+		for(size_t i = 0; i < counter; ++i)
+			atraits::set_data_index(m_pHandler, vElems[i], i);
+
 	//	after defragmentation there are no free indices.
 		m_stackFreeEntries = UINTStack();
 		m_numDataEntries = counter;
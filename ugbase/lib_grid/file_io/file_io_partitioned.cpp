@@ -0,0 +1,547 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+
+#include <cstdio>
+#include <algorithm>
+#include <map>
+#include "file_io_partitioned.h"
+#include "common/serialization.h"
+#include "common/profiler/profiler.h"
+#include "lib_grid/algorithms/attachment_util.h"
+#include "lib_grid/parallelization/grid_object_id.h"
+#include "lib_grid/selector.h"
+#include "lib_grid/lib_grid_messages.h"
+
+#ifdef UG_PARALLEL
+	#include "pcl/pcl.h"
+	#include "pcl/parallel_file.h"
+	#include "lib_grid/parallelization/distributed_grid.h"
+#endif
+
+using namespace std;
+
+namespace ug
+{
+
+static const int PARTITIONED_GRID_MAGIC = 0x55475047;
+static const int PARTITIONED_GRID_VERSION = 1;
+
+////////////////////////////////////////////////////////////////////////////////
+//	SAVE
+///	marks a side of an element in the given part as shared, if it was already found in another part
+template <class TSide>
+static void MarkSide(MultiElementAttachmentAccessor<AInt>& aaFirstPart,
+					 MultiElementAttachmentAccessor<AByte>& aaShared,
+					 TSide* s, int part)
+{
+	int& firstPart = aaFirstPart[s];
+	if(firstPart == -1)
+		firstPart = part;
+	else if(firstPart != part)
+		aaShared[s] = 1;
+}
+
+template <class TElem>
+static void AssignIDs(MultiGrid& mg, MultiElementAttachmentAccessor<AGeomObjID>& aaID)
+{
+	typedef typename Grid::traits<TElem>::iterator iter_t;
+	size_t localID = 0;
+	for(iter_t iter = mg.begin<TElem>(); iter != mg.end<TElem>(); ++iter)
+		aaID[*iter] = MakeGeomObjID(0, localID++);
+}
+
+template <class TElem>
+static void SavePartitionedGrid(MultiGrid& mg, SubsetHandler& shPartition,
+								GridDataSerializationHandler& serializer,
+								const char* filename,
+								const std::vector<int>* processMap)
+{
+	typedef typename Grid::traits<TElem>::iterator iter_t;
+
+//	sort the elements of highest dimension into their parts
+	vector<vector<TElem*> > vPartElems;
+	for(iter_t iter = mg.begin<TElem>(); iter != mg.end<TElem>(); ++iter){
+		TElem* e = *iter;
+		int part = shPartition.get_subset_index(e);
+		UG_COND_THROW(part < 0, "SavePartitionedGrid: All elements of highest "
+					  "dimension have to be assigned to a partition.");
+		if(processMap){
+			UG_COND_THROW(part >= (int)processMap->size(), "SavePartitionedGrid: "
+						  "No target process specified for partition " << part);
+			part = (*processMap)[part];
+		}
+		if(part >= (int)vPartElems.size())
+			vPartElems.resize(part + 1);
+		vPartElems[part].push_back(e);
+	}
+	UG_COND_THROW(vPartElems.empty(), "SavePartitionedGrid: The grid is empty.");
+
+//	sides, which are contained in more than one part, are marked as shared
+	AInt aFirstPart;
+	AByte aShared;
+	mg.attach_to_all_dv(aFirstPart, -1);
+	mg.attach_to_all_dv(aShared, 0);
+	MultiElementAttachmentAccessor<AInt> aaFirstPart(mg, aFirstPart);
+	MultiElementAttachmentAccessor<AByte> aaShared(mg, aShared);
+
+	Grid::traits<Vertex>::secure_container vrts;
+	Grid::traits<Edge>::secure_container edges;
+	Grid::traits<Face>::secure_container faces;
+
+	for(size_t part = 0; part < vPartElems.size(); ++part){
+		for(size_t i = 0; i < vPartElems[part].size(); ++i){
+			TElem* e = vPartElems[part][i];
+			if(TElem::dim > 0){
+				mg.associated_elements(vrts, e);
+				for(size_t j = 0; j < vrts.size(); ++j)
+					MarkSide(aaFirstPart, aaShared, vrts[j], (int)part);
+			}
+			if(TElem::dim > 1){
+				mg.associated_elements(edges, e);
+				for(size_t j = 0; j < edges.size(); ++j)
+					MarkSide(aaFirstPart, aaShared, edges[j], (int)part);
+			}
+			if(TElem::dim > 2){
+				mg.associated_elements(faces, e);
+				for(size_t j = 0; j < faces.size(); ++j)
+					MarkSide(aaFirstPart, aaShared, faces[j], (int)part);
+			}
+		}
+	}
+
+//	every element is identified by a global id, which is unique per element type
+	AGeomObjID aID;
+	AInt aIndex;
+	mg.attach_to_all(aID);
+	mg.attach_to_all(aIndex);
+	MultiElementAttachmentAccessor<AGeomObjID> aaID(mg, aID);
+	MultiElementAttachmentAccessor<AInt> aaIndex(mg, aIndex);
+	AssignIDs<Vertex>(mg, aaID);
+	AssignIDs<Edge>(mg, aaID);
+	AssignIDs<Face>(mg, aaID);
+	AssignIDs<Volume>(mg, aaID);
+
+	GridDataSerializationHandler sharedSerializer;
+	sharedSerializer.add(GeomObjAttachmentSerializer<Vertex, AByte>::create(mg, aShared));
+	sharedSerializer.add(GeomObjAttachmentSerializer<Edge, AByte>::create(mg, aShared));
+	sharedSerializer.add(GeomObjAttachmentSerializer<Face, AByte>::create(mg, aShared));
+
+//	the file starts with the number of parts and the end offset of each part,
+//	which are written after the parts, as in pcl::WriteCombinedParallelFile.
+	const int numParts = (int)vPartElems.size();
+	vector<long long> vNextOffset(numParts, 0);
+
+	FILE* f = fopen(filename, "wb");
+	UG_COND_THROW(!f, "SavePartitionedGrid: Could not open " << filename);
+
+	bool ok = (fwrite(&numParts, sizeof(int), 1, f) == 1)
+			&& (fwrite(&vNextOffset.front(), sizeof(long long), numParts, f)
+				== (size_t)numParts);
+	long long offset = sizeof(int) + numParts * sizeof(long long);
+
+	Selector sel(mg);
+	for(int part = 0; ok && part < numParts; ++part){
+	//	select the elements of the part together with their sides
+		sel.clear();
+		sel.select(vPartElems[part].begin(), vPartElems[part].end());
+		for(size_t i = 0; i < vPartElems[part].size(); ++i){
+			TElem* e = vPartElems[part][i];
+			if(TElem::dim > 0){
+				mg.associated_elements(vrts, e);
+				for(size_t j = 0; j < vrts.size(); ++j)
+					sel.select(vrts[j]);
+			}
+			if(TElem::dim > 1){
+				mg.associated_elements(edges, e);
+				for(size_t j = 0; j < edges.size(); ++j)
+					sel.select(edges[j]);
+			}
+			if(TElem::dim > 2){
+				mg.associated_elements(faces, e);
+				for(size_t j = 0; j < faces.size(); ++j)
+					sel.select(faces[j]);
+			}
+		}
+
+		GridObjectCollection goc = sel.get_grid_objects();
+		BinaryBuffer out;
+		Serialize(out, PARTITIONED_GRID_MAGIC);
+		Serialize(out, PARTITIONED_GRID_VERSION);
+		SerializeMultiGridElements(mg, goc, aaIndex, out, &aaID);
+		serializer.write_infos(out);
+		serializer.serialize(out, goc);
+		sharedSerializer.write_infos(out);
+		sharedSerializer.serialize(out, goc);
+		Serialize(out, PARTITIONED_GRID_MAGIC);
+
+		ok = (fwrite(out.buffer(), 1, out.write_pos(), f) == out.write_pos());
+		offset += out.write_pos();
+		vNextOffset[part] = offset;
+	}
+
+	ok = ok && (fseek(f, sizeof(int), SEEK_SET) == 0)
+			&& (fwrite(&vNextOffset.front(), sizeof(long long), numParts, f)
+				== (size_t)numParts);
+	fclose(f);
+
+	mg.detach_from_all(aFirstPart);
+	mg.detach_from_all(aShared);
+	mg.detach_from_all(aID);
+	mg.detach_from_all(aIndex);
+
+	UG_COND_THROW(!ok, "SavePartitionedGrid: Could not write " << filename);
+}
+
+void SavePartitionedGrid(MultiGrid& mg, SubsetHandler& shPartition,
+						 GridDataSerializationHandler& serializer,
+						 const char* filename,
+						 const std::vector<int>* processMap)
+{
+	PROFILE_FUNC_GROUP("grid");
+	UG_COND_THROW(mg.num_levels() > 1, "SavePartitionedGrid: "
+				  "Only grids with one level are supported.");
+
+	if(mg.num<Volume>() > 0)
+		SavePartitionedGrid<Volume>(mg, shPartition, serializer, filename, processMap);
+	else if(mg.num<Face>() > 0)
+		SavePartitionedGrid<Face>(mg, shPartition, serializer, filename, processMap);
+	else if(mg.num<Edge>() > 0)
+		SavePartitionedGrid<Edge>(mg, shPartition, serializer, filename, processMap);
+	else
+		SavePartitionedGrid<Vertex>(mg, shPartition, serializer, filename, processMap);
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+//	LOAD
+#ifdef UG_PARALLEL
+///	sends the non-empty buffers vSendBuf[rank] to the associated processes
+/**	On return vRecvBuf contains the buffers received from the processes in
+ * vRecvFrom. The buffer for the local process is passed on directly.*/
+static void ExchangeBuffers(vector<BinaryBuffer>& vRecvBuf, vector<int>& vRecvFrom,
+							vector<BinaryBuffer>& vSendBuf)
+{
+	pcl::ProcessCommunicator procComm;
+	const int numProcs = procComm.size();
+	const int localRank = pcl::ProcRank();
+
+	vector<int> vSendFlag(numProcs, 0), vRecvFlag(numProcs, 0);
+	vector<int> vSendTo;
+	vector<BinaryBuffer> vOut;
+	for(int i = 0; i < numProcs; ++i){
+		if(i != localRank && vSendBuf[i].write_pos() > 0){
+			vSendFlag[i] = 1;
+			vSendTo.push_back(i);
+			vOut.push_back(vSendBuf[i]);
+		}
+	}
+	procComm.alltoall(&vSendFlag.front(), 1, PCL_DT_INT,
+					  &vRecvFlag.front(), 1, PCL_DT_INT);
+
+	vRecvFrom.clear();
+	for(int i = 0; i < numProcs; ++i){
+		if(vRecvFlag[i])
+			vRecvFrom.push_back(i);
+	}
+	vRecvBuf.clear();
+	vRecvBuf.resize(vRecvFrom.size());
+
+	procComm.distribute_data(GetDataPtr(vRecvBuf), GetDataPtr(vRecvFrom),
+							 (int)vRecvFrom.size(), GetDataPtr(vOut),
+							 GetDataPtr(vSendTo), (int)vSendTo.size());
+
+	if(vSendBuf[localRank].write_pos() > 0){
+		vRecvBuf.push_back(vSendBuf[localRank]);
+		vRecvFrom.push_back(localRank);
+	}
+}
+
+///	writes the global ids of the shared elements to the query of their directory process
+/**	The directory process of an element is determined by its global id.*/
+template <class TElem>
+static void CollectSharedIDs(vector<BinaryBuffer>& vQuery,
+							 vector<vector<GridObject*> >& vQueried,
+							 const vector<TElem*>& vElems,
+							 MultiElementAttachmentAccessor<AByte>& aaShared,
+							 MultiElementAttachmentAccessor<AGeomObjID>& aaID)
+{
+	const size_t numProcs = vQuery.size();
+	for(size_t i = 0; i < vElems.size(); ++i){
+		TElem* e = vElems[i];
+		if(!aaShared[e])
+			continue;
+		const GeomObjID& id = aaID[e];
+		const size_t dirRank = id.second % numProcs;
+		Serialize(vQuery[dirRank], (int)e->base_object_id());
+		Serialize(vQuery[dirRank], id);
+		vQueried[dirRank].push_back(e);
+	}
+}
+
+///	adds an element to the horizontal interfaces to all other processes holding a copy
+/**	The copy on the process with the lowest rank is the master.*/
+template <class TElem>
+static void AddToHorizontalInterfaces(GridLayoutMap& glm, TElem* e,
+									  const vector<int>& vHolders)
+{
+	if(vHolders.size() < 2)
+		return;
+
+	const int localRank = pcl::ProcRank();
+	const int master = *min_element(vHolders.begin(), vHolders.end());
+	if(master == localRank){
+		for(size_t i = 0; i < vHolders.size(); ++i){
+			if(vHolders[i] != localRank)
+				glm.get_layout<TElem>(INT_H_MASTER).interface(vHolders[i], 0).push_back(e);
+		}
+	}
+	else
+		glm.get_layout<TElem>(INT_H_SLAVE).interface(master, 0).push_back(e);
+}
+
+template <class TElem>
+static void SortInterfaceEntries(MultiGrid& mg, GridLayoutMap& glm, AGeomObjID& aID)
+{
+	CompareByAttachment<TElem, AGeomObjID> gidCmp(mg, aID);
+	if(glm.has_layout<TElem>(INT_H_MASTER))
+		glm.get_layout<TElem>(INT_H_MASTER).sort_interface_entries(gidCmp);
+	if(glm.has_layout<TElem>(INT_H_SLAVE))
+		glm.get_layout<TElem>(INT_H_SLAVE).sort_interface_entries(gidCmp);
+}
+
+///	creates the horizontal interfaces between the copies of the shared elements
+/**
+ * Each process sends the global ids of its shared elements to a directory
+ * process, which is determined by the id. The directory processes collect all
+ * processes holding a copy and return them in the order of the queries.
+ * No process thus has to know the whole set of shared elements.
+ */
+static void CreateHorizontalInterfaces(MultiGrid& mg, GridLayoutMap& glm,
+									   const vector<Vertex*>& vrts,
+									   const vector<Edge*>& edges,
+									   const vector<Face*>& faces,
+									   MultiElementAttachmentAccessor<AByte>& aaShared,
+									   AGeomObjID& aID)
+{
+	typedef pair<int, GeomObjID> Key;
+	const int numProcs = pcl::NumProcs();
+	MultiElementAttachmentAccessor<AGeomObjID> aaID(mg, aID);
+
+	vector<BinaryBuffer> vQuery(numProcs);
+	vector<vector<GridObject*> > vQueried(numProcs);
+	CollectSharedIDs(vQuery, vQueried, vrts, aaShared, aaID);
+	CollectSharedIDs(vQuery, vQueried, edges, aaShared, aaID);
+	CollectSharedIDs(vQuery, vQueried, faces, aaShared, aaID);
+
+//	collect the holders of each id on its directory process
+	vector<BinaryBuffer> vRecvQuery;
+	vector<int> vQueryFrom;
+	ExchangeBuffers(vRecvQuery, vQueryFrom, vQuery);
+
+	map<Key, vector<int> > holders;
+	for(size_t i = 0; i < vRecvQuery.size(); ++i){
+		BinaryBuffer& in = vRecvQuery[i];
+		while(!in.eof()){
+			Key key;
+			Deserialize(in, key.first);
+			Deserialize(in, key.second);
+			holders[key].push_back(vQueryFrom[i]);
+		}
+	}
+
+	vector<BinaryBuffer> vAnswer(numProcs);
+	for(size_t i = 0; i < vRecvQuery.size(); ++i){
+		BinaryBuffer& in = vRecvQuery[i];
+		in.set_read_pos(0);
+		while(!in.eof()){
+			Key key;
+			Deserialize(in, key.first);
+			Deserialize(in, key.second);
+			Serialize(vAnswer[vQueryFrom[i]], holders[key]);
+		}
+	}
+
+//	the answers are received in the order of the queries
+	vector<BinaryBuffer> vRecvAnswer;
+	vector<int> vAnswerFrom;
+	ExchangeBuffers(vRecvAnswer, vAnswerFrom, vAnswer);
+
+	vector<int> vHolders;
+	for(size_t i = 0; i < vRecvAnswer.size(); ++i){
+		BinaryBuffer& in = vRecvAnswer[i];
+		vector<GridObject*>& queried = vQueried[vAnswerFrom[i]];
+		for(size_t j = 0; j < queried.size(); ++j){
+			Deserialize(in, vHolders);
+			GridObject* o = queried[j];
+			switch(o->base_object_id()){
+				case VERTEX:
+					AddToHorizontalInterfaces(glm, static_cast<Vertex*>(o), vHolders);
+					break;
+				case EDGE:
+					AddToHorizontalInterfaces(glm, static_cast<Edge*>(o), vHolders);
+					break;
+				case FACE:
+					AddToHorizontalInterfaces(glm, static_cast<Face*>(o), vHolders);
+					break;
+				default:
+					UG_THROW("LoadPartitionedGrid: Unexpected shared element.");
+			}
+		}
+	}
+
+	SortInterfaceEntries<Vertex>(mg, glm, aID);
+	SortInterfaceEntries<Edge>(mg, glm, aID);
+	SortInterfaceEntries<Face>(mg, glm, aID);
+}
+#endif
+
+///	reads the part of the local process. Returns the number of parts in the file.
+static int ReadPart(BinaryBuffer& in, const char* filename)
+{
+#ifdef UG_PARALLEL
+	return pcl::ReadCombinedParallelFilePart(in, filename);
+#else
+	FILE* f = fopen(filename, "rb");
+	UG_COND_THROW(!f, "LoadPartitionedGrid: Could not open " << filename);
+
+	int numParts = 0;
+	long long nextOffset = 0;
+	bool ok = (fread(&numParts, sizeof(numParts), 1, f) == 1)
+			&& (fread(&nextOffset, sizeof(nextOffset), 1, f) == 1);
+	if(!ok || numParts != 1){
+		fclose(f);
+		UG_THROW("LoadPartitionedGrid: " << filename << " contains "
+				 << numParts << " parts, but ug was compiled without "
+				 "parallel support.");
+	}
+
+	long long size = nextOffset - sizeof(int) - sizeof(long long);
+	vector<char> data(size + 1);
+	ok = (fread(&data[0], 1, size, f) == (size_t)size);
+	fclose(f);
+	UG_COND_THROW(!ok, "LoadPartitionedGrid: Could not read " << filename);
+
+	in.clear();
+	in.write(&data[0], size);
+	return numParts;
+#endif
+}
+
+void LoadPartitionedGrid(MultiGrid& mg, GridDataSerializationHandler& serializer,
+						 const char* filename)
+{
+	PROFILE_FUNC_GROUP("grid");
+
+//	processes, for which no part exists in the file, receive an empty buffer
+	BinaryBuffer in;
+	ReadPart(in, filename);
+	const bool hasPart = (in.write_pos() > 0);
+
+	if(hasPart){
+		int magic = 0, version = 0;
+		Deserialize(in, magic);
+		Deserialize(in, version);
+		UG_COND_THROW(magic != PARTITIONED_GRID_MAGIC
+					  || version != PARTITIONED_GRID_VERSION,
+					  "LoadPartitionedGrid: " << filename
+					  << " is not a valid partitioned grid file.");
+	}
+
+	mg.message_hub()->post_message(GridMessage_Creation(GMCT_CREATION_STARTS, -1));
+
+#ifdef UG_PARALLEL
+	DistributedGridManager& distGridMgr = *mg.distributed_grid_manager();
+	GridLayoutMap& glm = distGridMgr.grid_layout_map();
+	distGridMgr.enable_interface_management(false);
+	mg.clear_geometry();
+	glm.clear();
+	AGeomObjID& aID = aGeomObjID;
+#else
+	mg.clear_geometry();
+	AGeomObjID aID;
+#endif
+	if(!mg.has_vertex_attachment(aID)) mg.attach_to_vertices(aID);
+	if(!mg.has_edge_attachment(aID)) mg.attach_to_edges(aID);
+	if(!mg.has_face_attachment(aID)) mg.attach_to_faces(aID);
+	if(!mg.has_volume_attachment(aID)) mg.attach_to_volumes(aID);
+	MultiElementAttachmentAccessor<AGeomObjID> aaID(mg, aID);
+
+	AByte aShared;
+	mg.attach_to_all_dv(aShared, 0);
+	MultiElementAttachmentAccessor<AByte> aaShared(mg, aShared);
+
+	vector<Vertex*> vrts;
+	vector<Edge*> edges;
+	vector<Face*> faces;
+	vector<Volume*> vols;
+
+	if(hasPart){
+		if(!DeserializeMultiGridElements(mg, in, &vrts, &edges, &faces, &vols, &aaID))
+			UG_THROW("LoadPartitionedGrid: Could not read the grid from " << filename);
+
+		GridDataSerializationHandler sharedSerializer;
+		sharedSerializer.add(GeomObjAttachmentSerializer<Vertex, AByte>::create(mg, aShared));
+		sharedSerializer.add(GeomObjAttachmentSerializer<Edge, AByte>::create(mg, aShared));
+		sharedSerializer.add(GeomObjAttachmentSerializer<Face, AByte>::create(mg, aShared));
+
+		GridDataSerializationHandler* vSerializer[] = {&serializer, &sharedSerializer};
+		for(size_t i = 0; i < 2; ++i){
+			GridDataSerializationHandler& s = *vSerializer[i];
+			s.deserialization_starts();
+			s.read_infos(in);
+			s.deserialize(in, vrts.begin(), vrts.end());
+			s.deserialize(in, edges.begin(), edges.end());
+			s.deserialize(in, faces.begin(), faces.end());
+			s.deserialize(in, vols.begin(), vols.end());
+			s.deserialization_done();
+		}
+
+		int magic = 0;
+		Deserialize(in, magic);
+		UG_COND_THROW(magic != PARTITIONED_GRID_MAGIC,
+					  "LoadPartitionedGrid: Magic number mismatch in " << filename);
+	}
+
+#ifdef UG_PARALLEL
+	CreateHorizontalInterfaces(mg, glm, vrts, edges, faces, aaShared, aID);
+	glm.remove_empty_interfaces();
+	distGridMgr.enable_interface_management(true);
+	distGridMgr.grid_layouts_changed(false);
+#else
+	mg.detach_from_all(aID);
+#endif
+	mg.detach_from_all(aShared);
+
+	mg.message_hub()->post_message(GridMessage_Creation(GMCT_CREATION_STOPS, -1));
+}
+
+}//	end of namespace
@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+
+#ifndef __H__UG__LIB_GRID__FILE_IO_PARTITIONED__
+#define __H__UG__LIB_GRID__FILE_IO_PARTITIONED__
+
+#include <vector>
+#include "lib_grid/multi_grid.h"
+#include "lib_grid/tools/subset_handler_grid.h"
+#include "lib_grid/algorithms/serialization.h"
+
+namespace ug
+{
+
+///	writes the parts of a grid into one pre-partitioned grid file
+/**
+ * The partition of each element is given by its subset in shPartition. If a
+ * processMap is specified, subset i is written to part (*processMap)[i],
+ * otherwise to part i. For every part, the elements of highest dimension and
+ * their sides are serialized together with the data of the given serializer
+ * (e.g. vertex positions and subset handlers) and a global id for each element.
+ * Elements which are shared between several parts are marked in the file.
+ *
+ * The file uses the layout of pcl::WriteCombinedParallelFile. The method can
+ * thus be used to partition a grid once (e.g. in a serial run) for a
+ * following parallel run, in which LoadPartitionedGrid is used.
+ *
+ * The method is not collective and only supports grids with one level.
+ */
+void SavePartitionedGrid(MultiGrid& mg, SubsetHandler& shPartition,
+						 GridDataSerializationHandler& serializer,
+						 const char* filename,
+						 const std::vector<int>* processMap = NULL);
+
+///	loads the part of a pre-partitioned grid file, which belongs to the local process
+/**
+ * Process i reads part i of a file written by SavePartitionedGrid. Processes
+ * for which no part exists in the file remain empty. The horizontal interfaces
+ * between the parts are reconstructed from the global ids of the shared
+ * elements, so that neither a single process has to hold the whole grid nor
+ * a redistribution is required. The shared element with the lowest rank
+ * thereby becomes the master.
+ *
+ * The given serializer has to match the one used for saving. The grid has
+ * to be empty. In serial builds only files with one part can be loaded.
+ *
+ * This method is collective.
+ */
+void LoadPartitionedGrid(MultiGrid& mg, GridDataSerializationHandler& serializer,
+						 const char* filename);
+
+}//	end of namespace
+
+#endif
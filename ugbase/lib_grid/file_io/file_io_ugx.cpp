@@ -32,10 +32,15 @@
 
 #include <sstream>
 #include <fstream>
+#include <cstring>
+#include <cstdio>
 #include <boost/archive/text_oarchive.hpp>
 #include <boost/archive/text_iarchive.hpp>
 #include "common/common.h"
 #include "common/util/file_util.h"
+#include "common/util/base64_file_writer.h"
+#include "common/util/endian_detection.h"
+#include "common/util/vector_util.h"
 #include "file_io_ugx.h"
 #include "common/boost_serialization_routines.h"
 #include "common/parser/rapidxml/rapidxml_print.hpp"
@@ -44,6 +49,11 @@
 #include "lib_grid/algorithms/attachment_util.h"
 #include "lib_grid/refinement/projectors/projectors.h"
 
+#ifdef UG_POSIX
+	#include <fcntl.h>
+	#include <unistd.h>
+	#include <sys/mman.h>
+#endif
 
 using namespace std;
 using namespace rapidxml;
@@ -82,10 +92,178 @@ bool LoadGridFromUGX(Grid& grid, ISubsetHandler& sh,
 	return LoadGridFromUGX(grid, sh, filename, aPosition);
 }
 
+////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////
+//	binary data
+
+///	name of the byte order of this system as written to binary nodes
+static const char* ByteOrderName()
+{
+	return IsLittleEndian() ? "LittleEndian" : "BigEndian";
+}
+
+///	the comment behind the xml declaration which contains the offset of the appended data
+static const char* APPENDED_DATA_TAG = "<!--ugx_appended_data offset=\"";
+
+
+////////////////////////////////////////////////////////////////////////
+//	UGXFileContent
+UGXFileContent::UGXFileContent() :
+	m_mappedData(NULL),
+	m_mappedSize(0),
+	m_appendedData(NULL),
+	m_appendedSize(0)
+{
+}
+
+UGXFileContent::~UGXFileContent()
+{
+	release();
+}
+
+void UGXFileContent::
+release()
+{
+#ifdef UG_POSIX
+	if(m_mappedData)
+		munmap(m_mappedData, m_mappedSize);
+#endif
+	m_mappedData = NULL;
+	m_mappedSize = 0;
+	std::vector<char>().swap(m_fileData);
+	std::vector<char>().swap(m_decodedData);
+	m_appendedData = NULL;
+	m_appendedSize = 0;
+}
+
+char* UGXFileContent::
+read_file(rapidxml::xml_document<>& doc, const char* filename)
+{
+	release();
+
+	ifstream in(filename, ios::binary);
+	if(!in)
+		return NULL;
+
+//	get the length of the file
+	streampos posStart = in.tellg();
+	in.seekg(0, ios_base::end);
+	streampos posEnd = in.tellg();
+	size_t size = (size_t)(posEnd - posStart);
+
+//	go back to the start of the file
+	in.seekg(posStart);
+
+//	check whether the file contains appended data. The offset of the
+//	appended data is stored in a comment directly behind the declaration.
+	char prolog[256];
+	in.read(prolog, std::min<size_t>(size, 255));
+	prolog[in.gcount()] = 0;
+
+	size_t offset = 0;
+	const char* tag = strstr(prolog, APPENDED_DATA_TAG);
+	if(tag)
+		offset = strtoul(tag + strlen(APPENDED_DATA_TAG), NULL, 10);
+
+	in.clear();
+	in.seekg(posStart);
+
+	if(offset == 0){
+	//	read the whole file en-block and terminate it with 0
+		char* fileContent = doc.allocate_string(0, size + 1);
+		in.read(fileContent, size);
+		fileContent[size] = 0;
+		return fileContent;
+	}
+
+	UG_COND_THROW(offset > size, "UGXFileContent: appended data offset "
+				  << offset << " exceeds the size of file '" << filename << "'.");
+
+//	map the file into memory, so that the appended data is only read from
+//	the disk when it is accessed.
+	const char* data = NULL;
+#ifdef UG_POSIX
+	int fd = open(filename, O_RDONLY);
+	if(fd != -1){
+		void* ptr = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+		close(fd);
+		if(ptr != MAP_FAILED){
+			madvise(ptr, size, MADV_SEQUENTIAL);
+			m_mappedData = (char*)ptr;
+			m_mappedSize = size;
+			data = m_mappedData;
+		}
+	}
+#endif
+
+//	if the file couldn't be mapped, we'll read it en-block
+	if(!data){
+		m_fileData.resize(size);
+		in.read(GetDataPtr(m_fileData), size);
+		data = GetDataPtr(m_fileData);
+	}
+
+	UG_COND_THROW(data[offset - 1] != '_', "UGXFileContent: appended data of file '"
+				  << filename << "' doesn't start at offset " << offset << ".");
+
+	m_appendedData = data + offset;
+	m_appendedSize = size - offset;
+
+//	only the xml content is copied to the document
+	char* fileContent = doc.allocate_string(0, offset);
+	memcpy(fileContent, data, offset - 1);
+	fileContent[offset - 1] = 0;
+	return fileContent;
+}
+
+bool UGXFileContent::
+binary_data(const char*& dataOut, size_t& sizeOut, rapidxml::xml_node<>* node)
+{
+	xml_attribute<>* attribFormat = node->first_attribute("format");
+	if(!attribFormat)
+		return false;
+
+	xml_attribute<>* attribSize = node->first_attribute("size");
+	UG_COND_THROW(!attribSize, "UGXFileContent: size of binary data missing in node '"
+				  << node->name() << "'.");
+	sizeOut = strtoul(attribSize->value(), NULL, 10);
+
+	xml_attribute<>* attribOrder = node->first_attribute("byte_order");
+	UG_COND_THROW(attribOrder && strcmp(attribOrder->value(), ByteOrderName()) != 0,
+				  "UGXFileContent: byte order '" << attribOrder->value()
+				  << "' of node '" << node->name() << "' isn't supported on this system.");
+
+	if(strcmp(attribFormat->value(), "raw") == 0){
+		xml_attribute<>* attribOffset = node->first_attribute("offset");
+		UG_COND_THROW(!attribOffset, "UGXFileContent: offset of raw data missing in node '"
+					  << node->name() << "'.");
+		size_t offset = strtoul(attribOffset->value(), NULL, 10);
+		UG_COND_THROW(!m_appendedData || offset + sizeOut > m_appendedSize,
+					  "UGXFileContent: raw data of node '" << node->name()
+					  << "' exceeds the appended data of the file.");
+		dataOut = m_appendedData + offset;
+		return true;
+	}
+	else if(strcmp(attribFormat->value(), "base64") == 0){
+		DecodeBase64(m_decodedData, node->value(), node->value_size());
+		UG_COND_THROW(m_decodedData.size() < sizeOut,
+					  "UGXFileContent: base64 data of node '" << node->name()
+					  << "' is too short.");
+		dataOut = GetDataPtr(m_decodedData);
+		return true;
+	}
+
+	UG_THROW("UGXFileContent: unknown data format '" << attribFormat->value()
+			 << "' in node '" << node->name() << "'.");
+	return false;
+}
+
+
 ////////////////////////////////////////////////////////////////////////
 ////////////////////////////////////////////////////////////////////////
 //	GridWriterUGX
-GridWriterUGX::GridWriterUGX()
+GridWriterUGX::GridWriterUGX() :
+	m_dataMode(ASCII)
 {
 	xml_node<>* decl = m_doc.allocate_node(node_declaration);
 	decl->append_attribute(m_doc.allocate_attribute("version", "1.0"));
@@ -100,17 +278,68 @@ GridWriterUGX::~GridWriterUGX()
 		m_vEntries[i].grid->detach_from_vertices(m_aInt);
 }
 
+void GridWriterUGX::
+set_data_mode(DataMode mode)
+{
+	UG_COND_THROW(!m_vEntries.empty(), "GridWriterUGX::set_data_mode: "
+				  "The data mode has to be set before grids are added.");
+	m_dataMode = mode;
+}
+
+GridWriterUGX::DataMode GridWriterUGX::
+data_mode_by_name(const std::string& name)
+{
+	if(name == "ascii")
+		return ASCII;
+	else if(name == "base64")
+		return BASE64;
+	else if(name == "raw")
+		return RAW;
+
+	UG_THROW("GridWriterUGX: unknown data mode '" << name
+			 << "'. Supported are 'ascii', 'base64' and 'raw'.");
+	return ASCII;
+}
+
 bool GridWriterUGX::
 write_to_stream(std::ostream& out)
 {
-	out << m_doc;
-	return true;
+	if(m_dataMode != RAW){
+		out << m_doc;
+		return true;
+	}
+
+//	print all nodes but the declaration, which is written together with
+//	the offset of the appended data
+	stringstream ss;
+	for(xml_node<>* node = m_doc.first_node(); node; node = node->next_sibling()){
+		if(node->type() != node_declaration)
+			ss << *node;
+	}
+
+	const char* declaration = "<?xml version=\"1.0\" encoding=\"utf-8\"?>\n";
+	const size_t prologSize = strlen(declaration) + strlen(APPENDED_DATA_TAG) + 20 + 5;
+
+//	the appended data starts behind a '_' and is aligned to 8 bytes
+	string xml = ss.str();
+	size_t offset = prologSize + xml.size() + 1;
+	xml.append((8 - offset % 8) % 8, '\n');
+	offset = prologSize + xml.size() + 1;
+
+	char prolog[256];
+	snprintf(prolog, 256, "%s%s%020lu\"-->\n", declaration, APPENDED_DATA_TAG,
+			 (unsigned long)offset);
+	UG_ASSERT(strlen(prolog) == prologSize, "Bad size of ugx prolog.");
+
+	out << prolog << xml << '_';
+	out.write(GetDataPtr(m_appendedData), m_appendedData.size());
+	return (bool)out;
 }
 
 bool GridWriterUGX::
 write_to_file(const char* filename)
 {
-	ofstream out(filename);
+	ofstream out(filename, (m_dataMode == RAW) ? ios::out | ios::binary : ios::out);
 	if(out){
 		return write_to_stream(out);
 	}
@@ -197,9 +426,8 @@ rapidxml::xml_node<>* GridWriterUGX::
 create_subset_element_node(const char* name, const ISubsetHandler& sh,
 							size_t si)
 {
-
-//	the stringstream to which we'll write the data
-	stringstream ss;
+//	collect the indices of the elements in the subset
+	vector<int> vInd;
 
 	if(sh.grid()){
 	//	access the grid
@@ -213,12 +441,21 @@ create_subset_element_node(const char* name, const ISubsetHandler& sh,
 				for(typename geometry_traits<TGeomObj>::iterator iter =
 					goc.begin<TGeomObj>(lvl); iter != goc.end<TGeomObj>(lvl); ++iter)
 				{
-					ss << aaInd[*iter] << " ";
+					vInd.push_back(aaInd[*iter]);
 				}
 			}
 		}
 	}
 
+	if(m_dataMode != ASCII)
+		return create_binary_node(name, (const char*)GetDataPtr(vInd),
+								  vInd.size() * sizeof(int));
+
+//	the stringstream to which we'll write the data
+	stringstream ss;
+	for(size_t i = 0; i < vInd.size(); ++i)
+		ss << vInd[i] << " ";
+
 	if(ss.str().size() > 0){
 	//	allocate a string and erase last character(' ')
 		char* nodeData = m_doc.allocate_string(ss.str().c_str(), ss.str().size());
@@ -510,11 +747,61 @@ add_elements_to_node(rapidxml::xml_node<>* node,
 											  grid.end<Octahedron>(), aaIndVRT));
 }
 
+rapidxml::xml_node<>* GridWriterUGX::
+create_binary_node(const char* name, const char* data, size_t size)
+{
+	if(size == 0)
+		return m_doc.allocate_node(node_element, name);
+
+	xml_node<>* node = NULL;
+	if(m_dataMode == RAW){
+	//	the data is appended to the file. Sections are aligned to 8 bytes.
+		node = m_doc.allocate_node(node_element, name);
+		node->append_attribute(m_doc.allocate_attribute("format", "raw"));
+		node->append_attribute(m_doc.allocate_attribute("offset",
+						m_doc.allocate_string(mkstr(m_appendedData.size()).c_str())));
+		m_appendedData.insert(m_appendedData.end(), data, data + size);
+		m_appendedData.resize(m_appendedData.size() + (8 - size % 8) % 8, 0);
+	}
+	else{
+		string enc;
+		EncodeBase64(enc, data, size);
+		node = m_doc.allocate_node(node_element, name,
+						m_doc.allocate_string(enc.c_str(), enc.size() + 1));
+		node->append_attribute(m_doc.allocate_attribute("format", "base64"));
+	}
+
+	node->append_attribute(m_doc.allocate_attribute("size",
+						m_doc.allocate_string(mkstr(size).c_str())));
+	node->append_attribute(m_doc.allocate_attribute("byte_order", ByteOrderName()));
+	return node;
+}
+
+template <class TIterator>
+rapidxml::xml_node<>* GridWriterUGX::
+create_binary_element_node(const char* name, TIterator elemsBegin,
+						   TIterator elemsEnd, AAVrtIndex aaIndVRT)
+{
+//	collect the vertex indices of all elements
+	vector<int> vInd;
+	for(TIterator iter = elemsBegin; iter != elemsEnd; ++iter)
+	{
+		for(size_t i = 0; i < (*iter)->num_vertices(); ++i)
+			vInd.push_back(aaIndVRT[(*iter)->vertex(i)]);
+	}
+
+	return create_binary_node(name, (const char*)GetDataPtr(vInd),
+							  vInd.size() * sizeof(int));
+}
+
 rapidxml::xml_node<>* GridWriterUGX::
 create_edge_node(RegularEdgeIterator edgesBegin,
 				 RegularEdgeIterator edgesEnd,
 				 AAVrtIndex aaIndVRT)
 {
+	if(m_dataMode != ASCII)
+		return create_binary_element_node("edges", edgesBegin, edgesEnd, aaIndVRT);
+
 //	write the elements to a temporary stream
 	stringstream ss;
 	for(RegularEdgeIterator iter = edgesBegin; iter != edgesEnd; ++iter)
@@ -608,6 +895,9 @@ create_triangle_node(TriangleIterator trisBegin,
 				 	 TriangleIterator trisEnd,
 				 	 AAVrtIndex aaIndVRT)
 {
+	if(m_dataMode != ASCII)
+		return create_binary_element_node("triangles", trisBegin, trisEnd, aaIndVRT);
+
 //	write the elements to a temporary stream
 	stringstream ss;
 	for(TriangleIterator iter = trisBegin; iter != trisEnd; ++iter)
@@ -700,6 +990,9 @@ create_quadrilateral_node(QuadrilateralIterator quadsBegin,
 						  QuadrilateralIterator quadsEnd,
 						  AAVrtIndex aaIndVRT)
 {
+	if(m_dataMode != ASCII)
+		return create_binary_element_node("quadrilaterals", quadsBegin, quadsEnd, aaIndVRT);
+
 //	write the elements to a temporary stream
 	stringstream ss;
 	for(QuadrilateralIterator iter = quadsBegin; iter != quadsEnd; ++iter)
@@ -790,6 +1083,9 @@ create_tetrahedron_node(TetrahedronIterator tetsBegin,
 						  TetrahedronIterator tetsEnd,
 						  AAVrtIndex aaIndVRT)
 {
+	if(m_dataMode != ASCII)
+		return create_binary_element_node("tetrahedrons", tetsBegin, tetsEnd, aaIndVRT);
+
 //	write the elements to a temporary stream
 	stringstream ss;
 	for(TetrahedronIterator iter = tetsBegin; iter != tetsEnd; ++iter)
@@ -816,6 +1112,9 @@ create_hexahedron_node(HexahedronIterator hexasBegin,
 						  HexahedronIterator hexasEnd,
 						  AAVrtIndex aaIndVRT)
 {
+	if(m_dataMode != ASCII)
+		return create_binary_element_node("hexahedrons", hexasBegin, hexasEnd, aaIndVRT);
+
 //	write the elements to a temporary stream
 	stringstream ss;
 	for(HexahedronIterator iter = hexasBegin; iter != hexasEnd; ++iter)
@@ -844,6 +1143,9 @@ create_prism_node(PrismIterator prismsBegin,
 					PrismIterator prismsEnd,
 					AAVrtIndex aaIndVRT)
 {
+	if(m_dataMode != ASCII)
+		return create_binary_element_node("prisms", prismsBegin, prismsEnd, aaIndVRT);
+
 //	write the elements to a temporary stream
 	stringstream ss;
 	for(PrismIterator iter = prismsBegin; iter != prismsEnd; ++iter)
@@ -871,6 +1173,9 @@ create_pyramid_node(PyramidIterator pyrasBegin,
 					PyramidIterator pyrasEnd,
 					AAVrtIndex aaIndVRT)
 {
+	if(m_dataMode != ASCII)
+		return create_binary_element_node("pyramids", pyrasBegin, pyrasEnd, aaIndVRT);
+
 //	write the elements to a temporary stream
 	stringstream ss;
 	for(PyramidIterator iter = pyrasBegin; iter != pyrasEnd; ++iter)
@@ -898,6 +1203,9 @@ create_octahedron_node(OctahedronIterator octsBegin,
 						OctahedronIterator octsEnd,
 						AAVrtIndex aaIndVRT)
 {
+	if(m_dataMode != ASCII)
+		return create_binary_element_node("octahedrons", octsBegin, octsEnd, aaIndVRT);
+
 //	write the elements to a temporary stream
 	stringstream ss;
 	for(OctahedronIterator iter = octsBegin; iter != octsEnd; ++iter)
@@ -1054,6 +1362,26 @@ read_subset_handler_elements(ISubsetHandler& shOut,
 
 	while(elemNode)
 	{
+	//	read binary indices
+		const char* data;
+		size_t size;
+		if(m_content.binary_data(data, size, elemNode)){
+			for(size_t i = 0; i + sizeof(int) <= size; i += sizeof(int)){
+				int index;
+				memcpy(&index, data + i, sizeof(int));
+				if(index >= 0 && (size_t)index < vElems.size()){
+					shOut.assign_subset(vElems[index], subsetIndex);
+				}
+				else{
+					UG_LOG("Bad element index in subset-node " << elemNodeName <<
+							": " << index << ". Ignoring element.\n");
+					return false;
+				}
+			}
+			elemNode = elemNode->next_sibling(elemNodeName);
+			continue;
+		}
+
 	//	read the indices
 		stringstream ss(elemNode->value(), ios_base::in);
 
@@ -1303,25 +1631,11 @@ projection_handler(ProjectionHandler& phOut, size_t phIndex, size_t refGridIndex
 bool GridReaderUGX::
 parse_file(const char* filename)
 {
-	ifstream in(filename, ios::binary);
-	if(!in)
+//	read the xml content of the file. Appended binary data stays in the file.
+	char* fileContent = m_content.read_file(m_doc, filename);
+	if(!fileContent)
 		return false;
 
-//	get the length of the file
-	streampos posStart = in.tellg();
-	in.seekg(0, ios_base::end);
-	streampos posEnd = in.tellg();
-	streamsize size = posEnd - posStart;
-
-//	go back to the start of the file
-	in.seekg(posStart);
-
-//	read the whole file en-block and terminate it with 0
-	char* fileContent = m_doc.allocate_string(0, size + 1);
-	in.read(fileContent, size);
-	fileContent[size] = 0;
-	in.close();
-
 //	parse the xml-data
 	m_doc.parse<0>(fileContent);
 
@@ -1368,11 +1682,93 @@ new_document_parsed()
 	return true;
 }
 
+///	creates an element of type TElem from the given vertices
+template <class TElem>
+static TElem* CreateElement(Grid& grid, Vertex* const* v);
+
+template <>
+RegularEdge* CreateElement<RegularEdge>(Grid& grid, Vertex* const* v)
+{return *grid.create<RegularEdge>(EdgeDescriptor(v[0], v[1]));}
+
+template <>
+Triangle* CreateElement<Triangle>(Grid& grid, Vertex* const* v)
+{return *grid.create<Triangle>(TriangleDescriptor(v[0], v[1], v[2]));}
+
+template <>
+Quadrilateral* CreateElement<Quadrilateral>(Grid& grid, Vertex* const* v)
+{return *grid.create<Quadrilateral>(QuadrilateralDescriptor(v[0], v[1], v[2], v[3]));}
+
+template <>
+Tetrahedron* CreateElement<Tetrahedron>(Grid& grid, Vertex* const* v)
+{return *grid.create<Tetrahedron>(TetrahedronDescriptor(v[0], v[1], v[2], v[3]));}
+
+template <>
+Hexahedron* CreateElement<Hexahedron>(Grid& grid, Vertex* const* v)
+{return *grid.create<Hexahedron>(HexahedronDescriptor(v[0], v[1], v[2], v[3],
+													  v[4], v[5], v[6], v[7]));}
+
+template <>
+Prism* CreateElement<Prism>(Grid& grid, Vertex* const* v)
+{return *grid.create<Prism>(PrismDescriptor(v[0], v[1], v[2], v[3], v[4], v[5]));}
+
+template <>
+Pyramid* CreateElement<Pyramid>(Grid& grid, Vertex* const* v)
+{return *grid.create<Pyramid>(PyramidDescriptor(v[0], v[1], v[2], v[3], v[4]));}
+
+template <>
+Octahedron* CreateElement<Octahedron>(Grid& grid, Vertex* const* v)
+{return *grid.create<Octahedron>(OctahedronDescriptor(v[0], v[1], v[2], v[3], v[4], v[5]));}
+
+template <class TElem, class TBaseElem>
+bool GridReaderUGX::
+create_binary_elements(std::vector<TBaseElem*>& elemsOut,
+					   Grid& grid, const char* data, size_t size,
+					   size_t numElemVrts,
+					   std::vector<Vertex*>& vrts)
+{
+	const size_t elemSize = numElemVrts * sizeof(int);
+	if(size % elemSize != 0){
+		UG_LOG("  ERROR in GridReaderUGX::create_binary_elements: size of binary "
+				"data doesn't match the number of element vertices.\n");
+		return false;
+	}
+
+	const size_t numElems = size / elemSize;
+	elemsOut.reserve(elemsOut.size() + numElems);
+
+	int ind[8];
+	Vertex* v[8];
+	const int maxInd = (int)vrts.size() - 1;
+	for(size_t i = 0; i < numElems; ++i){
+	//	the data isn't necessarily aligned, which is why it is copied
+		memcpy(ind, data + i * elemSize, elemSize);
+
+	//	make sure that the indices are valid
+		for(size_t j = 0; j < numElemVrts; ++j){
+			if(ind[j] < 0 || ind[j] > maxInd){
+				UG_LOG("  ERROR in GridReaderUGX::create_binary_elements: "
+						"invalid vertex index: " << ind[j] << "\n");
+				return false;
+			}
+			v[j] = vrts[ind[j]];
+		}
+
+		elemsOut.push_back(CreateElement<TElem>(grid, v));
+	}
+
+	return true;
+}
+
 bool GridReaderUGX::
 create_edges(std::vector<Edge*>& edgesOut,
 			Grid& grid, rapidxml::xml_node<>* node,
 			std::vector<Vertex*>& vrts)
 {
+	const char* data;
+	size_t size;
+	if(m_content.binary_data(data, size, node))
+		return create_binary_elements<RegularEdge>(edgesOut, grid, data, size, 2, vrts);
+
 //	create a buffer with which we can access the data
 	string str(node->value(), node->value_size());
 	stringstream ss(str, ios_base::in);
@@ -1491,6 +1887,11 @@ create_triangles(std::vector<Face*>& facesOut,
 				  Grid& grid, rapidxml::xml_node<>* node,
 				  std::vector<Vertex*>& vrts)
 {
+	const char* data;
+	size_t size;
+	if(m_content.binary_data(data, size, node))
+		return create_binary_elements<Triangle>(facesOut, grid, data, size, 3, vrts);
+
 //	create a buffer with which we can access the data
 	string str(node->value(), node->value_size());
 	stringstream ss(str, ios_base::in);
@@ -1613,6 +2014,11 @@ create_quadrilaterals(std::vector<Face*>& facesOut,
 					   Grid& grid, rapidxml::xml_node<>* node,
 					   std::vector<Vertex*>& vrts)
 {
+	const char* data;
+	size_t size;
+	if(m_content.binary_data(data, size, node))
+		return create_binary_elements<Quadrilateral>(facesOut, grid, data, size, 4, vrts);
+
 //	create a buffer with which we can access the data
 	string str(node->value(), node->value_size());
 	stringstream ss(str, ios_base::in);
@@ -1744,6 +2150,11 @@ create_tetrahedrons(std::vector<Volume*>& volsOut,
 					 Grid& grid, rapidxml::xml_node<>* node,
 					 std::vector<Vertex*>& vrts)
 {
+	const char* data;
+	size_t size;
+	if(m_content.binary_data(data, size, node))
+		return create_binary_elements<Tetrahedron>(volsOut, grid, data, size, 4, vrts);
+
 //	create a buffer with which we can access the data
 	string str(node->value(), node->value_size());
 	stringstream ss(str, ios_base::in);
@@ -1783,6 +2194,11 @@ create_hexahedrons(std::vector<Volume*>& volsOut,
 					Grid& grid, rapidxml::xml_node<>* node,
 					std::vector<Vertex*>& vrts)
 {
+	const char* data;
+	size_t size;
+	if(m_content.binary_data(data, size, node))
+		return create_binary_elements<Hexahedron>(volsOut, grid, data, size, 8, vrts);
+
 //	create a buffer with which we can access the data
 	string str(node->value(), node->value_size());
 	stringstream ss(str, ios_base::in);
@@ -1826,6 +2242,11 @@ create_prisms(std::vector<Volume*>& volsOut,
 			  Grid& grid, rapidxml::xml_node<>* node,
 			  std::vector<Vertex*>& vrts)
 {
+	const char* data;
+	size_t size;
+	if(m_content.binary_data(data, size, node))
+		return create_binary_elements<Prism>(volsOut, grid, data, size, 6, vrts);
+
 //	create a buffer with which we can access the data
 	string str(node->value(), node->value_size());
 	stringstream ss(str, ios_base::in);
@@ -1867,6 +2288,11 @@ create_pyramids(std::vector<Volume*>& volsOut,
 				Grid& grid, rapidxml::xml_node<>* node,
 				std::vector<Vertex*>& vrts)
 {
+	const char* data;
+	size_t size;
+	if(m_content.binary_data(data, size, node))
+		return create_binary_elements<Pyramid>(volsOut, grid, data, size, 5, vrts);
+
 //	create a buffer with which we can access the data
 	string str(node->value(), node->value_size());
 	stringstream ss(str, ios_base::in);
@@ -1907,6 +2333,11 @@ create_octahedrons(std::vector<Volume*>& volsOut,
 					Grid& grid, rapidxml::xml_node<>* node,
 					std::vector<Vertex*>& vrts)
 {
+	const char* data;
+	size_t size;
+	if(m_content.binary_data(data, size, node))
+		return create_binary_elements<Octahedron>(volsOut, grid, data, size, 6, vrts);
+
 //	create a buffer with which we can access the data
 	string str(node->value(), node->value_size());
 	stringstream ss(str, ios_base::in);
@@ -1954,24 +2385,11 @@ bool UGXFileInfo::parse_file(const char* filename)
 	PROFILE_FUNC_GROUP("UGXFileInfo");
 	string tfile = FindFileInStandardPaths(filename);
 
-	ifstream in(tfile.c_str(), ios::binary);
-	UG_COND_THROW(!in, "UGXFileInfo: couldn't find file '" << filename << "'");
-
-//	get the length of the file
-	streampos posStart = in.tellg();
-	in.seekg(0, ios_base::end);
-	streampos posEnd = in.tellg();
-	streamsize size = posEnd - posStart;
-
-//	go back to the start of the file
-	in.seekg(posStart);
-
-//	read the whole file en-block and terminate it with 0
+//	read the xml content of the file
 	rapidxml::xml_document<> doc;
-	char* fileContent = doc.allocate_string(0, size + 1);
-	in.read(fileContent, size);
-	fileContent[size] = 0;
-	in.close();
+	UGXFileContent content;
+	char* fileContent = content.read_file(doc, tfile.c_str());
+	UG_COND_THROW(!fileContent, "UGXFileInfo: couldn't find file '" << filename << "'");
 
 //	parse the xml-data
 	doc.parse<0>(fileContent);
@@ -2008,7 +2426,7 @@ bool UGXFileInfo::parse_file(const char* filename)
 		{
 			// create a bounding box around the vertices contained in this xml node
 			AABox<vector3> newBox;
-			bool validBox = calculate_vertex_node_bbox(vrtNode, newBox);
+			bool validBox = calculate_vertex_node_bbox(vrtNode, newBox, content);
 		    if (validBox)
 		    	box = AABox<vector3>(box, newBox);
 
@@ -2184,7 +2602,8 @@ UGXFileInfo::subset_info(size_t gridInd, size_t shInd, size_t subsetInd) const
 }
 
 bool
-UGXFileInfo::calculate_vertex_node_bbox(rapidxml::xml_node<>* vrtNode, AABox<vector3>& bb) const
+UGXFileInfo::calculate_vertex_node_bbox(rapidxml::xml_node<>* vrtNode, AABox<vector3>& bb,
+										UGXFileContent& content) const
 {
 	size_t numSrcCoords = 0;
 	rapidxml::xml_attribute<>* attrib = vrtNode->first_attribute("coords");
@@ -2199,15 +2618,39 @@ UGXFileInfo::calculate_vertex_node_bbox(rapidxml::xml_node<>* vrtNode, AABox<vec
 	if (numSrcCoords > 3)
 		return false;
 
-//	create a buffer with which we can access the data
-	std::string str(vrtNode->value(), vrtNode->value_size());
-	std::stringstream ss(str, std::ios_base::in);
-
 	AABox<vector3> box(vector3(0, 0, 0), vector3(0, 0, 0));
 	vector3 min(0, 0, 0);
 	vector3 max(0, 0, 0);
 	vector3 vrt(0, 0, 0);
 	size_t nVrt = 0;
+
+	// binary coordinates
+	const char* data;
+	size_t size;
+	if (content.binary_data(data, size, vrtNode))
+	{
+		const size_t vrtSize = numSrcCoords * sizeof(double);
+		for (size_t offset = 0; vrtSize > 0 && offset + vrtSize <= size; offset += vrtSize)
+		{
+			double coords[3];
+			memcpy(coords, data + offset, vrtSize);
+			++nVrt;
+
+			for (size_t j = 0; j < numSrcCoords; ++j)
+			{
+				min[j] = std::min(min[j], coords[j]);
+				max[j] = std::max(max[j], coords[j]);
+			}
+		}
+
+		bb = AABox<vector3>(min, max);
+		return nVrt > 0;
+	}
+
+	// create a buffer with which we can access the data
+	std::string str(vrtNode->value(), vrtNode->value_size());
+	std::stringstream ss(str, std::ios_base::in);
+
 	while (!ss.eof())
 	{
 		for (size_t i = 0; i < numSrcCoords; ++i)
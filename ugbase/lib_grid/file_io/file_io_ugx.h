@@ -96,6 +96,59 @@ bool LoadGridFromUGX(Grid& grid, ISubsetHandler& sh,
 bool LoadGridFromUGX(Grid& grid, ISubsetHandler& sh,
 					const char* filename);
 					
+
+////////////////////////////////////////////////////////////////////////
+///	Gives access to the content of a ugx file including its binary data.
+/**	Instead of ascii text, the data of the vertex, element and subset nodes
+ *	of a ugx file can be stored in binary form (see GridWriterUGX::DataMode).
+ *	Such nodes have a 'format' attribute with one of the values
+ *	- "base64":	the data is base64 encoded in the value of the node,
+ *	- "raw":	the data is stored in the appended data section of the file,
+ *				starting at the byte given by the 'offset' attribute.
+ *
+ *	The 'size' attribute contains the number of bytes and the 'byte_order'
+ *	attribute the byte order of the data. Indices are stored as 32 bit
+ *	integers, coordinates as doubles.
+ *
+ *	A file with appended data contains a comment directly after the xml
+ *	declaration, which holds the offset of the appended data in the file.
+ *	The appended data starts behind a '_', which follows the xml content.
+ *	Such files are memory mapped and only the xml content is copied and
+ *	parsed, so that the binary data never becomes part of the xml document.
+ */
+class UGXFileContent
+{
+	public:
+		UGXFileContent();
+		~UGXFileContent();
+
+	///	reads a ugx file and returns its xml content as a 0-terminated string
+	/**	The string is allocated by the given document. Returns NULL if the file
+	 *	could not be read.*/
+		char* read_file(rapidxml::xml_document<>& doc, const char* filename);
+
+	///	returns the binary data of the given node
+	/**	Returns false if the data of the node is stored as ascii text. Base64
+	 *	encoded data is decoded into an internal buffer, which is valid until
+	 *	the next call. Raw data is returned directly from the mapped file.*/
+		bool binary_data(const char*& dataOut, size_t& sizeOut,
+						 rapidxml::xml_node<>* node);
+
+	private:
+		UGXFileContent(const UGXFileContent&);
+		UGXFileContent& operator=(const UGXFileContent&);
+
+		void release();
+
+	private:
+		char*				m_mappedData;
+		size_t				m_mappedSize;
+		std::vector<char>	m_fileData;
+		const char*			m_appendedData;
+		size_t				m_appendedSize;
+		std::vector<char>	m_decodedData;
+};
+
 					
 
 ////////////////////////////////////////////////////////////////////////					
@@ -106,10 +159,25 @@ bool LoadGridFromUGX(Grid& grid, ISubsetHandler& sh,
  */
 class GridWriterUGX
 {
+	public:
+	///	storage of the vertex, element and subset data (see UGXFileContent)
+		enum DataMode
+		{
+			ASCII,	///< text (default)
+			BASE64,	///< base64 encoded binary data in the xml nodes
+			RAW		///< binary data in the appended data section of the file
+		};
+
 	public:
 		GridWriterUGX();
 		virtual ~GridWriterUGX();
 
+	///	sets the storage of the data. Has to be called before add_grid.
+		void set_data_mode(DataMode mode);
+
+	///	returns the data mode for the name "ascii", "base64" or "raw"
+		static DataMode data_mode_by_name(const std::string& name);
+
 	/**	TPositionAttachments value type has to be compatible with MathVector.
 	 *	Make sure that aPos is attached to the vertices of the grid.*/
 		template <class TPositionAttachment>
@@ -146,6 +214,16 @@ class GridWriterUGX
 
 	protected:
 		void init_grid_attachments(Grid& grid);
+
+	///	creates a node containing the given binary data according to the data mode
+		rapidxml::xml_node<>*
+		create_binary_node(const char* name, const char* data, size_t size);
+
+	///	creates a node containing the vertex indices of the given elements in binary form
+		template <class TIterator>
+		rapidxml::xml_node<>*
+		create_binary_element_node(const char* name, TIterator elemsBegin,
+								   TIterator elemsEnd, AAVrtIndex aaIndVRT);
 		
 	//	VERTICES
 		template <class TAAPos>
@@ -287,6 +365,12 @@ class GridWriterUGX
 
 	///	attached to vertices of each grid during add_grid.
 		AInt	m_aInt;
+
+	///	storage of the vertex, element and subset data
+		DataMode	m_dataMode;
+
+	///	binary data, which is appended to the file in RAW mode
+		std::vector<char>	m_appendedData;
 };
 
 
@@ -466,6 +550,13 @@ class GridReaderUGX
 								Grid& grid, rapidxml::xml_node<>* node,
 								std::vector<Vertex*>& vrts);
 
+	///	creates elements from binary vertex indices
+		template <class TElem, class TBaseElem>
+		bool create_binary_elements(std::vector<TBaseElem*>& elemsOut,
+									Grid& grid, const char* data, size_t size,
+									size_t numElemVrts,
+									std::vector<Vertex*>& vrts);
+
 		template <class TGeomObj>
 		bool read_subset_handler_elements(ISubsetHandler& shOut,
 										 const char* elemNodeName,
@@ -491,6 +582,9 @@ class GridReaderUGX
 
 	///	holds grids which already have been created
 		std::vector<GridEntry>	m_entries;
+
+	///	gives access to the binary data of the parsed file
+		UGXFileContent	m_content;
 };
 
 
@@ -602,10 +696,12 @@ class UGXFileInfo{
 	 *
 	 * @param[in] vrtNode	node in the xml file (containing vertex information)
 	 * @param[out] bb		output bounding box
+ * @param[in] content	content of the file (for binary vertex data)
 	 *
 	 * @return true if at least one valid (coordinate dimension in {0,1,2,3}) vertex is contained
 	 */
-		bool calculate_vertex_node_bbox(rapidxml::xml_node<>* vrtNode, AABox<vector3>& bb) const;
+		bool calculate_vertex_node_bbox(rapidxml::xml_node<>* vrtNode, AABox<vector3>& bb,
+										UGXFileContent& content) const;
 };
 
 }//	end of namespace
@@ -35,6 +35,7 @@
 
 #include <sstream>
 #include <cstring>
+#include "common/util/vector_util.h"
 #include "lib_grid/algorithms/debug_util.h"
 #include "lib_grid/global_attachments.h"
 
@@ -225,28 +226,42 @@ create_vertex_node(RegularVertexIterator vrtsBegin,
 //	the number of coordinates
 	const int numCoords = (int)TAAPos::ValueType::Size;
 
-//	write the vertices to a temporary stream
-	stringstream ss;
-	ss.precision(18);
-	for(RegularVertexIterator iter = vrtsBegin; iter != vrtsEnd; ++iter)
-	{
-		for(int i = 0; i < numCoords; ++i)
-			ss << aaPos[*iter][i] << " ";
-	}
-
 //	create the node
 	xml_node<>* node = NULL;
 
-	if(ss.str().size() > 0){
-	//	allocate a string and erase last character(' ')
-		char* nodeData = m_doc.allocate_string(ss.str().c_str(), ss.str().size());
-		nodeData[ss.str().size()-1] = 0;
-	//	create a node with some data
-		node = m_doc.allocate_node(node_element, "vertices", nodeData);
+	if(m_dataMode != ASCII){
+	//	the coordinates are stored as doubles
+		vector<double> vCoords;
+		for(RegularVertexIterator iter = vrtsBegin; iter != vrtsEnd; ++iter)
+		{
+			for(int i = 0; i < numCoords; ++i)
+				vCoords.push_back(aaPos[*iter][i]);
+		}
+
+		node = create_binary_node("vertices", (const char*)GetDataPtr(vCoords),
+								  vCoords.size() * sizeof(double));
 	}
 	else{
-	//	create an emtpy node
-		node = m_doc.allocate_node(node_element, "vertices");
+	//	write the vertices to a temporary stream
+		stringstream ss;
+		ss.precision(18);
+		for(RegularVertexIterator iter = vrtsBegin; iter != vrtsEnd; ++iter)
+		{
+			for(int i = 0; i < numCoords; ++i)
+				ss << aaPos[*iter][i] << " ";
+		}
+
+		if(ss.str().size() > 0){
+		//	allocate a string and erase last character(' ')
+			char* nodeData = m_doc.allocate_string(ss.str().c_str(), ss.str().size());
+			nodeData[ss.str().size()-1] = 0;
+		//	create a node with some data
+			node = m_doc.allocate_node(node_element, "vertices", nodeData);
+		}
+		else{
+		//	create an emtpy node
+			node = m_doc.allocate_node(node_element, "vertices");
+		}
 	}
 
 	char* buff = m_doc.allocate_string(NULL, 10);
@@ -701,6 +716,39 @@ create_vertices(std::vector<Vertex*>& vrtsOut, Grid& grid,
 	if(numSrcCoords < 1 || numDestCoords < 1)
 		return false;
 
+//	binary coordinates are copied directly to the position attachment.
+//	If numDestCoords < numSrcCoords we'll ignore some coords,
+//	in the other case we'll add some 0's.
+	const char* data;
+	size_t size;
+	if(m_content.binary_data(data, size, vrtNode)){
+		UG_COND_THROW(numSrcCoords > 3, "GridReaderUGX: binary vertices with "
+					  << numSrcCoords << " coordinates are not supported.");
+		const size_t vrtSize = numSrcCoords * sizeof(double);
+		const int minNumCoords = min(numSrcCoords, numDestCoords);
+		const size_t numVrts = size / vrtSize;
+		vrtsOut.reserve(vrtsOut.size() + numVrts);
+
+		double coords[3];
+		for(size_t i = 0; i < numVrts; ++i){
+			memcpy(coords, data + i * vrtSize, vrtSize);
+
+			typename TAAPos::ValueType v;
+			for(int j = 0; j < minNumCoords; ++j)
+				v[j] = coords[j];
+			for(int j = minNumCoords; j < numDestCoords; ++j)
+				v[j] = 0;
+
+		//	create a new vertex
+			RegularVertex* vrt = *grid.create<RegularVertex>();
+			vrtsOut.push_back(vrt);
+
+		//	set the coordinates
+			aaPos[vrt] = v;
+		}
+		return true;
+	}
+
 //	create a buffer with which we can access the data
 	string str(vrtNode->value(), vrtNode->value_size());
 	stringstream ss(str, ios_base::in);
@@ -123,6 +123,9 @@ Grid::~Grid()
 	#endif
 
 	if(m_periodicBndMgr)		delete m_periodicBndMgr;
+
+//	return the memory of the elements, unless used by other grids
+	SlabObjectAllocator::inst().release_free_slabs();
 }
 
 void Grid::notify_and_clear_observers_on_grid_destruction(GridObserver* initiator)
@@ -499,6 +499,20 @@ class UG_API Grid
 	////////////////////////////////////////////////
 	///	flips the orientation of a volume.
 		void flip_orientation(Volume* vol);
+
+	////////////////////////////////////////////////
+	///	rearranges elements in the order in which they appear in vElems
+	/**	Each element of vElems is moved to the end of its section in the
+	 * element storage, such that the elements of a section are afterwards
+	 * iterated in the order of vElems. Elements not contained in vElems
+	 * precede them. The attached data is aligned with the new order, i.e.
+	 * data of successively iterated elements lies contiguously in memory.
+	 *
+	 * Element pointers and iterators stay valid, data arrays obtained from
+	 * the attachment pipe are invalidated.
+	 * TGeomObj has to be one of Vertex, Edge, Face or Volume.*/
+		template <class TGeomObj>
+		void reorder_elements(const std::vector<TGeomObj*>& vElems);
 		
 	////////////////////////////////////////////////
 	//	Iterators
@@ -44,6 +44,7 @@
 #include "lib_grid/attachments/attached_list.h"
 #include "common/util/hash_function.h"
 #include "common/allocators/small_object_allocator.h"
+#include "common/allocators/slab_allocator.h"
 #include "common/math/ugmath_types.h"
 #include "common/util/pointer_const_array.h"
 
@@ -151,9 +152,14 @@ template<> class attachment_traits<Volume*, ElementStorage<Volume> >;
  * In order to be used by libGrid, all derivatives of GridObject
  * have to specialize geometry_traits<GeomObjectType>.
  *
+ * Instances are allocated through the SlabObjectAllocator, i.e. objects of
+ * the same size are taken from common slabs of memory and freed memory is
+ * recycled for new objects. This avoids one heap allocation per object and
+ * improves locality when iterating over the elements of a grid.
+ *
  * \ingroup lib_grid_grid_objects
  */
-class UG_API GridObject/* : public SmallObject<>*/
+class UG_API GridObject : public SlabObject
 {
 	friend class Grid;
 	friend class attachment_traits<Vertex*, ElementStorage<Vertex> >;
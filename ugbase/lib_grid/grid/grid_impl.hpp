@@ -224,6 +224,27 @@ Grid::back()
 	return static_cast<TGeomObj*>(*element_storage<TGeomObj>().m_sectionContainer.
 										back(geometry_traits<TGeomObj>::CONTAINER_SECTION));
 }
+
+template <class TGeomObj>
+void
+Grid::reorder_elements(const std::vector<TGeomObj*>& vElems)
+{
+	STATIC_ASSERT(geometry_traits<TGeomObj>::BASE_OBJECT_ID != -1,
+		invalid_GeomObj);
+
+	typename traits<TGeomObj>::ElementStorage& storage = element_storage<TGeomObj>();
+
+//	erasing and reinserting an element appends it to its section
+	for(size_t i = 0; i < vElems.size(); ++i){
+		TGeomObj* elem = vElems[i];
+		const int section = elem->container_section();
+		storage.m_sectionContainer.erase(get_iterator(elem), section);
+		storage.m_sectionContainer.insert(elem, section);
+	}
+
+	storage.m_attachmentPipe.align_data();
+}
+
 ////////////////////////////////////////////////////////////////////////
 //	element numbers
 template <class TGeomObj>
@@ -34,11 +34,39 @@
 #include "common/util/binary_buffer.h"
 #include "common/log.h"
 #include <map>
+#include <algorithm>
 #include <string>
 #include <mpi.h>
 
 namespace pcl{
 
+///	maximal number of bytes read or written by one process in one MPI-IO call
+static const long long MAX_CHUNK_SIZE = 1 << 28;
+
+///	collectively reads or writes 'size' bytes at 'offset' in chunks of MAX_CHUNK_SIZE
+/**	The count argument of MPI-IO calls is an int and large collective requests
+ * are handled badly by many MPI-IO implementations. The data is thus
+ * transferred in chunks. Since all processes have to participate in each
+ * collective call, the number of chunks is agreed on first. Processes with
+ * less (or no) data participate with empty requests.*/
+static void CollectiveChunkedAccess(MPI_File fh, long long offset, char* p,
+                                    long long size, bool write, MPI_Comm comm)
+{
+	MPI_Status status;
+	long long myNumChunks = (size + MAX_CHUNK_SIZE - 1) / MAX_CHUNK_SIZE;
+	long long numChunks = 0;
+	MPI_Allreduce(&myNumChunks, &numChunks, 1, MPI_LONG_LONG, MPI_MAX, comm);
+
+	for(long long i = 0; i < numChunks; ++i){
+		long long begin = std::min(i * MAX_CHUNK_SIZE, size);
+		int count = (int)(std::min(begin + MAX_CHUNK_SIZE, size) - begin);
+		if(write)
+			MPI_File_write_at_all(fh, offset + begin, p + begin, count, MPI_BYTE, &status);
+		else
+			MPI_File_read_at_all(fh, offset + begin, p + begin, count, MPI_BYTE, &status);
+	}
+}
+
 
 void WriteCombinedParallelFile(ug::BinaryBuffer &buffer, std::string strFilename, pcl::ProcessCommunicator pc)
 {
@@ -77,12 +105,11 @@ void WriteCombinedParallelFile(ug::BinaryBuffer &buffer, std::string strFilename
 	}
 
 	long long myOffset = myNextOffset - mySize;
-	MPI_File_seek(fh, myOffset, MPI_SEEK_SET);
 
 //	UG_LOG_ALL_PROCS("MySize = " << mySize << "\n" << " myOffset = " << myOffset << "\n");
 //	UG_LOG_ALL_PROCS("buffer.write_pos() = " << buffer.write_pos() << "\n" << "(pc.size()+1)*sizeof(size_t) = " << (pc.size()+1)*sizeof(size_t) << "\n");
 
-	MPI_File_write(fh, buffer.buffer(), mySize, MPI_BYTE, &status);
+	CollectiveChunkedAccess(fh, myOffset, buffer.buffer(), mySize, true, m_mpiComm);
 
 	MPI_File_close(&fh);
 }
@@ -123,10 +150,8 @@ void ReadCombinedParallelFile(ug::BinaryBuffer &buffer, std::string strFilename,
 
 //	UG_LOG_ALL_PROCS("MySize = " << mySize << "\n" << "myNextOffset = " << myNextOffset << " - " << myNextOffset2 << "\n");
 
-	MPI_File_seek(fh, myNextOffset, MPI_SEEK_SET);
-
 	char *p = new char[mySize];
-	MPI_File_read(fh, p, mySize, MPI_BYTE, &status);
+	CollectiveChunkedAccess(fh, myNextOffset, p, mySize, false, m_mpiComm);
 	buffer.clear();
 	buffer.reserve(mySize);
 	buffer.write(p, mySize);
@@ -136,4 +161,108 @@ void ReadCombinedParallelFile(ug::BinaryBuffer &buffer, std::string strFilename,
 	//	UG_LOG("File read.\n");
 }
 
+///	reads the number of parts and their end offsets on the root and broadcasts them
+static int ReadCombinedParallelFileHeader(MPI_File fh, std::vector<long long>& allNextOffsets,
+                                          int root, MPI_Comm comm)
+{
+	MPI_Status status;
+	int numParts = 0;
+	if(root == pcl::ProcRank())
+		MPI_File_read(fh, &numParts, sizeof(numParts), MPI_BYTE, &status);
+	MPI_Bcast(&numParts, 1, MPI_INT, root, comm);
+	if(numParts < 1)
+		return numParts;
+
+	allNextOffsets.resize(numParts);
+	if(root == pcl::ProcRank())
+		MPI_File_read(fh, &allNextOffsets[0], numParts * sizeof(long long), MPI_BYTE, &status);
+	MPI_Bcast(&allNextOffsets[0], numParts, MPI_LONG_LONG, root, comm);
+	return numParts;
+}
+
+///	collectively reads the given part (or nothing, if part >= numParts) into buffer
+static void ReadCombinedParallelFilePartAt(MPI_File fh, ug::BinaryBuffer& buffer, int part,
+                                           const std::vector<long long>& allNextOffsets,
+                                           MPI_Comm comm)
+{
+	const int numParts = (int)allNextOffsets.size();
+	long long myOffset = 0, mySize = 0;
+	if(part < numParts){
+		myOffset = (part == 0) ? numParts*sizeof(long long) + sizeof(int)
+							   : allNextOffsets[part - 1];
+		mySize = allNextOffsets[part] - myOffset;
+	}
+
+	std::vector<char> data(mySize + 1);
+	CollectiveChunkedAccess(fh, myOffset, &data[0], mySize, false, comm);
+
+	buffer.clear();
+	buffer.reserve(mySize);
+	buffer.write(&data[0], mySize);
+}
+
+int ReadCombinedParallelFilePart(ug::BinaryBuffer &buffer, std::string strFilename, pcl::ProcessCommunicator pc)
+{
+	MPI_Comm m_mpiComm = pc.get_mpi_communicator();
+	MPI_File fh;
+
+	char filename[1024];
+	strcpy(filename, strFilename.c_str());
+	if(MPI_File_open(m_mpiComm, filename, MPI_MODE_RDONLY, MPI_INFO_NULL, &fh))
+		UG_THROW("could not open "<<filename);
+
+//	the root reads the header and broadcasts it, since the number of parts
+//	may differ from the number of reading processes
+	std::vector<long long> allNextOffsets;
+	int numParts = ReadCombinedParallelFileHeader(fh, allNextOffsets, pc.get_proc_id(0), m_mpiComm);
+
+	if(numParts < 1 || numParts > (int)pc.size()){
+		MPI_File_close(&fh);
+		UG_THROW("file " << strFilename << " contains " << numParts << " parts, "
+				 "but can only be read on at most " << pc.size() << " processes.");
+	}
+
+	ReadCombinedParallelFilePartAt(fh, buffer, pc.get_local_proc_id(), allNextOffsets, m_mpiComm);
+
+	MPI_File_close(&fh);
+	return numParts;
+}
+
+int ReadCombinedParallelFileParts(std::vector<ug::BinaryBuffer> &vBuffer, std::string strFilename, pcl::ProcessCommunicator pc)
+{
+	MPI_Comm m_mpiComm = pc.get_mpi_communicator();
+	MPI_File fh;
+
+	char filename[1024];
+	strcpy(filename, strFilename.c_str());
+	if(MPI_File_open(m_mpiComm, filename, MPI_MODE_RDONLY, MPI_INFO_NULL, &fh))
+		UG_THROW("could not open "<<filename);
+
+	std::vector<long long> allNextOffsets;
+	int numParts = ReadCombinedParallelFileHeader(fh, allNextOffsets, pc.get_proc_id(0), m_mpiComm);
+
+	if(numParts < 1){
+		MPI_File_close(&fh);
+		UG_THROW("file " << strFilename << " contains no parts.");
+	}
+
+//	the parts are read round-robin, all processes take part in each round
+	const int numProcs = (int)pc.size();
+	const int rank = pc.get_local_proc_id();
+	const int numRounds = (numParts + numProcs - 1) / numProcs;
+
+	vBuffer.clear();
+	vBuffer.reserve(numRounds);
+	for(int round = 0; round < numRounds; ++round){
+		const int part = round * numProcs + rank;
+		ug::BinaryBuffer buffer;
+		ReadCombinedParallelFilePartAt(fh, buffer, part, allNextOffsets, m_mpiComm);
+		if(part < numParts)
+			vBuffer.push_back(buffer);
+	}
+
+	MPI_File_close(&fh);
+	return numParts;
+}
+
 }
@@ -33,6 +33,7 @@
 #ifndef PARALLEL_FILE_H_
 #define PARALLEL_FILE_H_
 
+#include <vector>
 #include "pcl_process_communicator.h"
 #include "common/util/binary_buffer.h"
 
@@ -44,6 +45,8 @@ namespace pcl{
  *
  * NOTE: you have to use this function to do i/o from a lot of cores (1000+),
  * otherwise you will get big i/o problems.
+ * The data of all processes is written collectively and in chunks, so that
+ * parts larger than 2GB can be written as well.
  *
  * The file format is as follows:
  *
@@ -89,5 +92,35 @@ void WriteCombinedParallelFile(ug::BinaryBuffer &buffer, std::string strFilename
  */
 void ReadCombinedParallelFile(ug::BinaryBuffer &buffer, std::string strFilename, pcl::ProcessCommunicator pc = pcl::ProcessCommunicator(pcl::PCD_WORLD));
 
+
+/**
+ * This function reads a combined parallel file, which may have been written by
+ * less processes than participate in the read. The process with local index i
+ * in pc receives the data written by the i-th process, processes without
+ * associated data receive an empty buffer.
+ * The data is read collectively and in chunks, so that large parts can be
+ * read as well.
+ *
+ * @param buffer		a Binary buffer to read data to
+ * @param strFilename	the filename
+ * @param pc			a processes communicator (default pcl::World)
+ * @return				the number of processes which wrote the file
+ */
+int ReadCombinedParallelFilePart(ug::BinaryBuffer &buffer, std::string strFilename, pcl::ProcessCommunicator pc = pcl::ProcessCommunicator(pcl::PCD_WORLD));
+
+/**
+ * This function reads a combined parallel file, which may have been written by
+ * more or less processes than participate in the read. The parts are
+ * distributed round-robin, i.e. the process with local index i in pc receives
+ * the parts i, i + pc.size(), i + 2*pc.size(), ... in this order. Processes
+ * without associated data receive an empty vector.
+ *
+ * @param vBuffer		Binary buffers to read the parts to
+ * @param strFilename	the filename
+ * @param pc			a processes communicator (default pcl::World)
+ * @return				the number of processes which wrote the file
+ */
+int ReadCombinedParallelFileParts(std::vector<ug::BinaryBuffer> &vBuffer, std::string strFilename, pcl::ProcessCommunicator pc = pcl::ProcessCommunicator(pcl::PCD_WORLD));
+
 }
 #endif /* PARALLEL_ARCHIVE_H_ */
@@ -314,6 +314,25 @@ class ProcessCommunicator
 		void allreduce(const std::vector<T> &send, std::vector<T> &receive,
 					   pcl::ReduceOperation op) const;
 
+	///	starts a non-blocking MPI_Iallreduce on the processes of the communicator.
+	/**	The reduction is completed by pcl::MPI_Wait(&request). Until then, the
+	 * buffers must neither be changed nor read. If non-blocking collectives are
+	 * not supported by the MPI implementation (MPI < 3), a blocking allreduce is
+	 * performed and request is set to MPI_REQUEST_NULL.*/
+		void iallreduce(const void* sendBuf, void* recBuf, int count,
+						DataType type, ReduceOperation op,
+						MPI_Request& request) const;
+
+	/** simplified non-blocking allreduce for buffers.
+	 * \param pSendBuff the input buffer
+	 * \param pReceiveBuff the output buffer
+	 * \param count number of elements in the input/output buffers
+	 * \param op the Reduce Operation
+	 * \param request the request to wait for*/
+		template<typename T>
+		void iallreduce(const T *pSendBuff, T *pReceiveBuff, size_t count,
+						pcl::ReduceOperation op, MPI_Request& request) const;
+
 
 	/** performs a MPI_Bcast
 	 * @param v		pointer to data
@@ -217,6 +217,15 @@ allreduce(const T *pSendBuff, T *pReceiveBuff, size_t count, pcl::ReduceOperatio
 	allreduce(pSendBuff, pReceiveBuff, count, DataTypeTraits<T>::get_data_type(), op);
 }
 
+template<typename T>
+void ProcessCommunicator::
+iallreduce(const T *pSendBuff, T *pReceiveBuff, size_t count,
+		   pcl::ReduceOperation op, MPI_Request& request) const
+{
+	iallreduce(pSendBuff, pReceiveBuff, count, DataTypeTraits<T>::get_data_type(),
+			   op, request);
+}
+
 template<typename T>
 void ProcessCommunicator::
 allreduce(const std::vector<T> &send, std::vector<T> &receive,
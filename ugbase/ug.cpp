@@ -39,6 +39,7 @@
 #include "common/util/os_info.h"
 #include "common/profiler/profiler.h"
 #include "common/profiler/profile_node.h"
+#include "common/profiler/profile_counter.h"
 
 #include "common/profiler/memtracker.h"
 
@@ -213,6 +214,7 @@ int UGFinalizeNoPCLFinalize()
 #else
 			PROFILER_OUTPUT();
 #endif
+			UG_LOG(ProfileCounter::summary());
 		}
 
 #ifdef UG_PROFILER